@@ -1471,25 +1471,42 @@ namespace AZ
 // Lua Memory manager hook
 // [3/19/2012]
 //=========================================================================
+struct LuaMemoryHookData
+{
+    IAllocator* m_allocator = nullptr;
+    AZ::u64 m_allocatedBytes = 0; ///< Total bytes requested by the VM, used to measure the allocation rate
+    AZ::u64 m_freedBytes = 0;
+};
+
 static void* LuaMemoryHook(void* userData, void* ptr, size_t osize, size_t nsize)
 {
-    (void)osize;
-    IAllocator* allocator = reinterpret_cast<IAllocator*>(userData);
+    LuaMemoryHookData* data = reinterpret_cast<LuaMemoryHookData*>(userData);
     if (nsize == 0)
     {
         if (ptr)
         {
-            allocator->DeAllocate(ptr);
+            data->m_freedBytes += osize;
+            data->m_allocator->DeAllocate(ptr);
         }
         return nullptr;
     }
     else if (ptr == nullptr)
     {
-        return allocator->Allocate(nsize, LUA_DEFAULT_ALIGNMENT);
+        // osize holds the type of the new object, not a size
+        data->m_allocatedBytes += nsize;
+        return data->m_allocator->Allocate(nsize, LUA_DEFAULT_ALIGNMENT);
     }
     else
     {
-        return allocator->ReAllocate(ptr, nsize, LUA_DEFAULT_ALIGNMENT);
+        if (nsize > osize)
+        {
+            data->m_allocatedBytes += nsize - osize;
+        }
+        else
+        {
+            data->m_freedBytes += osize - nsize;
+        }
+        return data->m_allocator->ReAllocate(ptr, nsize, LUA_DEFAULT_ALIGNMENT);
     }
 }
 
@@ -3420,6 +3437,20 @@ LUA_API const Node* lua_getDummyNode()
         public:
             AZ_CLASS_ALLOCATOR(LuaScriptCaller, AZ::SystemAllocator);
 
+            // there's no limit inherently in BehaviorContext (as there is no document limit in C++), but the LY supported limits default to 40 for Lua, ScriptCanvas, and ScriptEvents.
+            // this limit of 40 is however implicit, for now.
+            static constexpr size_t MaxArguments = 40;
+
+            // Storage on the C++ stack for a number or boolean read from Lua, large enough for any type LuaScriptNumber handles.
+            struct alignas(8) LocalValue
+            {
+                AZ::u8 m_data[8];
+            };
+
+            // Reads a number or boolean from the Lua stack directly into the typed local of an argument. The readers are chosen once
+            // from the signature of the method when it is bound.
+            using LuaReadLocal = void(*)(lua_State* lua, int stackIndex, LocalValue& local, u32 traits);
+
             LuaScriptCaller(BehaviorContext* context, BehaviorMethod* method)
             {
                 (void)context;
@@ -3440,21 +3471,43 @@ LUA_API const Node* lua_getDummyNode()
                         , arg->m_name, method->m_name.c_str(), arg->m_name, arg->m_name, arg->m_name, method->m_name.c_str());
 
                     m_fromLua.push_back(AZStd::make_pair(fromStack, argClass));
+                    m_readLocal.push_back(FindReadLocal(arg));
                 }
 
                 if (method->HasResult())
                 {
                     m_resultToLua = ToLuaStack(context, method->GetResult(), &m_prepareResult, m_resultClass);
+                    m_isResultLocal = m_resultToLua && FindReadLocal(method->GetResult()) != nullptr;
                 }
                 else
                 {
                     m_resultToLua = nullptr;
                 }
+
+                // Pick the call thunk that only constructs as many BehaviorArguments as the method takes, most methods take a few only.
+                const size_t numArguments = m_method->GetNumArguments();
+                AZ_Assert(numArguments <= MaxArguments, "Method %s takes %zu arguments, Lua supports %zu at most!", m_method->m_name.c_str(), numArguments, MaxArguments);
+                if (numArguments <= 4)
+                {
+                    m_call = &LuaScriptCaller::Call<4>;
+                }
+                else if (numArguments <= 8)
+                {
+                    m_call = &LuaScriptCaller::Call<8>;
+                }
+                else if (numArguments <= 16)
+                {
+                    m_call = &LuaScriptCaller::Call<16>;
+                }
+                else
+                {
+                    m_call = &LuaScriptCaller::Call<MaxArguments>;
+                }
             }
 
             int ManualCall(lua_State* lua) override
             {
-                return Call(lua);
+                return m_call(lua);
             }
 
             void PushClosure(lua_State* lua, const char* debugDescription) override
@@ -3464,9 +3517,59 @@ LUA_API const Node* lua_getDummyNode()
                 lua_pushlightuserdata(lua, this); // if there is no reason to keep the data in the "methods" we can use full user data and rely on __gc to clean it
                 lua_pushstring(lua, debugDescription);
                 lua_pushcclosure(lua, &Internal::LuaMethodTagHelper, 0);
-                lua_pushcclosure(lua, &LuaScriptCaller::Call, 3);
+                lua_pushcclosure(lua, m_call, 3);
             }
 
+            template<class T>
+            static void ReadLocal(lua_State* lua, int stackIndex, LocalValue& local, u32 traits)
+            {
+                static_assert(sizeof(T) <= sizeof(LocalValue) && AZStd::is_trivially_destructible_v<T>, "Only numbers and booleans can be read into a LocalValue!");
+                T& value = *new (local.m_data) T(ScriptValue<T>::StackRead(lua, stackIndex));
+
+                // If the value is an index, subtract 1 (1 -> 0)
+                if (traits & BehaviorParameter::Traits::TR_INDEX)
+                {
+                    Internal::Incrementer<T>::Decrement(value);
+                }
+            }
+
+            // Numbers and booleans passed by value or reference are read without the temporary storage and function dispatch of LuaLoadFromStack.
+            static LuaReadLocal FindReadLocal(const BehaviorParameter* param)
+            {
+                if (param->m_traits & BehaviorParameter::TR_POINTER)
+                {
+                    return nullptr;
+                }
+
+                const Uuid& typeId = param->m_typeId;
+                if (typeId == AzTypeInfo<bool>::Uuid()) return &ReadLocal<bool>;
+                else if (typeId == AzTypeInfo<char>::Uuid()) return &ReadLocal<char>;
+                else if (typeId == AzTypeInfo<AZ::s8>::Uuid()) return &ReadLocal<AZ::s8>;
+                else if (typeId == AzTypeInfo<short>::Uuid()) return &ReadLocal<short>;
+                else if (typeId == AzTypeInfo<int>::Uuid()) return &ReadLocal<int>;
+                else if (typeId == AzTypeInfo<long>::Uuid()) return &ReadLocal<long>;
+                else if (typeId == AzTypeInfo<AZ::s64>::Uuid()) return &ReadLocal<AZ::s64>;
+                else if (typeId == AzTypeInfo<unsigned char>::Uuid()) return &ReadLocal<unsigned char>;
+                else if (typeId == AzTypeInfo<unsigned short>::Uuid()) return &ReadLocal<unsigned short>;
+                else if (typeId == AzTypeInfo<unsigned int>::Uuid()) return &ReadLocal<unsigned int>;
+                else if (typeId == AzTypeInfo<unsigned long>::Uuid()) return &ReadLocal<unsigned long>;
+                else if (typeId == AzTypeInfo<AZ::u64>::Uuid()) return &ReadLocal<AZ::u64>;
+                else if (typeId == AzTypeInfo<float>::Uuid()) return &ReadLocal<float>;
+                else if (typeId == AzTypeInfo<double>::Uuid()) return &ReadLocal<double>;
+                return nullptr;
+            }
+
+            // State the result callback refers to, so that the callback captures a single pointer and fits in the small buffer of
+            // AZStd::function, instead of allocating on every call.
+            struct ResultState
+            {
+                LuaScriptCaller* m_caller;
+                lua_State* m_lua;
+                BehaviorArgument* m_result;
+                int m_numResults;
+            };
+
+            template<size_t NumArgumentSlots>
             static int Call(lua_State* lua)
             {
                 LuaScriptCaller* thisPtr = reinterpret_cast<LuaScriptCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
@@ -3480,23 +3583,28 @@ LUA_API const Node* lua_getDummyNode()
                     return 0;
                 }
 
-                // there's no limit inherently in BehaviorContext (as there is no document limit in C++), but the LY supported limits default to 40 for Lua, ScriptCanvas, and ScriptEvents.
-                // this limit of 40 is however implicit, for now.
-                BehaviorArgument arguments[40];
+                BehaviorArgument arguments[NumArgumentSlots];
+                LocalValue locals[NumArgumentSlots];
                 BehaviorArgument result;
+                LocalValue resultLocal;
                 ScriptContext::StackVariableAllocator tempData;
                 AZStd::allocator backupAllocator;
                 bool usedBackupAlloc  = false;
 
                 int numArguments = GetMin(static_cast<int>(thisPtr->m_method->GetNumArguments()), numElementsOnStack);
-                AZ_Assert(static_cast<int>(AZ_ARRAY_SIZE(arguments)) >= numArguments, "Increase the argument array size!");
+                AZ_Assert(static_cast<int>(NumArgumentSlots) >= numArguments, "Increase the argument array size!");
 
                 // for each argument read a variable from the stack to a BehaviorArgument
                 for (int i = 0; i < numArguments; ++i)
                 {
                     const AZ::BehaviorParameter* parameter = thisPtr->m_method->GetArgument(i);
                     arguments[i].Set(*parameter); // store the type of result we expect (pointer, const, etc.)
-                    if (!thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], thisPtr->m_fromLua[i].second, &tempData))
+                    if (LuaReadLocal readLocal = thisPtr->m_readLocal[i])
+                    {
+                        readLocal(lua, i + 1, locals[i], parameter->m_traits);
+                        arguments[i].m_value = locals[i].m_data;
+                    }
+                    else if (!thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], thisPtr->m_fromLua[i].second, &tempData))
                     {
                         ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Lua failed to call method: cannot convert parameter %d from %s to %s",
                             i + 1, arguments[i].m_name, parameter->m_name);
@@ -3511,24 +3619,31 @@ LUA_API const Node* lua_getDummyNode()
                     ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Cannot pass nil as 'this' ptr to member function %s.", thisPtr->m_method->m_name.c_str());
                     return 0;
                 }
-                int numResults = 0;
+
+                ResultState resultState{ thisPtr, lua, &result, 0 };
 
                 if (thisPtr->m_resultToLua)
                 {
                     result.Set(*thisPtr->m_method->GetResult());
 
-                    if (thisPtr->m_prepareResult)
+                    if (thisPtr->m_isResultLocal)
+                    {
+                        // even references are stored by value, see AllocateTempStorageLuaNative
+                        memset(resultLocal.m_data, 0, sizeof(resultLocal.m_data));
+                        result.m_value = resultLocal.m_data;
+                    }
+                    else if (thisPtr->m_prepareResult)
                     {
                         usedBackupAlloc  = thisPtr->m_prepareResult(result, thisPtr->m_resultClass, tempData, &backupAllocator); // pass temp memory and class info
                     }
 
-                    // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
+                    // TODO: Make it optional for EBuses only.
+                    result.m_onAssignedResult = AZStd::function<void()>([&resultState]()
                     {
-                        if (result.m_value)
+                        if (resultState.m_result->m_value)
                         {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
+                            resultState.m_caller->m_resultToLua(resultState.m_lua, *resultState.m_result);
+                            ++resultState.m_numResults;
                         }
                     });
                 }
@@ -3545,10 +3660,10 @@ LUA_API const Node* lua_getDummyNode()
                     // push result back to lua
                     if (result.m_value)
                     {
-                        if (numResults == 0)
+                        if (resultState.m_numResults == 0)
                         {
                             lua_pushnil(lua);
-                            ++numResults;
+                            ++resultState.m_numResults;
                         }
 
                         // destroy any value parameters
@@ -3564,7 +3679,7 @@ LUA_API const Node* lua_getDummyNode()
                     else
                     {
                         lua_pushnil(lua); // we have result but no value (true for null pointers too
-                        ++numResults;
+                        ++resultState.m_numResults;
                     }
                 }
 
@@ -3586,13 +3701,16 @@ LUA_API const Node* lua_getDummyNode()
                     }
                 }
 
-                return numResults;
+                return resultState.m_numResults;
             }
 
             AZStd::vector<AZStd::pair<LuaLoadFromStack, BehaviorClass*>> m_fromLua;
+            AZStd::vector<LuaReadLocal> m_readLocal;
             LuaPushToStack m_resultToLua;
             LuaPrepareValue m_prepareResult;
             BehaviorClass* m_resultClass;
+            lua_CFunction m_call = nullptr;
+            bool m_isResultLocal = false;
 
             bool m_isResult;
         };
@@ -4334,7 +4452,8 @@ LUA_API const Node* lua_getDummyNode()
                     {
                         allocator = &m_luaAllocator;
                     }
-                    m_lua = lua_newstate(&LuaMemoryHook, allocator);
+                    m_memoryHookData.m_allocator = allocator;
+                    m_lua = lua_newstate(&LuaMemoryHook, &m_memoryHookData);
                     AZ_Assert(m_lua, "Failed to create new LUA state!");
                 }
 
@@ -5834,6 +5953,10 @@ LUA_API const Node* lua_getDummyNode()
             AZStd::vector< ScriptTypeFactory >  m_scriptPropertyArrayFactories;
             ScriptTypeFactory                   m_scriptPropertyTableFactory;
             Internal::LuaSystemAllocator m_luaAllocator;
+            LuaMemoryHookData m_memoryHookData;
+            AZ::u64 m_garbageCollectorSteps = 0;
+            AZ::u64 m_garbageCollectorCycles = 0;
+            bool m_isGenerationalGarbageCollection = false;
             AZStd::thread::id m_ownerThreadId; // Check if Lua methods (including EBus handlers) are called from background threads.
         };
 
@@ -5872,12 +5995,55 @@ LUA_API const Node* lua_getDummyNode()
     void ScriptContext::GarbageCollect()
     {
         lua_gc(m_impl->m_lua, LUA_GCCOLLECT, 0);
+        ++m_impl->m_garbageCollectorCycles;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::GarbageCollectStep(int numberOfSteps)
+    {
+        ++m_impl->m_garbageCollectorSteps;
+        if (lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps) != 0)
+        {
+            ++m_impl->m_garbageCollectorCycles;
+            return true;
+        }
+        return false;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::SetGenerationalGarbageCollection(bool enable)
+    {
+#if defined(LUA_GCGEN)
+        if (enable != m_impl->m_isGenerationalGarbageCollection)
+        {
+            // 0 keeps the current parameters of the mode
+            lua_gc(m_impl->m_lua, enable ? LUA_GCGEN : LUA_GCINC, 0, 0, 0);
+            m_impl->m_isGenerationalGarbageCollection = enable;
+        }
+        return true;
+#else
+        return !enable;
+#endif
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    bool ScriptContext::IsGenerationalGarbageCollection() const
+    {
+        return m_impl->m_isGenerationalGarbageCollection;
     }
 
     //////////////////////////////////////////////////////////////////////////
-    void ScriptContext::GarbageCollectStep(int numberOfSteps)
+    ScriptContext::GarbageCollectorStatistics ScriptContext::GetGarbageCollectorStatistics() const
     {
-        lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
+        GarbageCollectorStatistics statistics;
+        statistics.m_memoryUsage = GetMemoryUsage();
+        statistics.m_allocatedBytes = m_impl->m_memoryHookData.m_allocatedBytes;
+        statistics.m_freedBytes = m_impl->m_memoryHookData.m_freedBytes;
+        statistics.m_steps = m_impl->m_garbageCollectorSteps;
+        statistics.m_cycles = m_impl->m_garbageCollectorCycles;
+        statistics.m_isAllocationTracked = !m_impl->m_isCustomLuaVM;
+        statistics.m_isGenerational = m_impl->m_isGenerationalGarbageCollection;
+        return statistics;
     }
 
     //////////////////////////////////////////////////////////////////////////
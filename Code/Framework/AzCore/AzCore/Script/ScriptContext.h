@@ -865,8 +865,30 @@ namespace AZ
         /**
          *  Step the garbage collector. There is no exact number that works in all cases, tune this number for optimal
          * performance in your app.
+         * \returns true if the step finished a collection cycle.
          */
-        void GarbageCollectStep(int numberOfSteps = 2);
+        bool GarbageCollectStep(int numberOfSteps = 2);
+
+        /**
+         * Switch the garbage collector between the incremental (default) and the generational mode.
+         * \returns false if the generational mode was requested but is not supported by the Lua version.
+         */
+        bool SetGenerationalGarbageCollection(bool enable);
+        bool IsGenerationalGarbageCollection() const;
+
+        struct GarbageCollectorStatistics
+        {
+            size_t m_memoryUsage = 0; ///< Bytes currently used by the VM, same as GetMemoryUsage
+            AZ::u64 m_allocatedBytes = 0; ///< Total bytes allocated since the context was created
+            AZ::u64 m_freedBytes = 0; ///< Total bytes freed since the context was created
+            AZ::u64 m_steps = 0; ///< Number of GarbageCollectStep calls
+            AZ::u64 m_cycles = 0; ///< Number of collection cycles finished by GarbageCollectStep or GarbageCollect
+            bool m_isAllocationTracked = false; ///< False for contexts created on a custom lua_State, which don't go through our allocator
+            bool m_isGenerational = false;
+        };
+
+        /// Return the allocation and collection statistics of the context, cycles finished by Lua on its own are not counted.
+        GarbageCollectorStatistics GetGarbageCollectorStatistics() const;
 
         lua_State* NativeContext();
 
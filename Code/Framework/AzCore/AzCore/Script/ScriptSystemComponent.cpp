@@ -15,6 +15,8 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Debug/ProfilerReflection.h>
 #include <AzCore/Debug/TraceReflection.h>
 #include <AzCore/IO/FileIO.h>
@@ -47,6 +49,14 @@ namespace AZ
  *      If the script was loaded by a ScriptComponent, Load will be called once reload is complete.
  */
 
+AZ_CVAR(AZ::u32, script_gcBudgetMicroseconds, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Time in microseconds the Lua garbage collector may spend per frame over all script contexts, on top of the fixed number of steps of "
+    "each context. 0, the default, runs the fixed steps only.");
+AZ_CVAR(AZ::u32, script_gcStepSizeKB, 8, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Size in KB of the allocation each garbage collector step pays back, the granularity at which the budget is checked.");
+AZ_CVAR(bool, script_gcGenerational, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Use the generational Lua garbage collector, where supported. Its minor collections are run by Lua during allocation instead of the frame budget.");
+
 namespace LocalTU_ScriptSystemComponent {
     // Called when a module has already been loaded
     static int LuaRequireLoadedModule(lua_State* l)
@@ -302,6 +312,13 @@ ScriptContext*  ScriptSystemComponent::GetContext(ScriptContextId id)
 //=========================================================================
 void    ScriptSystemComponent::OnSystemTick()
 {
+    const AZStd::chrono::steady_clock::time_point now = AZStd::chrono::steady_clock::now();
+    const float deltaTime = m_lastSystemTickTime.time_since_epoch().count() == 0
+        ? 0.0f
+        : AZStd::chrono::duration<float>(now - m_lastSystemTickTime).count();
+    m_lastSystemTickTime = now;
+
+    AZ::s64 totalDebtKB = 0;
     for (size_t i = 0; i < m_contexts.size(); ++i)
     {
         ContextContainer& contextContainer = m_contexts[i];
@@ -310,7 +327,160 @@ void    ScriptSystemComponent::OnSystemTick()
             contextContainer.m_context->GetDebugContext()->ProcessDebugCommands();
         }
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        UpdateAllocationStatistics(contextContainer, deltaTime);
+        totalDebtKB += contextContainer.m_unpaidAllocationKB + aznumeric_cast<AZ::s64>(contextContainer.m_allocatedSinceLastTick / 1024);
+    }
+
+    // This is the end of the frame, the budget is split over the contexts by the memory they allocated and did not pay back yet.
+    AZ_PROFILE_SCOPE(AzCore, "ScriptSystemComponent::OnSystemTick:CollectGarbage");
+    const double budget = aznumeric_cast<double>(static_cast<AZ::u32>(script_gcBudgetMicroseconds));
+    for (size_t i = 0; i < m_contexts.size(); ++i)
+    {
+        ContextContainer& contextContainer = m_contexts[i];
+        const AZ::s64 debtKB = contextContainer.m_unpaidAllocationKB + aznumeric_cast<AZ::s64>(contextContainer.m_allocatedSinceLastTick / 1024);
+        const double share = totalDebtKB > 0 ? aznumeric_cast<double>(debtKB) / aznumeric_cast<double>(totalDebtKB) : 0.0;
+        CollectGarbage(contextContainer, AZStd::chrono::microseconds(aznumeric_cast<AZ::s64>(budget * share)));
+
+        AZ_PROFILE_DATAPOINT(AzCore, contextContainer.m_lastMemoryUsage / 1024, contextContainer.m_memoryUsageCounterName.c_str());
+        AZ_PROFILE_DATAPOINT(AzCore, contextContainer.m_allocationRate / 1024.0f, contextContainer.m_allocationRateCounterName.c_str());
+        AZ_PROFILE_DATAPOINT(AzCore, contextContainer.m_lastCollectTime.count(), contextContainer.m_collectTimeCounterName.c_str());
+    }
+}
+
+//=========================================================================
+// UpdateAllocationStatistics
+//=========================================================================
+void ScriptSystemComponent::UpdateAllocationStatistics(ContextContainer& container, float deltaTime)
+{
+    if (container.m_memoryUsageCounterName.empty())
+    {
+        const AZ::u32 id = container.m_context->GetId();
+        container.m_memoryUsageCounterName = AZStd::wstring::format(L"Script/%u/Memory usage (KB)", id);
+        container.m_allocationRateCounterName = AZStd::wstring::format(L"Script/%u/Allocation rate (KB per second)", id);
+        container.m_collectTimeCounterName = AZStd::wstring::format(L"Script/%u/Garbage collection time (us)", id);
+    }
+
+    const ScriptContext::GarbageCollectorStatistics statistics = container.m_context->GetGarbageCollectorStatistics();
+    if (statistics.m_isAllocationTracked)
+    {
+        container.m_allocatedSinceLastTick = statistics.m_allocatedBytes - container.m_lastAllocatedBytes;
+        container.m_lastAllocatedBytes = statistics.m_allocatedBytes;
+    }
+    else
+    {
+        // Custom Lua VMs don't go through our allocator, use the growth of the memory usage instead.
+        container.m_allocatedSinceLastTick =
+            statistics.m_memoryUsage > container.m_lastMemoryUsage ? statistics.m_memoryUsage - container.m_lastMemoryUsage : 0;
+    }
+    container.m_lastMemoryUsage = statistics.m_memoryUsage;
+
+    if (deltaTime > 0.0f)
+    {
+        const float rate = aznumeric_cast<float>(container.m_allocatedSinceLastTick) / deltaTime;
+        container.m_allocationRate += (rate - container.m_allocationRate) * 0.1f;
+    }
+}
+
+//=========================================================================
+// CollectGarbage
+//=========================================================================
+void ScriptSystemComponent::CollectGarbage(ContextContainer& container, AZStd::chrono::microseconds budget)
+{
+    ScriptContext* context = container.m_context;
+    if (!context->SetGenerationalGarbageCollection(script_gcGenerational))
+    {
+        AZ_Warning("Script", false, "Generational garbage collection is not supported by this version of Lua.");
+        script_gcGenerational = false;
+    }
+
+    container.m_lastCollectTime = AZStd::chrono::microseconds(0);
+    if (context->IsGenerationalGarbageCollection())
+    {
+        container.m_unpaidAllocationKB = 0;
+        return;
+    }
+
+    const AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
+
+    // The fixed steps run as they always did, the budget only adds to them.
+    if (context->GarbageCollectStep(container.m_garbageCollectorSteps))
+    {
+        container.m_unpaidAllocationKB = 0;
+    }
+    else if (static_cast<AZ::u32>(script_gcBudgetMicroseconds) == 0)
+    {
+        container.m_unpaidAllocationKB = 0;
+    }
+    else
+    {
+        // Lua converts the KB passed to a step into work with its step multiplier, so paying back the allocation keeps the collector
+        // ahead of it. The debt can not exceed the memory in use, which bounds it when the scripts allocate more than the budget collects.
+        const AZ::s64 debtKB = AZStd::min(
+            container.m_unpaidAllocationKB + aznumeric_cast<AZ::s64>(container.m_allocatedSinceLastTick / 1024) - container.m_garbageCollectorSteps,
+            aznumeric_cast<AZ::s64>(container.m_lastMemoryUsage / 1024));
+        const AZ::s64 stepSizeKB = AZStd::max<AZ::s64>(static_cast<AZ::u32>(script_gcStepSizeKB), 1);
+        if (debtKB <= 0)
+        {
+            container.m_unpaidAllocationKB = 0;
+        }
+        else if (budget.count() > 0)
+        {
+            container.m_unpaidAllocationKB = CollectGarbageWithinBudget(*context, debtKB, stepSizeKB, budget);
+        }
+        else
+        {
+            // the share of the budget of this context rounded down to nothing, it collects on a later tick
+            container.m_unpaidAllocationKB = debtKB;
+        }
+    }
+
+    container.m_lastCollectTime = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - start);
+    container.m_maxCollectTime = AZStd::max(container.m_maxCollectTime, container.m_lastCollectTime);
+}
+
+//=========================================================================
+// CollectGarbageWithinBudget
+//=========================================================================
+AZ::s64 ScriptSystemComponent::CollectGarbageWithinBudget(ScriptContext& context, AZ::s64 debtKB, AZ::s64 stepSizeKB, AZStd::chrono::microseconds budget)
+{
+    if (debtKB <= 0)
+    {
+        return 0;
+    }
+
+    const AZStd::chrono::steady_clock::time_point start = AZStd::chrono::steady_clock::now();
+    stepSizeKB = AZStd::max<AZ::s64>(stepSizeKB, 1);
+    do
+    {
+        const AZ::s64 stepKB = AZStd::min(debtKB, stepSizeKB);
+        if (context.GarbageCollectStep(aznumeric_cast<int>(stepKB)))
+        {
+            // the cycle collected everything the debt was allocated for
+            return 0;
+        }
+        debtKB -= stepKB;
+    }
+    while (debtKB > 0 && AZStd::chrono::steady_clock::now() - start < budget);
+
+    return debtKB;
+}
+
+//=========================================================================
+// DumpGarbageCollectorStats
+//=========================================================================
+void ScriptSystemComponent::DumpGarbageCollectorStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+{
+    for (const ContextContainer& container : m_contexts)
+    {
+        const ScriptContext::GarbageCollectorStatistics statistics = container.m_context->GetGarbageCollectorStatistics();
+        AZLOG_INFO("ScriptContext %u: mode = %s, memory usage = %zu KB, allocated = %llu KB, freed = %llu KB, allocation rate = %.1f KB/s",
+            container.m_context->GetId(), statistics.m_isGenerational ? "generational" : "incremental", statistics.m_memoryUsage / 1024,
+            static_cast<unsigned long long>(statistics.m_allocatedBytes / 1024), static_cast<unsigned long long>(statistics.m_freedBytes / 1024),
+            container.m_allocationRate / 1024.0f);
+        AZLOG_INFO("ScriptContext %u: steps = %llu, cycles = %llu, last collect time = %lld us, max collect time = %lld us, unpaid = %lld KB",
+            container.m_context->GetId(), static_cast<unsigned long long>(statistics.m_steps), static_cast<unsigned long long>(statistics.m_cycles),
+            static_cast<long long>(container.m_lastCollectTime.count()), static_cast<long long>(container.m_maxCollectTime.count()),
+            static_cast<long long>(container.m_unpaidAllocationKB));
     }
 }
 
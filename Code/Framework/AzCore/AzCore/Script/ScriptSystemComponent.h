@@ -9,6 +9,7 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/Asset/AssetManager.h>
@@ -38,6 +39,11 @@ namespace AZ
         ScriptSystemComponent();
         ~ScriptSystemComponent() override;
 
+        /// Steps the incremental garbage collector of the context in steps of stepSizeKB, to pay back debtKB of allocation, until the
+        /// debt is paid, a collection cycle finishes or the budget is spent. The first step always runs, so every call makes progress.
+        /// \returns the KB left to pay back on the next call, 0 when the debt was paid or the cycle finished.
+        static AZ::s64 CollectGarbageWithinBudget(ScriptContext& context, AZ::s64 debtKB, AZ::s64 stepSizeKB, AZStd::chrono::microseconds budget);
+
     protected:
         //////////////////////////////////////////////////////////////////////////
         // Component base
@@ -134,6 +140,18 @@ namespace AZ
             AZStd::unordered_map<Uuid, Data::Asset<ScriptAsset>> m_trackedScripts;
             AZStd::recursive_mutex m_loadedScriptsMutex;
 
+            // Garbage collector scheduling state, see CollectGarbage()
+            AZ::u64 m_lastAllocatedBytes = 0;
+            size_t m_lastMemoryUsage = 0;
+            AZ::u64 m_allocatedSinceLastTick = 0;
+            AZ::s64 m_unpaidAllocationKB = 0; ///< Allocation the budget of the previous ticks did not pay back
+            float m_allocationRate = 0.0f; ///< Bytes per second, smoothed over the last frames
+            AZStd::chrono::microseconds m_lastCollectTime{ 0 };
+            AZStd::chrono::microseconds m_maxCollectTime{ 0 };
+            AZStd::wstring m_memoryUsageCounterName;
+            AZStd::wstring m_allocationRateCounterName;
+            AZStd::wstring m_collectTimeCounterName;
+
             ContextContainer() = default;
             ContextContainer(const ContextContainer&) = delete;
             ContextContainer(ContextContainer&& rhs)
@@ -147,6 +165,16 @@ namespace AZ
                 m_context = rhs.m_context;
                 m_isOwner = rhs.m_isOwner;
                 m_garbageCollectorSteps = rhs.m_garbageCollectorSteps;
+                m_lastAllocatedBytes = rhs.m_lastAllocatedBytes;
+                m_lastMemoryUsage = rhs.m_lastMemoryUsage;
+                m_allocatedSinceLastTick = rhs.m_allocatedSinceLastTick;
+                m_unpaidAllocationKB = rhs.m_unpaidAllocationKB;
+                m_allocationRate = rhs.m_allocationRate;
+                m_lastCollectTime = rhs.m_lastCollectTime;
+                m_maxCollectTime = rhs.m_maxCollectTime;
+                m_memoryUsageCounterName.swap(rhs.m_memoryUsageCounterName);
+                m_allocationRateCounterName.swap(rhs.m_allocationRateCounterName);
+                m_collectTimeCounterName.swap(rhs.m_collectTimeCounterName);
 
                 {
                     AZStd::lock_guard<AZStd::recursive_mutex> myLock(m_loadedScriptsMutex);
@@ -160,6 +188,17 @@ namespace AZ
 
         ContextContainer*       GetContextContainer(ScriptContextId id);
 
+        /// Measures the allocation of the context since the last tick.
+        void UpdateAllocationStatistics(ContextContainer& container, float deltaTime);
+
+        /// Runs m_garbageCollectorSteps on the context, then, with a non zero budget, pays back the memory it allocated since the last
+        /// tick, and what previous ticks left unpaid, within the budget. What is left is carried over to the next tick.
+        void CollectGarbage(ContextContainer& container, AZStd::chrono::microseconds budget);
+
+        void DumpGarbageCollectorStats(const AZ::ConsoleCommandContainer& arguments);
+        AZ_CONSOLEFUNC(ScriptSystemComponent, DumpGarbageCollectorStats, AZ::ConsoleFunctorFlags::Null,
+            "Dump the Lua memory and garbage collector stats of all script contexts to the console window");
+
         /// Default require hook installed on new contexts, looks for a compiled asset in the asset system corresponding to the module path and name.
         /// If found, loads the module if not done previously, leaves it on the stack, otherwise pushes string error.
         /// Additionally connects to the script id to reload the script if the script changes
@@ -173,5 +212,6 @@ namespace AZ
         InMemoryScriptModules m_inMemoryModules;
 
         AZStd::vector<ContextContainer> m_contexts;
+        AZStd::chrono::steady_clock::time_point m_lastSystemTickTime;
     };
 }
@@ -4192,6 +4192,82 @@ ramenShop.handler:Connect(4);
         m_script->Execute("AZTestAssert(ScriptClass == nil)");
     }
 
+    TEST_F(BaseScriptTest, LuaGarbageCollectorStatistics_TrackAllocationAndCollection)
+    {
+        const ScriptContext::GarbageCollectorStatistics before = m_script->GetGarbageCollectorStatistics();
+        EXPECT_TRUE(before.m_isAllocationTracked);
+        EXPECT_FALSE(before.m_isGenerational);
+
+        m_script->Execute("local t = {} for i = 1, 1000 do t[i] = { i } end");
+        const ScriptContext::GarbageCollectorStatistics afterAllocation = m_script->GetGarbageCollectorStatistics();
+        EXPECT_GT(afterAllocation.m_allocatedBytes, before.m_allocatedBytes + 1000 * sizeof(double));
+        EXPECT_EQ(afterAllocation.m_memoryUsage, m_script->GetMemoryUsage());
+
+        m_script->GarbageCollect();
+        const ScriptContext::GarbageCollectorStatistics afterCollection = m_script->GetGarbageCollectorStatistics();
+        EXPECT_EQ(afterCollection.m_cycles, afterAllocation.m_cycles + 1);
+        EXPECT_GT(afterCollection.m_freedBytes, afterAllocation.m_freedBytes);
+        EXPECT_LT(afterCollection.m_memoryUsage, afterAllocation.m_memoryUsage);
+
+        // Steps large enough to pay back all allocations finish the cycle.
+        bool isCycleFinished = false;
+        for (int i = 0; i < 100 && !isCycleFinished; ++i)
+        {
+            isCycleFinished = m_script->GarbageCollectStep(1024);
+        }
+        EXPECT_TRUE(isCycleFinished);
+        EXPECT_GT(m_script->GetGarbageCollectorStatistics().m_steps, afterCollection.m_steps);
+    }
+
+    TEST_F(BaseScriptTest, LuaGarbageCollector_GenerationalMode)
+    {
+        EXPECT_TRUE(m_script->SetGenerationalGarbageCollection(true));
+        EXPECT_TRUE(m_script->IsGenerationalGarbageCollection());
+        m_script->Execute("local t = {} for i = 1, 1000 do t[i] = { i } end");
+        m_script->GarbageCollect();
+
+        EXPECT_TRUE(m_script->SetGenerationalGarbageCollection(false));
+        EXPECT_FALSE(m_script->GetGarbageCollectorStatistics().m_isGenerational);
+    }
+
+    TEST_F(BaseScriptTest, LuaGarbageCollector_BudgetStopsStepsAndResumesOnNextFrame)
+    {
+        // Everything stays alive, so a collection cycle has to mark all of it. The full collection leaves the collector paused, the next
+        // step starts a new cycle.
+        m_script->Execute("g_live = {} for i = 1, 100000 do g_live[i] = { i, i * 2 } end");
+        m_script->GarbageCollect();
+        const AZ::s64 debtKB = aznumeric_cast<AZ::s64>(m_script->GetMemoryUsage() / 1024);
+        ASSERT_GT(debtKB, 1024);
+
+        // A budget far too small for the debt stops after a few steps, and returns what is left.
+        const ScriptContext::GarbageCollectorStatistics before = m_script->GetGarbageCollectorStatistics();
+        const AZ::s64 firstFrameUnpaidKB = ScriptSystemComponent::CollectGarbageWithinBudget(*m_script, debtKB, 1, AZStd::chrono::microseconds(1));
+        const ScriptContext::GarbageCollectorStatistics afterFirstFrame = m_script->GetGarbageCollectorStatistics();
+        const AZ::s64 firstFrameSteps = aznumeric_cast<AZ::s64>(afterFirstFrame.m_steps - before.m_steps);
+        EXPECT_GE(firstFrameSteps, 1);
+        EXPECT_LT(firstFrameSteps, debtKB / 2);
+        EXPECT_EQ(afterFirstFrame.m_cycles, before.m_cycles);
+        EXPECT_EQ(firstFrameUnpaidKB, debtKB - firstFrameSteps);
+
+        // The next frame picks up the debt where the previous one stopped.
+        const AZ::s64 secondFrameUnpaidKB = ScriptSystemComponent::CollectGarbageWithinBudget(*m_script, firstFrameUnpaidKB, 1, AZStd::chrono::microseconds(1));
+        const ScriptContext::GarbageCollectorStatistics afterSecondFrame = m_script->GetGarbageCollectorStatistics();
+        const AZ::s64 secondFrameSteps = aznumeric_cast<AZ::s64>(afterSecondFrame.m_steps - afterFirstFrame.m_steps);
+        EXPECT_GE(secondFrameSteps, 1);
+        EXPECT_EQ(afterSecondFrame.m_cycles, before.m_cycles);
+        EXPECT_EQ(secondFrameUnpaidKB, firstFrameUnpaidKB - secondFrameSteps);
+
+        // A budget large enough pays the rest back, or finishes the cycle, and leaves nothing for the frame after.
+        EXPECT_EQ(0, ScriptSystemComponent::CollectGarbageWithinBudget(*m_script, secondFrameUnpaidKB, 1, AZStd::chrono::seconds(10)));
+
+        // Without a debt there is nothing to step.
+        const AZ::u64 steps = m_script->GetGarbageCollectorStatistics().m_steps;
+        EXPECT_EQ(0, ScriptSystemComponent::CollectGarbageWithinBudget(*m_script, 0, 1, AZStd::chrono::seconds(10)));
+        EXPECT_EQ(steps, m_script->GetGarbageCollectorStatistics().m_steps);
+
+        m_script->Execute("g_live = nil");
+    }
+
     class MathScriptTest
         : public BaseScriptTest
     {
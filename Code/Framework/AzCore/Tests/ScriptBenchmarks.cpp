@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/lua/lua.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    class LuaCallBenchmarkRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        virtual float GetScaled(float value) = 0;
+        virtual void SetValue(float value) = 0;
+    };
+    using LuaCallBenchmarkRequestBus = AZ::EBus<LuaCallBenchmarkRequests>;
+
+    class LuaCallBenchmarkHandler
+        : public LuaCallBenchmarkRequestBus::Handler
+    {
+    public:
+        LuaCallBenchmarkHandler() { LuaCallBenchmarkRequestBus::Handler::BusConnect(); }
+        ~LuaCallBenchmarkHandler() override { LuaCallBenchmarkRequestBus::Handler::BusDisconnect(); }
+        float GetScaled(float value) override { return value * 0.5f; }
+        void SetValue(float value) override { m_value = value; }
+
+        float m_value = 0.0f;
+    };
+
+    // Measures the overhead of calls from Lua to reflected C++, each iteration runs a Lua loop of NumCalls calls.
+    class LuaCallBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr int NumCalls = 1000;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void RunLuaFunction(::benchmark::State& state, const char* functionName)
+        {
+            lua_State* lua = m_script->NativeContext();
+            for ([[maybe_unused]] auto _ : state)
+            {
+                lua_getglobal(lua, functionName);
+                lua_pushinteger(lua, NumCalls);
+                if (lua_pcall(lua, 1, 0, 0) != 0)
+                {
+                    state.SkipWithError(lua_tostring(lua, -1));
+                    lua_pop(lua, 1);
+                    break;
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * NumCalls);
+        }
+
+    private:
+        void internalSetUp()
+        {
+            m_behaviorContext = aznew AZ::BehaviorContext();
+            AZ::MathReflect(m_behaviorContext);
+            m_behaviorContext->EBus<LuaCallBenchmarkRequestBus>("LuaCallBenchmarkRequestBus")
+                ->Event("GetScaled", &LuaCallBenchmarkRequests::GetScaled)
+                ->Event("SetValue", &LuaCallBenchmarkRequests::SetValue);
+
+            m_handler = aznew LuaCallBenchmarkHandler();
+
+            m_script = aznew AZ::ScriptContext();
+            m_script->BindTo(m_behaviorContext);
+            m_script->Execute(
+                "function CallLuaFunction(n) local f = function(x) return x end local x = 0.5 for i = 1, n do x = f(x) end return x end\n"
+                "function CallMathClamp(n) local clamp = Math.Clamp local x = 0.5 for i = 1, n do x = clamp(x, 0.0, 1.0) end return x end\n"
+                "function CallVector3Dot(n) local a = Vector3(1, 2, 3) local b = Vector3(4, 5, 6) local x = 0 for i = 1, n do x = a:Dot(b) end return x end\n"
+                "function CallVector3Construct(n) local v for i = 1, n do v = Vector3(i, 2, 3) end return v end\n"
+                "function CallEBusResult(n) local bus = LuaCallBenchmarkRequestBus.Broadcast local x = 1.0 for i = 1, n do x = bus.GetScaled(x) end return x end\n"
+                "function CallEBusNoResult(n) local bus = LuaCallBenchmarkRequestBus.Broadcast for i = 1, n do bus.SetValue(i) end end\n");
+        }
+
+        void internalTearDown()
+        {
+            delete m_script;
+            m_script = nullptr;
+            delete m_handler;
+            m_handler = nullptr;
+            delete m_behaviorContext;
+            m_behaviorContext = nullptr;
+        }
+
+        AZ::BehaviorContext* m_behaviorContext = nullptr;
+        AZ::ScriptContext* m_script = nullptr;
+        LuaCallBenchmarkHandler* m_handler = nullptr;
+    };
+
+    // Baseline, a call to a Lua function that does not leave the virtual machine.
+    BENCHMARK_DEFINE_F(LuaCallBenchmarkFixture, LuaFunction)(::benchmark::State& state)
+    {
+        RunLuaFunction(state, "CallLuaFunction");
+    }
+    BENCHMARK_REGISTER_F(LuaCallBenchmarkFixture, LuaFunction);
+
+    // Free function with number arguments and result.
+    BENCHMARK_DEFINE_F(LuaCallBenchmarkFixture, MathClamp)(::benchmark::State& state)
+    {
+        RunLuaFunction(state, "CallMathClamp");
+    }
+    BENCHMARK_REGISTER_F(LuaCallBenchmarkFixture, MathClamp);
+
+    // Member function with a reflected class argument and a number result.
+    BENCHMARK_DEFINE_F(LuaCallBenchmarkFixture, Vector3Dot)(::benchmark::State& state)
+    {
+        RunLuaFunction(state, "CallVector3Dot");
+    }
+    BENCHMARK_REGISTER_F(LuaCallBenchmarkFixture, Vector3Dot);
+
+    // Constructor with number arguments, which returns a new object to Lua.
+    BENCHMARK_DEFINE_F(LuaCallBenchmarkFixture, Vector3Construct)(::benchmark::State& state)
+    {
+        RunLuaFunction(state, "CallVector3Construct");
+    }
+    BENCHMARK_REGISTER_F(LuaCallBenchmarkFixture, Vector3Construct);
+
+    BENCHMARK_DEFINE_F(LuaCallBenchmarkFixture, EBusBroadcastResult)(::benchmark::State& state)
+    {
+        RunLuaFunction(state, "CallEBusResult");
+    }
+    BENCHMARK_REGISTER_F(LuaCallBenchmarkFixture, EBusBroadcastResult);
+
+    BENCHMARK_DEFINE_F(LuaCallBenchmarkFixture, EBusBroadcastNoResult)(::benchmark::State& state)
+    {
+        RunLuaFunction(state, "CallEBusNoResult");
+    }
+    BENCHMARK_REGISTER_F(LuaCallBenchmarkFixture, EBusBroadcastNoResult);
+}
+#endif // HAVE_BENCHMARK
@@ -182,6 +182,7 @@ set(FILES
     RTTI/TypeSafeIntegralTests.cpp
     Rtti.cpp
     Script.cpp
+    ScriptBenchmarks.cpp
     ScriptMath.cpp
     Serialization/Json/ArraySerializerTests.cpp
     Serialization/Json/AnySerializerTests.cpp
@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -152,6 +153,12 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        m_hierarchySystem = AZ::Interface<ITransformHierarchySystem>::Get();
+        if (m_hierarchySystem)
+        {
+            m_hierarchySystem->AddTransform(this);
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
@@ -165,6 +172,12 @@ namespace AzFramework
             parentTransform->NotifyChildChangedEvent(AZ::ChildChangeType::Removed, GetEntityId());
         }
 
+        if (m_hierarchySystem)
+        {
+            m_hierarchySystem->RemoveTransform(this);
+            m_hierarchySystem = nullptr;
+        }
+
         m_notificationBus = nullptr;
         if (m_parentId.IsValid())
         {
@@ -474,6 +487,10 @@ namespace AzFramework
     void TransformComponent::SetOnParentChangedBehavior(AZ::OnParentChangedBehavior onParentChangedBehavior)
     {
         m_onParentChangedBehavior = onParentChangedBehavior;
+        if (m_hierarchySystem)
+        {
+            m_hierarchySystem->OnParentChangedBehaviorChanged(GetEntityId(), onParentChangedBehavior);
+        }
     }
 
     void TransformComponent::OnTransformChanged(const AZ::Transform& parentLocalTM, const AZ::Transform& parentWorldTM)
@@ -514,6 +531,12 @@ namespace AzFramework
             parentId = handler->GetParentId();
         }
 #endif
+        // Parents that are tracked by the transform hierarchy system don't need to notify us directly.
+        if (IsParentInTransformHierarchy())
+        {
+            AZ::TransformNotificationBus::Handler::BusDisconnect();
+        }
+
         AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get();
         AZ::Entity* parentEntity = (componentApplication != nullptr) ? componentApplication->FindEntity(parentEntityId) : nullptr;
         AZ_Assert(parentEntity, "We expect to have a parent entity associated with the provided parent's entity Id.");
@@ -562,6 +585,11 @@ namespace AzFramework
         }
 
         m_parentId = parentId;
+        if (m_hierarchySystem)
+        {
+            m_hierarchySystem->OnTransformParentChanged(GetEntityId(), m_parentId);
+        }
+
         if (m_parentId.IsValid())
         {
             AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get();
@@ -570,7 +598,10 @@ namespace AzFramework
 
             m_onNewParentKeepWorldTM = isKeepWorldTM;
 
-            AZ::TransformNotificationBus::Handler::BusConnect(m_parentId);
+            if (!IsParentInTransformHierarchy())
+            {
+                AZ::TransformNotificationBus::Handler::BusConnect(m_parentId);
+            }
             AZ::TransformHierarchyInformationBus::Handler::BusConnect(m_parentId);
             AZ::EntityBus::Handler::BusConnect(m_parentId);
         }
@@ -667,6 +698,11 @@ namespace AzFramework
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
 
+        if (m_hierarchySystem)
+        {
+            m_hierarchySystem->OnTransformChanged(GetEntityId(), m_localTM, m_worldTM);
+        }
+
         AzFramework::IEntityBoundsUnion* boundsUnion = AZ::Interface<AzFramework::IEntityBoundsUnion>::Get();
         if (boundsUnion != nullptr)
         {
@@ -688,6 +724,39 @@ namespace AzFramework
         AZ::TransformNotificationBus::Event(
             m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+
+        if (m_hierarchySystem)
+        {
+            m_hierarchySystem->OnTransformChanged(GetEntityId(), m_localTM, m_worldTM);
+        }
+    }
+
+    void TransformComponent::OnHierarchyTransformsUpdated(const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        m_localTM = localTM;
+        m_worldTM = worldTM;
+
+        // Match OnTransformChangedImpl: with DoNotUpdate only the local transform changes, so there's nothing to notify.
+        if (m_onParentChangedBehavior == AZ::OnParentChangedBehavior::Update)
+        {
+            AZ::TransformNotificationBus::Event(
+                m_notificationBus, &AZ::TransformNotificationBus::Events::OnTransformChanged, m_localTM, m_worldTM);
+            m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+        }
+    }
+
+    void TransformComponent::DetachFromTransformHierarchySystem()
+    {
+        m_hierarchySystem = nullptr;
+        if (m_parentId.IsValid() && !AZ::TransformNotificationBus::Handler::BusIsConnected())
+        {
+            AZ::TransformNotificationBus::Handler::BusConnect(m_parentId);
+        }
+    }
+
+    bool TransformComponent::IsParentInTransformHierarchy() const
+    {
+        return m_hierarchySystem && m_hierarchySystem->IsTransformTracked(m_parentId);
     }
 
     bool TransformComponent::AreMoveRequestsAllowed() const
@@ -25,6 +25,7 @@ namespace AzToolsFramework
 namespace AzFramework
 {
     class GameEntityContextComponent;
+    class ITransformHierarchySystem;
 
     /// @deprecated Use AZ::TransformConfig
     using TransformComponentConfiguration = AZ::TransformConfig;
@@ -41,6 +42,7 @@ namespace AzFramework
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class TransformHierarchySystem;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -162,6 +164,16 @@ namespace AzFramework
         void ComputeWorldTM();
         //////////////////////////////////////////////////////////////////////////
 
+        //! Batched transform hierarchy support.
+        //! @{
+        //! Called by the transform hierarchy system once per tick when a parent change affected this transform.
+        void OnHierarchyTransformsUpdated(const AZ::Transform& localTM, const AZ::Transform& worldTM);
+        //! Called when the transform hierarchy system shuts down, to go back to listening to the parent's notifications.
+        void DetachFromTransformHierarchySystem();
+        //! Returns true if parent changes are delivered by the transform hierarchy system instead of TransformNotificationBus.
+        bool IsParentInTransformHierarchy() const;
+        //! @}
+
         //! Returns whether external calls are currently allowed to move the transform.
         bool AreMoveRequestsAllowed() const;
 
@@ -184,6 +196,7 @@ namespace AzFramework
         AZ::EntityId m_parentId; ///< If valid, this transform is parented to m_parentId.
         AZ::TransformInterface* m_parentTM = nullptr; ///< Cached - pointer to parent transform, to avoid extra calls. Valid only when if it's present.
         AZ::TransformNotificationBus::BusPtr m_notificationBus; ///< Cached bus pointer to the notification bus.
+        ITransformHierarchySystem* m_hierarchySystem = nullptr; ///< If set, parent changes are propagated by this system while active.
         ParentActivationTransformMode m_parentActivationTransformMode = ParentActivationTransformMode::MaintainOriginalRelativeTransform;
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchy.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/functional.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    void TransformHierarchy::AddEntity(
+        AZ::EntityId entityId,
+        AZ::EntityId parentId,
+        const AZ::Transform& localTM,
+        const AZ::Transform& worldTM,
+        AZ::OnParentChangedBehavior onParentChangedBehavior)
+    {
+        if (Contains(entityId))
+        {
+            AZ_Assert(false, "Entity %s is already in the transform hierarchy.", entityId.ToString().c_str());
+            return;
+        }
+
+        const AZ::u32 entityIndex = aznumeric_cast<AZ::u32>(m_entityIds.size());
+        m_entityIds.push_back(entityId);
+        m_parentIds.push_back(parentId);
+        m_parentIndices.push_back(InvalidIndex);
+        m_depths.push_back(0);
+        m_localTMs.push_back(localTM);
+        m_worldTMs.push_back(worldTM);
+        m_flags.push_back(onParentChangedBehavior == AZ::OnParentChangedBehavior::DoNotUpdate ? Flag_KeepWorldTM : 0);
+        m_entityIndices[entityId] = entityIndex;
+        m_layoutDirty = true;
+
+        // Any children that were added before this entity need to pick up its world transform.
+        MarkDirty(entityIndex, Flag_TransformsSet);
+    }
+
+    void TransformHierarchy::RemoveEntity(AZ::EntityId entityId)
+    {
+        auto entityItr = m_entityIndices.find(entityId);
+        if (entityItr == m_entityIndices.end())
+        {
+            return;
+        }
+
+        // Swap the last entity into the removed slot. The layout gets rebuilt before the next update anyway.
+        const AZ::u32 entityIndex = entityItr->second;
+        const AZ::u32 lastIndex = aznumeric_cast<AZ::u32>(m_entityIds.size() - 1);
+        m_entityIndices.erase(entityItr);
+        if (entityIndex != lastIndex)
+        {
+            m_entityIds[entityIndex] = m_entityIds[lastIndex];
+            m_parentIds[entityIndex] = m_parentIds[lastIndex];
+            m_parentIndices[entityIndex] = m_parentIndices[lastIndex];
+            m_depths[entityIndex] = m_depths[lastIndex];
+            m_localTMs[entityIndex] = m_localTMs[lastIndex];
+            m_worldTMs[entityIndex] = m_worldTMs[lastIndex];
+            m_flags[entityIndex] = m_flags[lastIndex];
+            m_entityIndices[m_entityIds[entityIndex]] = entityIndex;
+        }
+
+        m_entityIds.pop_back();
+        m_parentIds.pop_back();
+        m_parentIndices.pop_back();
+        m_depths.pop_back();
+        m_localTMs.pop_back();
+        m_worldTMs.pop_back();
+        m_flags.pop_back();
+        m_layoutDirty = true;
+    }
+
+    void TransformHierarchy::Clear()
+    {
+        m_entityIds.clear();
+        m_parentIds.clear();
+        m_parentIndices.clear();
+        m_depths.clear();
+        m_localTMs.clear();
+        m_worldTMs.clear();
+        m_flags.clear();
+        m_levelStarts.clear();
+        m_entityIndices.clear();
+        m_minDirtyDepth = 0;
+        m_layoutDirty = false;
+        m_hasDirtyEntities = false;
+    }
+
+    void TransformHierarchy::SetParent(AZ::EntityId entityId, AZ::EntityId parentId)
+    {
+        auto entityItr = m_entityIndices.find(entityId);
+        if (entityItr != m_entityIndices.end() && m_parentIds[entityItr->second] != parentId)
+        {
+            m_parentIds[entityItr->second] = parentId;
+            m_layoutDirty = true;
+        }
+    }
+
+    void TransformHierarchy::SetOnParentChangedBehavior(AZ::EntityId entityId, AZ::OnParentChangedBehavior onParentChangedBehavior)
+    {
+        auto entityItr = m_entityIndices.find(entityId);
+        if (entityItr == m_entityIndices.end())
+        {
+            return;
+        }
+
+        AZ::u8& flags = m_flags[entityItr->second];
+        if (onParentChangedBehavior == AZ::OnParentChangedBehavior::DoNotUpdate)
+        {
+            flags |= Flag_KeepWorldTM;
+        }
+        else
+        {
+            flags &= ~Flag_KeepWorldTM;
+        }
+    }
+
+    void TransformHierarchy::SetTransforms(AZ::EntityId entityId, const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        auto entityItr = m_entityIndices.find(entityId);
+        if (entityItr == m_entityIndices.end())
+        {
+            return;
+        }
+
+        // The caller's transforms replace any pending local transform change.
+        const AZ::u32 entityIndex = entityItr->second;
+        m_localTMs[entityIndex] = localTM;
+        m_worldTMs[entityIndex] = worldTM;
+        m_flags[entityIndex] &= ~Flag_LocalDirty;
+        MarkDirty(entityIndex, Flag_TransformsSet);
+    }
+
+    void TransformHierarchy::SetLocalTM(AZ::EntityId entityId, const AZ::Transform& localTM)
+    {
+        auto entityItr = m_entityIndices.find(entityId);
+        if (entityItr == m_entityIndices.end())
+        {
+            return;
+        }
+
+        const AZ::u32 entityIndex = entityItr->second;
+        m_localTMs[entityIndex] = localTM;
+        MarkDirty(entityIndex, Flag_LocalDirty);
+    }
+
+    void TransformHierarchy::UpdateTransforms(const TransformsUpdatedCallback& transformsUpdatedCallback)
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        if (m_layoutDirty)
+        {
+            RebuildLayout();
+        }
+
+        if (!m_hasDirtyEntities)
+        {
+            return;
+        }
+
+        // Parents are always updated before their children, because each level only depends on the levels above it.
+        const AZ::u32 levelCount = aznumeric_cast<AZ::u32>(m_levelStarts.size() - 1);
+        for (AZ::u32 level = m_minDirtyDepth; level < levelCount; ++level)
+        {
+            UpdateLevel(m_levelStarts[level], m_levelStarts[level + 1]);
+        }
+
+        // Clear the update state before reporting anything, so that the callback can safely make new changes to the hierarchy.
+        AZStd::vector<AZ::EntityId> updatedEntities;
+        const AZ::u32 entityCount = aznumeric_cast<AZ::u32>(m_entityIds.size());
+        for (AZ::u32 entityIndex = m_levelStarts[m_minDirtyDepth]; entityIndex < entityCount; ++entityIndex)
+        {
+            if (transformsUpdatedCallback && (m_flags[entityIndex] & Flag_Recomputed))
+            {
+                updatedEntities.push_back(m_entityIds[entityIndex]);
+            }
+            m_flags[entityIndex] &= ~Flag_UpdateState;
+        }
+        m_hasDirtyEntities = false;
+
+        for (const AZ::EntityId& entityId : updatedEntities)
+        {
+            // Look the entity up again in case an earlier callback removed or moved it.
+            auto entityItr = m_entityIndices.find(entityId);
+            if (entityItr != m_entityIndices.end())
+            {
+                const AZ::Transform localTM = m_localTMs[entityItr->second];
+                const AZ::Transform worldTM = m_worldTMs[entityItr->second];
+                transformsUpdatedCallback(entityId, localTM, worldTM);
+            }
+        }
+    }
+
+    bool TransformHierarchy::Contains(AZ::EntityId entityId) const
+    {
+        return m_entityIndices.find(entityId) != m_entityIndices.end();
+    }
+
+    const AZ::Transform& TransformHierarchy::GetLocalTM(AZ::EntityId entityId) const
+    {
+        static const AZ::Transform identity = AZ::Transform::CreateIdentity();
+        auto entityItr = m_entityIndices.find(entityId);
+        return (entityItr != m_entityIndices.end()) ? m_localTMs[entityItr->second] : identity;
+    }
+
+    const AZ::Transform& TransformHierarchy::GetWorldTM(AZ::EntityId entityId) const
+    {
+        static const AZ::Transform identity = AZ::Transform::CreateIdentity();
+        auto entityItr = m_entityIndices.find(entityId);
+        return (entityItr != m_entityIndices.end()) ? m_worldTMs[entityItr->second] : identity;
+    }
+
+    void TransformHierarchy::RebuildLayout()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        const AZ::u32 entityCount = aznumeric_cast<AZ::u32>(m_entityIds.size());
+
+        // Resolve the parent ids into indices in the current, unsorted order.
+        AZStd::vector<AZ::u32> parentIndices(entityCount, InvalidIndex);
+        for (AZ::u32 entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+        {
+            auto parentItr = m_entityIndices.find(m_parentIds[entityIndex]);
+            if (parentItr != m_entityIndices.end())
+            {
+                parentIndices[entityIndex] = parentItr->second;
+            }
+        }
+
+        // Compute the depths by walking up from each entity to the first ancestor with a known depth.
+        constexpr AZ::u32 UnknownDepth = InvalidIndex;
+        constexpr AZ::u32 VisitingDepth = InvalidIndex - 1;
+        AZStd::vector<AZ::u32> depths(entityCount, UnknownDepth);
+        AZStd::vector<AZ::u32> ancestors;
+        AZ::u32 maxDepth = 0;
+        for (AZ::u32 entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+        {
+            ancestors.clear();
+            AZ::u32 currentIndex = entityIndex;
+            while (currentIndex != InvalidIndex && depths[currentIndex] == UnknownDepth)
+            {
+                depths[currentIndex] = VisitingDepth;
+                ancestors.push_back(currentIndex);
+                currentIndex = parentIndices[currentIndex];
+            }
+
+            AZ::u32 depth = 0;
+            if (currentIndex != InvalidIndex)
+            {
+                if (depths[currentIndex] == VisitingDepth)
+                {
+                    // The walk came back to an entity it already visited. The TransformComponent doesn't allow this,
+                    // so break the cycle by treating the last entity visited as a root.
+                    AZ_Warning(
+                        "TransformHierarchy", false, "Entity %s is part of a transform hierarchy cycle.",
+                        m_entityIds[ancestors.back()].ToString().c_str());
+                    parentIndices[ancestors.back()] = InvalidIndex;
+                }
+                else
+                {
+                    depth = depths[currentIndex] + 1;
+                }
+            }
+
+            for (auto ancestorItr = ancestors.rbegin(); ancestorItr != ancestors.rend(); ++ancestorItr)
+            {
+                depths[*ancestorItr] = depth++;
+            }
+            maxDepth = ancestors.empty() ? maxDepth : AZStd::max(maxDepth, depth - 1);
+        }
+
+        // Counting sort by depth. This keeps the existing order within each level, so entities that were already sorted stay put.
+        m_levelStarts.assign(entityCount > 0 ? maxDepth + 2 : 1, 0);
+        for (AZ::u32 depth : depths)
+        {
+            ++m_levelStarts[depth + 1];
+        }
+        for (size_t level = 1; level < m_levelStarts.size(); ++level)
+        {
+            m_levelStarts[level] += m_levelStarts[level - 1];
+        }
+
+        AZStd::vector<AZ::u32> levelCursors(m_levelStarts.begin(), m_levelStarts.end() - 1);
+        AZStd::vector<AZ::u32> sortedIndices(entityCount);
+        for (AZ::u32 entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+        {
+            sortedIndices[entityIndex] = levelCursors[depths[entityIndex]]++;
+        }
+
+        auto sortByDepth = [&sortedIndices](auto& values)
+        {
+            auto sortedValues = values;
+            for (size_t entityIndex = 0; entityIndex < sortedIndices.size(); ++entityIndex)
+            {
+                sortedValues[sortedIndices[entityIndex]] = AZStd::move(values[entityIndex]);
+            }
+            values.swap(sortedValues);
+        };
+        sortByDepth(m_entityIds);
+        sortByDepth(m_parentIds);
+        sortByDepth(m_localTMs);
+        sortByDepth(m_worldTMs);
+        sortByDepth(m_flags);
+        sortByDepth(depths);
+
+        m_parentIndices.resize(entityCount);
+        for (AZ::u32 entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+        {
+            const AZ::u32 parentIndex = parentIndices[entityIndex];
+            m_parentIndices[sortedIndices[entityIndex]] = (parentIndex != InvalidIndex) ? sortedIndices[parentIndex] : InvalidIndex;
+        }
+        m_depths.swap(depths);
+
+        // Refresh the index lookup, and find the first level that the next update needs to visit.
+        m_minDirtyDepth = maxDepth;
+        for (AZ::u32 entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+        {
+            m_entityIndices[m_entityIds[entityIndex]] = entityIndex;
+            if (m_flags[entityIndex] & Flag_Dirty)
+            {
+                m_minDirtyDepth = AZStd::min(m_minDirtyDepth, m_depths[entityIndex]);
+            }
+        }
+        m_hasDirtyEntities = m_hasDirtyEntities && (entityCount > 0);
+        m_layoutDirty = false;
+    }
+
+    void TransformHierarchy::UpdateLevel(AZ::u32 levelStart, AZ::u32 levelEnd)
+    {
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        if (!jobContext || (levelEnd - levelStart) < 2 * MinEntitiesPerJob)
+        {
+            for (AZ::u32 entityIndex = levelStart; entityIndex < levelEnd; ++entityIndex)
+            {
+                UpdateEntity(entityIndex);
+            }
+            return;
+        }
+
+        // Every entity in a level only reads from the level above it, so the level can be split into independent chunks.
+        AZ::JobCompletion jobCompletion;
+        for (AZ::u32 chunkStart = levelStart; chunkStart < levelEnd; chunkStart += aznumeric_cast<AZ::u32>(MinEntitiesPerJob))
+        {
+            const AZ::u32 chunkEnd = AZStd::min(chunkStart + aznumeric_cast<AZ::u32>(MinEntitiesPerJob), levelEnd);
+            AZ::Job* job = AZ::CreateJobFunction(
+                [this, chunkStart, chunkEnd]()
+                {
+                    for (AZ::u32 entityIndex = chunkStart; entityIndex < chunkEnd; ++entityIndex)
+                    {
+                        UpdateEntity(entityIndex);
+                    }
+                },
+                true,
+                jobContext);
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    void TransformHierarchy::UpdateEntity(AZ::u32 entityIndex)
+    {
+        AZ::u8 flags = m_flags[entityIndex];
+        const AZ::u32 parentIndex = m_parentIndices[entityIndex];
+        const bool parentChanged = (parentIndex != InvalidIndex) && (m_flags[parentIndex] & Flag_WorldChanged);
+
+        // Transforms that were set directly are already correct, but the children still need to be updated.
+        if (flags & Flag_TransformsSet)
+        {
+            flags |= Flag_WorldChanged;
+        }
+
+        if (parentChanged || (flags & Flag_LocalDirty))
+        {
+            if (parentIndex == InvalidIndex)
+            {
+                m_worldTMs[entityIndex] = m_localTMs[entityIndex];
+                flags |= Flag_WorldChanged | Flag_Recomputed;
+            }
+            else if ((flags & Flag_KeepWorldTM) && !(flags & Flag_LocalDirty))
+            {
+                // The world transform stays where it is, so only the local transform changes and the children aren't affected.
+                m_localTMs[entityIndex] = m_worldTMs[parentIndex].GetInverse() * m_worldTMs[entityIndex];
+                flags |= Flag_Recomputed;
+            }
+            else
+            {
+                m_worldTMs[entityIndex] = m_worldTMs[parentIndex] * m_localTMs[entityIndex];
+                flags |= Flag_WorldChanged | Flag_Recomputed;
+            }
+        }
+
+        m_flags[entityIndex] = flags;
+    }
+
+    void TransformHierarchy::MarkDirty(AZ::u32 entityIndex, AZ::u8 dirtyFlag)
+    {
+        m_flags[entityIndex] |= dirtyFlag;
+
+        // The depths aren't valid while the layout is dirty. The rebuild finds the first dirty level itself.
+        if (!m_layoutDirty)
+        {
+            m_minDirtyDepth = m_hasDirtyEntities ? AZStd::min(m_minDirtyDepth, m_depths[entityIndex]) : m_depths[entityIndex];
+        }
+        m_hasDirtyEntities = true;
+    }
+} // namespace AzFramework
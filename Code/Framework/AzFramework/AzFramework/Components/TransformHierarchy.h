@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_fwd.h>
+#include <AzCore/std/limits.h>
+
+namespace AzFramework
+{
+    //! Stores the local and world transforms of a set of entities in contiguous arrays that are sorted by hierarchy depth,
+    //! so that transform changes can be propagated down the hierarchy in a single batched pass instead of one entity at a time.
+    //!
+    //! Changes are recorded as dirty flags, and UpdateTransforms() recomputes every affected world transform one depth level at a
+    //! time. Every parent is at a lower depth than its children, so all the entities within a depth level can be updated in parallel.
+    //! Each entity whose transforms were recomputed is reported once per update, no matter how many of its ancestors changed.
+    //!
+    //! An entity whose parent isn't in the hierarchy is treated as a root, and its world transform matches its local transform.
+    class TransformHierarchy
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TransformHierarchy, AZ::SystemAllocator);
+
+        //! Called by UpdateTransforms() for each entity whose transforms were recomputed from its parent.
+        using TransformsUpdatedCallback =
+            AZStd::function<void(AZ::EntityId entityId, const AZ::Transform& localTM, const AZ::Transform& worldTM)>;
+
+        //! Entity levels with at least this many entities get split into multiple jobs.
+        static constexpr size_t MinEntitiesPerJob = 256;
+
+        //! Add an entity to the hierarchy.
+        //! @param entityId The entity to add.
+        //! @param parentId The parent of the entity, or an invalid id if the entity has no parent.
+        //! @param localTM The transform of the entity relative to its parent.
+        //! @param worldTM The world transform of the entity.
+        //! @param onParentChangedBehavior Whether the world transform or the local transform is kept when the parent moves.
+        void AddEntity(
+            AZ::EntityId entityId,
+            AZ::EntityId parentId,
+            const AZ::Transform& localTM,
+            const AZ::Transform& worldTM,
+            AZ::OnParentChangedBehavior onParentChangedBehavior = AZ::OnParentChangedBehavior::Update);
+
+        //! Remove an entity from the hierarchy. Its children are treated as roots until it's added again.
+        void RemoveEntity(AZ::EntityId entityId);
+
+        //! Remove every entity from the hierarchy.
+        void Clear();
+
+        //! Change the parent of an entity. The transforms of the entity aren't changed.
+        void SetParent(AZ::EntityId entityId, AZ::EntityId parentId);
+
+        //! Change what happens to an entity's transforms when its parent moves.
+        void SetOnParentChangedBehavior(AZ::EntityId entityId, AZ::OnParentChangedBehavior onParentChangedBehavior);
+
+        //! Set both transforms of an entity, when the caller has already computed them. The entity itself won't be reported
+        //! by the next update unless one of its ancestors also changes, but all of its descendants will be updated.
+        void SetTransforms(AZ::EntityId entityId, const AZ::Transform& localTM, const AZ::Transform& worldTM);
+
+        //! Set the local transform of an entity. Its world transform, and the world transforms of its descendants,
+        //! get recomputed by the next update.
+        void SetLocalTM(AZ::EntityId entityId, const AZ::Transform& localTM);
+
+        //! Recompute the transforms of every entity affected by a change since the last update.
+        //! @param transformsUpdatedCallback Optional callback for each entity whose transforms were recomputed.
+        //! Entities are reported in depth order, so a parent is always reported before its children.
+        void UpdateTransforms(const TransformsUpdatedCallback& transformsUpdatedCallback = {});
+
+        //! Returns true if an entity has been added to the hierarchy.
+        bool Contains(AZ::EntityId entityId) const;
+
+        //! Returns the number of entities in the hierarchy.
+        size_t GetEntityCount() const
+        {
+            return m_entityIds.size();
+        }
+
+        //! Returns true if there are changes that the next update needs to process.
+        bool HasPendingUpdates() const
+        {
+            return m_hasDirtyEntities || m_layoutDirty;
+        }
+
+        //! Get the local transform of an entity, or identity if the entity isn't in the hierarchy.
+        const AZ::Transform& GetLocalTM(AZ::EntityId entityId) const;
+
+        //! Get the world transform of an entity, or identity if the entity isn't in the hierarchy.
+        //! Until the next update, this won't reflect changes to the entity's ancestors.
+        const AZ::Transform& GetWorldTM(AZ::EntityId entityId) const;
+
+    private:
+        static constexpr AZ::u32 InvalidIndex = AZStd::numeric_limits<AZ::u32>::max();
+
+        //! Per-entity state bits.
+        enum EntityFlags : AZ::u8
+        {
+            //! Both transforms were set directly, so only the descendants need to be updated.
+            Flag_TransformsSet = 1 << 0,
+            //! The local transform was set directly, so the world transform needs to be recomputed.
+            Flag_LocalDirty = 1 << 1,
+            //! Keep the world transform instead of the local transform when the parent moves.
+            Flag_KeepWorldTM = 1 << 2,
+            //! Set during an update when the world transform changed, so the children need to be updated.
+            Flag_WorldChanged = 1 << 3,
+            //! Set during an update when the transforms were recomputed, so the entity needs to be reported.
+            Flag_Recomputed = 1 << 4,
+
+            Flag_Dirty = Flag_TransformsSet | Flag_LocalDirty,
+            Flag_UpdateState = Flag_Dirty | Flag_WorldChanged | Flag_Recomputed
+        };
+
+        //! Sort the entity arrays by hierarchy depth and resolve the parent indices.
+        void RebuildLayout();
+
+        //! Update the transforms of every entity in one depth level.
+        void UpdateLevel(AZ::u32 levelStart, AZ::u32 levelEnd);
+        void UpdateEntity(AZ::u32 entityIndex);
+
+        void MarkDirty(AZ::u32 entityIndex, AZ::u8 dirtyFlag);
+
+        // The entity data is stored as a structure of arrays. Once the layout has been rebuilt, all the arrays are sorted by
+        // hierarchy depth, and every entity's parent has a lower index than the entity itself.
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::EntityId> m_parentIds;
+        AZStd::vector<AZ::u32> m_parentIndices;
+        AZStd::vector<AZ::u32> m_depths;
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<AZ::u8> m_flags;
+
+        //! The first entity index of each depth level, plus one final entry for the total entity count.
+        AZStd::vector<AZ::u32> m_levelStarts;
+
+        AZStd::unordered_map<AZ::EntityId, AZ::u32> m_entityIndices;
+
+        //! The lowest depth with a dirty entity. Nothing above this depth needs to be visited by an update.
+        AZ::u32 m_minDirtyDepth = 0;
+
+        //! Set when entities are added, removed, or reparented, which means the arrays need to be sorted again.
+        bool m_layoutDirty = false;
+        bool m_hasDirtyEntities = false;
+    };
+} // namespace AzFramework
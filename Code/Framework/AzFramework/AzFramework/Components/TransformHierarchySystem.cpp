@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchySystem.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzFramework/Components/TransformComponent.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
+
+namespace AzFramework
+{
+    AZ_CVAR(bool, bg_transformHierarchyBatchedUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If set, game entity transforms propagate parent changes to their children in one batched pass at the end of each tick, "
+        "instead of immediately through TransformNotificationBus. Takes effect the next time the game entity context is activated.");
+
+    void TransformHierarchySystem::Connect()
+    {
+        if (!bg_transformHierarchyBatchedUpdates)
+        {
+            return;
+        }
+
+        AZ::Interface<ITransformHierarchySystem>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+        m_connected = true;
+    }
+
+    void TransformHierarchySystem::Disconnect()
+    {
+        if (!m_connected)
+        {
+            return;
+        }
+
+        // Deliver any changes that are still pending, then hand the remaining transforms back to TransformNotificationBus.
+        ProcessTransformHierarchyUpdates();
+
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<ITransformHierarchySystem>::Unregister(this);
+        m_connected = false;
+
+        auto transforms = AZStd::move(m_transforms);
+        m_transforms.clear();
+        m_transformHierarchy.Clear();
+        for (auto& [entityId, transform] : transforms)
+        {
+            transform->DetachFromTransformHierarchySystem();
+        }
+    }
+
+    void TransformHierarchySystem::AddTransform(TransformComponent* transform)
+    {
+        const AZ::EntityId entityId = transform->GetEntityId();
+        m_transforms[entityId] = transform;
+        m_transformHierarchy.AddEntity(
+            entityId, transform->m_parentId, transform->m_localTM, transform->m_worldTM, transform->m_onParentChangedBehavior);
+    }
+
+    void TransformHierarchySystem::RemoveTransform(TransformComponent* transform)
+    {
+        const AZ::EntityId entityId = transform->GetEntityId();
+        m_transforms.erase(entityId);
+        m_transformHierarchy.RemoveEntity(entityId);
+    }
+
+    bool TransformHierarchySystem::IsTransformTracked(AZ::EntityId entityId) const
+    {
+        return m_transformHierarchy.Contains(entityId);
+    }
+
+    void TransformHierarchySystem::OnTransformParentChanged(AZ::EntityId entityId, AZ::EntityId parentId)
+    {
+        m_transformHierarchy.SetParent(entityId, parentId);
+    }
+
+    void TransformHierarchySystem::OnTransformChanged(AZ::EntityId entityId, const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        m_transformHierarchy.SetTransforms(entityId, localTM, worldTM);
+    }
+
+    void TransformHierarchySystem::OnParentChangedBehaviorChanged(
+        AZ::EntityId entityId, AZ::OnParentChangedBehavior onParentChangedBehavior)
+    {
+        m_transformHierarchy.SetOnParentChangedBehavior(entityId, onParentChangedBehavior);
+    }
+
+    void TransformHierarchySystem::ProcessTransformHierarchyUpdates()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        if (!m_transformHierarchy.HasPendingUpdates())
+        {
+            return;
+        }
+
+        m_transformHierarchy.UpdateTransforms(
+            [this](AZ::EntityId entityId, const AZ::Transform& localTM, const AZ::Transform& worldTM)
+            {
+                if (auto transformIt = m_transforms.find(entityId); transformIt != m_transforms.end())
+                {
+                    transformIt->second->OnHierarchyTransformsUpdated(localTM, worldTM);
+                }
+            });
+    }
+
+    void TransformHierarchySystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ProcessTransformHierarchyUpdates();
+    }
+
+    int TransformHierarchySystem::GetTickOrder()
+    {
+        // Propagate after everything else has had a chance to move entities this tick.
+        return AZ::ComponentTickBus::TICK_LAST;
+    }
+} // namespace AzFramework
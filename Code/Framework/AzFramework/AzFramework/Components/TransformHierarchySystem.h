@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Propagates transform changes from parents to children in one batched pass per tick, instead of each
+    //! TransformComponent listening to its parent's TransformNotificationBus.
+    //! Transform components register with the system when they activate, if it's available. Changes to a registered
+    //! transform are immediately visible on that entity, but its descendants are only updated at the end of the tick.
+    class ITransformHierarchySystem
+    {
+    public:
+        AZ_RTTI(ITransformHierarchySystem, "{3B8E5C4A-61D2-4F0B-9E27-D4A18C0F7B35}");
+
+        //! Start tracking an active transform component.
+        virtual void AddTransform(TransformComponent* transform) = 0;
+
+        //! Stop tracking a transform component that's about to deactivate.
+        virtual void RemoveTransform(TransformComponent* transform) = 0;
+
+        //! Returns true if the transform of the given entity is tracked by the system.
+        virtual bool IsTransformTracked(AZ::EntityId entityId) const = 0;
+
+        //! Notifies the system that a tracked transform has a new parent.
+        virtual void OnTransformParentChanged(AZ::EntityId entityId, AZ::EntityId parentId) = 0;
+
+        //! Notifies the system that a tracked transform has been modified, so its descendants need to be updated.
+        virtual void OnTransformChanged(AZ::EntityId entityId, const AZ::Transform& localTM, const AZ::Transform& worldTM) = 0;
+
+        //! Notifies the system that a tracked transform has a new OnParentChangedBehavior.
+        virtual void OnParentChangedBehaviorChanged(AZ::EntityId entityId, AZ::OnParentChangedBehavior onParentChangedBehavior) = 0;
+
+        //! Propagates all the pending transform changes to the descendants, and notifies each updated entity once.
+        //! @note During normal operation this is called every frame in OnTick but can
+        //! also be called explicitly (e.g. For testing purposes).
+        virtual void ProcessTransformHierarchyUpdates() = 0;
+
+    protected:
+        ~ITransformHierarchySystem() = default;
+    };
+
+    //! Batched transform propagation for the entities in the game entity context.
+    //! The system is only enabled when the bg_transformHierarchyBatchedUpdates cvar is set before it connects.
+    class TransformHierarchySystem
+        : public ITransformHierarchySystem
+        , private AZ::TickBus::Handler
+    {
+    public:
+        void Connect();
+        void Disconnect();
+
+        // ITransformHierarchySystem overrides ...
+        void AddTransform(TransformComponent* transform) override;
+        void RemoveTransform(TransformComponent* transform) override;
+        bool IsTransformTracked(AZ::EntityId entityId) const override;
+        void OnTransformParentChanged(AZ::EntityId entityId, AZ::EntityId parentId) override;
+        void OnTransformChanged(AZ::EntityId entityId, const AZ::Transform& localTM, const AZ::Transform& worldTM) override;
+        void OnParentChangedBehaviorChanged(AZ::EntityId entityId, AZ::OnParentChangedBehavior onParentChangedBehavior) override;
+        void ProcessTransformHierarchyUpdates() override;
+
+    private:
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        TransformHierarchy m_transformHierarchy;
+        AZStd::unordered_map<AZ::EntityId, TransformComponent*> m_transforms;
+        bool m_connected = false;
+    };
+} // namespace AzFramework
@@ -13,6 +13,7 @@
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Component/Component.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
 
@@ -92,6 +93,7 @@ namespace AzFramework
     private:
 
         AzFramework::EntityVisibilityBoundsUnionSystem m_entityVisibilityBoundsUnionSystem;
+        AzFramework::TransformHierarchySystem m_transformHierarchySystem;
     };
 } // namespace AzFramework
 
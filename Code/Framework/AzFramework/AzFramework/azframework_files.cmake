@@ -128,6 +128,10 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/TransformHierarchy.cpp
+    Components/TransformHierarchy.h
+    Components/TransformHierarchySystem.cpp
+    Components/TransformHierarchySystem.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Stand-in for TransformNotificationBus, so that the per-entity propagation used by TransformComponent can be
+    //! measured without activating real entities.
+    class BenchmarkTransformNotifications : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        using BusIdType = AZ::EntityId;
+
+        virtual void OnTransformChanged(const AZ::Transform& localTM, const AZ::Transform& worldTM) = 0;
+    };
+    using BenchmarkTransformNotificationBus = AZ::EBus<BenchmarkTransformNotifications>;
+
+    //! Listens to its parent's notifications and forwards its own, the same way TransformComponent does.
+    class BusTransform : public BenchmarkTransformNotificationBus::Handler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(BusTransform, AZ::SystemAllocator);
+
+        BusTransform(AZ::EntityId entityId, AZ::EntityId parentId, const AZ::Transform& localTM)
+            : m_entityId(entityId)
+            , m_localTM(localTM)
+        {
+            BenchmarkTransformNotificationBus::Handler::BusConnect(parentId);
+        }
+
+        void OnTransformChanged([[maybe_unused]] const AZ::Transform& parentLocalTM, const AZ::Transform& parentWorldTM) override
+        {
+            m_worldTM = parentWorldTM * m_localTM;
+            BenchmarkTransformNotificationBus::Event(m_entityId, &BenchmarkTransformNotifications::OnTransformChanged, m_localTM, m_worldTM);
+        }
+
+    private:
+        AZ::EntityId m_entityId;
+        AZ::Transform m_localTM;
+        AZ::Transform m_worldTM = AZ::Transform::CreateIdentity();
+    };
+
+    class BM_TransformHierarchy
+        : public benchmark::Fixture
+    {
+        void internalSetUp(int64_t descendantCount)
+        {
+            AZ::JobManagerDesc jobManagerDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            const unsigned int workerThreadCount = AZStd::max(AZStd::thread::hardware_concurrency(), 2u) - 1;
+            for (unsigned int threadIndex = 0; threadIndex < workerThreadCount; ++threadIndex)
+            {
+                jobManagerDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+
+            // Build a tree where every entity has BranchingFactor children, filled in breadth first.
+            constexpr AZ::u64 BranchingFactor = 8;
+            const AZ::Transform childLocalTM = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 1.0f));
+            m_hierarchy.AddEntity(m_rootId, AZ::EntityId(), AZ::Transform::CreateIdentity(), AZ::Transform::CreateIdentity());
+            for (AZ::u64 descendantIndex = 0; descendantIndex < static_cast<AZ::u64>(descendantCount); ++descendantIndex)
+            {
+                const AZ::EntityId entityId(RootId + 1 + descendantIndex);
+                const AZ::EntityId parentId(RootId + descendantIndex / BranchingFactor);
+                m_hierarchy.AddEntity(entityId, parentId, childLocalTM, AZ::Transform::CreateIdentity());
+                m_busTransforms.push_back(AZStd::make_unique<BusTransform>(entityId, parentId, childLocalTM));
+            }
+            m_hierarchy.UpdateTransforms();
+        }
+
+        void internalTearDown()
+        {
+            m_busTransforms.clear();
+            m_busTransforms.shrink_to_fit();
+            m_hierarchy.Clear();
+            m_jobContext.reset();
+            m_jobManager.reset();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void RunBatchedUpdates(benchmark::State& state)
+        {
+            AZ::u64 updatedEntityCount = 0;
+            auto countUpdatedEntities = [&updatedEntityCount](AZ::EntityId, const AZ::Transform&, const AZ::Transform&)
+            {
+                ++updatedEntityCount;
+            };
+
+            float rootHeight = 0.0f;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                rootHeight += 1.0f;
+                const AZ::Transform rootTM = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, rootHeight));
+                m_hierarchy.SetTransforms(m_rootId, rootTM, rootTM);
+                m_hierarchy.UpdateTransforms(countUpdatedEntities);
+            }
+            benchmark::DoNotOptimize(updatedEntityCount);
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        static constexpr AZ::u64 RootId = 1;
+        const AZ::EntityId m_rootId = AZ::EntityId(RootId);
+        AzFramework::TransformHierarchy m_hierarchy;
+        AZStd::vector<AZStd::unique_ptr<BusTransform>> m_busTransforms;
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+    };
+
+    BENCHMARK_DEFINE_F(BM_TransformHierarchy, MoveRootPerEntityNotifications)(benchmark::State& state)
+    {
+        float rootHeight = 0.0f;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            rootHeight += 1.0f;
+            const AZ::Transform rootTM = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, rootHeight));
+            BenchmarkTransformNotificationBus::Event(m_rootId, &BenchmarkTransformNotifications::OnTransformChanged, rootTM, rootTM);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(BM_TransformHierarchy, MoveRootBatchedSerial)(benchmark::State& state)
+    {
+        RunBatchedUpdates(state);
+    }
+
+    BENCHMARK_DEFINE_F(BM_TransformHierarchy, MoveRootBatchedParallel)(benchmark::State& state)
+    {
+        AZ::JobContext::SetGlobalContext(m_jobContext.get());
+        RunBatchedUpdates(state);
+        AZ::JobContext::SetGlobalContext(nullptr);
+    }
+
+    BENCHMARK_REGISTER_F(BM_TransformHierarchy, MoveRootPerEntityNotifications)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BM_TransformHierarchy, MoveRootBatchedSerial)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(BM_TransformHierarchy, MoveRootBatchedParallel)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+
+#endif // HAVE_BENCHMARK
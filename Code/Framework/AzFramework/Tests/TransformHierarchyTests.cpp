@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzFramework/Components/TransformHierarchy.h>
+
+namespace UnitTest
+{
+    class TransformHierarchyTests : public LeakDetectionFixture
+    {
+    public:
+        static AZ::Transform CreateTranslation(float x, float y, float z)
+        {
+            return AZ::Transform::CreateTranslation(AZ::Vector3(x, y, z));
+        }
+
+        // Run an update, and count how many times each entity gets reported.
+        AZStd::unordered_map<AZ::EntityId, int> UpdateAndCountReports(AzFramework::TransformHierarchy& hierarchy)
+        {
+            AZStd::unordered_map<AZ::EntityId, int> reportCounts;
+            hierarchy.UpdateTransforms(
+                [&reportCounts](AZ::EntityId entityId, [[maybe_unused]] const AZ::Transform& localTM, [[maybe_unused]] const AZ::Transform& worldTM)
+                {
+                    ++reportCounts[entityId];
+                });
+            return reportCounts;
+        }
+    };
+
+    TEST_F(TransformHierarchyTests, ChildWorldTMFollowsParent)
+    {
+        const AZ::EntityId parentId(1);
+        const AZ::EntityId childId(2);
+
+        AzFramework::TransformHierarchy hierarchy;
+        hierarchy.AddEntity(parentId, AZ::EntityId(), CreateTranslation(1.0f, 0.0f, 0.0f), CreateTranslation(1.0f, 0.0f, 0.0f));
+        hierarchy.AddEntity(childId, parentId, CreateTranslation(0.0f, 1.0f, 0.0f), AZ::Transform::CreateIdentity());
+        hierarchy.UpdateTransforms();
+        EXPECT_THAT(hierarchy.GetWorldTM(childId).GetTranslation(), IsClose(AZ::Vector3(1.0f, 1.0f, 0.0f)));
+
+        // Moving the parent only updates the child once the hierarchy is updated.
+        hierarchy.SetTransforms(parentId, CreateTranslation(5.0f, 0.0f, 0.0f), CreateTranslation(5.0f, 0.0f, 0.0f));
+        EXPECT_TRUE(hierarchy.HasPendingUpdates());
+        EXPECT_THAT(hierarchy.GetWorldTM(childId).GetTranslation(), IsClose(AZ::Vector3(1.0f, 1.0f, 0.0f)));
+
+        hierarchy.UpdateTransforms();
+        EXPECT_FALSE(hierarchy.HasPendingUpdates());
+        EXPECT_THAT(hierarchy.GetWorldTM(childId).GetTranslation(), IsClose(AZ::Vector3(5.0f, 1.0f, 0.0f)));
+        EXPECT_THAT(hierarchy.GetLocalTM(childId).GetTranslation(), IsClose(AZ::Vector3(0.0f, 1.0f, 0.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, ChildAddedBeforeParentIsUpdatedAfterParent)
+    {
+        const AZ::EntityId parentId(1);
+        const AZ::EntityId childId(2);
+        const AZ::EntityId grandchildId(3);
+
+        AzFramework::TransformHierarchy hierarchy;
+        hierarchy.AddEntity(grandchildId, childId, CreateTranslation(0.0f, 0.0f, 1.0f), AZ::Transform::CreateIdentity());
+        hierarchy.AddEntity(childId, parentId, CreateTranslation(0.0f, 1.0f, 0.0f), AZ::Transform::CreateIdentity());
+        hierarchy.AddEntity(parentId, AZ::EntityId(), CreateTranslation(1.0f, 0.0f, 0.0f), CreateTranslation(1.0f, 0.0f, 0.0f));
+        hierarchy.UpdateTransforms();
+
+        EXPECT_THAT(hierarchy.GetWorldTM(childId).GetTranslation(), IsClose(AZ::Vector3(1.0f, 1.0f, 0.0f)));
+        EXPECT_THAT(hierarchy.GetWorldTM(grandchildId).GetTranslation(), IsClose(AZ::Vector3(1.0f, 1.0f, 1.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, EachUpdatedEntityIsReportedOnce)
+    {
+        const AZ::EntityId rootId(1);
+        const AZ::EntityId childId(2);
+        const AZ::EntityId grandchildId(3);
+
+        AzFramework::TransformHierarchy hierarchy;
+        hierarchy.AddEntity(rootId, AZ::EntityId(), AZ::Transform::CreateIdentity(), AZ::Transform::CreateIdentity());
+        hierarchy.AddEntity(childId, rootId, AZ::Transform::CreateIdentity(), AZ::Transform::CreateIdentity());
+        hierarchy.AddEntity(grandchildId, childId, AZ::Transform::CreateIdentity(), AZ::Transform::CreateIdentity());
+        hierarchy.UpdateTransforms();
+
+        // Both the root and the child move, but the grandchild should only be reported once.
+        hierarchy.SetTransforms(rootId, CreateTranslation(1.0f, 0.0f, 0.0f), CreateTranslation(1.0f, 0.0f, 0.0f));
+        hierarchy.SetLocalTM(childId, CreateTranslation(0.0f, 2.0f, 0.0f));
+        const auto reportCounts = UpdateAndCountReports(hierarchy);
+
+        EXPECT_EQ(reportCounts.size(), 2u);
+        EXPECT_EQ(reportCounts.count(rootId), 0u);
+        EXPECT_EQ(reportCounts.at(childId), 1);
+        EXPECT_EQ(reportCounts.at(grandchildId), 1);
+        EXPECT_THAT(hierarchy.GetWorldTM(grandchildId).GetTranslation(), IsClose(AZ::Vector3(1.0f, 2.0f, 0.0f)));
+
+        // Nothing changed, so nothing is reported.
+        EXPECT_TRUE(UpdateAndCountReports(hierarchy).empty());
+    }
+
+    TEST_F(TransformHierarchyTests, DoNotUpdateBehaviorKeepsWorldTM)
+    {
+        const AZ::EntityId parentId(1);
+        const AZ::EntityId childId(2);
+        const AZ::EntityId grandchildId(3);
+
+        AzFramework::TransformHierarchy hierarchy;
+        hierarchy.AddEntity(parentId, AZ::EntityId(), AZ::Transform::CreateIdentity(), AZ::Transform::CreateIdentity());
+        hierarchy.AddEntity(
+            childId, parentId, CreateTranslation(0.0f, 1.0f, 0.0f), CreateTranslation(0.0f, 1.0f, 0.0f),
+            AZ::OnParentChangedBehavior::DoNotUpdate);
+        hierarchy.AddEntity(grandchildId, childId, CreateTranslation(0.0f, 0.0f, 1.0f), AZ::Transform::CreateIdentity());
+        hierarchy.UpdateTransforms();
+
+        hierarchy.SetTransforms(parentId, CreateTranslation(3.0f, 0.0f, 0.0f), CreateTranslation(3.0f, 0.0f, 0.0f));
+        const auto reportCounts = UpdateAndCountReports(hierarchy);
+
+        // The child's local transform is updated to keep it in place, so its own children don't move either.
+        EXPECT_THAT(hierarchy.GetWorldTM(childId).GetTranslation(), IsClose(AZ::Vector3(0.0f, 1.0f, 0.0f)));
+        EXPECT_THAT(hierarchy.GetLocalTM(childId).GetTranslation(), IsClose(AZ::Vector3(-3.0f, 1.0f, 0.0f)));
+        EXPECT_THAT(hierarchy.GetWorldTM(grandchildId).GetTranslation(), IsClose(AZ::Vector3(0.0f, 1.0f, 1.0f)));
+        EXPECT_EQ(reportCounts.count(childId), 1u);
+        EXPECT_EQ(reportCounts.count(grandchildId), 0u);
+    }
+
+    TEST_F(TransformHierarchyTests, ReparentingAndRemovingEntitiesUpdatesLayout)
+    {
+        const AZ::EntityId firstParentId(1);
+        const AZ::EntityId secondParentId(2);
+        const AZ::EntityId childId(3);
+
+        AzFramework::TransformHierarchy hierarchy;
+        hierarchy.AddEntity(firstParentId, AZ::EntityId(), CreateTranslation(1.0f, 0.0f, 0.0f), CreateTranslation(1.0f, 0.0f, 0.0f));
+        hierarchy.AddEntity(secondParentId, AZ::EntityId(), CreateTranslation(2.0f, 0.0f, 0.0f), CreateTranslation(2.0f, 0.0f, 0.0f));
+        hierarchy.AddEntity(childId, firstParentId, CreateTranslation(0.0f, 1.0f, 0.0f), AZ::Transform::CreateIdentity());
+        hierarchy.UpdateTransforms();
+        EXPECT_THAT(hierarchy.GetWorldTM(childId).GetTranslation(), IsClose(AZ::Vector3(1.0f, 1.0f, 0.0f)));
+
+        // The new parent's changes should reach the child, and the old parent's changes shouldn't.
+        hierarchy.SetParent(childId, secondParentId);
+        hierarchy.SetTransforms(firstParentId, CreateTranslation(10.0f, 0.0f, 0.0f), CreateTranslation(10.0f, 0.0f, 0.0f));
+        hierarchy.SetTransforms(secondParentId, CreateTranslation(4.0f, 0.0f, 0.0f), CreateTranslation(4.0f, 0.0f, 0.0f));
+        hierarchy.UpdateTransforms();
+        EXPECT_THAT(hierarchy.GetWorldTM(childId).GetTranslation(), IsClose(AZ::Vector3(4.0f, 1.0f, 0.0f)));
+
+        // Once its parent is removed, the child is a root and keeps its last transforms.
+        hierarchy.RemoveEntity(secondParentId);
+        hierarchy.UpdateTransforms();
+        EXPECT_EQ(hierarchy.GetEntityCount(), 2u);
+        EXPECT_FALSE(hierarchy.Contains(secondParentId));
+        EXPECT_THAT(hierarchy.GetWorldTM(childId).GetTranslation(), IsClose(AZ::Vector3(4.0f, 1.0f, 0.0f)));
+
+        hierarchy.SetLocalTM(childId, CreateTranslation(0.0f, 5.0f, 0.0f));
+        hierarchy.UpdateTransforms();
+        EXPECT_THAT(hierarchy.GetWorldTM(childId).GetTranslation(), IsClose(AZ::Vector3(0.0f, 5.0f, 0.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, LargeLevelsAreUpdatedInParallel)
+    {
+        AZ::JobManagerDesc jobManagerDesc;
+        AZ::JobManagerThreadDesc threadDesc;
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            jobManagerDesc.m_workerThreads.push_back(threadDesc);
+        }
+        auto jobManager = aznew AZ::JobManager(jobManagerDesc);
+        auto jobContext = aznew AZ::JobContext(*jobManager);
+        AZ::JobContext::SetGlobalContext(jobContext);
+
+        // A root with enough children and grandchildren that both levels get split into multiple jobs.
+        constexpr AZ::u64 ChildCount = AzFramework::TransformHierarchy::MinEntitiesPerJob * 4;
+        const AZ::EntityId rootId(1);
+
+        AzFramework::TransformHierarchy hierarchy;
+        hierarchy.AddEntity(rootId, AZ::EntityId(), AZ::Transform::CreateIdentity(), AZ::Transform::CreateIdentity());
+        for (AZ::u64 childIndex = 0; childIndex < ChildCount; ++childIndex)
+        {
+            const AZ::EntityId childId(2 + childIndex);
+            const AZ::EntityId grandchildId(2 + ChildCount + childIndex);
+            const float offset = aznumeric_cast<float>(childIndex);
+            hierarchy.AddEntity(childId, rootId, CreateTranslation(offset, 0.0f, 0.0f), AZ::Transform::CreateIdentity());
+            hierarchy.AddEntity(grandchildId, childId, CreateTranslation(0.0f, offset, 0.0f), AZ::Transform::CreateIdentity());
+        }
+        hierarchy.UpdateTransforms();
+
+        hierarchy.SetTransforms(rootId, CreateTranslation(0.0f, 0.0f, 7.0f), CreateTranslation(0.0f, 0.0f, 7.0f));
+        const auto reportCounts = UpdateAndCountReports(hierarchy);
+        EXPECT_EQ(reportCounts.size(), ChildCount * 2);
+
+        for (AZ::u64 childIndex = 0; childIndex < ChildCount; ++childIndex)
+        {
+            const AZ::EntityId grandchildId(2 + ChildCount + childIndex);
+            const float offset = aznumeric_cast<float>(childIndex);
+            EXPECT_THAT(hierarchy.GetWorldTM(grandchildId).GetTranslation(), IsClose(AZ::Vector3(offset, offset, 7.0f)));
+        }
+
+        AZ::JobContext::SetGlobalContext(nullptr);
+        delete jobContext;
+        delete jobManager;
+    }
+} // namespace UnitTest
@@ -35,6 +35,8 @@ set(FILES
     Scene.cpp
     CameraState.cpp
     InputTests.cpp
+    TransformHierarchyPerformanceTests.cpp
+    TransformHierarchyTests.cpp
     DocumentPropertyEditor/AdapterBuilderTests.cpp
     DocumentPropertyEditor/SchemaTests.cpp
     DocumentPropertyEditor/CvarAdapterTests.cpp
@@ -21,6 +21,7 @@
 #include <SceneAPI/SceneData/Rules/CommentRule.h>
 #include <SceneAPI/SceneData/Rules/LodRule.h>
 #include <SceneAPI/SceneData/Rules/MaterialRule.h>
+#include <SceneAPI/SceneData/Rules/MeshOptimizationRule.h>
 #include <SceneAPI/SceneData/Rules/UnmodifiableRule.h>
 #include <SceneAPI/SceneData/Rules/StaticMeshAdvancedRule.h>
 #include <SceneAPI/SceneData/Rules/SkeletonProxyRule.h>
@@ -99,6 +100,10 @@ namespace AZ
                     {
                         modifiers.push_back(SceneData::TagRule::TYPEINFO_Uuid());
                     }
+                    if (existingRules.find(SceneData::MeshOptimizationRule::TYPEINFO_Uuid()) == existingRules.end())
+                    {
+                        modifiers.push_back(SceneData::MeshOptimizationRule::TYPEINFO_Uuid());
+                    }
                 }
                 else if (target.RTTI_IsTypeOf(DataTypes::ISkinGroup::TYPEINFO_Uuid()))
                 {
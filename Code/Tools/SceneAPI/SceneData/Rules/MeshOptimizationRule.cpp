@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <SceneAPI/SceneData/Rules/MeshOptimizationRule.h>
+
+namespace AZ
+{
+    namespace SceneAPI
+    {
+        namespace SceneData
+        {
+            bool MeshOptimizationRule::GetOptimizeVertexCache() const
+            {
+                return m_optimizeVertexCache;
+            }
+
+            void MeshOptimizationRule::SetOptimizeVertexCache(bool value)
+            {
+                m_optimizeVertexCache = value;
+            }
+
+            bool MeshOptimizationRule::GetOptimizeOverdraw() const
+            {
+                return m_optimizeOverdraw;
+            }
+
+            void MeshOptimizationRule::SetOptimizeOverdraw(bool value)
+            {
+                m_optimizeOverdraw = value;
+            }
+
+            float MeshOptimizationRule::GetOverdrawThreshold() const
+            {
+                return m_overdrawThreshold;
+            }
+
+            void MeshOptimizationRule::SetOverdrawThreshold(float value)
+            {
+                m_overdrawThreshold = value;
+            }
+
+            bool MeshOptimizationRule::GetOptimizeVertexFetch() const
+            {
+                return m_optimizeVertexFetch;
+            }
+
+            void MeshOptimizationRule::SetOptimizeVertexFetch(bool value)
+            {
+                m_optimizeVertexFetch = value;
+            }
+
+            bool MeshOptimizationRule::GetUse16BitIndices() const
+            {
+                return m_use16BitIndices;
+            }
+
+            void MeshOptimizationRule::SetUse16BitIndices(bool value)
+            {
+                m_use16BitIndices = value;
+            }
+
+            bool MeshOptimizationRule::GetQuantizeVertexAttributes() const
+            {
+                return m_quantizeVertexAttributes;
+            }
+
+            void MeshOptimizationRule::SetQuantizeVertexAttributes(bool value)
+            {
+                m_quantizeVertexAttributes = value;
+            }
+
+            void MeshOptimizationRule::Reflect(AZ::ReflectContext* context)
+            {
+                AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
+                if (!serializeContext)
+                {
+                    return;
+                }
+
+                serializeContext->Class<MeshOptimizationRule, DataTypes::IRule>()
+                    ->Version(1)
+                    ->Field("optimizeVertexCache", &MeshOptimizationRule::m_optimizeVertexCache)
+                    ->Field("optimizeOverdraw", &MeshOptimizationRule::m_optimizeOverdraw)
+                    ->Field("overdrawThreshold", &MeshOptimizationRule::m_overdrawThreshold)
+                    ->Field("optimizeVertexFetch", &MeshOptimizationRule::m_optimizeVertexFetch)
+                    ->Field("use16BitIndices", &MeshOptimizationRule::m_use16BitIndices)
+                    ->Field("quantizeVertexAttributes", &MeshOptimizationRule::m_quantizeVertexAttributes);
+
+                AZ::EditContext* editContext = serializeContext->GetEditContext();
+                if (editContext)
+                {
+                    editContext->Class<MeshOptimizationRule>("Mesh optimization", "Optimize the index and vertex buffers of the meshes for rendering.")
+                        ->ClassElement(Edit::ClassElements::EditorData, "")
+                            ->Attribute("AutoExpand", true)
+                            ->Attribute(AZ::Edit::Attributes::NameLabelOverride, "")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &MeshOptimizationRule::m_optimizeVertexCache, "Optimize vertex cache",
+                            "Reorder the triangles so they reuse the vertices recently transformed by the GPU.")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &MeshOptimizationRule::m_optimizeOverdraw, "Optimize overdraw",
+                            "Reorder clusters of triangles so the outward facing triangles are drawn first, which reduces overdraw.")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &MeshOptimizationRule::m_overdrawThreshold, "Overdraw threshold",
+                            "How much the vertex cache efficiency may degrade to reduce overdraw. 1.05 allows 5% more vertex cache misses.")
+                            ->Attribute(AZ::Edit::Attributes::Min, 1.0f)
+                            ->Attribute(AZ::Edit::Attributes::Max, 3.0f)
+                            ->Attribute(AZ::Edit::Attributes::Step, 0.01f)
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &MeshOptimizationRule::m_optimizeVertexFetch, "Optimize vertex fetch",
+                            "Reorder the vertices in the order they are first used by the triangles. Meshes with morph targets keep their vertex order.")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &MeshOptimizationRule::m_use16BitIndices, "Use 16-bit indices",
+                            "Use 16-bit indices when every mesh of a level of detail has less than 65536 vertices.")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &MeshOptimizationRule::m_quantizeVertexAttributes, "Quantize vertex attributes",
+                            "Store normals, tangents and bitangents as 16-bit normalized integers and UVs as 16-bit floats. "
+                            "Skinned, morphed and cloth meshes keep 32-bit floats since they are processed by compute shaders, and so do the "
+                            "attributes which are out of the range of the quantized formats. Leave this off for models used with ray tracing, "
+                            "which reads the vertex streams as 32-bit floats.");
+                }
+            }
+        } // SceneData
+    } // SceneAPI
+} // AZ
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <SceneAPI/SceneCore/DataTypes/Rules/IRule.h>
+#include <SceneAPI/SceneData/SceneDataConfiguration.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace SceneAPI
+    {
+        namespace SceneData
+        {
+            //! The MeshOptimizationRule class contains the settings of the optimization stage of the model builder
+            //! for one particular mesh group in the scene. Without this rule, the index and vertex streams are
+            //! emitted in source order with full precision attributes.
+            class SCENE_DATA_CLASS MeshOptimizationRule
+                : public DataTypes::IRule
+            {
+            public:
+                AZ_RTTI(MeshOptimizationRule, "{3A1E0C5B-7F62-4D0B-9C3E-5B8A2D4F6E71}", DataTypes::IRule);
+                AZ_CLASS_ALLOCATOR(MeshOptimizationRule, AZ::SystemAllocator)
+
+                SCENE_DATA_API MeshOptimizationRule() = default;
+                SCENE_DATA_API ~MeshOptimizationRule() override = default;
+
+                //! Reorder the triangles so they reuse the vertices in the post-transform vertex cache.
+                SCENE_DATA_API bool GetOptimizeVertexCache() const;
+                SCENE_DATA_API void SetOptimizeVertexCache(bool value);
+
+                //! Reorder clusters of triangles so the outward facing ones are drawn first, to reduce overdraw.
+                SCENE_DATA_API bool GetOptimizeOverdraw() const;
+                SCENE_DATA_API void SetOptimizeOverdraw(bool value);
+
+                //! How much the vertex cache efficiency (ACMR) may degrade to reduce overdraw. 1.05 allows 5% more cache misses.
+                SCENE_DATA_API float GetOverdrawThreshold() const;
+                SCENE_DATA_API void SetOverdrawThreshold(float value);
+
+                //! Reorder the vertices in the order the triangles first use them, for better memory locality.
+                SCENE_DATA_API bool GetOptimizeVertexFetch() const;
+                SCENE_DATA_API void SetOptimizeVertexFetch(bool value);
+
+                //! Use 16-bit indices for the level of details with less than 65536 vertices per mesh.
+                SCENE_DATA_API bool GetUse16BitIndices() const;
+                SCENE_DATA_API void SetUse16BitIndices(bool value);
+
+                //! Store normals, tangents and bitangents as 16-bit normalized integers and UVs as 16-bit floats.
+                SCENE_DATA_API bool GetQuantizeVertexAttributes() const;
+                SCENE_DATA_API void SetQuantizeVertexAttributes(bool value);
+
+                static void Reflect(ReflectContext* context);
+
+            protected:
+                bool m_optimizeVertexCache = true;
+                bool m_optimizeOverdraw = true;
+                float m_overdrawThreshold = 1.05f;
+                bool m_optimizeVertexFetch = true;
+                bool m_use16BitIndices = true;
+                bool m_quantizeVertexAttributes = false;
+            };
+        } // SceneData
+    } // SceneAPI
+} // AZ
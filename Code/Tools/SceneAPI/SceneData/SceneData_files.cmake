@@ -57,6 +57,8 @@ set(FILES
     Rules/StaticMeshAdvancedRule.cpp
     Rules/MaterialRule.h
     Rules/MaterialRule.cpp
+    Rules/MeshOptimizationRule.h
+    Rules/MeshOptimizationRule.cpp
     Rules/ScriptProcessorRule.h
     Rules/ScriptProcessorRule.cpp
     Rules/SkeletonProxyRule.h
@@ -8,13 +8,13 @@
 
 #include <astcenc.h>
 
-#include <AzCore/Jobs/JobCompletion.h>
-#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/PlatformIncl.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Compressors/ASTCCompressor.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/ImageParallel.h>
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
 
@@ -171,7 +171,7 @@ namespace ImageProcessingAtom
         const astcenc_profile profile = GetAstcProfile(srcImage->HasImageFlags(EIF_SRGBRead), srcImage->HasImageFlags(EIF_HDR));
 
         astcenc_config config;
-        astcenc_error status;
+        AZStd::atomic<astcenc_error> status;
         status = astcenc_config_init(profile, dstFormatInfo->blockWidth, dstFormatInfo->blockHeight, 1, quality, flags, &config);
 
         //ASTCENC_FLG_MAP_NORMAL
@@ -184,8 +184,6 @@ namespace ImageProcessingAtom
         status = astcenc_context_alloc(&config, threadCount, &context);
         AZ_Assert( status == ASTCENC_SUCCESS, "ERROR: Codec context alloc failed: %s\n", astcenc_get_error_string(status));
 
-        AZ::Job* currentJob = AZ::JobContext::GetGlobalContext()->GetJobManager().GetCurrentJob();
-
         const astcenc_type dataType =GetAstcDataType(fmtSrc);
 
         // Compress the image for each mips
@@ -209,66 +207,20 @@ namespace ImageProcessingAtom
             dstImage->GetImagePointer(mip, dstMem, dstPitch);
             AZ::u32 dataSize = dstImage->GetMipBufSize(mip);
 
-            if (threadCount == 1)
-            {
-                astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, 0);
-                if (error != ASTCENC_SUCCESS)
-                {
-                    status = error;
-                }
-            }
-            else
-            {
-                AZ::JobCompletion* completionJob = nullptr;
-                if (!currentJob)
-                {
-                    completionJob = aznew AZ::JobCompletion();
-                }
-                // Create jobs for each compression thread
-                for (AZ::u32 threadIdx = 0; threadIdx < threadCount; threadIdx++)
+            // astcenc splits the blocks of the image between the thread indices of the context by itself,
+            // so each index only needs to be run once, on any thread
+            ForEachBlock(threadCount, ParallelBlockCost,
+                [&status, context, &image, &swizzle, dstMem, dataSize](AZ::u32 threadBegin, AZ::u32 threadEnd)
                 {
-                    const auto jobLambda = [&status, context, &image, &swizzle, dstMem, dataSize, threadIdx]()
+                    for (AZ::u32 threadIdx = threadBegin; threadIdx < threadEnd; ++threadIdx)
                     {
                         astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, threadIdx);
                         if (error != ASTCENC_SUCCESS)
                         {
                             status = error;
                         }
-                    };
-
-                    AZ::Job* simulationJob = AZ::CreateJobFunction(AZStd::move(jobLambda), true, nullptr);  //auto-deletes
-
-                    // adds this job as child to current job if there is a current job
-                    // otherwise adds it as a dependent for the complete job
-                    if (currentJob)
-                    {
-                        currentJob->StartAsChild(simulationJob);
                     }
-                    else
-                    {
-                        simulationJob->SetDependent(completionJob);
-                        simulationJob->Start();
-                    }
-
-                    astcenc_error error = astcenc_compress_image(context, &image, &swizzle, dstMem, dataSize, threadIdx);
-                    if (error != ASTCENC_SUCCESS)
-                    {
-                        status = error;
-                    }
-                }
-                
-                if (currentJob)
-                {
-                    currentJob->WaitForChildren();
-                }
-
-                if (completionJob)
-                {
-                    completionJob->StartAndWaitForCompletion();
-                    delete completionJob;
-                    completionJob = nullptr;
-                }
-            }
+                });
 
             if (status != ASTCENC_SUCCESS)
             {
@@ -342,50 +342,59 @@ namespace ImageProcessingAtom
             uint32 dwDstPitch;
             dstImage->GetImagePointer(dwMip, pDstMem, dwDstPitch);
 
-            {
-                CrySquisherCallbackUserData userData;
-                userData.m_pImageObject = dstImage;
-                userData.m_dstOffset = 0;
-                userData.m_dstMem = pDstMem;
-
-                CryTextureSquisher::CompressorParameters compress;
+            CryTextureSquisher::CompressorParameters compress;
 
-                compress.srcBuffer = pSrcMem;
-                compress.width = dwLocalWidth;
-                compress.height = dwLocalHeight;
-                compress.pitch = dwSrcPitch;
+            compress.srcBuffer = pSrcMem;
+            compress.width = dwLocalWidth;
+            compress.height = dwLocalHeight;
+            compress.pitch = dwSrcPitch;
 
-                compress.srcType = (CPixelFormats::GetInstance().IsFormatFloatingPoint(fmtSrc, true) ?
-                                    CryTextureSquisher::eBufferType_ufloat : CryTextureSquisher::eBufferType_uint8);
-                if (CPixelFormats::GetInstance().IsFormatSigned(fmtDst))
-                {
-                    compress.srcType = (compress.srcType == CryTextureSquisher::eBufferType_ufloat ?
-                                        CryTextureSquisher::eBufferType_sfloat : CryTextureSquisher::eBufferType_sint8);
-                }
+            compress.srcType = (CPixelFormats::GetInstance().IsFormatFloatingPoint(fmtSrc, true) ?
+                                CryTextureSquisher::eBufferType_ufloat : CryTextureSquisher::eBufferType_uint8);
+            if (CPixelFormats::GetInstance().IsFormatSigned(fmtDst))
+            {
+                compress.srcType = (compress.srcType == CryTextureSquisher::eBufferType_ufloat ?
+                                    CryTextureSquisher::eBufferType_sfloat : CryTextureSquisher::eBufferType_sint8);
+            }
 
-                const AZ::Vector3 uniform = AZ::Vector3(0.3333f, 0.3334f, 0.3333f);
+            const AZ::Vector3 uniform = AZ::Vector3(0.3333f, 0.3334f, 0.3333f);
 
-                compress.weights[0] = weights.GetX();
-                compress.weights[1] = weights.GetY();
-                compress.weights[2] = weights.GetZ();
+            compress.weights[0] = weights.GetX();
+            compress.weights[1] = weights.GetY();
+            compress.weights[2] = weights.GetZ();
 
-                compress.perceptual =
-                    (compress.weights[0] != uniform.GetX()) ||
-                    (compress.weights[1] != uniform.GetY()) ||
-                    (compress.weights[2] != uniform.GetZ());
+            // note: perceptual weights are global to squish, so CryTextureSquisher serializes perceptual compression
+            compress.perceptual =
+                (compress.weights[0] != uniform.GetX()) ||
+                (compress.weights[1] != uniform.GetY()) ||
+                (compress.weights[2] != uniform.GetZ());
 
-                compress.quality =
-                    (quality == eQuality_Preview ? CryTextureSquisher::eQualityProfile_Low :
-                     (quality == eQuality_Fast ? CryTextureSquisher::eQualityProfile_Low :
-                      (quality == eQuality_Slow ? CryTextureSquisher::eQualityProfile_High :
-                       CryTextureSquisher::eQualityProfile_Medium)));
+            compress.quality =
+                (quality == eQuality_Preview ? CryTextureSquisher::eQualityProfile_Low :
+                 (quality == eQuality_Fast ? CryTextureSquisher::eQualityProfile_Low :
+                  (quality == eQuality_Slow ? CryTextureSquisher::eQualityProfile_High :
+                   CryTextureSquisher::eQualityProfile_Medium)));
 
-                compress.userPtr = &userData;
-                compress.userOutputFunction = CrySquisherOutputCallback;
-                compress.preset = GetCompressPreset(fmtDst, fmtSrc);
+            compress.userOutputFunction = CrySquisherOutputCallback;
+            compress.preset = GetCompressPreset(fmtDst, fmtSrc);
 
-                CryTextureSquisher::Compress(compress);
-            }
+            //compress the tiles of the mip. Each tile is compressed as an image made of its own rows, whose blocks are
+            //output straight to the tile's range of the destination mip
+            ForEachCompressionTile(dwLocalWidth, dwLocalHeight, fmtDst,
+                [&](const CompressionTile& tile)
+                {
+                    CrySquisherCallbackUserData userData;
+                    userData.m_pImageObject = dstImage;
+                    userData.m_dstOffset = 0;
+                    userData.m_dstMem = pDstMem + tile.m_dstOffset;
+
+                    CryTextureSquisher::CompressorParameters tileCompress = compress;
+                    tileCompress.srcBuffer = pSrcMem + static_cast<size_t>(tile.m_pixelRowBegin) * dwSrcPitch;
+                    tileCompress.height = tile.m_pixelRowCount;
+                    tileCompress.userPtr = &userData;
+
+                    CryTextureSquisher::Compress(tileCompress);
+                });
         } // for: all mips
 
         return dstImage;
@@ -8,6 +8,9 @@
 
 
 #include <AzCore/PlatformIncl.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <Processing/ImageParallel.h>
+#include <Processing/PixelFormatInfo.h>
 #include <Compressors/ASTCCompressor.h>
 #include <Compressors/CTSquisher.h>
 #include <Compressors/ISPCTextureCompressor.h>
@@ -43,6 +46,71 @@ namespace ImageProcessingAtom
         return nullptr;
     }
 
+    namespace
+    {
+        //compressing a pixel costs a lot more than the pixel operations ParallelBlockCost is measured in
+        static constexpr AZ::u64 CompressionCostPerPixel = 16;
+
+        AZStd::mutex s_compressionStatsMutex;
+        ICompressor::CompressionStatsList s_compressionStats;
+    }
+
+    void ICompressor::ForEachCompressionTile(AZ::u32 width, AZ::u32 height, EPixelFormat compressedFmt, const CompressionTileFunction& tileFunction)
+    {
+        const PixelFormatInfo* formatInfo = CPixelFormats::GetInstance().GetPixelFormatInfo(compressedFmt);
+        AZ_Assert(formatInfo && formatInfo->bCompressed, "ForEachCompressionTile requires a compressed pixel format");
+
+        const AZ::u32 blockWidth = formatInfo->blockWidth;
+        const AZ::u32 blockHeight = formatInfo->blockHeight;
+        const AZ::u32 blocksPerRow = (width + blockWidth - 1) / blockWidth;
+        const AZ::u32 blockRowCount = (height + blockHeight - 1) / blockHeight;
+        const AZ::u32 blockRowSize = blocksPerRow * formatInfo->bitsPerBlock / 8;
+        const AZ::u64 blockRowCost = aznumeric_cast<AZ::u64>(blocksPerRow) * blockWidth * blockHeight * CompressionCostPerPixel;
+
+        ForEachBlock(blockRowCount, blockRowCost,
+            [&](AZ::u32 blockRowBegin, AZ::u32 blockRowEnd)
+            {
+                CompressionTile tile;
+                tile.m_pixelRowBegin = blockRowBegin * blockHeight;
+                tile.m_pixelRowCount = AZStd::min(blockRowEnd * blockHeight, height) - tile.m_pixelRowBegin;
+                tile.m_dstOffset = blockRowBegin * blockRowSize;
+                tileFunction(tile);
+            });
+    }
+
+    double ICompressor::CompressionStats::GetMegaPixelsPerSecond() const
+    {
+        return m_seconds > 0.0 ? static_cast<double>(m_pixelCount) / (m_seconds * 1000000.0) : 0.0;
+    }
+
+    void ICompressor::AddCompressionStats(const char* compressorName, AZ::u64 pixelCount, double seconds)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(s_compressionStatsMutex);
+        for (CompressionStats& stats : s_compressionStats)
+        {
+            if (strcmp(stats.m_compressorName, compressorName) == 0)
+            {
+                stats.m_pixelCount += pixelCount;
+                stats.m_seconds += seconds;
+                return;
+            }
+        }
+
+        if (s_compressionStats.size() < s_compressionStats.capacity())
+        {
+            CompressionStats& stats = s_compressionStats.emplace_back();
+            stats.m_compressorName = compressorName;
+            stats.m_pixelCount = pixelCount;
+            stats.m_seconds = seconds;
+        }
+    }
+
+    ICompressor::CompressionStatsList ICompressor::GetCompressionStats()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(s_compressionStatsMutex);
+        return s_compressionStats;
+    }
+
     ICompressor::~ICompressor()
     {
     }
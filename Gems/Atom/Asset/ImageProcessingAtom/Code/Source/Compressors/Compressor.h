@@ -12,6 +12,9 @@
 #include <Atom/ImageProcessing/PixelFormats.h>
 #include <Atom/ImageProcessing/ImageObject.h>
 
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/function/function_template.h>
+
 namespace ImageProcessingAtom
 {
     class ICompressor;
@@ -41,6 +44,28 @@ namespace ImageProcessingAtom
             bool discardAlpha = false;
         };
 
+        //a horizontal strip of whole block rows of one mip. Compressed blocks are stored row by row, so the blocks
+        //of a tile occupy one contiguous range of the compressed mip and tiles can be compressed independently.
+        struct CompressionTile
+        {
+            AZ::u32 m_pixelRowBegin = 0;    //first source pixel row of the tile
+            AZ::u32 m_pixelRowCount = 0;    //number of source pixel rows of the tile. Only the last tile may not be a multiple of the block height
+            AZ::u32 m_dstOffset = 0;        //offset in bytes of the first block of the tile in the compressed mip
+        };
+        using CompressionTileFunction = AZStd::function<void(const CompressionTile&)>;
+
+        //compression throughput of one compressor, accumulated over the images it compressed in this process
+        struct CompressionStats
+        {
+            const char* m_compressorName = nullptr;
+            AZ::u64 m_pixelCount = 0;
+            double m_seconds = 0.0;
+
+            double GetMegaPixelsPerSecond() const;
+        };
+        static constexpr size_t MaxCompressionStats = 8;
+        using CompressionStatsList = AZStd::fixed_vector<CompressionStats, MaxCompressionStats>;
+
     public:
         //compress the source image to desired compressed pixel format
         virtual IImageObjectPtr CompressImage(IImageObjectPtr srcImage, EPixelFormat fmtDst, const CompressOption* compressOption) const = 0;
@@ -52,6 +77,15 @@ namespace ImageProcessingAtom
         //find compressor for specified compressed pixel format. isCompressing to indicate if it's for compressing or decompressing
         static ICompressorPtr FindCompressor(EPixelFormat fmt, ColorSpace colorSpace, bool isCompressing);
 
+        //split a width x height mip of the compressed format into tiles and call tileFunction for each of them.
+        //the tiles are processed in parallel on the job system when it's available, and since they don't overlap each call
+        //can write its blocks straight into the destination mip at m_dstOffset.
+        static void ForEachCompressionTile(AZ::u32 width, AZ::u32 height, EPixelFormat compressedFmt, const CompressionTileFunction& tileFunction);
+
+        //add the pixels compressed by a compressor and the time it took to the throughput stats of this process
+        static void AddCompressionStats(const char* compressorName, AZ::u64 pixelCount, double seconds);
+        static CompressionStatsList GetCompressionStats();
+
         virtual ~ICompressor() = 0;
     };
 }; // namespace ImageProcessingAtom
@@ -182,6 +182,29 @@ namespace ImageProcessingAtom
             }
         }
 
+        // Get the encoder settings of the destination format from the profile setters
+        bc6h_enc_settings bc6Settings = {};
+        bc7_enc_settings bc7Settings = {};
+        switch (destinationFormat)
+        {
+        case ePixelFormat_BC3:
+            break;
+        case ePixelFormat_BC6UH:
+            compressionProfile->GetBC6()(&bc6Settings);
+            break;
+        case ePixelFormat_BC7:
+        case ePixelFormat_BC7t:
+            compressionProfile->GetBC7(discardAlpha)(&bc7Settings);
+            break;
+        default:
+        {
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+        break;
+        }
+
         // Allocate the destination image
         IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
 
@@ -189,60 +212,46 @@ namespace ImageProcessingAtom
         const uint32 mipCount = destinationImage->GetMipCount();
         for (uint32_t mip = 0; mip < mipCount; mip++)
         {
-            // Create rgba_surface as input
             uint32 sourcePitch = 0;
             AZ::u8* sourceImageData = nullptr;
             sourceImage->GetImagePointer(mip, sourceImageData, sourcePitch);
-            rgba_surface sourceSurface = {};
-            {
-                sourceSurface.ptr = sourceImageData;
-                sourceSurface.width = sourceImage->GetWidth(mip);
-                sourceSurface.height = sourceImage->GetHeight(mip);
-                sourceSurface.stride = static_cast<int32_t>(sourcePitch);
-            }
+            const uint32 sourceWidth = sourceImage->GetWidth(mip);
 
             // Get the mip image destination pointer
             uint32_t destinationPitch = 0;
             AZ::u8* destinationImageData = nullptr;
             destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
 
-            // Compress with the correct function, depending on the destination format
-            switch (destinationFormat)
-            {
-            case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
-                break;
-            case ePixelFormat_BC6UH:
-            {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
-                // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
-            {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
-
-                // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            default:
-            {
-                // No valid pixel format
-                AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                return nullptr;
-            }
-            break;
-            }
+            // Compress the mip tile by tile, each tile writing its rows of blocks straight into the destination mip
+            ForEachCompressionTile(sourceWidth, sourceImage->GetHeight(mip), destinationFormat,
+                [&](const CompressionTile& tile)
+                {
+                    // Create rgba_surface of the tile rows as input
+                    rgba_surface sourceSurface = {};
+                    {
+                        sourceSurface.ptr = sourceImageData + static_cast<size_t>(tile.m_pixelRowBegin) * sourcePitch;
+                        sourceSurface.width = sourceWidth;
+                        sourceSurface.height = tile.m_pixelRowCount;
+                        sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                    }
+                    AZ::u8* tileDestination = destinationImageData + tile.m_dstOffset;
+
+                    // Compress with the correct function, depending on the destination format
+                    switch (destinationFormat)
+                    {
+                    case ePixelFormat_BC3:
+                        CompressBlocksBC3(&sourceSurface, tileDestination);
+                        break;
+                    case ePixelFormat_BC6UH:
+                        // Compress with BC6 half precision
+                        CompressBlocksBC6H(&sourceSurface, tileDestination, &bc6Settings);
+                        break;
+                    default:
+                        // Compress with BC7
+                        CompressBlocksBC7(&sourceSurface, tileDestination, &bc7Settings);
+                        break;
+                    }
+                });
         }
 
         return destinationImage;
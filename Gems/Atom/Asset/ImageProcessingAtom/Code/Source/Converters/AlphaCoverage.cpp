@@ -7,8 +7,11 @@
  */
 
 
+#include <AzCore/std/parallel/atomic.h>
+
 #include <Processing/ImageObjectImpl.h>
 #include <Processing/ImageConvert.h>
+#include <Processing/ImageParallel.h>
 #include <Processing/PixelFormatInfo.h>
 #include <Converters/PixelOperation.h>
 
@@ -41,16 +44,21 @@ namespace ImageProcessingAtom
             const float fAlphaOffset = textureSetting->ComputeMIPAlphaOffset(mip);
             const float fAlphaScale = ComputeAlphaCoverageScaleFactor(mip, fDesiredAlphaCoverage, fAlphaRef);
 
-            AZ::u8* pixelBuf = m_mips[mip]->m_pData;
+            AZ::u8* mipBuf = m_mips[mip]->m_pData;
             const AZ::u32 pixelCount = GetPixelCount(mip);
 
-            for (AZ::u32 i = 0; i < pixelCount; ++i, pixelBuf += pixelBytes)
-            {
-                float r, g, b, a;
-                pixelOp->GetRGBA(pixelBuf, r, g, b, a);
-                a = AZ::GetMin(a * fAlphaScale + fAlphaOffset, 1.0f);
-                pixelOp->SetRGBA(pixelBuf, r, g, b, a);
-            }
+            ForEachBlock(pixelCount, 1,
+                [&](AZ::u32 pixelBegin, AZ::u32 pixelEnd)
+                {
+                    AZ::u8* pixelBuf = mipBuf + static_cast<size_t>(pixelBegin) * pixelBytes;
+                    for (AZ::u32 i = pixelBegin; i < pixelEnd; ++i, pixelBuf += pixelBytes)
+                    {
+                        float r, g, b, a;
+                        pixelOp->GetRGBA(pixelBuf, r, g, b, a);
+                        a = AZ::GetMin(a * fAlphaScale + fAlphaOffset, 1.0f);
+                        pixelOp->SetRGBA(pixelBuf, r, g, b, a);
+                    }
+                });
         }
     }
 
@@ -93,23 +101,30 @@ namespace ImageProcessingAtom
             return 0;
         }
 
-        uint32 coverage = 0;
+        AZStd::atomic<uint32> coverage{ 0 };
 
         //create pixel operation function
         IPixelOperationPtr pixelOp = CreatePixelOperation(m_pixelFormat);
         //get count of bytes per pixel
         AZ::u32 pixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(m_pixelFormat)->bitsPerBlock / 8;
 
-        AZ::u8* pixelBuf = m_mips[mip]->m_pData;
+        const AZ::u8* mipBuf = m_mips[mip]->m_pData;
         const AZ::u32 pixelCount = GetPixelCount(mip);
 
-        for (AZ::u32 i = 0; i < pixelCount; ++i, pixelBuf += pixelBytes)
-        {
-            float r, g, b, a;
-            pixelOp->GetRGBA(pixelBuf, r, g, b, a);
-            coverage += a > fAlphaRef;
-        }
-
-        return (float)coverage / (float)(pixelCount);
+        ForEachBlock(pixelCount, 1,
+            [&](AZ::u32 pixelBegin, AZ::u32 pixelEnd)
+            {
+                const AZ::u8* pixelBuf = mipBuf + static_cast<size_t>(pixelBegin) * pixelBytes;
+                uint32 blockCoverage = 0;
+                for (AZ::u32 i = pixelBegin; i < pixelEnd; ++i, pixelBuf += pixelBytes)
+                {
+                    float r, g, b, a;
+                    pixelOp->GetRGBA(pixelBuf, r, g, b, a);
+                    blockCoverage += a > fAlphaRef;
+                }
+                coverage += blockCoverage;
+            });
+
+        return (float)coverage.load() / (float)(pixelCount);
     }
 } // namespace ImageProcessingAtom
@@ -10,6 +10,7 @@
 
 #include <Processing/ImageFlags.h>
 #include <Processing/ImageObjectImpl.h>
+#include <Processing/ImageParallel.h>
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
 
@@ -100,14 +101,22 @@ namespace ImageProcessingAtom
                 [[maybe_unused]] const PixelFormatInfo* compressedInfo = CPixelFormats::GetInstance().GetPixelFormatInfo(compressedFmt);
                 if (isSrcUncompressed)
                 {
-                    AZ::u64 startTime = AZStd::GetTimeUTCMilliSecond();
+                    AZ::u64 pixelCount = 0;
+                    for (AZ::u32 mip = 0; mip < Get()->GetMipCount(); ++mip)
+                    {
+                        pixelCount += aznumeric_cast<AZ::u64>(Get()->GetWidth(mip)) * Get()->GetHeight(mip);
+                    }
+
+                    AZ::u64 startTime = AZStd::GetTimeUTCMicroSecond();
                     dstImage = compressor->CompressImage(Get(), fmtDst, &m_compressOption);
-                    AZ::u64 endTime = AZStd::GetTimeUTCMilliSecond();
-                    [[maybe_unused]] double processTime = static_cast<double>(endTime - startTime) / 1000.0;
+                    AZ::u64 endTime = AZStd::GetTimeUTCMicroSecond();
+                    double processTime = static_cast<double>(endTime - startTime) / 1000000.0;
                     if (dstImage)
                     {
-                        AZ_TracePrintf("Image Processing", "Image [%dx%d] was compressed to [%s] format by [%s] in %.3f seconds\n",
-                            Get()->GetWidth(0), Get()->GetHeight(0), compressedInfo->szName, compressor->GetName(), processTime);
+                        ICompressor::AddCompressionStats(compressor->GetName(), pixelCount, processTime);
+                        AZ_TracePrintf("Image Processing", "Image [%dx%d] was compressed to [%s] format by [%s] in %.3f seconds (%.2f MPix/s)\n",
+                            Get()->GetWidth(0), Get()->GetHeight(0), compressedInfo->szName, compressor->GetName(), processTime,
+                            processTime > 0.0 ? static_cast<double>(pixelCount) / (processTime * 1000000.0) : 0.0);
                     }
                 }
                 else
@@ -153,23 +162,29 @@ namespace ImageProcessingAtom
         uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
 
         const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
-            uint8* srcPixelBuf;
+            uint8* srcMipBuf;
             uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
+            srcImage->GetImagePointer(dwMip, srcMipBuf, srcPitch);
+            uint8* dstMipBuf;
             uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
+            dstImage->GetImagePointer(dwMip, dstMipBuf, dstPitch);
 
             const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
 
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
-            {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+            ForEachBlock(pixelCount, 1,
+                [&](uint32 pixelBegin, uint32 pixelEnd)
+                {
+                    const uint8* srcPixelBuf = srcMipBuf + static_cast<size_t>(pixelBegin) * srcPixelBytes;
+                    uint8* dstPixelBuf = dstMipBuf + static_cast<size_t>(pixelBegin) * dstPixelBytes;
+                    float r, g, b, a;
+                    for (uint32 i = pixelBegin; i < pixelEnd; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+                    {
+                        srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
+                        dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
+                    }
+                });
         }
 
         m_img = dstImage;
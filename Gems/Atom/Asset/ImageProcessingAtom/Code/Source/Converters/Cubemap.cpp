@@ -12,6 +12,7 @@
 #include <Processing/PixelFormatInfo.h>
 #include <Processing/ImageConvert.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/ImageParallel.h>
 
 #include <Compressors/Compressor.h>
 #include <Converters/PixelOperation.h>
@@ -550,29 +551,34 @@ namespace ImageProcessingAtom
         IImageObjectPtr mippedSourceImage(IImageObject::CreateImage(outWidth, outHeight, maxMipCount, srcPixelFormat));
         mippedSourceImage->CopyPropertiesFrom(m_image->Get());
 
-        for (int iSide = 0; iSide < 6; ++iSide)
-        {
-            for (int iMip = 0; iMip < (int)maxMipCount; iMip++)
+        // every face of every mip is filtered from the source image, so they are independent and can be generated in parallel
+        ForEachBlock(6 * maxMipCount, ParallelBlockCost,
+            [&](AZ::u32 faceMipBegin, AZ::u32 faceMipEnd)
             {
-                QRect srcRect;
-                QRect dstRect;
+                for (AZ::u32 faceMip = faceMipBegin; faceMip < faceMipEnd; ++faceMip)
+                {
+                    const int iSide = faceMip / maxMipCount;
+                    const int iMip = faceMip % maxMipCount;
 
-                srcRect.setLeft(0);
-                srcRect.setRight(srcFaceSize);
-                srcRect.setTop(iSide * srcFaceSize);
-                srcRect.setBottom((iSide + 1) * srcFaceSize);
+                    QRect srcRect;
+                    QRect dstRect;
 
-                AZ::u32 mipFaceSize = outFaceSize >> iMip;
+                    srcRect.setLeft(0);
+                    srcRect.setRight(srcFaceSize);
+                    srcRect.setTop(iSide * srcFaceSize);
+                    srcRect.setBottom((iSide + 1) * srcFaceSize);
 
-                dstRect.setLeft(0);
-                dstRect.setRight(mipFaceSize);
-                dstRect.setTop(iSide * mipFaceSize);
-                dstRect.setBottom((iSide + 1) * mipFaceSize);
+                    AZ::u32 mipFaceSize = outFaceSize >> iMip;
 
-                MipGenType mipGenType = (iMip == 0 ? MipGenType::point : MipGenType::box);
-                FilterImage(mipGenType, MipGenEvalType::sum, 0, 0, m_image->Get(), 0, mippedSourceImage, iMip, &srcRect, &dstRect);
-            }
-        }
+                    dstRect.setLeft(0);
+                    dstRect.setRight(mipFaceSize);
+                    dstRect.setTop(iSide * mipFaceSize);
+                    dstRect.setBottom((iSide + 1) * mipFaceSize);
+
+                    MipGenType mipGenType = (iMip == 0 ? MipGenType::point : MipGenType::box);
+                    FilterImage(mipGenType, MipGenEvalType::sum, 0, 0, m_image->Get(), 0, mippedSourceImage, iMip, &srcRect, &dstRect);
+                }
+            });
 
         //replace the source cubemap with the mipped version
         delete srcCubemap;
@@ -584,25 +590,29 @@ namespace ImageProcessingAtom
         CubemapLayout* dstCubemap = CubemapLayout::CreateCubemapLayout(outImage);
         AZ::u32 dstMipCount = outImage->GetMipCount();
 
-        //filter mip 0 from source to destination
-        for (int iSide = 0; iSide < 6; ++iSide)
-        {
-            QRect srcRect;
-            QRect dstRect;
+        //filter mip 0 from source to destination, one face per job
+        ForEachBlock(6, ParallelBlockCost,
+            [&](AZ::u32 sideBegin, AZ::u32 sideEnd)
+            {
+                for (AZ::u32 iSide = sideBegin; iSide < sideEnd; ++iSide)
+                {
+                    QRect srcRect;
+                    QRect dstRect;
 
-            srcRect.setLeft(0);
-            srcRect.setRight(srcFaceSize);
-            srcRect.setTop(iSide * srcFaceSize);
-            srcRect.setBottom((iSide + 1) * srcFaceSize);
+                    srcRect.setLeft(0);
+                    srcRect.setRight(srcFaceSize);
+                    srcRect.setTop(iSide * srcFaceSize);
+                    srcRect.setBottom((iSide + 1) * srcFaceSize);
 
-            dstRect.setLeft(0);
-            dstRect.setRight(outFaceSize);
-            dstRect.setTop(iSide * outFaceSize);
-            dstRect.setBottom((iSide + 1) * outFaceSize);
+                    dstRect.setLeft(0);
+                    dstRect.setRight(outFaceSize);
+                    dstRect.setTop(iSide * outFaceSize);
+                    dstRect.setBottom((iSide + 1) * outFaceSize);
 
-            FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, 0, 0, m_image->Get(), 0,
-                outImage, 0, &srcRect, &dstRect);
-        }
+                    FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, 0, 0, m_image->Get(), 0,
+                        outImage, 0, &srcRect, &dstRect);
+                }
+            });
 
         CCubeMapProcessor  atiCubemanGen;
         //ATI's cubemap generator to filter the image edges to avoid seam problem
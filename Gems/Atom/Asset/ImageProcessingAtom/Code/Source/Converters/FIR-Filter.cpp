@@ -7,10 +7,12 @@
  */
 
 
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/base.h>
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Processing/ImageConvert.h>
+#include <Processing/ImageParallel.h>
 #include <Processing/ImageToProcess.h>
 
 #include <Converters/FIR-Windows.h>
@@ -205,386 +207,6 @@ namespace ImageProcessingAtom
         DataType*** rows;
     };
 
-    /* #################################################################################################################### \
-     */
-    #define filterTVariables(filterVxNNum, dtyp, wtyp, reps)                                                                                                                                   \
-        /* addition of c-pointers already takes care of datatype-sizes */                                                                                                                      \
-        const signed long int dy = /*parm->mirror ? -1 :*/ 1;                                                                                                                                  \
-        const unsigned int stridei = parm->incols  * 1 * 1;                                                                                                                                    \
-        [[maybe_unused]] const unsigned int stridet = parm->subcols * 1 * 1;                                                                                                                   \
-        [[maybe_unused]] const unsigned int strideo = parm->outcols * 1 * 1;                                                                                                                   \
-        /* offset and shift calculations still require the unmodified values */                                                                                                                \
-        const unsigned int strideiraw = parm->incols;                                                                                                                                          \
-        [[maybe_unused]] const unsigned int stridetraw = parm->subcols;                                                                                                                        \
-        const unsigned int strideoraw = parm->outcols;                                                                                                                                         \
-                                                                                                                                                                                               \
-        class Plane2D<dtyp> tmp(tmpcols, tmprows, 4);                                                                                                                                          \
-        dtyp*** t = (dtyp***)tmp;                                                                                                                                                              \
-        int srcPos, dstPos;                                                                                                                                                                    \
-        bool plusminush = false; [[maybe_unused]] const bool of = true;                                                                                                                        \
-        bool plusminusv = false; [[maybe_unused]] const bool nc = false;                                                                                                                       \
-        FilterWeights<wtyp>* fwh = calculateFilterWeights<wtyp>(parm->resample.colrem, parm->caged ? 0 : 0 - parm->region.subtop, parm->caged ? srccols : parm->subrows - parm->region.subtop, \
-            parm->resample.colquo,               0,               dstcols, reps, parm->resample.colblur, parm->resample.wf, parm->resample.operation != eWindowEvaluation_Sum, plusminush);    \
-        FilterWeights<wtyp>* fwv = calculateFilterWeights<wtyp>(parm->resample.rowrem, parm->caged ? 0 : 0 - parm->region.intop, parm->caged ? srcrows : parm->inrows  - parm->region.intop,   \
-            parm->resample.rowquo,               0,               dstrows, reps, parm->resample.rowblur, parm->resample.wf, parm->resample.operation != eWindowEvaluation_Sum, plusminusv);    \
-
-    #define filterFTVariables(filterVxNNum) \
-        filterTVariables(filterVxNNum, float, signed short, 1)
-
-    /* #################################################################################################################### \
-     */
-    #define filterTCleanUp(filterVxNNum) \
-        delete[] fwh;                    \
-        delete[] fwv;
-
-    /* #################################################################################################################### \
-     */
-    #define filterTInitLoop()
-
-    /* ******************************************************************************************************************** \
-     */
-    #define filterTExitLoop()
-
-    /* #################################################################################################################### \
-     */
-    #define filter4xNf(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip, init, next, fetch, store, exit, op, pm, hv, dtyp, atyp) \
-        init(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);                                                                  \
-                                                                                                                                     \
-        dstPos = 0; do {                                                                                                             \
-            FilterWeights<signed short>& fw = *(hv + dstPos);                                                                        \
-            const signed short* w = fw.weights;                                                                                      \
-                                                                                                                                     \
-            next(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);                                                              \
-                                                                                                                                     \
-            atyp res0 = (op != eWindowEvaluation_Min ? 0 : 32768);                                                                   \
-            atyp res1 = (op != eWindowEvaluation_Min ? 0 : 32768);                                                                   \
-            atyp res2 = (op != eWindowEvaluation_Min ? 0 : 32768);                                                                   \
-            atyp res3 = (op != eWindowEvaluation_Min ? 0 : 32768);                                                                   \
-                                                                                                                                     \
-            srcPos = fw.first; do {                                                                                                  \
-                /* get value */                                                                                                      \
-                fetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);                                                         \
-                                                                                                                                     \
-                /* build result using sign inverted weights [32767,-32768] */                                                        \
-                if constexpr (op == eWindowEvaluation_Sum) {                                                                         \
-                    res0 -= ((atyp)_0 * *w);                                                                                         \
-                    res1 -= ((atyp)_1 * *w);                                                                                         \
-                    res2 -= ((atyp)_2 * *w);                                                                                         \
-                    res3 -= ((atyp)_3 * *w++);                                                                                       \
-                }                                                                                                                    \
-                else if constexpr (op == eWindowEvaluation_Max) {                                                                    \
-                    res0 = maximum(res0, -(atyp)_0 * *w);                                                                            \
-                    res1 = maximum(res1, -(atyp)_1 * *w);                                                                            \
-                    res2 = maximum(res2, -(atyp)_2 * *w);                                                                            \
-                    res3 = maximum(res3, -(atyp)_3 * *w++);                                                                          \
-                }                                                                                                                    \
-                else if constexpr (op == eWindowEvaluation_Min) {                                                                    \
-                    res0 = (atyp)32768.0 - maximum((atyp)32768.0 - res0, -(atyp)(1.0f - _0) * *w);                                   \
-                    res1 = (atyp)32768.0 - maximum((atyp)32768.0 - res1, -(atyp)(1.0f - _1) * *w);                                   \
-                    res2 = (atyp)32768.0 - maximum((atyp)32768.0 - res2, -(atyp)(1.0f - _2) * *w);                                   \
-                    res3 = (atyp)32768.0 - maximum((atyp)32768.0 - res3, -(atyp)(1.0f - _3) * *w++);                                 \
-                }                                                                                                                    \
-            } while (++srcPos < fw.last);                                                                                            \
-                                                                                                                                     \
-            /*  dtyp _0 = ldexp((dtyp)res0, -15);   */                                                                               \
-            /*  dtyp _1 = ldexp((dtyp)res1, -15);   */                                                                               \
-            /*  dtyp _2 = ldexp((dtyp)res2, -15);   */                                                                               \
-            /*  dtyp _3 = ldexp((dtyp)res3, -15);   */                                                                               \
-                                                                                                                                     \
-            dtyp _0 = (dtyp)res0 * (dtyp)(1.0 / 32768.0);                                                                            \
-            dtyp _1 = (dtyp)res1 * (dtyp)(1.0 / 32768.0);                                                                            \
-            dtyp _2 = (dtyp)res2 * (dtyp)(1.0 / 32768.0);                                                                            \
-            dtyp _3 = (dtyp)res3 * (dtyp)(1.0 / 32768.0);                                                                            \
-                                                                                                                                     \
-            /* put value */                                                                                                          \
-            store(srcOffs, srcSize, srcSkip, dstOffs,   dstSize, dstSkip);                                                           \
-        } while (++dstPos < (signed)dstSize);                                                                                        \
-                                                                                                                                     \
-        exit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);
-
-    #define filterF4xNHor(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip, init, next, fetch, store, exit, op, pm) \
-        filter4xNf(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip, init, next, fetch, store, exit, op, 0, fwh, float, float /*double*/)
-
-    #define filterF4xNVer(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip, init, next, fetch, store, exit, op, pm) \
-        filter4xNf(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip, init, next, fetch, store, exit, op, 0, fwv, float, float /*double*/)
-
-    /* #################################################################################################################### \
-     */
-    #define resampleF4xNFromPlane(stride)    \
-        float _0, _1, _2, _3;                \
-                                             \
-        _0 = (*i0)[ix], i0 += (stride) * dy; \
-        _1 = (*i1)[ix], i1 += (stride) * dy; \
-        _2 = (*i2)[ix], i2 += (stride) * dy; \
-        _3 = (*i3)[ix], i3 += (stride) * dy;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define resampleF4xNFromStream(stride, instream) \
-        float _0, _1, _2, _3;                        \
-                                                     \
-        _0 = instream[0];                            \
-        _1 = instream[1];                            \
-        _2 = instream[2];                            \
-        _3 = instream[3], instream += (stride) * 4;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define resampleF4xNFromStreamSwapped(stride, instream) \
-        float _0, _1, _2, _3;                               \
-                                                            \
-        _3 = instream[0];                                   \
-        _2 = instream[1];                                   \
-        _1 = instream[2];                                   \
-        _0 = instream[3], instream += (stride) * 4;
-
-    /* #################################################################################################################### \
-     */
-    #define resampleF4xNToPlane(stride) \
-        (*o0)[ox] = _0;                 \
-        (*o1)[ox] = _1;                 \
-        (*o2)[ox] = _2;                 \
-        (*o3)[ox] = _3, ox += (1) * 1;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define resampleF4xNToStream(stride, outstream) \
-        outstream[0] = _0;                          \
-        outstream[1] = _1;                          \
-        outstream[2] = _2;                          \
-        outstream[3] = _3, outstream += (1) * 4;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define resampleF4xNToStreamSwapped(stride, outstream) \
-        outstream[0] = _3;                                 \
-        outstream[1] = _2;                                 \
-        outstream[2] = _1;                                 \
-        outstream[3] = _0, outstream += (1) * 4;
-
-    /* #################################################################################################################### \
-     */
-    #undef  filterF4xNFromPlane
-    #define filterF4xNFromPlane(stride) \
-        resampleF4xNFromPlane(stride)
-
-    /* ******************************************************************************************************************** \
-     */
-    #undef  filterF4xNFromStream
-    #define filterF4xNFromStream(stride, instream) \
-        resampleF4xNFromStream(stride, instream)
-
-    /* ******************************************************************************************************************** \
-     */
-    #undef  filterF4xNFromStreamSwapped
-    #define filterF4xNFromStreamSwapped(stride, instream) \
-        resampleF4xNFromStreamSwapped(stride, instream)
-
-    /* #################################################################################################################### \
-     */
-    #undef  filterF4xNToPlane
-    #define filterF4xNToPlane(stride) \
-        resampleF4xNToPlane(stride)
-
-    /* ******************************************************************************************************************** \
-     */
-    #undef  filterF4xNToStream
-    #define filterF4xNToStream(stride, outstream) \
-        resampleF4xNToStream(stride, outstream)
-
-    /* ******************************************************************************************************************** \
-     */
-    #undef  filterF4xNToStreamSwapped
-    #define filterF4xNToStreamSwapped(stride, outstream) \
-        resampleF4xNToStreamSwapped(stride, outstream)
-
-    /* #################################################################################################################### \
-     */
-    #define loopEnter(id, untill, advance) \
-        unsigned int id; for (id = 0; id < untill; id += advance) {
-    #define loopLeave(id, untill, advance) \
-        }
-
-    /* #################################################################################################################### \
-     */
-    #define all4InitSwappablePlanePointers(left, top, row, rows, pp, swap, dtyp)                       \
-        dtyp* pp##0, *pp##1, *pp##2, *pp##3;                                                           \
-                                                                                                       \
-        pp##0 = pp[0][/*parm->mirror ? (rows - 1)   - (row + top) :*/ (row + top)] + left;     /* r */ \
-        pp##1 = pp[1][/*parm->mirror ? (rows - 1)   - (row + top) :*/ (row + top)] + left;     /* g */ \
-        pp##2 = pp[2][/*parm->mirror ? (rows - 1)   - (row + top) :*/ (row + top)] + left;     /* b */ \
-        pp##3 = pp[3][/*parm->mirror ? (rows - 1)   - (row + top) :*/ (row + top)] + left;     /* a */
-
-    #define allF4InitSwappablePlanePointers(left, top, row, rows, pp, swap) \
-        all4InitSwappablePlanePointers(left, top, row, rows, pp, swap, float)
-
-    /* #################################################################################################################### \
-     */
-    #define all4InitFixedPlanePointers(left, top, row, rows, pp, swap, dtyp) \
-        dtyp* pp##0, *pp##1, *pp##2, *pp##3;                                 \
-                                                                             \
-        pp##0 = pp[0][(row + top)] + left;      /* r */                      \
-        pp##1 = pp[1][(row + top)] + left;      /* g */                      \
-        pp##2 = pp[2][(row + top)] + left;      /* b */                      \
-        pp##3 = pp[3][(row + top)] + left;      /* a */
-
-    #define allF4InitFixedPlanePointers(left, top, row, rows, pp, swap) \
-        all4InitFixedPlanePointers(left, top, row, rows, pp, swap, float)
-
-    /* #################################################################################################################### \
-     */
-    #define all4InitSwappablePlaneReferences(left, offs, top, row, rows, pp, swap, dtyp)         \
-        unsigned long int pp##x = left + offs;                                                   \
-        dtyp** pp##0;                                                                            \
-        dtyp** pp##1;                                                                            \
-        dtyp** pp##2;                                                                            \
-        dtyp** pp##3;                                                                            \
-                                                                                                 \
-        pp##0 = pp[0] + (/*parm->mirror ? (rows - 1) - (row + top) :*/ (row + top));     /* r */ \
-        pp##1 = pp[1] + (/*parm->mirror ? (rows - 1) - (row + top) :*/ (row + top));     /* g */ \
-        pp##2 = pp[2] + (/*parm->mirror ? (rows - 1) - (row + top) :*/ (row + top));     /* b */ \
-        pp##3 = pp[3] + (/*parm->mirror ? (rows - 1) - (row + top) :*/ (row + top));     /* a */
-
-    #define allF4InitSwappablePlaneReferences(left, offs, top, row, rows, pp, swap) \
-        all4InitSwappablePlaneReferences(left, offs, top, row, rows, pp, swap, float)
-
-    /* #################################################################################################################### \
-     */
-    #define all4InitFixedPlaneReferences(left, row, rows, pp, ps, dtyp) \
-        unsigned long int pp##x = left;                                 \
-        dtyp** pp##0;                                                   \
-        dtyp** pp##1;                                                   \
-        dtyp** pp##2;                                                   \
-        dtyp** pp##3;                                                   \
-                                                                        \
-        pp##0 = ps[0] + (row);      /* r */                             \
-        pp##1 = ps[1] + (row);      /* g */                             \
-        pp##2 = ps[2] + (row);      /* b */                             \
-        pp##3 = ps[3] + (row);      /* a */
-
-    #define allF4InitFixedPlaneReferences(left, row, rows, pp, ps) \
-        all4InitFixedPlaneReferences(left, row, rows, pp, ps, float)
-
-    /* #################################################################################################################### \
-     */
-    #define allF4AdvanceSwappablePlaneReferences(row, rows, pp) \
-        pp##0 += (rows - row) * dy;                     /* r */ \
-        pp##1 += (rows - row) * dy;                     /* g */ \
-        pp##2 += (rows - row) * dy;                     /* b */ \
-        pp##3 += (rows - row) * dy;                     /* a */
-
-    /* #################################################################################################################### \
-     */
-    #define allF4AdvanceFixedPlaneReferences(row, rows, pp) \
-        allF4AdvanceSwappablePlaneReferences(row, rows, pp)
-
-    /* #################################################################################################################### \
-     */
-    #define allF4AdvanceStreamPointer(left, col, cols, sp) \
-        sp += ((cols) - (left + col)) * 4;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define allF4AdvNMULStreamPointer(top, stride, sp) \
-        sp -= ((stride) * (top)) * 4;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define allF4AdvPMULStreamPointer(top, stride, sp) \
-        sp += ((stride) * (top)) * 4;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define allF4AdvSUBMStreamPointer(left, top, stride, sp) \
-        sp -= (((stride) * (top)) - (left)) * 4;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define allF4AdvADDMStreamPointer(left, top, stride, sp) \
-        sp += ((left) + ((stride) * (top))) * 4;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define allF4AdvPADDStreamPointer(offs, sp) \
-        sp += (offs) * 4;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define allF4AdvSSUBStreamPointer(top, shift, offs, sp) \
-        sp += (((top) << (shift)) - (offs)) * 4;
-
-    /* ******************************************************************************************************************** \
-     */
-    #define allF4AdvNAMAStreamPointer(left, top, offs, stride, sp) \
-        sp -= ((left) + (((top) + (offs)) * (stride))) * 4;
-
-    /* ################################################################################################################### \
-    */
-    #undef  comcpyFNum
-    #define comcpyFNum                  1
-    #undef  orderedFNum
-    #define orderedFNum                 1
-    #undef  orderedFShift
-    #define orderedFShift               0
-    #undef  interleavedFNum
-    #define interleavedFNum         1
-
-    /* #################################################################################################################### \
-     */
-    #      define allTInitFixedOutPlaneReferences       allF4InitFixedPlaneReferences
-    #      define allTInitFixedInPlaneReferences        allF4InitFixedPlaneReferences
-    #      define allCInitSwappableInPlaneReferences        /*allF4InitSwappablePlaneReferences*/
-    #      define allCInitSwappableOutPlaneReferences       /*allF4InitSwappablePlaneReferences*/
-
-    #      define allCAdvADDMInStreamPointer        allF4AdvADDMStreamPointer
-    #      define allCAdvPADDInStreamPointer        allF4AdvPADDStreamPointer
-    #      define allCAdvPMULInStreamPointer        allF4AdvPMULStreamPointer
-    #      define allCAdvNMULInStreamPointer        allF4AdvNMULStreamPointer
-    #      define allCAdvADDMOutStreamPointer       allF4AdvADDMStreamPointer
-    #      define allCAdvSSUBOutStreamPointer       allF4AdvSSUBStreamPointer
-
-    #      define   getCxNFromStreamSwapped     /*filterF4xNFromStreamSwapped*/
-    #      define   getCxNFromStream        filterF4xNFromStream
-    #      define   getCxNFromPlane         /*filterF4xNFromPlane*/
-    #      define   getTxNFromPlane         filterF4xNFromPlane
-
-    #      define   filterHor           filterF4xNHor
-    #      define   filterVer           filterF4xNVer
-
-    #      define   comcpyCCheckHiLo()      /*orderedF4CheckHiLo*/
-    #      define   comcpyCCoVar()          /*orderedF4CoVar*/
-    #      define   comcpyCHistogram()      /*orderedF4Histogram*/
-
-    #      define   putCxNToStreamSwapped       /*filterF4xNToStreamSwapped*/
-    #      define   putCxNToStream          filterF4xNToStream
-    #      define   putCxNToPlane           /*filterF4xNToPlane*/
-    #      define   putTxNToPlane           filterF4xNToPlane
-
-    #    define orderedNum          orderedFNum
-    #    define orderedShift            orderedFShift
-
-    #    define comcpyCMergeHiLo(orderedNum)        /*comcpyFTMergeHiLo*/
-    #    define comcpyCCompleteCoVar(orderedNum)        /*comcpyFTCompleteCoVar*/
-    #    define comcpyCCompleteHistogram(orderedNum)    /*comcpyFTCompleteHistogram*/
-
-    #    define hiloCVariables          /*hiloFTVariables*/
-    #    define covarCVariables         /*covarFTVariables*/
-    #    define histoCVariables         /*histoFTVariables*/
-
-    #    define filterCVariables        filterFTVariables
-
-    #  define   orderedTInitLoop()          /*orderedTInitLoop*/
-    #  define   hiloTInitLoop()             /*hiloTInitLoop*/
-    #  define   covarTInitLoop()              /*covarTInitLoop*/
-    #  define   histoTInitLoop()              /*histoTInitLoop*/
-
-    #  define   orderedTExitLoop()          /*orderedTExitLoop*/
-    #  define   hiloTExitLoop()             /*hiloTExitLoop*/
-    #  define   covarTExitLoop()              /*covarTExitLoop*/
-    #  define   histoTExitLoop()              /*histoTExitLoop*/
-
-    #  define   filterCCleanUp          filterTCleanUp
-
     /* #################################################################################################################### \
      */
 
@@ -752,6 +374,134 @@ namespace ImageProcessingAtom
         AZ_Assert(parm->docols > 0, "%s: Expect column count to be above zero!", __FUNCTION__);
     }
 
+    /* #################################################################################################################### \
+     * SIMD row kernels
+     *
+     * The four channels of a texel are filtered together in one SIMD register. Every lane performs exactly the
+     * same float operations, in the same order, as the scalar per-channel loop did, so the output is bit-identical.
+     */
+    using FilterLanes = AZ::Simd::Vec4;
+
+    /* maximum() from FIR-Weights.h lane by lane, Vec4::Max() differs on signed zeros on some platforms */
+    AZ_FORCE_INLINE static FilterLanes::FloatType filterMaximum(FilterLanes::FloatArgType ths, FilterLanes::FloatArgType tht)
+    {
+        return FilterLanes::Select(ths, tht, FilterLanes::CmpGt(ths, tht));
+    }
+
+    /* flips the sign bit, which is what the unary minus of the scalar code does (0 - x would turn -0 into +0) */
+    AZ_FORCE_INLINE static FilterLanes::FloatType filterNegate(FilterLanes::FloatArgType value)
+    {
+        return FilterLanes::Xor(value, FilterLanes::Splat(-0.0f));
+    }
+
+    /* ******************************************************************************************************************** \
+     * evaluates one filter window, fetchTexel(srcPos) returns the 4 channels of the source texel at srcPos
+     */
+    template<int operation, class FetchTexel>
+    AZ_FORCE_INLINE static FilterLanes::FloatType filterWindow(const FilterWeights<signed short>& fw, const FetchTexel& fetchTexel)
+    {
+        const FilterLanes::FloatType one = FilterLanes::Splat(1.0f);
+        const FilterLanes::FloatType top = FilterLanes::Splat(32768.0f);
+        const signed short* w = fw.weights;
+
+        FilterLanes::FloatType res = FilterLanes::Splat(operation != eWindowEvaluation_Min ? 0.0f : 32768.0f);
+
+        int srcPos = fw.first; do {
+            const FilterLanes::FloatType v = fetchTexel(srcPos);
+            const FilterLanes::FloatType weight = FilterLanes::Splat(static_cast<float>(*w++));
+
+            /* build result using sign inverted weights [32767,-32768] */
+            if constexpr (operation == eWindowEvaluation_Sum)
+            {
+                res = FilterLanes::Sub(res, FilterLanes::Mul(v, weight));
+            }
+            else if constexpr (operation == eWindowEvaluation_Max)
+            {
+                res = filterMaximum(res, FilterLanes::Mul(filterNegate(v), weight));
+            }
+            else if constexpr (operation == eWindowEvaluation_Min)
+            {
+                res = FilterLanes::Sub(top, filterMaximum(FilterLanes::Sub(top, res), FilterLanes::Mul(filterNegate(FilterLanes::Sub(one, v)), weight)));
+            }
+        } while (++srcPos < fw.last);
+
+        return FilterLanes::Mul(res, FilterLanes::Splat((float)(1.0 / 32768.0)));
+    }
+
+    /* ******************************************************************************************************************** \
+     * 1st pass, reading cols, writing rows (xy-flip)
+     *
+     * make srccol x inrow -> dstrow x srccol
+     *
+     * every texel of the temporary row "tmprow" is the vertically filtered source column "tmprow"
+     */
+    template<int operation>
+    static void filterColumnsToRows(const float* i0, unsigned int incols, const FilterWeights<signed short>* fwv, unsigned int dstrows,
+        float* const* t, unsigned int tmprowBegin, unsigned int tmprowEnd)
+    {
+        const ptrdiff_t stridei = static_cast<ptrdiff_t>(incols) * 4;
+
+        for (unsigned int tmprow = tmprowBegin; tmprow < tmprowEnd; ++tmprow)
+        {
+            const float* column = i0 + tmprow * 4;
+            float* out = t[tmprow];
+
+            for (unsigned int dstPos = 0; dstPos < dstrows; ++dstPos)
+            {
+                const FilterLanes::FloatType res = filterWindow<operation>(fwv[dstPos],
+                    [column, stridei](int srcPos) { return FilterLanes::LoadUnaligned(column + srcPos * stridei); });
+                FilterLanes::StoreUnaligned(out + dstPos * 4, res);
+            }
+        }
+    }
+
+    /* ******************************************************************************************************************** \
+     * 2nd pass, reading cols, writing rows (xy-flip)
+     *
+     * make dstrow x srccol -> outcol x dstrow
+     */
+    template<int operation>
+    static void filterColumnsToOutput(const float* const* t, int subtop, const FilterWeights<signed short>* fwh, unsigned int dstcols,
+        float* o0, unsigned int outcols, unsigned int dstrowBegin, unsigned int dstrowEnd)
+    {
+        const float* const* rows = t + subtop;
+
+        for (unsigned int dstrow = dstrowBegin; dstrow < dstrowEnd; ++dstrow)
+        {
+            const unsigned int ix = dstrow * 4;
+            float* out = o0 + static_cast<size_t>(dstrow) * outcols * 4;
+
+            for (unsigned int dstPos = 0; dstPos < dstcols; ++dstPos)
+            {
+                const FilterLanes::FloatType res = filterWindow<operation>(fwh[dstPos],
+                    [rows, ix](int srcPos) { return FilterLanes::LoadUnaligned(rows[srcPos] + ix); });
+                FilterLanes::StoreUnaligned(out + dstPos * 4, res);
+            }
+        }
+    }
+
+    /* ******************************************************************************************************************** \
+     * both passes, each one split into blocks of independent rows which are processed on the job system
+     */
+    template<int operation>
+    static void filterPasses(const float* i0, float* o0, const struct prcparm* parm, float* const* t,
+        const FilterWeights<signed short>* fwh, const FilterWeights<signed short>* fwv, unsigned int tmprows, unsigned int dstrows, unsigned int dstcols)
+    {
+        const AZ::u64 colcost = static_cast<AZ::u64>(dstrows) * maximum(fwv[0].last - fwv[0].first, 1);
+        ForEachBlock(tmprows, colcost,
+            [=](AZ::u32 tmprowBegin, AZ::u32 tmprowEnd)
+            {
+                filterColumnsToRows<operation>(i0, parm->incols, fwv, dstrows, t, tmprowBegin, tmprowEnd);
+            });
+
+        const AZ::u64 rowcost = static_cast<AZ::u64>(dstcols) * maximum(fwh[0].last - fwh[0].first, 1);
+        ForEachBlock(dstrows, rowcost,
+            [=](AZ::u32 dstrowBegin, AZ::u32 dstrowEnd)
+            {
+                filterColumnsToOutput<operation>(t, parm->region.subtop, fwh, dstcols, o0, parm->outcols, dstrowBegin, dstrowEnd);
+            });
+    }
+
     /* #################################################################################################################### \
      * multi-threadable if needed
      */
@@ -762,7 +512,6 @@ namespace ImageProcessingAtom
         const unsigned int srccols = parm->docols * parm->resample.colrem / parm->resample.colquo;
         const unsigned int dstrows = parm->dorows;
         const unsigned int dstcols = parm->docols;
-        const unsigned int cstZero = 0;
 
         /* temporary buffer region */
         parm->subrows        = srccols;
@@ -780,10 +529,6 @@ namespace ImageProcessingAtom
             /* check for out-of-region access rectangle */
             calculateFilterRange(srccols, oleft, oright, dstcols, 0, dstcols, parm->resample.colblur, parm->resample.wf);
 
-            /* round down left, round up right */
-            oleft  =  oleft                      & (~(orderedNum - 1));
-            oright = (oright + (orderedNum - 1)) & (~(orderedNum - 1));
-
             /* clamp to available image-rectangle */
             if ((oleft  < (signed)parm->region.subtop) ||
                 (oright > (signed)parm->subrows))
@@ -806,277 +551,38 @@ namespace ImageProcessingAtom
          * common resampling
          */
 
-        /* init t */
-        filterCVariables(orderedNum);
+        /* temporary buffer, the 4 channels of a texel are interleaved */
+        Plane2D<float> tmp(tmpcols * 4, tmprows, 1);
+        float*** t = (float***)tmp;
 
-        filterTInitLoop();
+        bool plusminush = false;
+        bool plusminusv = false;
+        FilterWeights<signed short>* fwh = calculateFilterWeights<signed short>(parm->resample.colrem, parm->caged ? 0 : 0 - parm->region.subtop, parm->caged ? srccols : parm->subrows - parm->region.subtop,
+            parm->resample.colquo, 0, dstcols, 1, parm->resample.colblur, parm->resample.wf, parm->resample.operation != eWindowEvaluation_Sum, plusminush);
+        FilterWeights<signed short>* fwv = calculateFilterWeights<signed short>(parm->resample.rowrem, parm->caged ? 0 : 0 - parm->region.intop, parm->caged ? srcrows : parm->inrows - parm->region.intop,
+            parm->resample.rowquo, 0, dstrows, 1, parm->resample.rowblur, parm->resample.wf, parm->resample.operation != eWindowEvaluation_Sum, plusminusv);
 
-        /* --------------------------------------------------------------------------------------------
-         * reading rows, writing cols (xy-flip)
-         *
-         * make srccol x    inrow -> dstrow x srccol
-         *
-         * we are reading vertical, and writing horizontal
-         * in effect we can use fast parallel-reads, but need
-         * slow interleaved-writes
-         * as reads are slower (ask+receive) than writes (send)
-         * this should even be gracefully fast
-         */
-        allCAdvADDMInStreamPointer(parm->region.inleft, parm->region.intop, parm->incols, i);
-
-    #define filterRowInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allTInitFixedOutPlaneReferences(cstZero, srcOffs, -, o, t);
-
-    #define filterRowNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)                                                 \
-        /* every in/out-put may swap */                                                                                         \
-        allCInitSwappableInPlaneReferences(parm->region.inleft, srcOffs, parm->region.intop, fw.first, parm->inrows, i, false); \
-        /* because the filter moves back and forth, we always have to reposition from 0 */                                      \
-        allCAdvPMULInStreamPointer(srcSkip##raw, fw.first, i);
-
-    #define filterRowFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        /* vertical stride, horizontal fetch */                                  \
-        /* getCxNFromStreamSwapped(srcSkip, i); Expands to nothing */            \
-        getCxNFromStream(srcSkip, i);                                            \
-        getCxNFromPlane(1);                                                      \
-                                                                                 \
-        /*srcPos++;*/
-
-    #define filterRowStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)         \
-        /* because the filter moves back and forth, we always have to reposition to 0 */ \
-        allCAdvNMULInStreamPointer(srcSkip##raw, fw.last, i);                            \
-                                                                                         \
-        /* horizontal stride, vertical store */                                          \
-        putTxNToPlane(1);                                                                \
-                                                                                         \
-        /*dstPos++;*/
-
-    #define filterRowExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allCAdvPADDInStreamPointer(orderedNum, i);
+        /* the 1st pass reads all of the input before the 2nd pass writes any output */
+        const float* i0 = i + (static_cast<ptrdiff_t>(parm->region.inleft) + static_cast<ptrdiff_t>(parm->incols) * parm->region.intop) * 4;
+        float* o0 = o + (static_cast<ptrdiff_t>(parm->region.outleft) + static_cast<ptrdiff_t>(parm->outcols) * parm->region.outtop) * 4;
 
         if (parm->resample.operation == eWindowEvaluation_Sum)
         {
-            loopEnter(tmprow, tmprows, orderedNum);
-
-            {
-                filterVer(tmprow, srcrows, stridei,
-                    tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, eWindowEvaluation_Sum, of);
-            }
-
-            loopLeave(tmprow, tmprows, orderedNum);
+            filterPasses<eWindowEvaluation_Sum>(i0, o0, parm, t[0], fwh, fwv, tmprows, dstrows, dstcols);
         }
         else if (parm->resample.operation == eWindowEvaluation_Max)
         {
-            loopEnter(tmprow, tmprows, orderedNum);
-
-            {
-                filterVer(tmprow, srcrows, stridei,
-                    tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, eWindowEvaluation_Max, of);
-            }
-
-            loopLeave(tmprow, tmprows, orderedNum);
+            filterPasses<eWindowEvaluation_Max>(i0, o0, parm, t[0], fwh, fwv, tmprows, dstrows, dstcols);
         }
         else if (parm->resample.operation == eWindowEvaluation_Min)
         {
-            loopEnter(tmprow, tmprows, orderedNum);
-
-            {
-                filterVer(tmprow, srcrows, stridei,
-                    tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, eWindowEvaluation_Min, of);
-            }
-
-            loopLeave(tmprow, tmprows, orderedNum);
+            filterPasses<eWindowEvaluation_Min>(i0, o0, parm, t[0], fwh, fwv, tmprows, dstrows, dstcols);
         }
 
-        /* 1st resampling end
-         * --------------------------------------------------------------------------------------------
-         */
-        filterTExitLoop();
-
-        /* return collected min/max */
-        hiloCVariables(orderedNum);
-        covarCVariables(orderedNum);
-        histoCVariables(orderedNum);
-
-        /* --------------------------------------------------------------- */
-        orderedTInitLoop();
-        filterTInitLoop();
-
-        hiloTInitLoop();
-        covarTInitLoop();
-        histoTInitLoop();
-
-        /* --------------------------------------------------------------------------------------------
-         * reading rows, writing cols (xy-flip)
-         *
-         * make dstrow x srccol -> outcol x dstrow
-         *
-         * we are reading vertical, and writing horizontal
-         * in effect we can use fast parallel-reads, but need
-         * slow interleaved-writes
-         * as reads are slower (ask+receive) than writes (send)
-         * this should even be gracefully fast
-         */
-        allCAdvADDMOutStreamPointer(parm->region.outleft, parm->region.outtop, parm->outcols, o);
-
-    #define filterColInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allCInitSwappableOutPlaneReferences(parm->region.outleft, cstZero, parm->region.outtop, srcOffs, parm->outrows, o, false);
-
-    #define filterColNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        /* every in/out-put may swap */                                         \
-        allTInitFixedInPlaneReferences(srcOffs, parm->region.subtop + fw.first, -, i, t);
-
-    #define filterColFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        /* vertical stride, horizontal fetch */                                  \
-        getTxNFromPlane(1);                                                      \
-                                                                                 \
-        /*srcPos++;*/
-
-    #define filterColStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        comcpyCCheckHiLo();                                                      \
-        comcpyCCoVar();                                                          \
-        comcpyCHistogram();                                                      \
-                                                                                 \
-        /* horizontal stride, vertical store */                                  \
-        /* putCxNToStreamSwapped(dstSkip, o); Expands to nothing */              \
-        putCxNToStream(dstSkip, o);                                              \
-        putCxNToPlane(1);                                                        \
-                                                                                 \
-        /*dstPos++;*/
-
-    #define filterColExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allCAdvSSUBOutStreamPointer(dstSkip##raw, orderedShift, dstPos, o);
-
-        if (parm->resample.operation == eWindowEvaluation_Sum)
-        {
-            loopEnter(dstrow, dstrows, orderedNum);
-
-            {
-                filterHor(dstrow, srccols, stridet,
-                    dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, eWindowEvaluation_Sum, of);
-            }
-
-            loopLeave(dstrow, dstrows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Max)
-        {
-            loopEnter(dstrow, dstrows, orderedNum);
-
-            {
-                filterHor(dstrow, srccols, stridet,
-                    dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, eWindowEvaluation_Max, of);
-            }
-
-            loopLeave(dstrow, dstrows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Min)
-        {
-            loopEnter(dstrow, dstrows, orderedNum);
-
-            {
-                filterHor(dstrow, srccols, stridet,
-                    dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, eWindowEvaluation_Min, of);
-            }
-
-            loopLeave(dstrow, dstrows, orderedNum);
-        }
-
-        /* 2nd resampling end
-         * --------------------------------------------------------------------------------------------
-         */
-        histoTExitLoop();
-        covarTExitLoop();
-        hiloTExitLoop();
-
-        filterTExitLoop();
-        orderedTExitLoop();
-        /* --------------------------------------------------------------- */
-
-        /* return collected min/max */
-        comcpyCMergeHiLo(orderedNum);
-        comcpyCCompleteCoVar(orderedNum);
-        comcpyCCompleteHistogram(orderedNum);
-
-        /* exit t */
-        filterCCleanUp(orderedNum);
+        delete[] fwh;
+        delete[] fwv;
     }
 
-    // TODO: not working yet, debug and enable
-    /*
-      static void SplitAlgorithm(const void* i, void* o, struct prcparm* templ, int threads = 8)
-      {
-          struct prcparm fraction[32];
-          int t, istart = 0, sstart = 0, ostart = 0;
-          const bool scaler = true;
-
-          int theight = 0;
-
-          // prepare data to be emitted to the threads
-          for (t = 0; t < threads; t++)
-          {
-              fraction[t] = *templ;
-
-              // adjust the processing-region according to the available threads
-              {
-      #undef  split       // only prefix-threads need aligned transpose (for not trashing suffix-thread data)
-      #define split(rows) !scaler                                         \
-          ? ((rows * (t + 1)) / threads) & (~(t != threads - 1 ? 15 : 0)) \
-          : ((rows * (t + 1)) / threads) & (~0)
-
-                  // area covered
-                  const int  inrows = (fraction[t].regional ? fraction[t].region.inrows  : fraction[t].inrows);
-                  const int  incols = (fraction[t].regional ? fraction[t].region.incols  : fraction[t].incols);
-                  const int subrows = (fraction[t].regional ? fraction[t].region.subrows : fraction[t].subrows);
-                  const int subcols = (fraction[t].regional ? fraction[t].region.subcols : fraction[t].subcols);
-                  const int outrows = (fraction[t].regional ? fraction[t].region.outrows : fraction[t].outrows);
-                  const int outcols = (fraction[t].regional ? fraction[t].region.outcols : fraction[t].outcols);
-
-                  // splitting blocks
-                  const int istop = split(inrows), sstop = split(subrows), ostop = split(outrows);
-                  const int irows = istop - istart, srows = sstop - sstart, orows = ostop - ostart;
-                  const int icols = incols, scols = subcols, ocols = outcols;
-
-                  AZ_Assert(irows > 0, "%s: Expect row count to be above zero!", __FUNCTION__);
-                  AZ_Assert(orows > 0, "%s: Expect row count to be above zero!", __FUNCTION__);
-                  AZ_Assert(icols > 0, "%s: Expect column count to be above zero!", __FUNCTION__);
-                  AZ_Assert(ocols > 0, "%s: Expect column count to be above zero!", __FUNCTION__);
-
-                  // now we are regional
-                  fraction[t].regional       = true;
-
-                  // take previous regionality into account
-                  fraction[t].region.intop += istart;
-                  fraction[t].region.subtop += sstart;
-                  fraction[t].region.outtop += ostart;
-                  fraction[t].region.inrows = irows;
-                  fraction[t].region.subrows = srows;
-                  fraction[t].region.outrows = orows;
-
-                  // take previous regionality into account
-                  fraction[t].region.inleft += 0;
-                  fraction[t].region.subleft += 0;
-                  fraction[t].region.outleft += 0;
-                  fraction[t].region.incols  = icols;
-                  fraction[t].region.subcols  = scols;
-                  fraction[t].region.outcols  = ocols;
-
-                  // advance block
-                  istart = istop;
-                  sstart = sstop;
-                  ostart = ostop;
-
-                  // check
-                  theight += irows;
-              }
-
-              // the algorithm supports "i" and "o" pointing to the same memory
-              CheckBoundaries((float*)i, (float*)o, &fraction[t]);
-              RunAlgorithm((float*)i, (float*)o, &fraction[t]);
-          }
-
-          AZ_Assert(theight >= (templ->regional ? templ->region.inrows : templ->inrows), "%s: Invalid height!", __FUNCTION__);
-      }
-    */
-
     /* #################################################################################################################### \
      */
     void FilterImage(int filterIndex, int filterOp, float blurH, float blurV, const IImageObjectPtr srcImg, int srcMip,
@@ -1236,9 +742,6 @@ namespace ImageProcessingAtom
                 break;
             }
 
-            // TODO: not working yet, debug and enable
-            //      SplitAlgorithm(pSrcMem, pDestMem, &parm);
-
             // the algorithm supports "pSrcMem" and "pDestMem" pointing to the same memory
             CheckBoundaries((float*)pSrcMem, (float*)pDestMem, &parm);
             RunAlgorithm((float*)pSrcMem, (float*)pDestMem, &parm);
@@ -10,6 +10,7 @@
 #include <Processing/ImageToProcess.h>
 #include <Processing/PixelFormatInfo.h>
 #include <Processing/ImageFlags.h>
+#include <Processing/ImageParallel.h>
 #include <Atom/ImageProcessing/PixelFormats.h>
 #include <AzCore/Math/Color.h>
 
@@ -39,7 +40,6 @@ namespace ImageProcessingAtom
 
         void Initialize() const
         {
-            m_initialized = true;
             AZ_Assert(m_xMin >= 0.0f, "wrong initial data for m_xMin");
             for (int i = 0; i <= TABLE_SIZE; ++i)
             {
@@ -47,6 +47,16 @@ namespace ImageProcessingAtom
                 const float y = (*m_fn)(x);
                 m_table[i] = y;
             }
+            m_initialized = true;
+        }
+
+        // Call before using the table from multiple threads, so compute() never needs to initialize it.
+        void EnsureInitialized() const
+        {
+            if (!m_initialized)
+            {
+                Initialize();
+            }
         }
 
         inline float compute(float x) const
@@ -153,31 +163,39 @@ namespace ImageProcessingAtom
         uint32 srcPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(srcFmt)->bitsPerBlock / 8;
         uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
 
+        s_lutGammaToLinear.EnsureInitialized();
+
         const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
-            uint8* srcPixelBuf;
+            uint8* srcMipBuf;
             uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
+            srcImage->GetImagePointer(dwMip, srcMipBuf, srcPitch);
+            uint8* dstMipBuf;
             uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
+            dstImage->GetImagePointer(dwMip, dstMipBuf, dstPitch);
 
             const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
 
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
-            {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                if (bDeGamma)
+            ForEachBlock(pixelCount, 1,
+                [&](uint32 pixelBegin, uint32 pixelEnd)
                 {
-                    r = s_lutGammaToLinear.compute(r);
-                    g = s_lutGammaToLinear.compute(g);
-                    b = s_lutGammaToLinear.compute(b);
-                }
-
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+                    const uint8* srcPixelBuf = srcMipBuf + static_cast<size_t>(pixelBegin) * srcPixelBytes;
+                    uint8* dstPixelBuf = dstMipBuf + static_cast<size_t>(pixelBegin) * dstPixelBytes;
+                    float r, g, b, a;
+                    for (uint32 i = pixelBegin; i < pixelEnd; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+                    {
+                        srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
+                        if (bDeGamma)
+                        {
+                            r = s_lutGammaToLinear.compute(r);
+                            g = s_lutGammaToLinear.compute(g);
+                            b = s_lutGammaToLinear.compute(b);
+                        }
+
+                        dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
+                    }
+                });
         }
 
         m_img = dstImage;
@@ -214,27 +232,35 @@ namespace ImageProcessingAtom
         //get count of bytes per pixel for both src and dst images
         uint32 pixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(srcFmt)->bitsPerBlock / 8;
 
+        s_lutLinearToGamma.EnsureInitialized();
+
         const uint32 dwMips = srcImage->GetMipCount();
-        float r, g, b, a;
         for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
         {
-            uint8* srcPixelBuf;
+            uint8* srcMipBuf;
             uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
+            srcImage->GetImagePointer(dwMip, srcMipBuf, srcPitch);
+            uint8* dstMipBuf;
             uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
+            dstImage->GetImagePointer(dwMip, dstMipBuf, dstPitch);
 
             const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
 
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += pixelBytes, dstPixelBuf += pixelBytes)
-            {
-                pixelOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                r = s_lutLinearToGamma.compute(r);
-                g = s_lutLinearToGamma.compute(g);
-                b = s_lutLinearToGamma.compute(b);
-                pixelOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+            ForEachBlock(pixelCount, 1,
+                [&](uint32 pixelBegin, uint32 pixelEnd)
+                {
+                    const uint8* srcPixelBuf = srcMipBuf + static_cast<size_t>(pixelBegin) * pixelBytes;
+                    uint8* dstPixelBuf = dstMipBuf + static_cast<size_t>(pixelBegin) * pixelBytes;
+                    float r, g, b, a;
+                    for (uint32 i = pixelBegin; i < pixelEnd; ++i, srcPixelBuf += pixelBytes, dstPixelBuf += pixelBytes)
+                    {
+                        pixelOp->GetRGBA(srcPixelBuf, r, g, b, a);
+                        r = s_lutLinearToGamma.compute(r);
+                        g = s_lutLinearToGamma.compute(g);
+                        b = s_lutLinearToGamma.compute(b);
+                        pixelOp->SetRGBA(dstPixelBuf, r, g, b, a);
+                    }
+                });
         }
 
         m_img = dstImage;
@@ -14,6 +14,7 @@
 #include <AzCore/Debug/Trace.h>
 #include <BuilderSettings/BuilderSettingManager.h>
 #include <BuilderSettings/CubemapSettings.h>
+#include <Compressors/Compressor.h>
 #include <ImageLoader/ImageLoaders.h>
 #include <Processing/ImageAssetProducer.h>
 #include <Processing/ImageConvert.h>
@@ -421,6 +422,29 @@ namespace ImageProcessingAtom
         return;
     }
 
+    // print the throughput of each compressor used since the statsBefore snapshot was taken
+    void ReportCompressionStats(const ICompressor::CompressionStatsList& statsBefore)
+    {
+        for (const ICompressor::CompressionStats& stats : ICompressor::GetCompressionStats())
+        {
+            ICompressor::CompressionStats jobStats = stats;
+            for (const ICompressor::CompressionStats& previousStats : statsBefore)
+            {
+                if (strcmp(previousStats.m_compressorName, stats.m_compressorName) == 0)
+                {
+                    jobStats.m_pixelCount -= previousStats.m_pixelCount;
+                    jobStats.m_seconds -= previousStats.m_seconds;
+                }
+            }
+
+            if (jobStats.m_pixelCount > 0)
+            {
+                AZ_TracePrintf(AssetBuilderSDK::InfoWindow, "Compressor [%s] compressed %llu pixels in %.3f seconds (%.2f MPix/s)\n",
+                    jobStats.m_compressorName, static_cast<unsigned long long>(jobStats.m_pixelCount), jobStats.m_seconds, jobStats.GetMegaPixelsPerSecond());
+            }
+        }
+    }
+
     // later on, this function will be called for jobs that actually need doing.
     // the request will contain the CreateJobResponse you constructed earlier, including any keys and values you placed into the hash table
     void ImageBuilderWorker::ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
@@ -429,6 +453,7 @@ namespace ImageProcessingAtom
         AssetBuilderSDK::JobCancelListener jobCancelListener(request.m_jobId);
 
         AZStd::vector<AZStd::string> productFilepaths;
+        const ICompressor::CompressionStatsList compressionStatsBefore = ICompressor::GetCompressionStats();
         bool imageProcessingSuccessful = false;
         bool needConversion = true;
 
@@ -469,6 +494,7 @@ namespace ImageProcessingAtom
 
         if (imageProcessingSuccessful)
         {
+            ReportCompressionStats(compressionStatsBefore);
             response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
         }
         else
@@ -9,6 +9,7 @@
 #include <Processing/PixelFormatInfo.h>
 #include <Processing/ImageToProcess.h>
 #include <Processing/ImageConvert.h>
+#include <Processing/ImageParallel.h>
 #include <Processing/ImageAssetProducer.h>
 #include <Processing/ImageFlags.h>
 #include <Processing/Utils.h>
@@ -517,10 +518,15 @@ namespace ImageProcessingAtom
         float blurV = 0;
 
         // fill mipmap data for uncompressed output image
-        for (uint32 mip = 0; mip < outImage->GetMipCount(); mip++)
-        {
-            FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, blurH, blurV, m_image->Get(), 0, outImage, mip, nullptr, nullptr);
-        }
+        // every mip is filtered from the source image, so they are independent and can be generated in parallel
+        ForEachBlock(outImage->GetMipCount(), ParallelBlockCost,
+            [&](AZ::u32 mipBegin, AZ::u32 mipEnd)
+            {
+                for (uint32 mip = mipBegin; mip < mipEnd; mip++)
+                {
+                    FilterImage(m_input->m_textureSetting.m_mipGenType, m_input->m_textureSetting.m_mipGenEval, blurH, blurV, m_image->Get(), 0, outImage, mip, nullptr, nullptr);
+                }
+            });
 
         // transfer alpha coverage
         if (m_input->m_textureSetting.m_maintainAlphaCoverage)
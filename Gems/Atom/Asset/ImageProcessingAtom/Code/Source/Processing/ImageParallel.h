@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/algorithm.h>
+
+namespace ImageProcessingAtom
+{
+    //! Approximate amount of work (in "pixel operations") given to each job by ForEachBlock().
+    //! Small enough to balance an 8K image over all the cores, big enough for the job overhead to be irrelevant.
+    static constexpr AZ::u64 ParallelBlockCost = 64 * 1024;
+
+    //! Calls blockFunction(begin, end) over consecutive, non-overlapping ranges that cover [0, count).
+    //! The ranges are processed in parallel on the job system when a global job context exists and the total
+    //! cost (count * costPerItem) is worth splitting; otherwise blockFunction(0, count) runs on the calling thread.
+    //! Each item must be independent from the others, so the result is the same whichever way the work is split.
+    template<class BlockFunction>
+    void ForEachBlock(AZ::u32 count, AZ::u64 costPerItem, const BlockFunction& blockFunction)
+    {
+        const AZ::u32 itemsPerBlock = aznumeric_cast<AZ::u32>(
+            AZStd::clamp<AZ::u64>(ParallelBlockCost / AZStd::max<AZ::u64>(costPerItem, 1), 1, AZStd::max<AZ::u32>(count, 1)));
+        const AZ::u32 blockCount = (count + itemsPerBlock - 1) / itemsPerBlock;
+
+        if (blockCount <= 1 || AZ::JobContext::GetGlobalContext() == nullptr)
+        {
+            blockFunction(0u, count);
+            return;
+        }
+
+        AZ::parallel_for(0, aznumeric_cast<int>(blockCount),
+            [&blockFunction, itemsPerBlock, count](int block)
+            {
+                const AZ::u32 begin = aznumeric_cast<AZ::u32>(block) * itemsPerBlock;
+                blockFunction(begin, AZStd::min(begin + itemsPerBlock, count));
+            });
+    }
+} // namespace ImageProcessingAtom
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Atom/ImageProcessing/ImageObject.h>
+#include <Compressors/Compressor.h>
+#include <Processing/PixelFormatInfo.h>
+
+namespace UnitTest
+{
+    using namespace ImageProcessingAtom;
+
+    // Compresses generated images with the image builder compressors, without any editor or asset system setup.
+    // The items per second reported by the benchmarks are pixels compressed per second.
+    class CompressorBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            InternalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            InternalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void InternalSetUp(const ::benchmark::State& state)
+        {
+            // without a global job context the compressors compress all the tiles on the calling thread
+            if (state.range(1))
+            {
+                AZ::JobManagerDesc jobManagerDesc;
+                for (AZ::u32 i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+                {
+                    jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+                }
+                m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+                m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+                AZ::JobContext::SetGlobalContext(m_jobContext.get());
+            }
+
+            // a noisy pattern, so the compressors can't take shortcuts on flat blocks
+            const AZ::u32 size = aznumeric_cast<AZ::u32>(state.range(0));
+            m_srcImage = IImageObjectPtr(IImageObject::CreateImage(size, size, 1, ePixelFormat_R8G8B8A8));
+            AZ::u8* srcMem;
+            AZ::u32 srcPitch;
+            m_srcImage->GetImagePointer(0, srcMem, srcPitch);
+            for (AZ::u32 i = 0; i < m_srcImage->GetMipBufSize(0); ++i)
+            {
+                srcMem[i] = static_cast<AZ::u8>((i * 7919) % 251);
+            }
+        }
+
+        void InternalTearDown()
+        {
+            m_srcImage = nullptr;
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext = nullptr;
+            m_jobManager = nullptr;
+
+            CPixelFormats::DestroyInstance();
+        }
+
+        void RunCompressBenchmark(::benchmark::State& state, EPixelFormat compressedFormat)
+        {
+            ICompressorPtr compressor = ICompressor::FindCompressor(compressedFormat, ColorSpace::sRGB, true);
+            if (!compressor || compressor->GetSuggestedUncompressedFormat(compressedFormat, ePixelFormat_R8G8B8A8) != ePixelFormat_R8G8B8A8)
+            {
+                state.SkipWithError("No compressor compresses R8G8B8A8 images to the requested format");
+                return;
+            }
+
+            ICompressor::CompressOption option;
+            option.compressQuality = ICompressor::eQuality_Fast;
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                IImageObjectPtr dstImage = compressor->CompressImage(m_srcImage, compressedFormat, &option);
+                benchmark::DoNotOptimize(dstImage.get());
+            }
+
+            state.SetItemsProcessed(state.iterations() * m_srcImage->GetWidth(0) * m_srcImage->GetHeight(0));
+            state.SetLabel(compressor->GetName());
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        IImageObjectPtr m_srcImage;
+    };
+
+    BENCHMARK_DEFINE_F(CompressorBenchmark, BM_CompressBC1)(benchmark::State& state)
+    {
+        RunCompressBenchmark(state, ePixelFormat_BC1);
+    }
+
+    BENCHMARK_DEFINE_F(CompressorBenchmark, BM_CompressBC3)(benchmark::State& state)
+    {
+        RunCompressBenchmark(state, ePixelFormat_BC3);
+    }
+
+    BENCHMARK_DEFINE_F(CompressorBenchmark, BM_CompressBC7)(benchmark::State& state)
+    {
+        RunCompressBenchmark(state, ePixelFormat_BC7);
+    }
+
+    BENCHMARK_DEFINE_F(CompressorBenchmark, BM_CompressASTC4x4)(benchmark::State& state)
+    {
+        RunCompressBenchmark(state, ePixelFormat_ASTC_4x4);
+    }
+
+    // Arguments are the image size and whether the tiles are compressed on the job system (1) or on the calling thread (0)
+    static void CompressorBenchmarkArguments(::benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark->Args({ 256, 0 })->Args({ 256, 1 })->Args({ 1024, 0 })->Args({ 1024, 1 })->Unit(::benchmark::kMillisecond);
+    }
+
+    BENCHMARK_REGISTER_F(CompressorBenchmark, BM_CompressBC1)->Apply(CompressorBenchmarkArguments);
+    BENCHMARK_REGISTER_F(CompressorBenchmark, BM_CompressBC3)->Apply(CompressorBenchmarkArguments);
+    BENCHMARK_REGISTER_F(CompressorBenchmark, BM_CompressBC7)->Apply(CompressorBenchmarkArguments);
+    BENCHMARK_REGISTER_F(CompressorBenchmark, BM_CompressASTC4x4)->Apply(CompressorBenchmarkArguments);
+} // namespace UnitTest
+
+#endif // HAVE_BENCHMARK
@@ -45,6 +45,8 @@
 #include <Compressors/Compressor.h>
 
 #include <Converters/Cubemap.h>
+#include <Converters/FIR-Weights.h>
+#include <Converters/FIR-Windows.h>
 
 #include <BuilderSettings/BuilderSettingManager.h>
 #include <BuilderSettings/CubemapSettings.h>
@@ -952,6 +954,262 @@ namespace UnitTest
         }
     }
 
+    // Straightforward scalar version of the FIR filter from before it was vectorized, for a whole image without regions. Every channel
+    // is filtered on its own, with the same float operations the per-channel loops did, so it is a reference for the SIMD kernels, the
+    // transposed temporary buffer and the split in blocks.
+    static AZStd::vector<float> ReferenceFilterImage(IWindowFunction<double>* windowFunction, int operation, const float* src,
+        int incols, int inrows, int outcols, int outrows)
+    {
+        const int dstrows = outrows;
+        const int dstcols = outcols;
+
+        // the temporary buffer covers the source columns read by the horizontal filter
+        int inleft = 0;
+        int subtop = 0;
+        int subrows = incols;
+        int oleft;
+        int oright;
+        calculateFilterRange(incols, oleft, oright, dstcols, 0, dstcols, 0.0, windowFunction);
+        if (oleft < subtop || oright > subrows)
+        {
+            oleft = maximum<int>(oleft, -inleft);
+            oright = minimum<int>(oright, incols);
+        }
+        inleft += oleft;
+        subtop -= oleft;
+        subrows -= oleft;
+        subrows += (oright - incols);
+
+        bool plusminus = false;
+        FilterWeights<signed short>* fwh = calculateFilterWeights<signed short>(incols, 0 - subtop, subrows - subtop,
+            outcols, 0, dstcols, 1, 0.0, windowFunction, operation != eWindowEvaluation_Sum, plusminus);
+        FilterWeights<signed short>* fwv = calculateFilterWeights<signed short>(inrows, 0, inrows,
+            outrows, 0, dstrows, 1, 0.0, windowFunction, operation != eWindowEvaluation_Sum, plusminus);
+
+        auto filterWindow = [operation](const FilterWeights<signed short>& fw, const auto& fetch)
+        {
+            const signed short* w = fw.weights;
+            float res = (operation != eWindowEvaluation_Min ? 0.0f : 32768.0f);
+            int srcPos = fw.first;
+            do
+            {
+                const float v = fetch(srcPos);
+                if (operation == eWindowEvaluation_Sum)
+                {
+                    res -= (v * *w++);
+                }
+                else if (operation == eWindowEvaluation_Max)
+                {
+                    res = maximum(res, -v * *w++);
+                }
+                else
+                {
+                    res = 32768.0f - maximum(32768.0f - res, -(1.0f - v) * *w++);
+                }
+            } while (++srcPos < fw.last);
+            return res * (float)(1.0 / 32768.0);
+        };
+
+        // vertical pass, one temporary row per source column
+        AZStd::vector<float> tmp(static_cast<size_t>(subrows) * dstrows * 4);
+        for (int tmprow = 0; tmprow < subrows; ++tmprow)
+        {
+            for (int dstPos = 0; dstPos < dstrows; ++dstPos)
+            {
+                for (int c = 0; c < 4; ++c)
+                {
+                    tmp[(static_cast<size_t>(tmprow) * dstrows + dstPos) * 4 + c] = filterWindow(fwv[dstPos],
+                        [&](int srcPos) { return src[(static_cast<size_t>(srcPos) * incols + inleft + tmprow) * 4 + c]; });
+                }
+            }
+        }
+
+        // horizontal pass
+        AZStd::vector<float> dst(static_cast<size_t>(outcols) * outrows * 4);
+        for (int dstrow = 0; dstrow < dstrows; ++dstrow)
+        {
+            for (int dstPos = 0; dstPos < dstcols; ++dstPos)
+            {
+                for (int c = 0; c < 4; ++c)
+                {
+                    dst[(static_cast<size_t>(dstrow) * outcols + dstPos) * 4 + c] = filterWindow(fwh[dstPos],
+                        [&](int srcPos) { return tmp[(static_cast<size_t>(srcPos + subtop) * dstrows + dstrow) * 4 + c]; });
+                }
+            }
+        }
+
+        delete[] fwh;
+        delete[] fwv;
+        return dst;
+    }
+
+    TEST_F(ImageProcessingTest, FilterImage_ParallelAndSerial_MatchScalarReference)
+    {
+        // big enough for the filter passes to be split in several blocks on the job system
+        const AZ::u32 width = 512;
+        const AZ::u32 height = 384;
+        IImageObjectPtr srcImage(IImageObject::CreateImage(width, height, 1, ePixelFormat_R32G32B32A32F));
+
+        AZ::u8* srcMem;
+        AZ::u32 srcPitch;
+        srcImage->GetImagePointer(0, srcMem, srcPitch);
+        float* srcPixels = reinterpret_cast<float*>(srcMem);
+        for (AZ::u32 i = 0; i < width * height * 4; ++i)
+        {
+            // deterministic pattern that also has negative values and values above 1
+            srcPixels[i] = static_cast<float>((i * 7919) % 1013) / 900.0f - 0.05f;
+        }
+
+        struct FilterCase
+        {
+            MipGenType m_type;
+            MipGenEvalType m_eval;
+            IWindowFunction<double>* (*m_createWindow)();
+        };
+        const FilterCase filters[] = {
+            { MipGenType::box, MipGenEvalType::sum, []() -> IWindowFunction<double>* { return new BoxWindowFunction<double>(); } },
+            { MipGenType::triangle, MipGenEvalType::sum, []() -> IWindowFunction<double>* { return new TriangleWindowFunction<double>(); } },
+            { MipGenType::kaiserSinc, MipGenEvalType::sum, []() -> IWindowFunction<double>* {
+                return new CombinerWindowFunction<double>(new SincWindowFunction<double>(), new KaiserWindowFunction<double>()); } },
+            { MipGenType::box, MipGenEvalType::max, []() -> IWindowFunction<double>* { return new BoxWindowFunction<double>(); } },
+            { MipGenType::box, MipGenEvalType::min, []() -> IWindowFunction<double>* { return new BoxWindowFunction<double>(); } },
+        };
+
+        for (const FilterCase& filter : filters)
+        {
+            IImageObjectPtr parallelImage(IImageObject::CreateImage(width, height, 4, ePixelFormat_R32G32B32A32F));
+            IImageObjectPtr serialImage(IImageObject::CreateImage(width, height, 4, ePixelFormat_R32G32B32A32F));
+
+            for (AZ::u32 mip = 0; mip < parallelImage->GetMipCount(); ++mip)
+            {
+                FilterImage(filter.m_type, filter.m_eval, 0, 0, srcImage, 0, parallelImage, mip, nullptr, nullptr);
+            }
+
+            // without a global job context everything runs on the calling thread
+            JobContext::SetGlobalContext(nullptr);
+            for (AZ::u32 mip = 0; mip < serialImage->GetMipCount(); ++mip)
+            {
+                FilterImage(filter.m_type, filter.m_eval, 0, 0, srcImage, 0, serialImage, mip, nullptr, nullptr);
+            }
+            JobContext::SetGlobalContext(m_jobContext.get());
+
+            for (AZ::u32 mip = 0; mip < parallelImage->GetMipCount(); ++mip)
+            {
+                const AZ::u32 mipWidth = parallelImage->GetWidth(mip);
+                const AZ::u32 mipHeight = parallelImage->GetHeight(mip);
+                IWindowFunction<double>* windowFunction = filter.m_createWindow();
+                const AZStd::vector<float> reference = ReferenceFilterImage(windowFunction, static_cast<int>(filter.m_eval), srcPixels,
+                    width, height, mipWidth, mipHeight);
+                delete windowFunction;
+
+                AZ::u8* parallelMem;
+                AZ::u8* serialMem;
+                AZ::u32 pitch;
+                parallelImage->GetImagePointer(mip, parallelMem, pitch);
+                serialImage->GetImagePointer(mip, serialMem, pitch);
+                const float* parallelPixels = reinterpret_cast<const float*>(parallelMem);
+                const float* serialPixels = reinterpret_cast<const float*>(serialMem);
+
+                size_t mismatches = 0;
+                for (size_t i = 0; i < reference.size(); ++i)
+                {
+                    // a few ULP of slack for compilers that contract the scalar reference into fused multiply-adds
+                    const float tolerance = AZ::GetMax(AZ::GetAbs(reference[i]) * 1e-6f, 1e-7f);
+                    if (AZ::GetAbs(parallelPixels[i] - reference[i]) > tolerance || AZ::GetAbs(serialPixels[i] - reference[i]) > tolerance)
+                    {
+                        ++mismatches;
+                    }
+                }
+                EXPECT_EQ(mismatches, 0u) << "filter " << static_cast<int>(filter.m_type) << ", evaluation " << static_cast<int>(filter.m_eval)
+                    << ", mip " << mip;
+            }
+        }
+    }
+
+    TEST_F(ImageProcessingTest, FilterImage_BoxDownsample_AveragesSourcePixels)
+    {
+        IImageObjectPtr srcImage(IImageObject::CreateImage(4, 4, 1, ePixelFormat_R32G32B32A32F));
+        IImageObjectPtr dstImage(IImageObject::CreateImage(2, 2, 1, ePixelFormat_R32G32B32A32F));
+
+        AZ::u8* srcMem;
+        AZ::u32 pitch;
+        srcImage->GetImagePointer(0, srcMem, pitch);
+        float* srcPixels = reinterpret_cast<float*>(srcMem);
+        for (AZ::u32 y = 0; y < 4; ++y)
+        {
+            for (AZ::u32 x = 0; x < 4; ++x)
+            {
+                // each 2x2 quad is uniform, with different values per channel
+                const float value = static_cast<float>((y / 2) * 2 + (x / 2)) * 0.25f;
+                float* pixel = srcPixels + (y * 4 + x) * 4;
+                pixel[0] = value;
+                pixel[1] = 1.0f - value;
+                pixel[2] = 0.5f;
+                pixel[3] = 1.0f;
+            }
+        }
+
+        FilterImage(MipGenType::box, MipGenEvalType::sum, 0, 0, srcImage, 0, dstImage, 0, nullptr, nullptr);
+
+        AZ::u8* dstMem;
+        dstImage->GetImagePointer(0, dstMem, pitch);
+        const float* dstPixels = reinterpret_cast<const float*>(dstMem);
+        for (AZ::u32 i = 0; i < 4; ++i)
+        {
+            const float value = static_cast<float>(i) * 0.25f;
+            EXPECT_NEAR(dstPixels[i * 4 + 0], value, 0.0001f);
+            EXPECT_NEAR(dstPixels[i * 4 + 1], 1.0f - value, 0.0001f);
+            EXPECT_NEAR(dstPixels[i * 4 + 2], 0.5f, 0.0001f);
+            EXPECT_NEAR(dstPixels[i * 4 + 3], 1.0f, 0.0001f);
+        }
+    }
+
+    TEST_F(ImageProcessingTest, CompressImage_TiledParallelAndSerial_ProduceIdenticalResults)
+    {
+        // tall enough for the mips to be split in several tiles on the job system
+        const AZ::u32 width = 256;
+        const AZ::u32 height = 512;
+        IImageObjectPtr srcImage(IImageObject::CreateImage(width, height, 3, ePixelFormat_R8G8B8A8));
+        for (AZ::u32 mip = 0; mip < srcImage->GetMipCount(); ++mip)
+        {
+            AZ::u8* srcMem;
+            AZ::u32 srcPitch;
+            srcImage->GetImagePointer(mip, srcMem, srcPitch);
+            for (AZ::u32 i = 0; i < srcImage->GetMipBufSize(mip); ++i)
+            {
+                srcMem[i] = static_cast<AZ::u8>((i * 7919) % 251);
+            }
+        }
+
+        const EPixelFormat compressedFormats[] = { ePixelFormat_BC1, ePixelFormat_BC3, ePixelFormat_BC7 };
+        for (EPixelFormat compressedFormat : compressedFormats)
+        {
+            ICompressorPtr compressor = ICompressor::FindCompressor(compressedFormat, ColorSpace::sRGB, true);
+            ASSERT_TRUE(compressor);
+            ASSERT_EQ(compressor->GetSuggestedUncompressedFormat(compressedFormat, ePixelFormat_R8G8B8A8), ePixelFormat_R8G8B8A8);
+
+            ICompressor::CompressOption option;
+            option.compressQuality = ICompressor::eQuality_Fast;
+            IImageObjectPtr parallelImage = compressor->CompressImage(srcImage, compressedFormat, &option);
+
+            // without a global job context every tile is compressed on the calling thread
+            JobContext::SetGlobalContext(nullptr);
+            IImageObjectPtr serialImage = compressor->CompressImage(srcImage, compressedFormat, &option);
+            JobContext::SetGlobalContext(m_jobContext.get());
+
+            ASSERT_TRUE(parallelImage && serialImage);
+            for (AZ::u32 mip = 0; mip < parallelImage->GetMipCount(); ++mip)
+            {
+                AZ::u8* parallelMem;
+                AZ::u8* serialMem;
+                AZ::u32 pitch;
+                parallelImage->GetImagePointer(mip, parallelMem, pitch);
+                serialImage->GetImagePointer(mip, serialMem, pitch);
+                EXPECT_EQ(memcmp(parallelMem, serialMem, parallelImage->GetMipBufSize(mip)), 0);
+            }
+        }
+    }
+
     TEST_F(ImageProcessingTest, TestAverageColor)
     {
         //load builder presets
@@ -43,6 +43,7 @@ set(FILES
     Source/Processing/ImageFlags.h
     Source/Processing/ImageObjectImpl.cpp
     Source/Processing/ImageObjectImpl.h
+    Source/Processing/ImageParallel.h
     Source/Processing/ImagePreview.cpp
     Source/Processing/ImagePreview.h
     Source/Processing/ImageToProcess.h
@@ -7,5 +7,6 @@
 #
 
 set(FILES
+    Tests/CompressorBenchmarks.cpp
     Tests/ImageProcessing_Test.cpp
 )
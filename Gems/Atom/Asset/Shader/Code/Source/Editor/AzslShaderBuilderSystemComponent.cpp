@@ -80,6 +80,9 @@ namespace AZ
             RHI::ShaderPlatformInterfaceRegisterBus::Handler::BusConnect();
             ShaderPlatformInterfaceRequestBus::Handler::BusConnect();
 
+            // Shared by the Shader Asset Builder and the Shader Variant Asset Builder.
+            m_shaderCompilationCache.Init();
+
             // Register Shader Asset Builder
             AssetBuilderSDK::AssetBuilderDesc shaderAssetBuilderDescriptor;
             shaderAssetBuilderDescriptor.m_name = "Shader Asset Builder";
@@ -89,6 +92,7 @@ namespace AZ
             shaderAssetBuilderDescriptor.m_createJobFunction = AZStd::bind(&ShaderAssetBuilder::CreateJobs, &m_shaderAssetBuilder, AZStd::placeholders::_1, AZStd::placeholders::_2);
             shaderAssetBuilderDescriptor.m_processJobFunction = AZStd::bind(&ShaderAssetBuilder::ProcessJob, &m_shaderAssetBuilder, AZStd::placeholders::_1, AZStd::placeholders::_2);
 
+            m_shaderAssetBuilder.SetCompilationCache(&m_shaderCompilationCache);
             m_shaderAssetBuilder.BusConnect(shaderAssetBuilderDescriptor.m_busId);
             AssetBuilderSDK::AssetBuilderBus::Broadcast(&AssetBuilderSDK::AssetBuilderBus::Handler::RegisterBuilderInformation, shaderAssetBuilderDescriptor);
 
@@ -115,6 +119,7 @@ namespace AZ
                 shaderVariantAssetBuilderDescriptor.m_createJobFunction = AZStd::bind(&ShaderVariantAssetBuilder::CreateJobs, &m_shaderVariantAssetBuilder, AZStd::placeholders::_1, AZStd::placeholders::_2);
                 shaderVariantAssetBuilderDescriptor.m_processJobFunction = AZStd::bind(&ShaderVariantAssetBuilder::ProcessJob, &m_shaderVariantAssetBuilder, AZStd::placeholders::_1, AZStd::placeholders::_2);
 
+                m_shaderVariantAssetBuilder.SetCompilationCache(&m_shaderCompilationCache);
                 m_shaderVariantAssetBuilder.BusConnect(shaderVariantAssetBuilderDescriptor.m_busId);
                 AssetBuilderSDK::AssetBuilderBus::Broadcast(&AssetBuilderSDK::AssetBuilderBus::Handler::RegisterBuilderInformation, shaderVariantAssetBuilderDescriptor);
 
@@ -156,6 +161,10 @@ namespace AZ
             }
             m_precompiledShaderBuilder.BusDisconnect();
 
+            m_shaderAssetBuilder.SetCompilationCache(nullptr);
+            m_shaderVariantAssetBuilder.SetCompilationCache(nullptr);
+            m_shaderCompilationCache.ReportStatistics(ShaderCompilationCache::LogName);
+
             RHI::ShaderPlatformInterfaceRegisterBus::Handler::BusDisconnect();
             ShaderPlatformInterfaceRequestBus::Handler::BusDisconnect();
         }
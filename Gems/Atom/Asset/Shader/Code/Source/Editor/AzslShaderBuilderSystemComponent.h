@@ -77,6 +77,10 @@ namespace AZ
 
             ShaderVariantListBuilder m_shaderVariantListBuilder;
 
+            //! Content-addressed cache of platform shader compilation results.
+            //! See ShaderCompilationCache for the registry keys that control it.
+            ShaderCompilationCache m_shaderCompilationCache;
+
             /// Contains the ShaderPlatformInterface for all registered RHIs
             AZStd::unordered_map<RHI::APIType, RHI::ShaderPlatformInterface*> m_shaderPlatformInterfaces;
         };
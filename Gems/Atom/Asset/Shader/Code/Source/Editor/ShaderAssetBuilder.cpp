@@ -667,7 +667,8 @@ namespace AZ
                         variantAssetId,
                         superVariantAzslinStemName,
                         hlslFullPath,
-                        hlslSourceCode};
+                        hlslSourceCode,
+                        m_compilationCache};
 
                     // Preserve the Temp folder when shaders are compiled with debug symbols
                     // or because the ShaderSourceData has m_keepTempFolder set to true.
@@ -29,6 +29,7 @@ namespace AZ
     namespace ShaderBuilder
     {
         struct AzslData;
+        class ShaderCompilationCache;
 
         class ShaderAssetBuilder
             : public AssetBuilderSDK::AssetBuilderCommandBus::Handler
@@ -48,8 +49,13 @@ namespace AZ
             // AssetBuilderSDK::AssetBuilderCommandBus interface overrides ...
             void ShutDown() override { };
 
+            //! The cache is owned by the AzslShaderBuilderSystemComponent. Can be null.
+            void SetCompilationCache(ShaderCompilationCache* compilationCache) { m_compilationCache = compilationCache; }
+
         private:
             AZ_DISABLE_COPY_MOVE(ShaderAssetBuilder);
+
+            ShaderCompilationCache* m_compilationCache = nullptr;
         };
 
     } // ShaderBuilder
@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ShaderCompilationCache.h"
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/time.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <AzFramework/FileFunc/FileFunc.h>
+
+#include <Atom/RHI.Edit/Utils.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        namespace
+        {
+            // "AZSC" in little endian
+            constexpr AZ::u32 EntryMagic = 0x4353'5A41;
+
+            //! Fixed size header at the start of every cache entry. It is followed by the entry function name,
+            //! the byte code and the source code, in that order.
+            struct EntryHeader
+            {
+                AZ::u32 m_magic = EntryMagic;
+                AZ::u32 m_formatVersion = ShaderCompilationCache::FormatVersion;
+                //! Milliseconds since epoch (UTC). Refreshed on every hit so Trim() can evict the least recently used entries.
+                AZ::u64 m_lastUsedMilliseconds = 0;
+                AZ::u32 m_stageType = 0;
+                AZ::u32 m_dynamicBranchCount = 0;
+                AZ::u32 m_entryFunctionNameSize = 0;
+                AZ::u32 m_reserved = 0;
+                AZ::u64 m_byteCodeSize = 0;
+                AZ::u64 m_sourceCodeSize = 0;
+
+                AZ::u64 GetEntrySize() const
+                {
+                    return sizeof(EntryHeader) + m_entryFunctionNameSize + m_byteCodeSize + m_sourceCodeSize;
+                }
+
+                bool IsValid() const
+                {
+                    return m_magic == EntryMagic && m_formatVersion == ShaderCompilationCache::FormatVersion;
+                }
+            };
+
+            // Every variable length field is prefixed with its size so two different sequences of fields
+            // can never produce the same stream of bytes.
+            void HashString(Sha1& hasher, AZStd::string_view value)
+            {
+                const AZ::u64 size = value.size();
+                hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(&size), sizeof(size));
+                hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(value.data()), value.size());
+            }
+
+            void HashArguments(Sha1& hasher, const AZStd::vector<AZStd::string>& arguments)
+            {
+                const AZ::u64 count = arguments.size();
+                hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(&count), sizeof(count));
+                for (const AZStd::string& argument : arguments)
+                {
+                    HashString(hasher, argument);
+                }
+            }
+
+            ShaderCompilationCache::Key DigestToKey(Sha1& hasher)
+            {
+                RHI::ArrayOfCharForSha1 digest;
+                hasher.GetDigest(reinterpret_cast<Sha1::DigestType>(digest));
+                const AZStd::string hexDigest = RHI::ByteToHexString(digest);
+                return ShaderCompilationCache::Key(hexDigest.c_str(), hexDigest.size());
+            }
+        } // namespace
+
+        ShaderCompilationCache::Settings ShaderCompilationCache::LoadSettings()
+        {
+            Settings settings;
+
+            auto settingsRegistry = AZ::SettingsRegistry::Get();
+            AZ::IO::FixedMaxPathString cachePath;
+            if (settingsRegistry)
+            {
+                settingsRegistry->Get(settings.m_enabled, EnableRegistryKey);
+                settingsRegistry->Get(cachePath, PathRegistryKey);
+
+                AZ::u64 maxSizeMB = DefaultMaxSizeMB;
+                settingsRegistry->Get(maxSizeMB, MaxSizeMBRegistryKey);
+                settings.m_maxSizeBytes = maxSizeMB * 1024 * 1024;
+
+                AZ::u64 maxAgeDays = DefaultMaxAgeDays;
+                settingsRegistry->Get(maxAgeDays, MaxAgeDaysRegistryKey);
+                settings.m_maxAgeMilliseconds = maxAgeDays * 24 * 60 * 60 * 1000;
+
+                settingsRegistry->Get(settings.m_compilerVersion, CompilerVersionRegistryKey);
+            }
+
+            if (cachePath.empty())
+            {
+                settings.m_rootPath = AZ::Utils::GetProjectUserPath(settingsRegistry);
+                settings.m_rootPath /= DefaultCacheFolderName;
+            }
+            else
+            {
+                settings.m_rootPath = cachePath;
+            }
+
+            return settings;
+        }
+
+        void ShaderCompilationCache::Init()
+        {
+            Settings settings = LoadSettings();
+            if (!settings.m_enabled)
+            {
+                AZ_TracePrintf(LogName, "Shader compilation cache is disabled by the registry key %s\n", EnableRegistryKey);
+                Init(settings, {});
+                return;
+            }
+
+            AZ::IO::FixedMaxPath buildersPath = AZ::Utils::GetExecutableDirectory();
+            buildersPath /= "Builders";
+            Init(settings, FingerprintToolchain(buildersPath));
+        }
+
+        void ShaderCompilationCache::Init(const Settings& settings, AZStd::string_view toolchainFingerprint)
+        {
+            m_settings = settings;
+            m_toolchainFingerprint = toolchainFingerprint;
+
+            m_hits = 0;
+            m_misses = 0;
+            m_stores = 0;
+            m_evictions = 0;
+            m_bytesRead = 0;
+            m_bytesWritten = 0;
+
+            if (!IsEnabled())
+            {
+                return;
+            }
+
+            if (!AZ::IO::SystemFile::Exists(m_settings.m_rootPath.c_str()) && !AZ::IO::SystemFile::CreateDir(m_settings.m_rootPath.c_str()))
+            {
+                AZ_Warning(LogName, false, "Failed to create the shader compilation cache folder [%s]. The cache will be disabled.",
+                    m_settings.m_rootPath.c_str());
+                m_settings.m_enabled = false;
+                return;
+            }
+
+            AZ_TracePrintf(LogName, "Shader compilation cache at [%s]. Max size: %llu MB, Max age: %llu days.\n",
+                m_settings.m_rootPath.c_str(), m_settings.m_maxSizeBytes / (1024 * 1024),
+                m_settings.m_maxAgeMilliseconds / (24 * 60 * 60 * 1000));
+
+            Trim();
+        }
+
+        bool ShaderCompilationCache::IsEnabled() const
+        {
+            return m_settings.m_enabled && !m_settings.m_rootPath.empty();
+        }
+
+        ShaderCompilationCache::Key ShaderCompilationCache::ComputeKey(const KeyInputs& inputs) const
+        {
+            Sha1 hasher;
+
+            const AZ::u32 formatVersion = FormatVersion;
+            hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(&formatVersion), sizeof(formatVersion));
+            HashString(hasher, m_toolchainFingerprint);
+            HashString(hasher, m_settings.m_compilerVersion);
+
+            HashString(hasher, inputs.m_apiName);
+            HashString(hasher, inputs.m_platformIdentifier);
+            HashString(hasher, inputs.m_entryFunctionName);
+            const AZ::u32 stage = static_cast<AZ::u32>(inputs.m_stage);
+            hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(&stage), sizeof(stage));
+
+            if (inputs.m_shaderBuildArguments)
+            {
+                const RHI::ShaderBuildArguments& arguments = *inputs.m_shaderBuildArguments;
+                const AZ::u8 generateDebugInfo = arguments.m_generateDebugInfo ? 1 : 0;
+                hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(&generateDebugInfo), sizeof(generateDebugInfo));
+                HashArguments(hasher, arguments.m_preprocessorArguments);
+                HashArguments(hasher, arguments.m_azslcArguments);
+                HashArguments(hasher, arguments.m_dxcArguments);
+                HashArguments(hasher, arguments.m_spirvCrossArguments);
+                HashArguments(hasher, arguments.m_metalAirArguments);
+                HashArguments(hasher, arguments.m_metalLibArguments);
+            }
+
+            HashString(hasher, inputs.m_hlslSourceCode);
+
+            return DigestToKey(hasher);
+        }
+
+        AZ::IO::FixedMaxPath ShaderCompilationCache::GetEntryPath(const Key& key) const
+        {
+            // Shard the entries in 256 sub folders to keep directory listings fast.
+            AZ::IO::FixedMaxPath entryPath = m_settings.m_rootPath;
+            entryPath /= AZStd::string_view(key).substr(0, 2);
+            entryPath /= AZ::IO::FixedMaxPathString::format("%s.%s", key.c_str(), EntryExtension);
+            return entryPath;
+        }
+
+        bool ShaderCompilationCache::Load(const Key& key, RHI::ShaderPlatformInterface::StageDescriptor& outputDescriptor)
+        {
+            if (!IsEnabled())
+            {
+                return false;
+            }
+
+            const AZ::IO::FixedMaxPath entryPath = GetEntryPath(key);
+
+            AZ::IO::SystemFile entryFile;
+            if (!AZ::IO::SystemFile::Exists(entryPath.c_str()) || !entryFile.Open(entryPath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+            {
+                ++m_misses;
+                return false;
+            }
+
+            EntryHeader header;
+            const AZ::IO::SystemFile::SizeType fileSize = entryFile.Length();
+            if (entryFile.Read(sizeof(header), &header) != sizeof(header) || !header.IsValid() || header.GetEntrySize() != fileSize)
+            {
+                AZ_Warning(LogName, false, "Discarding invalid shader compilation cache entry [%s]", entryPath.c_str());
+                entryFile.Close();
+                AZ::IO::SystemFile::Delete(entryPath.c_str());
+                ++m_misses;
+                return false;
+            }
+
+            RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+            descriptor.m_stageType = static_cast<RHI::ShaderHardwareStage>(header.m_stageType);
+            descriptor.m_byProducts.m_dynamicBranchCount = header.m_dynamicBranchCount;
+            descriptor.m_entryFunctionName.resize_no_construct(header.m_entryFunctionNameSize);
+            descriptor.m_byteCode.resize_no_construct(header.m_byteCodeSize);
+            descriptor.m_sourceCode.resize_no_construct(header.m_sourceCodeSize);
+
+            const bool readSucceeded =
+                entryFile.Read(header.m_entryFunctionNameSize, descriptor.m_entryFunctionName.data()) == header.m_entryFunctionNameSize &&
+                entryFile.Read(header.m_byteCodeSize, descriptor.m_byteCode.data()) == header.m_byteCodeSize &&
+                entryFile.Read(header.m_sourceCodeSize, descriptor.m_sourceCode.data()) == header.m_sourceCodeSize;
+            if (!readSucceeded)
+            {
+                AZ_Warning(LogName, false, "Failed to read shader compilation cache entry [%s]", entryPath.c_str());
+                ++m_misses;
+                return false;
+            }
+
+            entryFile.Close();
+
+            // Refresh the last used time so the entry survives the next Trim(). The cache directory may be read-only or shared, in which
+            // case the entry is still a hit and only ages out sooner.
+            header.m_lastUsedMilliseconds = AZStd::GetTimeUTCMilliSecond();
+            AZ::IO::SystemFile touchFile;
+            if (touchFile.Open(entryPath.c_str(), AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                touchFile.Write(&header, sizeof(header));
+                touchFile.Close();
+            }
+
+            outputDescriptor = AZStd::move(descriptor);
+            ++m_hits;
+            m_bytesRead += fileSize;
+            return true;
+        }
+
+        bool ShaderCompilationCache::Store(const Key& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor)
+        {
+            if (!IsEnabled())
+            {
+                return false;
+            }
+
+            EntryHeader header;
+            header.m_lastUsedMilliseconds = AZStd::GetTimeUTCMilliSecond();
+            header.m_stageType = static_cast<AZ::u32>(descriptor.m_stageType);
+            header.m_dynamicBranchCount = descriptor.m_byProducts.m_dynamicBranchCount;
+            header.m_entryFunctionNameSize = aznumeric_cast<AZ::u32>(descriptor.m_entryFunctionName.size());
+            header.m_byteCodeSize = descriptor.m_byteCode.size();
+            header.m_sourceCodeSize = descriptor.m_sourceCode.size();
+
+            // Other AssetBuilder processes may be reading or writing the same entry. Write to a unique temporary file
+            // and rename it into place so readers never observe a partially written entry.
+            const AZ::IO::FixedMaxPath entryPath = GetEntryPath(key);
+            AZ::IO::FixedMaxPath tempPath = entryPath;
+            tempPath.ReplaceExtension(AZ::IO::FixedMaxPathString::format(".%s.tmp", AZ::Uuid::CreateRandom().ToFixedString(false, false).c_str()));
+
+            AZ::IO::SystemFile entryFile;
+            if (!entryFile.Open(tempPath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+            {
+                AZ_Warning(LogName, false, "Failed to create shader compilation cache entry [%s]", tempPath.c_str());
+                return false;
+            }
+
+            const bool writeSucceeded =
+                entryFile.Write(&header, sizeof(header)) == sizeof(header) &&
+                entryFile.Write(descriptor.m_entryFunctionName.data(), header.m_entryFunctionNameSize) == header.m_entryFunctionNameSize &&
+                entryFile.Write(descriptor.m_byteCode.data(), header.m_byteCodeSize) == header.m_byteCodeSize &&
+                entryFile.Write(descriptor.m_sourceCode.data(), header.m_sourceCodeSize) == header.m_sourceCodeSize;
+            entryFile.Close();
+
+            if (!writeSucceeded || !AZ::IO::SystemFile::Rename(tempPath.c_str(), entryPath.c_str(), true))
+            {
+                AZ_Warning(LogName, false, "Failed to write shader compilation cache entry [%s]", entryPath.c_str());
+                AZ::IO::SystemFile::Delete(tempPath.c_str());
+                return false;
+            }
+
+            ++m_stores;
+            m_bytesWritten += header.GetEntrySize();
+            return true;
+        }
+
+        AZ::u32 ShaderCompilationCache::Trim()
+        {
+            if (!IsEnabled())
+            {
+                return 0;
+            }
+
+            auto filesOutcome = AzFramework::FileFunc::FindFilesInPath(m_settings.m_rootPath.c_str(), "*", true);
+            if (!filesOutcome.IsSuccess())
+            {
+                return 0;
+            }
+
+            struct EntryInfo
+            {
+                AZStd::string m_path;
+                AZ::u64 m_lastUsedMilliseconds;
+                AZ::u64 m_size;
+            };
+            AZStd::vector<EntryInfo> entries;
+            AZ::u64 totalSize = 0;
+
+            const AZ::u64 now = AZStd::GetTimeUTCMilliSecond();
+            AZ::u32 evictedCount = 0;
+            const AZStd::string entryExtension = AZStd::string::format(".%s", EntryExtension);
+
+            for (const AZStd::string& filePath : filesOutcome.GetValue())
+            {
+                // Leftover temporary files from a crashed builder are evicted like expired entries.
+                if (!filePath.ends_with(entryExtension))
+                {
+                    if (filePath.ends_with(".tmp") && AZ::IO::SystemFile::Delete(filePath.c_str()))
+                    {
+                        ++evictedCount;
+                    }
+                    continue;
+                }
+
+                EntryHeader header;
+                const AZ::IO::SystemFile::SizeType bytesRead = AZ::IO::SystemFile::Read(filePath.c_str(), &header, sizeof(header));
+                const bool isExpired = now > header.m_lastUsedMilliseconds && (now - header.m_lastUsedMilliseconds) > m_settings.m_maxAgeMilliseconds;
+                if (bytesRead != sizeof(header) || !header.IsValid() || isExpired)
+                {
+                    if (AZ::IO::SystemFile::Delete(filePath.c_str()))
+                    {
+                        ++evictedCount;
+                    }
+                    continue;
+                }
+
+                const AZ::u64 size = AZ::IO::SystemFile::Length(filePath.c_str());
+                totalSize += size;
+                entries.push_back({ filePath, header.m_lastUsedMilliseconds, size });
+            }
+
+            size_t remainingCount = entries.size();
+            if (totalSize > m_settings.m_maxSizeBytes)
+            {
+                AZStd::sort(entries.begin(), entries.end(), [](const EntryInfo& lhs, const EntryInfo& rhs)
+                    {
+                        return lhs.m_lastUsedMilliseconds < rhs.m_lastUsedMilliseconds;
+                    });
+
+                for (const EntryInfo& entry : entries)
+                {
+                    if (totalSize <= m_settings.m_maxSizeBytes)
+                    {
+                        break;
+                    }
+                    if (AZ::IO::SystemFile::Delete(entry.m_path.c_str()))
+                    {
+                        totalSize -= entry.m_size;
+                        --remainingCount;
+                        ++evictedCount;
+                    }
+                }
+            }
+
+            m_evictions += evictedCount;
+            AZ_TracePrintf(LogName, "Shader compilation cache holds %zu entries (%llu KB). Evicted %u entries.\n",
+                remainingCount, totalSize / 1024, evictedCount);
+
+            return evictedCount;
+        }
+
+        ShaderCompilationCache::Statistics ShaderCompilationCache::GetStatistics() const
+        {
+            Statistics statistics;
+            statistics.m_hits = m_hits;
+            statistics.m_misses = m_misses;
+            statistics.m_stores = m_stores;
+            statistics.m_evictions = m_evictions;
+            statistics.m_bytesRead = m_bytesRead;
+            statistics.m_bytesWritten = m_bytesWritten;
+            return statistics;
+        }
+
+        void ShaderCompilationCache::ReportStatistics([[maybe_unused]] const char* window) const
+        {
+            if (!IsEnabled())
+            {
+                return;
+            }
+
+            [[maybe_unused]] const Statistics statistics = GetStatistics();
+            [[maybe_unused]] const AZ::u32 lookups = statistics.m_hits + statistics.m_misses;
+            AZ_TracePrintf(window, "Shader compilation cache: %u hits, %u misses (%.1f%% hit rate), %u stores, %u evictions, %llu KB read, %llu KB written.\n",
+                statistics.m_hits, statistics.m_misses, lookups ? (100.0f * statistics.m_hits) / lookups : 0.0f,
+                statistics.m_stores, statistics.m_evictions, statistics.m_bytesRead / 1024, statistics.m_bytesWritten / 1024);
+        }
+
+        AZStd::string ShaderCompilationCache::FingerprintToolchain(const AZ::IO::FixedMaxPath& buildersPath)
+        {
+            auto filesOutcome = AzFramework::FileFunc::FindFilesInPath(buildersPath.c_str(), "*", true);
+            if (!filesOutcome.IsSuccess() || filesOutcome.GetValue().empty())
+            {
+                AZ_Warning(LogName, false, "Could not fingerprint the shader compiler toolchain under [%s]. Consider setting the registry key %s.",
+                    buildersPath.c_str(), CompilerVersionRegistryKey);
+                return {};
+            }
+
+            // FindFilesInPath doesn't guarantee any particular order.
+            AZStd::vector<AZStd::string> files(filesOutcome.GetValue().begin(), filesOutcome.GetValue().end());
+            AZStd::sort(files.begin(), files.end());
+
+            Sha1 hasher;
+            AZStd::vector<AZStd::byte> buffer(64 * 1024);
+            for (const AZStd::string& filePath : files)
+            {
+                AZ::IO::FixedMaxPath relativePath = AZ::IO::PathView(filePath).LexicallyRelative(buildersPath);
+                HashString(hasher, relativePath.AsPosix());
+
+                AZ::IO::SystemFile file;
+                if (!file.Open(filePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+                {
+                    AZ_Warning(LogName, false, "Could not read [%s] to fingerprint the shader compiler toolchain.", filePath.c_str());
+                    continue;
+                }
+
+                const AZ::u64 size = file.Length();
+                hasher.ProcessBytes(reinterpret_cast<const AZStd::byte*>(&size), sizeof(size));
+                for (AZ::u64 remaining = size; remaining > 0;)
+                {
+                    const AZ::IO::SystemFile::SizeType bytesRead = file.Read(AZStd::min<AZ::u64>(remaining, buffer.size()), buffer.data());
+                    if (bytesRead == 0)
+                    {
+                        break;
+                    }
+                    hasher.ProcessBytes(buffer.data(), bytesRead);
+                    remaining -= bytesRead;
+                }
+            }
+
+            return AZStd::string(DigestToKey(hasher).c_str());
+        }
+    } // ShaderBuilder namespace
+} // AZ
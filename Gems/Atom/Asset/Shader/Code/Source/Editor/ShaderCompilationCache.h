@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/fixed_string.h>
+#include <AzCore/std/string/string.h>
+
+#include <Atom/RHI.Edit/ShaderBuildArguments.h>
+#include <Atom/RHI.Edit/ShaderPlatformInterface.h>
+
+namespace UnitTest
+{
+    class ShaderCompilationCacheTests;
+}
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        //! A local, content-addressed cache of platform shader compilation results.
+        //!
+        //! Each entry is keyed by the SHA1 of everything that can change the output of
+        //! RHI::ShaderPlatformInterface::CompilePlatformInternal():
+        //!   - The final HLSL code of the variant (the azslc output with the shader option #defines prepended).
+        //!   - The entry function name and hardware stage.
+        //!   - The RHI API name and the asset platform identifier.
+        //!   - All the ShaderBuildArguments (as provided by the ShaderBuildArgumentsManager).
+        //!   - A fingerprint of the shader compiler toolchain found under the Builders/ folder.
+        //! Because the key only depends on content, identical variants produced on another branch, by another
+        //! .shader file, or in another checkout that share the same cache folder, skip compilation entirely.
+        //!
+        //! The cache is trimmed by age and total size when Init() is called.
+        //! All the public functions are safe to call from multiple threads, and multiple AssetBuilder processes can
+        //! share the same cache folder because entries are written to a temporary file and renamed into place.
+        class ShaderCompilationCache final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(ShaderCompilationCache, AZ::SystemAllocator);
+
+            static constexpr char LogName[] = "ShaderCompilationCache";
+
+            //! Registry keys that can be used to customize the cache. All of them are optional.
+            static constexpr char EnableRegistryKey[] = "/O3DE/Atom/Shaders/Build/Cache/Enable";
+            static constexpr char PathRegistryKey[] = "/O3DE/Atom/Shaders/Build/Cache/Path";
+            static constexpr char MaxSizeMBRegistryKey[] = "/O3DE/Atom/Shaders/Build/Cache/MaxSizeMB";
+            static constexpr char MaxAgeDaysRegistryKey[] = "/O3DE/Atom/Shaders/Build/Cache/MaxAgeDays";
+            //! Optional string that is mixed into every key. Useful to force a cache flush, or to
+            //! distinguish toolchains that live outside of the Builders/ folder.
+            static constexpr char CompilerVersionRegistryKey[] = "/O3DE/Atom/Shaders/Build/Cache/CompilerVersion";
+
+            //! By default the cache lives in <ProjectUserPath>/ShaderCompilationCache
+            static constexpr char DefaultCacheFolderName[] = "ShaderCompilationCache";
+            static constexpr char EntryExtension[] = "azshadercache";
+
+            static constexpr AZ::u64 DefaultMaxSizeMB = 4096;
+            static constexpr AZ::u64 DefaultMaxAgeDays = 30;
+
+            //! Bump this number whenever the layout of the cached entries or the key changes.
+            static constexpr AZ::u32 FormatVersion = 1;
+
+            struct Settings
+            {
+                bool m_enabled = true;
+                AZ::IO::FixedMaxPath m_rootPath;
+                AZ::u64 m_maxSizeBytes = DefaultMaxSizeMB * 1024 * 1024;
+                AZ::u64 m_maxAgeMilliseconds = DefaultMaxAgeDays * 24 * 60 * 60 * 1000;
+                AZStd::string m_compilerVersion;
+            };
+
+            //! All the data that contributes to a cache key.
+            struct KeyInputs
+            {
+                AZStd::string_view m_apiName;
+                AZStd::string_view m_platformIdentifier;
+                AZStd::string_view m_hlslSourceCode;
+                AZStd::string_view m_entryFunctionName;
+                RHI::ShaderHardwareStage m_stage = RHI::ShaderHardwareStage::Invalid;
+                const RHI::ShaderBuildArguments* m_shaderBuildArguments = nullptr;
+            };
+
+            //! Hexadecimal string of the SHA1 digest of the KeyInputs.
+            static constexpr size_t Sha1NumHexChars = sizeof(AZ::u32) * 5 * 2;
+            using Key = AZStd::fixed_string<Sha1NumHexChars>;
+
+            struct Statistics
+            {
+                AZ::u32 m_hits = 0;
+                AZ::u32 m_misses = 0;
+                AZ::u32 m_stores = 0;
+                AZ::u32 m_evictions = 0;
+                AZ::u64 m_bytesRead = 0;
+                AZ::u64 m_bytesWritten = 0;
+            };
+
+            //! Reads the Settings from the registry.
+            static Settings LoadSettings();
+
+            //! Reads the Settings from the registry, fingerprints the compiler toolchain and trims the cache.
+            void Init();
+
+            //! Same as above, but with explicit settings and toolchain fingerprint. Useful for unit testing.
+            void Init(const Settings& settings, AZStd::string_view toolchainFingerprint);
+
+            bool IsEnabled() const;
+
+            Key ComputeKey(const KeyInputs& inputs) const;
+
+            //! Loads a previously stored compilation result.
+            //! @returns true if the entry was found and is valid, in which case @outputDescriptor is fully populated.
+            bool Load(const Key& key, RHI::ShaderPlatformInterface::StageDescriptor& outputDescriptor);
+
+            //! Stores the result of a successful compilation. Byproducts (debug files) are not cached.
+            bool Store(const Key& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor);
+
+            //! Removes entries that have not been used in Settings::m_maxAgeMilliseconds, and then the least recently
+            //! used entries until the total size of the cache is below Settings::m_maxSizeBytes.
+            //! @returns The number of evicted entries.
+            AZ::u32 Trim();
+
+            Statistics GetStatistics() const;
+
+            //! Prints the hit/miss statistics collected since Init() to the builder log. The builders call it once, on shutdown.
+            void ReportStatistics(const char* window) const;
+
+        private:
+            friend class ::UnitTest::ShaderCompilationCacheTests;
+
+            //! Hashes the relative path and the content of all the files under @buildersPath, which is <executable folder>/Builders
+            //! for the builders. That folder contains azslc, dxc, spirv-cross and the platform shader headers. Only the content is used
+            //! (not the modification time) so that the same toolchain installed on different machines produces the same fingerprint.
+            static AZStd::string FingerprintToolchain(const AZ::IO::FixedMaxPath& buildersPath);
+
+            AZ::IO::FixedMaxPath GetEntryPath(const Key& key) const;
+
+            Settings m_settings;
+            AZStd::string m_toolchainFingerprint;
+
+            AZStd::atomic<AZ::u32> m_hits{ 0 };
+            AZStd::atomic<AZ::u32> m_misses{ 0 };
+            AZStd::atomic<AZ::u32> m_stores{ 0 };
+            AZStd::atomic<AZ::u32> m_evictions{ 0 };
+            AZStd::atomic<AZ::u64> m_bytesRead{ 0 };
+            AZStd::atomic<AZ::u64> m_bytesWritten{ 0 };
+        };
+    } // ShaderBuilder namespace
+} // AZ
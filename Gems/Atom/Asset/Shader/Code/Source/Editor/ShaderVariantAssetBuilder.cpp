@@ -718,7 +718,8 @@ namespace AZ
                         shaderEntryPoints,
                         Uuid::CreateRandom(),
                         shaderStemNamePrefix,
-                        hlslSourcePath, hlslCode
+                        hlslSourcePath, hlslCode,
+                        m_compilationCache
                     };
 
                     // Preserve the Temp folder when shaders are compiled with debug symbols
@@ -869,12 +870,13 @@ namespace AZ
             }
 
             AZStd::string variantShaderSourcePath;
+            AZStd::string variantShaderSourceString;
             // Check if we need to prepend any code prefix
             if (!hlslCodeToPrependForVariant.empty())
             {
                 // Prepend any shader code prefix that we should apply to this variant
                 // and save it back to a file.
-                AZStd::string variantShaderSourceString(hlslCodeToPrependForVariant);
+                variantShaderSourceString = hlslCodeToPrependForVariant;
                 variantShaderSourceString += creationContext.m_hlslSourceContent;
 
                 AZStd::string shaderAssetName = AZStd::string::format(
@@ -908,6 +910,16 @@ namespace AZ
                 creationContext.m_shaderVariantAssetId, optionGroup.GetShaderVariantId(), shaderVariantStableId,
                 shaderOptions.IsFullySpecified());
 
+            // The cache key is built from the HLSL content, so compilation results can only be reused when the platform
+            // compiler doesn't depend on data outside of the HLSL file (like the SRG layouts), and when no debug byproducts
+            // are expected.
+            ShaderCompilationCache* compilationCache = creationContext.m_compilationCache;
+            const bool useCompilationCache = compilationCache && compilationCache->IsEnabled() &&
+                !creationContext.m_shaderBuildArguments.m_generateDebugInfo &&
+                !creationContext.m_shaderPlatformInterface.VariantCompilationRequiresSrgLayoutData();
+            const AZStd::string& variantShaderSourceContent =
+                hlslCodeToPrependForVariant.empty() ? creationContext.m_hlslSourceContent : variantShaderSourceString;
+
             const AZStd::unordered_map<AZStd::string, RPI::ShaderStageType>& shaderEntryPoints = creationContext.m_shaderEntryPoints;
             for (const auto& shaderEntryPoint : shaderEntryPoints)
             {
@@ -919,15 +931,42 @@ namespace AZ
 
                 auto assetBuilderShaderType = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
 
-                // Compile HLSL to the platform specific shader.
                 RHI::ShaderPlatformInterface::StageDescriptor descriptor;
-                bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
-                    creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
-                    creationContext.m_tempDirPath, descriptor, creationContext.m_shaderBuildArguments);
+                ShaderCompilationCache::Key cacheKey;
+                bool shaderWasCompiled = false;
+                if (useCompilationCache)
+                {
+                    ShaderCompilationCache::KeyInputs keyInputs;
+                    keyInputs.m_apiName = creationContext.m_shaderPlatformInterface.GetAPIName().GetStringView();
+                    keyInputs.m_platformIdentifier = creationContext.m_platformInfo.m_identifier;
+                    keyInputs.m_hlslSourceCode = variantShaderSourceContent;
+                    keyInputs.m_entryFunctionName = shaderEntryName;
+                    keyInputs.m_stage = assetBuilderShaderType;
+                    keyInputs.m_shaderBuildArguments = &creationContext.m_shaderBuildArguments;
+                    cacheKey = compilationCache->ComputeKey(keyInputs);
+
+                    shaderWasCompiled = compilationCache->Load(cacheKey, descriptor);
+                    AZ_TracePrintf(
+                        ShaderVariantAssetBuilderName, "Shader compilation cache %s for \"%s\" [%s]\n", shaderWasCompiled ? "hit" : "miss",
+                        shaderEntryName.c_str(), cacheKey.c_str());
+                }
 
                 if (!shaderWasCompiled)
                 {
-                    return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    // Compile HLSL to the platform specific shader.
+                    shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
+                        creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
+                        creationContext.m_tempDirPath, descriptor, creationContext.m_shaderBuildArguments);
+
+                    if (!shaderWasCompiled)
+                    {
+                        return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    }
+
+                    if (useCompilationCache)
+                    {
+                        compilationCache->Store(cacheKey, descriptor);
+                    }
                 }
                 // bubble up the byproducts to the caller by moving them to the context.
                 outputByproducts.emplace(AZStd::move(descriptor.m_byProducts));
@@ -18,6 +18,7 @@
 #include <Atom/RPI.Edit/Shader/ShaderVariantListSourceData.h>
 
 #include "ShaderBuilderUtility.h"
+#include "ShaderCompilationCache.h"
 
 namespace AZ
 {
@@ -43,6 +44,8 @@ namespace AZ
             const AZStd::string& m_shaderStemNamePrefix; //<shaderName>-<supervariantName>
             const AZStd::string& m_hlslSourcePath;
             const AZStd::string& m_hlslSourceContent;
+            //! Optional. When set, the platform compilation results are looked up in, and stored to, this cache.
+            ShaderCompilationCache* m_compilationCache = nullptr;
         };
 
 
@@ -87,6 +90,9 @@ namespace AZ
             // AssetBuilderSDK::AssetBuilderCommandBus interface overrides ...
             void ShutDown() override { };
 
+            //! The cache is owned by the AzslShaderBuilderSystemComponent. Can be null.
+            void SetCompilationCache(ShaderCompilationCache* compilationCache) { m_compilationCache = compilationCache; }
+
         private:
             AZ_DISABLE_COPY_MOVE(ShaderVariantAssetBuilder);
 
@@ -111,6 +117,7 @@ namespace AZ
             static AZStd::string GetShaderVariantTreeAssetJobKey();
             static AZStd::string GetShaderVariantAssetJobKey();
 
+            ShaderCompilationCache* m_compilationCache = nullptr;
         };
 
     } // ShaderBuilder
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/time.h>
+
+#include "Common/ShaderBuilderTestFixture.h"
+
+#include <ShaderCompilationCache.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class ShaderCompilationCacheTests : public ShaderBuilderTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            ShaderBuilderTestFixture::SetUp();
+
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_buildArguments = RHI::ShaderBuildArguments(
+                false, { "-DMACRO1=1" }, { "--azslc1" }, { "--dxc1", "-O3" }, { "--spirv1" }, {}, {});
+
+            m_keyInputs.m_apiName = "vulkan";
+            m_keyInputs.m_platformIdentifier = "pc";
+            m_keyInputs.m_hlslSourceCode = "float4 MainPS() : SV_Target0 { return 1; }";
+            m_keyInputs.m_entryFunctionName = "MainPS";
+            m_keyInputs.m_stage = RHI::ShaderHardwareStage::Fragment;
+            m_keyInputs.m_shaderBuildArguments = &m_buildArguments;
+        }
+
+        void TearDown() override
+        {
+            m_tempDirectory.reset();
+
+            ShaderBuilderTestFixture::TearDown();
+        }
+
+        ShaderBuilder::ShaderCompilationCache::Settings CreateSettings() const
+        {
+            ShaderBuilder::ShaderCompilationCache::Settings settings;
+            settings.m_rootPath = m_tempDirectory->GetDirectoryAsFixedMaxPath();
+            return settings;
+        }
+
+        static RHI::ShaderPlatformInterface::StageDescriptor CreateStageDescriptor(size_t byteCodeSize)
+        {
+            RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+            descriptor.m_stageType = RHI::ShaderHardwareStage::Fragment;
+            descriptor.m_entryFunctionName = "MainPS";
+            descriptor.m_byProducts.m_dynamicBranchCount = 3;
+            descriptor.m_byteCode.resize(byteCodeSize);
+            for (size_t i = 0; i < byteCodeSize; ++i)
+            {
+                descriptor.m_byteCode[i] = static_cast<uint8_t>(i);
+            }
+            const char sourceCode[] = "OpCapability Shader";
+            descriptor.m_sourceCode.assign(sourceCode, sourceCode + sizeof(sourceCode));
+            return descriptor;
+        }
+
+        static void SetLastUsedMilliseconds(ShaderBuilder::ShaderCompilationCache& cache, const ShaderBuilder::ShaderCompilationCache::Key& key, AZ::u64 lastUsed)
+        {
+            // m_lastUsedMilliseconds is the third field of the entry header, right after the magic and the format version.
+            const AZ::IO::FixedMaxPath entryPath = cache.GetEntryPath(key);
+            AZ::IO::SystemFile entryFile;
+            ASSERT_TRUE(entryFile.Open(entryPath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_WRITE));
+            entryFile.Seek(sizeof(AZ::u32) * 2, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+            entryFile.Write(&lastUsed, sizeof(lastUsed));
+        }
+
+        void WriteToolchainFile(AZStd::string_view machineName, AZStd::string_view relativePath, AZStd::string_view content) const
+        {
+            AZ::IO::FixedMaxPath filePath = m_tempDirectory->GetDirectoryAsFixedMaxPath() / machineName / "Builders" / relativePath;
+            AZ::IO::SystemFile file;
+            ASSERT_TRUE(file.Open(filePath.c_str(),
+                AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+            file.Write(content.data(), content.size());
+        }
+
+        AZStd::string FingerprintToolchain(AZStd::string_view machineName) const
+        {
+            return ShaderBuilder::ShaderCompilationCache::FingerprintToolchain(
+                m_tempDirectory->GetDirectoryAsFixedMaxPath() / machineName / "Builders");
+        }
+
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        RHI::ShaderBuildArguments m_buildArguments;
+        ShaderBuilder::ShaderCompilationCache::KeyInputs m_keyInputs;
+    }; // class ShaderCompilationCacheTests
+
+    TEST_F(ShaderCompilationCacheTests, ComputeKey_SameInputs_SameKey)
+    {
+        ShaderBuilder::ShaderCompilationCache cache;
+        cache.Init(CreateSettings(), "toolchain");
+
+        const auto key1 = cache.ComputeKey(m_keyInputs);
+        const auto key2 = cache.ComputeKey(m_keyInputs);
+        EXPECT_EQ(key1, key2);
+        EXPECT_EQ(key1.size(), ShaderBuilder::ShaderCompilationCache::Sha1NumHexChars);
+    }
+
+    TEST_F(ShaderCompilationCacheTests, ComputeKey_AnyInputChanges_KeyChanges)
+    {
+        ShaderBuilder::ShaderCompilationCache cache;
+        cache.Init(CreateSettings(), "toolchain");
+        const auto baseKey = cache.ComputeKey(m_keyInputs);
+
+        auto inputs = m_keyInputs;
+        inputs.m_hlslSourceCode = "#define o_enableFog_OPTION_DEF true\nfloat4 MainPS() : SV_Target0 { return 1; }";
+        EXPECT_NE(baseKey, cache.ComputeKey(inputs));
+
+        inputs = m_keyInputs;
+        inputs.m_apiName = "dx12";
+        EXPECT_NE(baseKey, cache.ComputeKey(inputs));
+
+        inputs = m_keyInputs;
+        inputs.m_platformIdentifier = "android";
+        EXPECT_NE(baseKey, cache.ComputeKey(inputs));
+
+        inputs = m_keyInputs;
+        inputs.m_stage = RHI::ShaderHardwareStage::Vertex;
+        EXPECT_NE(baseKey, cache.ComputeKey(inputs));
+
+        RHI::ShaderBuildArguments otherArguments = m_buildArguments;
+        otherArguments.m_dxcArguments.push_back("-Od");
+        inputs = m_keyInputs;
+        inputs.m_shaderBuildArguments = &otherArguments;
+        EXPECT_NE(baseKey, cache.ComputeKey(inputs));
+
+        // Moving an argument from one tool to another must produce a different key.
+        otherArguments = m_buildArguments;
+        otherArguments.m_dxcArguments.pop_back();
+        otherArguments.m_spirvCrossArguments.insert(otherArguments.m_spirvCrossArguments.begin(), "-O3");
+        EXPECT_NE(baseKey, cache.ComputeKey(inputs));
+
+        ShaderBuilder::ShaderCompilationCache otherToolchainCache;
+        otherToolchainCache.Init(CreateSettings(), "other toolchain");
+        EXPECT_NE(baseKey, otherToolchainCache.ComputeKey(m_keyInputs));
+    }
+
+    TEST_F(ShaderCompilationCacheTests, FingerprintToolchain_SameContentInAnotherFolder_SameFingerprint)
+    {
+        // The files are written in a different order, so they have different modification times in each folder.
+        WriteToolchainFile("MachineA", "AZSLc/azslc", "azslc 1.8.15");
+        WriteToolchainFile("MachineA", "DirectXShaderCompiler/dxc", "dxc 1.7.2308");
+        WriteToolchainFile("MachineB", "DirectXShaderCompiler/dxc", "dxc 1.7.2308");
+        WriteToolchainFile("MachineB", "AZSLc/azslc", "azslc 1.8.15");
+
+        const AZStd::string fingerprint = FingerprintToolchain("MachineA");
+        EXPECT_FALSE(fingerprint.empty());
+        EXPECT_EQ(fingerprint, FingerprintToolchain("MachineB"));
+    }
+
+    TEST_F(ShaderCompilationCacheTests, FingerprintToolchain_ContentChanges_FingerprintChanges)
+    {
+        WriteToolchainFile("MachineA", "AZSLc/azslc", "azslc 1.8.15");
+        WriteToolchainFile("MachineA", "DirectXShaderCompiler/dxc", "dxc 1.7.2308");
+        // Same file names and sizes, only the content of one binary is different.
+        WriteToolchainFile("MachineB", "AZSLc/azslc", "azslc 1.8.15");
+        WriteToolchainFile("MachineB", "DirectXShaderCompiler/dxc", "dxc 1.7.2309");
+
+        EXPECT_NE(FingerprintToolchain("MachineA"), FingerprintToolchain("MachineB"));
+    }
+
+    TEST_F(ShaderCompilationCacheTests, Load_MissingEntry_ReportsMiss)
+    {
+        ShaderBuilder::ShaderCompilationCache cache;
+        cache.Init(CreateSettings(), "toolchain");
+
+        RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+        EXPECT_FALSE(cache.Load(cache.ComputeKey(m_keyInputs), descriptor));
+
+        const auto statistics = cache.GetStatistics();
+        EXPECT_EQ(statistics.m_hits, 0);
+        EXPECT_EQ(statistics.m_misses, 1);
+    }
+
+    TEST_F(ShaderCompilationCacheTests, StoreThenLoad_RoundTripsStageDescriptor)
+    {
+        ShaderBuilder::ShaderCompilationCache cache;
+        cache.Init(CreateSettings(), "toolchain");
+
+        const auto key = cache.ComputeKey(m_keyInputs);
+        const auto storedDescriptor = CreateStageDescriptor(1000);
+        EXPECT_TRUE(cache.Store(key, storedDescriptor));
+
+        RHI::ShaderPlatformInterface::StageDescriptor loadedDescriptor;
+        ASSERT_TRUE(cache.Load(key, loadedDescriptor));
+        EXPECT_EQ(loadedDescriptor.m_stageType, storedDescriptor.m_stageType);
+        EXPECT_EQ(loadedDescriptor.m_entryFunctionName, storedDescriptor.m_entryFunctionName);
+        EXPECT_EQ(loadedDescriptor.m_byteCode, storedDescriptor.m_byteCode);
+        EXPECT_EQ(loadedDescriptor.m_sourceCode, storedDescriptor.m_sourceCode);
+        EXPECT_EQ(loadedDescriptor.m_byProducts.m_dynamicBranchCount, storedDescriptor.m_byProducts.m_dynamicBranchCount);
+        EXPECT_TRUE(loadedDescriptor.m_byProducts.m_intermediatePaths.empty());
+
+        const auto statistics = cache.GetStatistics();
+        EXPECT_EQ(statistics.m_hits, 1);
+        EXPECT_EQ(statistics.m_misses, 0);
+        EXPECT_EQ(statistics.m_stores, 1);
+    }
+
+    TEST_F(ShaderCompilationCacheTests, Load_ReadOnlyEntry_Hits)
+    {
+        ShaderBuilder::ShaderCompilationCache cache;
+        cache.Init(CreateSettings(), "toolchain");
+
+        const auto key = cache.ComputeKey(m_keyInputs);
+        const auto storedDescriptor = CreateStageDescriptor(100);
+        EXPECT_TRUE(cache.Store(key, storedDescriptor));
+
+        // A shared cache is often read-only for the machines that only consume it.
+        const AZ::IO::FixedMaxPath entryPath = cache.GetEntryPath(key);
+        ASSERT_TRUE(AZ::IO::SystemFile::SetWritable(entryPath.c_str(), false));
+
+        RHI::ShaderPlatformInterface::StageDescriptor loadedDescriptor;
+        EXPECT_TRUE(cache.Load(key, loadedDescriptor));
+        EXPECT_EQ(loadedDescriptor.m_byteCode, storedDescriptor.m_byteCode);
+        EXPECT_EQ(cache.GetStatistics().m_hits, 1);
+
+        AZ::IO::SystemFile::SetWritable(entryPath.c_str(), true);
+    }
+
+    TEST_F(ShaderCompilationCacheTests, Load_Disabled_AlwaysMisses)
+    {
+        auto settings = CreateSettings();
+        settings.m_enabled = false;
+        ShaderBuilder::ShaderCompilationCache cache;
+        cache.Init(settings, "toolchain");
+
+        const auto key = cache.ComputeKey(m_keyInputs);
+        EXPECT_FALSE(cache.Store(key, CreateStageDescriptor(16)));
+        RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+        EXPECT_FALSE(cache.Load(key, descriptor));
+    }
+
+    TEST_F(ShaderCompilationCacheTests, Trim_ExceedsMaxSize_EvictsLeastRecentlyUsed)
+    {
+        auto settings = CreateSettings();
+        settings.m_maxSizeBytes = 3000;
+        ShaderBuilder::ShaderCompilationCache cache;
+        cache.Init(settings, "toolchain");
+
+        AZStd::vector<ShaderBuilder::ShaderCompilationCache::Key> keys;
+        for (AZ::u64 i = 0; i < 4; ++i)
+        {
+            auto inputs = m_keyInputs;
+            const AZStd::string entryName = AZStd::string::format("Main%llu", i);
+            inputs.m_entryFunctionName = entryName;
+            keys.push_back(cache.ComputeKey(inputs));
+            EXPECT_TRUE(cache.Store(keys.back(), CreateStageDescriptor(1000)));
+            SetLastUsedMilliseconds(cache, keys.back(), AZStd::GetTimeUTCMilliSecond() - 1000 * (4 - i));
+        }
+
+        // Each entry is a bit more than 1000 bytes, so only the two most recently used entries fit.
+        EXPECT_EQ(cache.Trim(), 2);
+
+        RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+        EXPECT_FALSE(cache.Load(keys[0], descriptor));
+        EXPECT_FALSE(cache.Load(keys[1], descriptor));
+        EXPECT_TRUE(cache.Load(keys[2], descriptor));
+        EXPECT_TRUE(cache.Load(keys[3], descriptor));
+    }
+
+    TEST_F(ShaderCompilationCacheTests, Trim_ExpiredEntries_AreEvicted)
+    {
+        auto settings = CreateSettings();
+        settings.m_maxAgeMilliseconds = 60 * 1000;
+        ShaderBuilder::ShaderCompilationCache cache;
+        cache.Init(settings, "toolchain");
+
+        const auto key = cache.ComputeKey(m_keyInputs);
+        EXPECT_TRUE(cache.Store(key, CreateStageDescriptor(16)));
+        SetLastUsedMilliseconds(cache, key, AZStd::GetTimeUTCMilliSecond() - 2 * settings.m_maxAgeMilliseconds);
+
+        EXPECT_EQ(cache.Trim(), 1);
+        RHI::ShaderPlatformInterface::StageDescriptor descriptor;
+        EXPECT_FALSE(cache.Load(key, descriptor));
+    }
+} // namespace UnitTest
@@ -29,6 +29,8 @@ set(FILES
     Source/Editor/SrgLayoutUtility.h
     Source/Editor/ShaderBuildArgumentsManager.cpp
     Source/Editor/ShaderBuildArgumentsManager.h
+    Source/Editor/ShaderCompilationCache.cpp
+    Source/Editor/ShaderCompilationCache.h
     Source/Editor/ShaderVariantListBuilder.cpp
     Source/Editor/ShaderVariantListBuilder.h
     Source/Editor/HashedVariantListSourceData.h
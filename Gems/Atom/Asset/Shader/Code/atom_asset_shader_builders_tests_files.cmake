@@ -12,4 +12,5 @@ set(FILES
     Tests/McppBinderTests.cpp
     Tests/ShaderBuilderUtilityTests.cpp
     Tests/ShaderBuildArgumentsTests.cpp
+    Tests/ShaderCompilationCacheTests.cpp
 )
@@ -13,6 +13,7 @@
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
 #include <Atom/RHI/TagBitRegistry.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <AtomCore/std/parallel/concurrency_checker.h>
@@ -122,6 +123,7 @@ namespace AZ
             void SetVisible(bool isVisible);
             CustomMaterialInfo GetCustomMaterialWithFallback(const CustomMaterialId& id) const;
             void HandleDrawPacketUpdate();
+            void CollectStreamingImages(const Data::Instance<RPI::Material>& material);
 
             // When instancing is disabled, draw packets are owned by the ModelDataInstance
             RPI::MeshDrawPacketLods m_drawPacketListsByLod;
@@ -151,6 +153,9 @@ namespace AZ
             MeshFeatureProcessorInterface::ObjectSrgCreatedEvent m_objectSrgCreatedEvent;
             AZStd::unique_ptr<MeshLoader> m_meshLoader;
             RPI::Scene* m_scene = nullptr;
+
+            //! The streaming images used by the materials of this model. The screen size of the model is reported to them every frame it's visible.
+            AZStd::vector<Data::Instance<RPI::StreamingImage>> m_streamingImages;
             RHI::DrawItemSortKey m_sortKey = 0;
 
             TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
@@ -293,6 +298,7 @@ namespace AZ
             void SortInstanceBufferBuckets(TaskGraph& sortInstanceBufferBucketsTG, size_t viewIndex);
             void BuildInstanceBufferAndDrawCalls(TaskGraph& taskGraph, size_t viewIndex, const RPI::ViewPtr& view);
             void UpdateGPUInstanceBufferForView(size_t viewIndex, const RPI::ViewPtr& view);
+            void ReportStreamingImageScreenSizes(const RenderPacket& packet);
 
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<ModelDataInstance> m_modelData;
@@ -67,6 +67,15 @@ namespace AZ
             "Enable instanced draw calls in the MeshFeatureProcessor, but force one object per draw call. "
             "This is helpful for simulating the worst case scenario for instancing for profiling performance.");
 
+        AZ_CVAR(
+            float,
+            r_meshStreamingImageScreenHeight,
+            1080.0f,
+            nullptr,
+            AZ::ConsoleFunctorFlags::Null,
+            "The screen height (in pixels) the MeshFeatureProcessor uses to convert the screen coverage of visible meshes into the screen "
+            "size it reports to the streaming images of their materials. 0 disables the reports.");
+
         class ModelDataInstance;
 
         //! Mesh feature processor data types for customizing model materials
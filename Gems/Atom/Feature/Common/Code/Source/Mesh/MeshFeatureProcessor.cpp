@@ -449,6 +449,8 @@ namespace AZ
 
         void MeshFeatureProcessor::OnEndCulling(const MeshFeatureProcessor::RenderPacket& packet)
         {
+            ReportStreamingImageScreenSizes(packet);
+
             if (r_meshInstancingEnabled)
             {
                 AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: OnEndCulling");
@@ -510,6 +512,80 @@ namespace AZ
             }
         }
         
+        void MeshFeatureProcessor::ReportStreamingImageScreenSizes(const RenderPacket& packet)
+        {
+            AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: ReportStreamingImageScreenSizes");
+
+            const float screenHeight = r_meshStreamingImageScreenHeight;
+            if (screenHeight <= 0.0f)
+            {
+                return;
+            }
+
+            static const AZ::TaskDescriptor reportStreamingImageScreenSizesTaskDescriptor{
+                "AZ::Render::MeshFeatureProcessor::OnEndCulling - ReportStreamingImageScreenSizes", "Graphics"
+            };
+
+            AZ::TaskGraphEvent reportScreenSizesTGEvent{ "ReportStreamingImageScreenSizes Wait" };
+            AZ::TaskGraph reportScreenSizesTG{ "ReportStreamingImageScreenSizes" };
+            for (const auto& iteratorRange : m_modelData.GetParallelRanges())
+            {
+                reportScreenSizesTG.AddTask(
+                    reportStreamingImageScreenSizesTaskDescriptor,
+                    [&packet, iteratorRange, screenHeight]()
+                    {
+                        // Only the camera views decide how detailed the textures need to be. Shadow and reflection views see
+                        // the meshes at sizes which have nothing to do with how they look on screen.
+                        for (const RPI::ViewPtr& view : packet.m_views)
+                        {
+                            if ((view->GetUsageFlags() & RPI::View::UsageCamera) == 0)
+                            {
+                                continue;
+                            }
+
+                            const Matrix4x4& viewToClip = view->GetViewToClipMatrix();
+                            const float yScale = viewToClip.GetElement(1, 1);
+                            const bool isPerspective = viewToClip.GetElement(3, 3) == 0.0f;
+                            const Vector3 cameraPos = view->GetViewToWorldMatrix().GetTranslation();
+                            const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
+
+                            for (auto meshDataIter = iteratorRange.m_begin; meshDataIter != iteratorRange.m_end; ++meshDataIter)
+                            {
+                                // m_isVisible is set when the mesh passed culling in any view this frame
+                                const RPI::Cullable& cullable = meshDataIter->m_cullable;
+                                if (!cullable.m_isVisible || meshDataIter->m_streamingImages.empty())
+                                {
+                                    continue;
+                                }
+
+                                const Sphere& boundingSphere = cullable.m_cullData.m_boundingSphere;
+                                if (!ShapeIntersection::Overlaps(frustum, boundingSphere))
+                                {
+                                    continue;
+                                }
+
+                                // Assume the textures cover the mesh once, so they are displayed at about the projected size of the mesh
+                                const float screenSize = screenHeight * RPI::ModelLodUtils::ApproxScreenPercentage(
+                                    boundingSphere.GetCenter(), boundingSphere.GetRadius(), cameraPos, yScale, isPerspective);
+                                for (const Data::Instance<RPI::StreamingImage>& streamingImage : meshDataIter->m_streamingImages)
+                                {
+                                    streamingImage->ReportScreenSize(screenSize);
+                                }
+                            }
+                        }
+
+                        // The Cullable leaves it to its owner to clear the visibility flag every frame
+                        for (auto meshDataIter = iteratorRange.m_begin; meshDataIter != iteratorRange.m_end; ++meshDataIter)
+                        {
+                            meshDataIter->m_cullable.m_isVisible = false;
+                        }
+                    });
+            }
+
+            reportScreenSizesTG.Submit(&reportScreenSizesTGEvent);
+            reportScreenSizesTGEvent.Wait();
+        }
+
         void MeshFeatureProcessor::ResizePerViewInstanceVectors(size_t viewCount)
         {
             AZ_PROFILE_SCOPE(RPI, "MeshFeatureProcessor: ResizePerInstanceVectors");
@@ -1689,6 +1765,7 @@ namespace AZ
 
             m_customMaterials.clear();
             m_objectSrgList = {};
+            m_streamingImages.clear();
             m_model = {};
         }
 
@@ -1722,7 +1799,8 @@ namespace AZ
                 m_postCullingInstanceDataByLod.resize(modelLodCount);
                 m_updateDrawPacketEventHandlersByLod.resize(modelLodCount);
             }
-            
+
+            m_streamingImages.clear();
             for (size_t modelLodIndex = 0; modelLodIndex < modelLodCount; ++modelLodIndex)
             {
                 BuildDrawPacketList(meshFeatureProcessor, modelLodIndex);
@@ -1848,6 +1926,8 @@ namespace AZ
                     continue;
                 }
 
+                CollectStreamingImages(material);
+
                 auto& objectSrgLayout = material->GetAsset()->GetObjectSrgLayout();
 
                 if (!objectSrgLayout)
@@ -2012,6 +2092,24 @@ namespace AZ
             }
         }
 
+        void ModelDataInstance::CollectStreamingImages(const Data::Instance<RPI::Material>& material)
+        {
+            for (const RPI::MaterialPropertyValue& propertyValue : material->GetPropertyValues())
+            {
+                if (!propertyValue.Is<Data::Instance<RPI::Image>>())
+                {
+                    continue;
+                }
+
+                Data::Instance<RPI::StreamingImage> streamingImage =
+                    azrtti_cast<RPI::StreamingImage*>(propertyValue.GetValue<Data::Instance<RPI::Image>>().get());
+                if (streamingImage && AZStd::find(m_streamingImages.begin(), m_streamingImages.end(), streamingImage) == m_streamingImages.end())
+                {
+                    m_streamingImages.push_back(AZStd::move(streamingImage));
+                }
+            }
+        }
+
         void ModelDataInstance::SetRayTracingData(MeshFeatureProcessor* meshFeatureProcessor)
         {
             RayTracingFeatureProcessor* rayTracingFeatureProcessor = meshFeatureProcessor->GetRayTracingFeatureProcessor();
@@ -2119,6 +2217,14 @@ namespace AZ
                     material->GetAsset()->GetMaterialTypeAsset()->GetUvNameMap());
                 AZ_Assert(result, "Failed to retrieve mesh stream buffer views");
 
+                // the layout now has the formats of the mesh streams, which are 16-bit when the model was optimized
+                const AZStd::span<const RHI::StreamChannelDescriptor> streamChannels = inputStreamLayout.GetStreamChannels();
+                const RHI::Format positionFormat = streamChannels[0].m_format;
+                const RHI::Format normalFormat = streamChannels[1].m_format;
+                const RHI::Format tangentFormat = streamChannels[2].m_format;
+                const RHI::Format bitangentFormat = streamChannels[3].m_format;
+                const RHI::Format uvFormat = streamChannels[4].m_format;
+
                 // note that the element count is the size of the entire buffer, even though this mesh may only
                 // occupy a portion of the vertex buffer.  This is necessary since we are accessing it using
                 // a ByteAddressBuffer in the raytracing shaders and passing the byte offset to the shader in a constant buffer.
@@ -2137,6 +2243,20 @@ namespace AZ
                 uint32_t uvBufferByteCount = static_cast<uint32_t>(const_cast<RHI::Buffer*>(streamBufferViews[4].GetBuffer())->GetDescriptor().m_byteCount);
                 RHI::BufferViewDescriptor uvBufferDescriptor = RHI::BufferViewDescriptor::CreateRaw(0, uvBufferByteCount);
 
+                // the raytracing shaders decode the full precision streams and the 16-bit streams written by the model builder,
+                // missing optional streams have a dummy format and no data
+                const bool hasSupportedFormats =
+                    positionFormat == PositionStreamFormat &&
+                    (normalFormat == NormalStreamFormat || normalFormat == RHI::Format::R16G16B16A16_SNORM) &&
+                    (tangentBufferByteCount == 0 || tangentFormat == TangentStreamFormat || tangentFormat == RHI::Format::R16G16B16A16_SNORM) &&
+                    (bitangentBufferByteCount == 0 || bitangentFormat == BitangentStreamFormat || bitangentFormat == RHI::Format::R16G16B16A16_SNORM) &&
+                    (uvBufferByteCount == 0 || uvFormat == UVStreamFormat || uvFormat == RHI::Format::R16G16_FLOAT);
+                if (!hasSupportedFormats)
+                {
+                    AZ_Warning("MeshFeatureProcessor", false, "Mesh has vertex stream formats that are not supported by raytracing. Skipping.");
+                    continue;
+                }
+
                 const RHI::IndexBufferView& indexBufferView = mesh.m_indexBufferView;
                 uint32_t indexElementSize = indexBufferView.GetIndexFormat() == RHI::IndexFormat::Uint16 ? 2 : 4;
                 uint32_t indexElementCount = (uint32_t)indexBufferView.GetBuffer()->GetDescriptor().m_byteCount / indexElementSize;
@@ -2152,14 +2272,22 @@ namespace AZ
                 subMesh.m_positionVertexBufferView = streamBufferViews[0];
                 subMesh.m_positionShaderBufferView = const_cast<RHI::Buffer*>(streamBufferViews[0].GetBuffer())->GetBufferView(positionBufferDescriptor);
 
-                subMesh.m_normalFormat = NormalStreamFormat;
+                subMesh.m_normalFormat = normalFormat;
+                if (normalFormat == RHI::Format::R16G16B16A16_SNORM)
+                {
+                    subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::NormalSnorm16;
+                }
                 subMesh.m_normalVertexBufferView = streamBufferViews[1];
                 subMesh.m_normalShaderBufferView = const_cast<RHI::Buffer*>(streamBufferViews[1].GetBuffer())->GetBufferView(normalBufferDescriptor);
 
                 if (tangentBufferByteCount > 0)
                 {
                     subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::Tangent;
-                    subMesh.m_tangentFormat = TangentStreamFormat;
+                    subMesh.m_tangentFormat = tangentFormat;
+                    if (tangentFormat == RHI::Format::R16G16B16A16_SNORM)
+                    {
+                        subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::TangentSnorm16;
+                    }
                     subMesh.m_tangentVertexBufferView = streamBufferViews[2];
                     subMesh.m_tangentShaderBufferView = const_cast<RHI::Buffer*>(streamBufferViews[2].GetBuffer())->GetBufferView(tangentBufferDescriptor);
                 }
@@ -2167,7 +2295,11 @@ namespace AZ
                 if (bitangentBufferByteCount > 0)
                 {
                     subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::Bitangent;
-                    subMesh.m_bitangentFormat = BitangentStreamFormat;
+                    subMesh.m_bitangentFormat = bitangentFormat;
+                    if (bitangentFormat == RHI::Format::R16G16B16A16_SNORM)
+                    {
+                        subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::BitangentSnorm16;
+                    }
                     subMesh.m_bitangentVertexBufferView = streamBufferViews[3];
                     subMesh.m_bitangentShaderBufferView = const_cast<RHI::Buffer*>(streamBufferViews[3].GetBuffer())->GetBufferView(bitangentBufferDescriptor);
                 }
@@ -2175,11 +2307,19 @@ namespace AZ
                 if (uvBufferByteCount > 0)
                 {
                     subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::UV;
-                    subMesh.m_uvFormat = UVStreamFormat;
+                    subMesh.m_uvFormat = uvFormat;
+                    if (uvFormat == RHI::Format::R16G16_FLOAT)
+                    {
+                        subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::UVFloat16;
+                    }
                     subMesh.m_uvVertexBufferView = streamBufferViews[4];
                     subMesh.m_uvShaderBufferView = const_cast<RHI::Buffer*>(streamBufferViews[4].GetBuffer())->GetBufferView(uvBufferDescriptor);
                 }
 
+                if (indexBufferView.GetIndexFormat() == RHI::IndexFormat::Uint16)
+                {
+                    subMesh.m_bufferFlags |= RayTracingSubMeshBufferFlags::Index16;
+                }
                 subMesh.m_indexBufferView = mesh.m_indexBufferView;
                 subMesh.m_indexShaderBufferView = const_cast<RHI::Buffer*>(mesh.m_indexBufferView.GetBuffer())->GetBufferView(indexBufferDescriptor);
 
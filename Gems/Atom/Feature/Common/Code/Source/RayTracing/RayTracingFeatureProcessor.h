@@ -42,7 +42,14 @@ namespace AZ
 
             Tangent     = AZ_BIT(0),
             Bitangent   = AZ_BIT(1),
-            UV          = AZ_BIT(2)
+            UV          = AZ_BIT(2),
+
+            // formats of the optimized mesh streams, otherwise the streams are 32-bit
+            Index16             = AZ_BIT(3),
+            NormalSnorm16       = AZ_BIT(4),
+            TangentSnorm16      = AZ_BIT(5),
+            BitangentSnorm16    = AZ_BIT(6),
+            UVFloat16           = AZ_BIT(7)
         };
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::Render::RayTracingSubMeshBufferFlags);
 
@@ -74,6 +74,11 @@ namespace AZ
             //! Requests the image mips be made available.
             //! A value of 0 is the most detailed mip level. The value is clamped to the last mip in the chain.
             void SetTargetMip(uint16_t targetMipLevel);
+
+            //! Reports the size (in pixels) the image is displayed at in a view, e.g. the projected screen size of a mesh scaled
+            //! by its texel density. It may be called from any thread, any number of times per frame. The largest size reported
+            //! by the recent views drives the target mip level and the streaming priority of the image, instead of SetTargetMip().
+            void ReportScreenSize(float screenSizeInPixels);
             
             const Data::Instance<StreamingImagePool>& GetPool() const;
 
@@ -94,7 +99,8 @@ namespace AZ
 
             //! Queues an expansion operation which fetches mip chain assets from disk. Each time a contiguous range
             //! of mip chain assets are ready, an expansion is triggered for non-streamable image or is queued on the parent controller for streamable image.
-            void QueueExpandToMipChainLevel(size_t mipChainLevel);
+            //! @param loadParams The asset load parameters (streaming deadline and priority) used to fetch the mip chain assets.
+            void QueueExpandToMipChainLevel(size_t mipChainLevel, const Data::AssetLoadParameters& loadParams = {});
             
             //! Queues an expansion to the mip chain that is one level higher than the resident mip chain.
             void QueueExpandToNextMipChainLevel();
@@ -153,7 +159,7 @@ namespace AZ
             // Fetches the mip chain asset associated with the provided index. This will invoke a
             // streaming request from the asset system, which will take time. Fires an event to the
             // streaming controller when the mip is ready.            
-            void FetchMipChainAsset(size_t mipChainIndex);
+            void FetchMipChainAsset(size_t mipChainIndex, const Data::AssetLoadParameters& loadParams);
             
             // Returns whether the mip chain is loaded.
             bool IsMipChainAssetReady(size_t mipChainIndex) const;
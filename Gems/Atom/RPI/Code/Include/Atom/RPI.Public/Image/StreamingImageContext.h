@@ -11,6 +11,7 @@
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/intrusive_list.h>
 
 #include <Atom/RHI.Reflect/Limits.h>
@@ -54,12 +55,20 @@ namespace AZ
             //! Returns the timestamp of last access.
             size_t GetLastAccessTimestamp() const;
 
-            //! Calculate some mip stats which are used for determinate their expansion or eviction orders
-            //! The stats include: m_mipLevelTargetAdjusted, m_residentMip, m_evictableMips, m_missingMips, m_residentMipSize
-            //! This function need to be called every time after a mip is expanded or evicted or when the global mip bias is changed
-            void UpdateMipStats();
+            //! Returns the streaming priority score computed by the last controller update.
+            float GetStreamingScore() const;
 
         private:
+            // Estimates the device memory used by each mip chain of the image.
+            // Called by the controller when the image is attached.
+            void InitMipChainSizes();
+
+            // Merges the screen sizes reported since the last update into the recent screen size of the image,
+            // and updates the target mip level to match it.
+            void UpdateScreenSize();
+
+            // Returns the resolution the image is needed at, from its recent screen size or its target mip level.
+            float GetDemandedSize() const;
 
             // Holds a weak (raw) reference to the parent streaming image.
             StreamingImage* m_streamingImage = nullptr;
@@ -68,22 +77,30 @@ namespace AZ
             AZStd::atomic_bool m_queuedForMipExpand = {false};
 
             // Tracks the desired target mip level. Default to 0 which is the mip level with highest detail.
-            // User may use StreamingImage::SetTargetMip() function to set the target mip level for the image
+            // User may use StreamingImage::SetTargetMip() function to set the target mip level for the image.
+            // Once views report screen sizes for the image with StreamingImage::ReportScreenSize(), they drive the target mip level instead.
             AZStd::atomic_uint16_t m_mipLevelTarget = {0};
 
             // Tracks the last timestamp the image was requested.
             AZStd::atomic_size_t m_lastAccessTimestamp = {0};
-                        
-            // The target mip level which applied global mip bias
-            uint16_t m_mipLevelTargetAdjusted = 0;
-            // The most detailed mip which is resident
-            uint16_t m_residentMip = 0;
-            // The number of mips which can be evicted
-            uint16_t m_evictableMips = 0;
-            // The mips which are missing to reach m_mipLevelTargetAdjusted 
-            uint16_t m_missingMips = 0;
-            // The size of the most detailed mip
-            uint32_t m_residentMipSize = 1;
+
+            // The largest screen size (in pixels) reported by the views since the last update.
+            AZStd::atomic_uint32_t m_frameScreenSize = {0};
+
+            // Whether any view has reported a screen size for the image.
+            AZStd::atomic_bool m_hasScreenSize = {false};
+
+            // The largest screen size reported by recent views. It decays a bit every update the image isn't seen at that size.
+            float m_recentScreenSize = 0.0f;
+
+            // The streaming priority score of the image, recomputed every update.
+            float m_streamingScore = 0.0f;
+
+            // The mip chain the controller planned for the image under the memory budget.
+            uint16_t m_plannedMipChain = 0;
+
+            // The estimated device memory of each mip chain, from the most detailed to the tail mip chain.
+            AZStd::fixed_vector<size_t, RHI::Limits::Image::MipCountMax> m_mipChainSizes;
         };
 
         using StreamingImageContextPtr = AZStd::intrusive_ptr<StreamingImageContext>;
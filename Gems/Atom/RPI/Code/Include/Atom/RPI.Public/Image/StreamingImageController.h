@@ -10,9 +10,13 @@
 
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/span.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 
 #include <Atom/RPI.Public/Image/StreamingImage.h>
@@ -30,6 +34,12 @@ namespace AZ
     {
         class StreamingImage;
 
+        //! Schedules the mip chain streaming of the streamable images of a pool.
+        //! Every update, each image is scored from the screen size the views reported for it (or its target mip) and
+        //! the number of updates since it was last used. The controller then plans a target mip chain for every image
+        //! under the streaming memory budget, favoring the mip chains with the highest score per byte. Images above their
+        //! planned mip chain are trimmed right away; images below it fetch their mip chains from disk in score order,
+        //! with streamer deadlines which let the most important requests jump the IO queue.
         class StreamingImageController
         {
             friend class StreamingImagePool;
@@ -37,6 +47,40 @@ namespace AZ
             friend class StreamingImageContext;
 
         public:
+            //! The number of updates an image stays "recently used" for. The score of an image is halved when it
+            //! hasn't been used for this many updates.
+            static constexpr size_t RecentUseUpdateCount = 30;
+
+            //! The factor applied each update to the recent screen size of an image which wasn't reported at that size again.
+            static constexpr float ScreenSizeDecay = 0.95f;
+
+            //! The streaming deadline given to the mip chain fetches of the highest scored image. Each following image gets
+            //! one more of these, so the expansions issued in an update complete in priority order.
+            static constexpr AZStd::chrono::milliseconds ExpandDeadlineStep = AZStd::chrono::milliseconds(33);
+
+            //! The planning input and output for one image.
+            struct MipChainPlanEntry
+            {
+                //! [Input] The device memory of each mip chain, from the most detailed to the tail mip chain.
+                AZStd::fixed_vector<size_t, RHI::Limits::Image::MipCountMax> m_mipChainSizes;
+                //! [Input] The most detailed mip chain the image needs.
+                uint16_t m_desiredMipChain = 0;
+                //! [Input] The streaming score of the image. Higher scored images get their mip chains first.
+                float m_score = 0.0f;
+                //! [Output] The most detailed mip chain which fits in the budget.
+                uint16_t m_targetMipChain = 0;
+            };
+
+            //! Plans the target mip chain of every entry so the total memory of the target mip chains fits in the memory budget.
+            //! Every entry always keeps its tail mip chain. The remaining mip chains are added greedily, by highest score
+            //! per byte first, while they fit in the budget. A budget of 0 means there is no budget.
+            //! Returns the total memory of the planned mip chains.
+            static size_t PlanMipChainTargets(AZStd::span<MipChainPlanEntry> entries, size_t memoryBudget);
+
+            //! Returns the streaming score of an image from the size (in pixels) it is demanded at and the number of
+            //! updates since it was last used.
+            static float ComputeStreamingScore(float demandedSize, size_t updatesSinceLastUse);
+
             //! Create a StreamingImageController
             static AZStd::unique_ptr<StreamingImageController> Create(RHI::StreamingImagePool& pool);
 
@@ -44,6 +88,26 @@ namespace AZ
             ~StreamingImageController() = default;
 
         protected:
+            //! A candidate upgrade of a planning entry to its next more detailed mip chain.
+            struct MipChainUpgrade
+            {
+                //! The score gained per byte of the upgrade.
+                float m_priority = 0.0f;
+                size_t m_entryIndex = 0;
+
+                //! Max heap ordering: highest priority first, then lowest entry index so the plan is deterministic.
+                bool operator<(const MipChainUpgrade& other) const
+                {
+                    if (m_priority == other.m_priority)
+                    {
+                        return m_entryIndex > other.m_entryIndex;
+                    }
+                    return m_priority < other.m_priority;
+                }
+            };
+
+            //! Same as PlanMipChainTargets() above, with a caller provided scratch buffer for the candidate upgrades.
+            static size_t PlanMipChainTargets(AZStd::span<MipChainPlanEntry> entries, size_t memoryBudget, AZStd::vector<MipChainUpgrade>& upgrades);
 
             //! Attaches an instance of an image streaming asset to the controller.
             void AttachImage(StreamingImage* image);
@@ -60,6 +124,7 @@ namespace AZ
             //! Called by the streaming image when events occur.
             void OnSetTargetMip(StreamingImage* image, uint16_t targetMipLevel);
             void OnMipChainAssetReady(StreamingImage* image);
+            void OnReportScreenSize(StreamingImage* image, float screenSizeInPixels);
 
             //! Returns the number of images which are expanding their mipmaps
             uint32_t GetExpandingImageCount() const;
@@ -81,6 +146,12 @@ namespace AZ
             //! Return whether the available memory of the streaming image pool is low
             bool IsMemoryLow() const;
 
+            //! Set the memory budget the mip chains are planned against. 0 uses the pool's device memory budget.
+            void SetStreamingBudget(size_t budgetInBytes);
+
+            //! Returns the memory budget the mip chains are planned against. 0 means there is no budget.
+            size_t GetStreamingBudget() const;
+
         protected:
             using StreamingImageContextList = AZStd::intrusive_list<StreamingImageContext, AZStd::list_base_hook<StreamingImageContext>>;
 
@@ -88,8 +159,14 @@ namespace AZ
             // Evict one mip chain for the streaming image with lowest priority
             bool EvictOneMipChain();
 
-            // Stream in one mip chain for the streaming image with highest priority
-            bool ExpandOneMipChain();
+            // Scores all the streamable images and plans their target mip chains under the streaming budget
+            void UpdateStreamingPlan();
+
+            // Trims the images which have more mip chains than planned
+            void EvictToPlannedTargets();
+
+            // Queues the mip chain fetches of up to maxCount images which have fewer mip chains than planned, by highest score first
+            void ExpandToPlannedTargets(uint32_t maxCount);
 
             // Evict mipmaps for specific image
             // Return true if any mipmaps were evicted
@@ -101,15 +178,9 @@ namespace AZ
             // Get gpu memory usage of the streaming image pool
             size_t GetPoolMemoryUsage();
 
-            // Insert image to expandable and evictable lists
-            void ReinsertImageToLists(StreamingImage* image);
-
             // Called when the expanding of an image is finished or canceled
             void EndExpandImage(StreamingImage* image);
 
-            // Return whether an image need to expand its mipmap
-            bool NeedExpand(const StreamingImage* image) const;
-
             // Reset the cached variables related to last memory value when the controller receives low memory notification
             void ResetLowMemoryState();
 
@@ -134,35 +205,28 @@ namespace AZ
             // All the images which are managed by StreamingImageController
             AZStd::set<StreamingImage*> m_streamableImages;
 
-            // All the images which are managed by StreamingImageController can be in one or few of the following lists
-            // m_expandableImages, m_evictableImages or m_expandingImages
-            // - When an image hasn't reached its target mipmap level, it will be in the m_expandableImages list
-            // - When an image has mipmaps that can be evicted, it's in m_evictableImages list
-            // - When an image is in the process of expanding, it will be removed from m_expandableImages and added to m_expandingImages list
-            // - It's possible for an image to be in both m_expandableImages and m_evictableImages list.
-            // - Expanding will be canceled when memory is low
-            // - When an image is done expanding or evicted, they will get re-inserted back into m_expandableImages and m_evictableImages list
-            
-            // A list of expandable images which are sorted by their expanding priority
-            struct ExpandPriorityComparator
-            {
-                bool operator()(const StreamingImage* lhs, const StreamingImage* rhs) const;
-            };
-            AZStd::set<StreamingImage*, ExpandPriorityComparator> m_expandableImages;
-            // A list of images which have evictable mipmap. They are sorted by their evicting priority.
-            struct EvictPriorityComparator
-            {
-                bool operator()(const StreamingImage* lhs, const StreamingImage* rhs) const;
-            };
-
-            AZStd::set<StreamingImage*, EvictPriorityComparator> m_evictableImages;
             // mutex for access the image lists
             AZStd::recursive_mutex m_imageListAccessMutex;
 
-            // The images which are expanding will be added to this list and removed from m_streamableImages list.
-            // Once their expansion is finished, they would be removed from this list and added back to m_evictableImages or/and m_expandableImages list
+            // The images which are fetching or uploading mip chains. An image is removed from this list once its expansion
+            // is finished or canceled.
             AZStd::unordered_set<StreamingImage*> m_expandingImages;
 
+            // The planning entries of the streamable images and the matching images, rebuilt every update.
+            AZStd::vector<MipChainPlanEntry> m_planEntries;
+            AZStd::vector<StreamingImage*> m_planImages;
+
+            // Scratch buffers of the planning and expansion, kept between updates so they don't allocate every update.
+            AZStd::vector<MipChainUpgrade> m_planUpgrades;
+            AZStd::vector<StreamingImage*> m_expandImages;
+
+            // The memory budget set with SetStreamingBudget(). 0 uses the pool's device memory budget.
+            // It's set from any thread, while the update reads it.
+            AZStd::atomic_size_t m_streamingBudget{ 0 };
+
+            // The total memory of the mip chains planned by the last update.
+            size_t m_plannedMemoryUsage = 0;
+
             // A monotonically increasing counter used to track image mip requests. Useful for sorting contexts by LRU.
             size_t m_timestamp = 0;
 
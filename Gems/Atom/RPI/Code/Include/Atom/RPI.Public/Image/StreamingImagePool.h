@@ -77,6 +77,15 @@ namespace AZ
                         
             int16_t GetMipBias() const;
 
+            //! Set the device memory budget the streaming controller plans the images' mip chains against.
+            //! A value of 0 (the default) plans against the pool's heap memory budget instead. This allows simulating
+            //! a budget, for example on an RHI which doesn't support setting the pool's memory budget.
+            void SetStreamingBudget(size_t budgetInBytes);
+
+            //! Returns the device memory budget used by the streaming controller to plan the images' mip chains.
+            //! A value of 0 means there is no budget.
+            size_t GetStreamingBudget() const;
+
         private:
             StreamingImagePool() = default;
 
@@ -52,6 +52,7 @@ namespace AZ
 
             static AZStd::span<const float> GetPositionsBuffer(const ModelLodAsset::Mesh& mesh);
 
+            //! Returns the triangles of a mesh with 32-bit indices.
             static AZStd::span<const TriangleIndices> GetIndexBuffer(const ModelLodAsset::Mesh& mesh);
 
         private:
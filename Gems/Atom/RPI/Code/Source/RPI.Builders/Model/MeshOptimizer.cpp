@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Model/MeshOptimizer.h>
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/sort.h>
+
+#include <math.h>
+#include <string.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace MeshOptimizer
+        {
+            namespace
+            {
+                constexpr uint32_t InvalidIndex = ~0u;
+
+                // Scoring of Tom Forsyth's "Linear-Speed Vertex Cache Optimisation".
+                // The cache is a LRU cache, bigger than the actual hardware caches, since the scores only need to favor the most recently used vertices.
+                constexpr uint32_t ForsythCacheSize = 32;
+                constexpr float CacheDecayPower = 1.5f;
+                constexpr float LastTriangleScore = 0.75f;
+                constexpr float ValenceBoostScale = 2.0f;
+                constexpr float ValenceBoostPower = 0.5f;
+
+                float CalculateVertexScore(int32_t cachePosition, uint32_t remainingValence)
+                {
+                    if (remainingValence == 0)
+                    {
+                        // No triangle left to use this vertex
+                        return -1.0f;
+                    }
+
+                    float score = 0.0f;
+                    if (cachePosition >= 0)
+                    {
+                        if (cachePosition < 3)
+                        {
+                            // The vertices of the last triangle get a fixed score, so the next triangle doesn't just reuse the same edge
+                            score = LastTriangleScore;
+                        }
+                        else
+                        {
+                            const float scaler = 1.0f / (ForsythCacheSize - 3);
+                            score = powf(1.0f - (cachePosition - 3) * scaler, CacheDecayPower);
+                        }
+                    }
+
+                    // Favor the vertices with few triangles left, so they get out of the way instead of leaving lone triangles for the end
+                    score += ValenceBoostScale * powf(static_cast<float>(remainingValence), -ValenceBoostPower);
+                    return score;
+                }
+
+                Vector3 GetPosition(AZStd::span<const float> positions, uint32_t vertex)
+                {
+                    return Vector3(positions[vertex * 3], positions[vertex * 3 + 1], positions[vertex * 3 + 2]);
+                }
+
+                // Runs the FIFO cache simulation used by CalculateAcmr() one triangle at a time, so the cache can be flushed
+                // at arbitrary triangles.
+                class FifoCacheSimulation
+                {
+                public:
+                    FifoCacheSimulation(size_t vertexCount, uint32_t cacheSize)
+                        : m_cacheTimestamps(vertexCount, 0)
+                        , m_cacheSize(cacheSize)
+                        , m_timestamp(cacheSize + 1)
+                    {
+                    }
+
+                    uint32_t AddTriangle(const uint32_t* triangle)
+                    {
+                        uint32_t misses = 0;
+                        for (size_t corner = 0; corner < 3; ++corner)
+                        {
+                            // The vertex is in the cache if less than m_cacheSize vertices were added since it was added
+                            const uint32_t vertex = triangle[corner];
+                            if (m_timestamp - m_cacheTimestamps[vertex] > m_cacheSize)
+                            {
+                                m_cacheTimestamps[vertex] = m_timestamp++;
+                                ++misses;
+                            }
+                        }
+                        return misses;
+                    }
+
+                    void Flush()
+                    {
+                        m_timestamp += m_cacheSize + 1;
+                    }
+
+                private:
+                    AZStd::vector<uint32_t> m_cacheTimestamps;
+                    uint32_t m_cacheSize;
+                    uint32_t m_timestamp;
+                };
+            } // namespace
+
+            float CalculateAcmr(AZStd::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize)
+            {
+                const size_t triangleCount = indices.size() / 3;
+                if (triangleCount == 0)
+                {
+                    return 0.0f;
+                }
+
+                FifoCacheSimulation cache(vertexCount, cacheSize);
+                size_t misses = 0;
+                for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+                {
+                    misses += cache.AddTriangle(&indices[triangle * 3]);
+                }
+                return static_cast<float>(misses) / static_cast<float>(triangleCount);
+            }
+
+            void OptimizeVertexCache(AZStd::span<uint32_t> indices, size_t vertexCount)
+            {
+                const size_t triangleCount = indices.size() / 3;
+                if (triangleCount < 2)
+                {
+                    return;
+                }
+
+                // Build the list of triangles of each vertex. The first remainingValence[vertex] triangles of each list are
+                // the ones not emitted yet.
+                AZStd::vector<uint32_t> remainingValence(vertexCount, 0);
+                for (size_t i = 0; i < triangleCount * 3; ++i)
+                {
+                    ++remainingValence[indices[i]];
+                }
+
+                AZStd::vector<uint32_t> vertexTrianglesOffset(vertexCount + 1, 0);
+                for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    vertexTrianglesOffset[vertex + 1] = vertexTrianglesOffset[vertex] + remainingValence[vertex];
+                }
+
+                AZStd::vector<uint32_t> vertexTriangles(triangleCount * 3);
+                {
+                    AZStd::vector<uint32_t> fillCount(vertexCount, 0);
+                    for (size_t i = 0; i < triangleCount * 3; ++i)
+                    {
+                        const uint32_t vertex = indices[i];
+                        vertexTriangles[vertexTrianglesOffset[vertex] + fillCount[vertex]++] = static_cast<uint32_t>(i / 3);
+                    }
+                }
+
+                AZStd::vector<int32_t> cachePosition(vertexCount, -1);
+                AZStd::vector<float> vertexScore(vertexCount);
+                for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    vertexScore[vertex] = CalculateVertexScore(-1, remainingValence[vertex]);
+                }
+
+                AZStd::vector<float> triangleScore(triangleCount);
+                AZStd::vector<bool> triangleEmitted(triangleCount, false);
+                uint32_t bestTriangle = 0;
+                for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+                {
+                    triangleScore[triangle] = vertexScore[indices[triangle * 3]] + vertexScore[indices[triangle * 3 + 1]] +
+                        vertexScore[indices[triangle * 3 + 2]];
+                    if (triangleScore[triangle] > triangleScore[bestTriangle])
+                    {
+                        bestTriangle = static_cast<uint32_t>(triangle);
+                    }
+                }
+
+                AZStd::vector<uint32_t> optimizedIndices;
+                optimizedIndices.reserve(triangleCount * 3);
+
+                // The new cache is built with the vertices of the emitted triangle first, so it can exceed the cache size by 3
+                AZStd::array<uint32_t, ForsythCacheSize + 3> cache;
+                AZStd::array<uint32_t, ForsythCacheSize + 3> newCache;
+                size_t cacheCount = 0;
+                size_t scanCursor = 0;
+
+                for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+                {
+                    if (bestTriangle == InvalidIndex)
+                    {
+                        // None of the vertices in the cache has any triangle left, continue with the next triangle in the source order
+                        while (triangleEmitted[scanCursor])
+                        {
+                            ++scanCursor;
+                        }
+                        bestTriangle = static_cast<uint32_t>(scanCursor);
+                    }
+
+                    const uint32_t* triangleVertices = &indices[bestTriangle * 3];
+                    triangleEmitted[bestTriangle] = true;
+                    optimizedIndices.insert(optimizedIndices.end(), triangleVertices, triangleVertices + 3);
+
+                    size_t newCacheCount = 0;
+                    for (size_t corner = 0; corner < 3; ++corner)
+                    {
+                        const uint32_t vertex = triangleVertices[corner];
+
+                        // Remove the triangle from the remaining triangles of the vertex
+                        uint32_t* triangles = &vertexTriangles[vertexTrianglesOffset[vertex]];
+                        uint32_t& valence = remainingValence[vertex];
+                        for (uint32_t i = 0; i < valence; ++i)
+                        {
+                            if (triangles[i] == bestTriangle)
+                            {
+                                AZStd::swap(triangles[i], triangles[valence - 1]);
+                                --valence;
+                                break;
+                            }
+                        }
+
+                        if (AZStd::find(newCache.begin(), newCache.begin() + newCacheCount, vertex) == newCache.begin() + newCacheCount)
+                        {
+                            newCache[newCacheCount++] = vertex;
+                        }
+                    }
+
+                    for (size_t i = 0; i < cacheCount; ++i)
+                    {
+                        const uint32_t vertex = cache[i];
+                        if (vertex != triangleVertices[0] && vertex != triangleVertices[1] && vertex != triangleVertices[2])
+                        {
+                            newCache[newCacheCount++] = vertex;
+                        }
+                    }
+
+                    // Update the scores of the vertices whose position in the cache changed, including the ones pushed out of
+                    // the cache, and the scores of their remaining triangles
+                    for (size_t i = 0; i < newCacheCount; ++i)
+                    {
+                        const uint32_t vertex = newCache[i];
+                        cachePosition[vertex] = i < ForsythCacheSize ? static_cast<int32_t>(i) : -1;
+
+                        const float score = CalculateVertexScore(cachePosition[vertex], remainingValence[vertex]);
+                        const float scoreDelta = score - vertexScore[vertex];
+                        vertexScore[vertex] = score;
+
+                        const uint32_t* triangles = &vertexTriangles[vertexTrianglesOffset[vertex]];
+                        for (uint32_t j = 0; j < remainingValence[vertex]; ++j)
+                        {
+                            triangleScore[triangles[j]] += scoreDelta;
+                        }
+                    }
+
+                    cacheCount = AZStd::min<size_t>(newCacheCount, ForsythCacheSize);
+                    AZStd::swap(cache, newCache);
+
+                    // The next triangle is the best triangle that uses a vertex of the cache
+                    bestTriangle = InvalidIndex;
+                    float bestScore = -1.0f;
+                    for (size_t i = 0; i < cacheCount; ++i)
+                    {
+                        const uint32_t vertex = cache[i];
+                        const uint32_t* triangles = &vertexTriangles[vertexTrianglesOffset[vertex]];
+                        for (uint32_t j = 0; j < remainingValence[vertex]; ++j)
+                        {
+                            if (triangleScore[triangles[j]] > bestScore)
+                            {
+                                bestScore = triangleScore[triangles[j]];
+                                bestTriangle = triangles[j];
+                            }
+                        }
+                    }
+                }
+
+                AZStd::copy(optimizedIndices.begin(), optimizedIndices.end(), indices.begin());
+            }
+
+            void OptimizeOverdraw(AZStd::span<uint32_t> indices, AZStd::span<const float> positions, size_t vertexCount, float threshold)
+            {
+                const size_t triangleCount = indices.size() / 3;
+                if (triangleCount < 2)
+                {
+                    return;
+                }
+
+                // Hard boundaries: the triangles that miss the cache on all their vertices start a new cluster, since reordering
+                // the clusters at these points doesn't change the ACMR
+                AZStd::vector<uint32_t> hardClusterStarts;
+                size_t totalMisses = 0;
+                {
+                    FifoCacheSimulation cache(vertexCount, VertexCacheSize);
+                    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+                    {
+                        const uint32_t misses = cache.AddTriangle(&indices[triangle * 3]);
+                        totalMisses += misses;
+                        if (triangle == 0 || misses == 3)
+                        {
+                            hardClusterStarts.push_back(static_cast<uint32_t>(triangle));
+                        }
+                    }
+                }
+                hardClusterStarts.push_back(static_cast<uint32_t>(triangleCount));
+
+                // Soft boundaries: split the hard clusters further as soon as the ACMR of the cluster so far, counting the
+                // cache flush at its start, is under the threshold
+                const float acmrThreshold = static_cast<float>(totalMisses) / static_cast<float>(triangleCount) * AZStd::max(threshold, 1.0f);
+                AZStd::vector<uint32_t> clusterStarts;
+                {
+                    FifoCacheSimulation cache(vertexCount, VertexCacheSize);
+                    for (size_t hardCluster = 0; hardCluster + 1 < hardClusterStarts.size(); ++hardCluster)
+                    {
+                        uint32_t clusterStart = hardClusterStarts[hardCluster];
+                        const uint32_t hardClusterEnd = hardClusterStarts[hardCluster + 1];
+                        clusterStarts.push_back(clusterStart);
+                        cache.Flush();
+
+                        uint32_t clusterMisses = 0;
+                        for (uint32_t triangle = clusterStart; triangle < hardClusterEnd; ++triangle)
+                        {
+                            clusterMisses += cache.AddTriangle(&indices[triangle * 3]);
+                            const uint32_t clusterSize = triangle - clusterStart + 1;
+                            if (triangle + 1 < hardClusterEnd && static_cast<float>(clusterMisses) <= acmrThreshold * clusterSize)
+                            {
+                                clusterStart = triangle + 1;
+                                clusterStarts.push_back(clusterStart);
+                                clusterMisses = 0;
+                                cache.Flush();
+                            }
+                        }
+                    }
+                }
+                const size_t clusterCount = clusterStarts.size();
+                clusterStarts.push_back(static_cast<uint32_t>(triangleCount));
+                if (clusterCount < 2)
+                {
+                    return;
+                }
+
+                // Sort the clusters by how much they face away from the center of the mesh
+                AZStd::vector<Vector3> clusterCentroids(clusterCount, Vector3::CreateZero());
+                AZStd::vector<Vector3> clusterNormals(clusterCount, Vector3::CreateZero());
+                Vector3 meshCentroid = Vector3::CreateZero();
+                float meshArea = 0.0f;
+                for (size_t cluster = 0; cluster < clusterCount; ++cluster)
+                {
+                    float clusterArea = 0.0f;
+                    for (uint32_t triangle = clusterStarts[cluster]; triangle < clusterStarts[cluster + 1]; ++triangle)
+                    {
+                        const Vector3 p0 = GetPosition(positions, indices[triangle * 3]);
+                        const Vector3 p1 = GetPosition(positions, indices[triangle * 3 + 1]);
+                        const Vector3 p2 = GetPosition(positions, indices[triangle * 3 + 2]);
+
+                        // The length of the cross product is twice the area, so summing them gives the area weighted normal
+                        const Vector3 normal = (p1 - p0).Cross(p2 - p0);
+                        const float area = normal.GetLength();
+                        const Vector3 centroid = (p0 + p1 + p2) / 3.0f;
+
+                        clusterNormals[cluster] += normal;
+                        clusterCentroids[cluster] += centroid * area;
+                        clusterArea += area;
+                    }
+
+                    meshCentroid += clusterCentroids[cluster];
+                    meshArea += clusterArea;
+                    clusterCentroids[cluster] = clusterArea > 0.0f ? clusterCentroids[cluster] / clusterArea : Vector3::CreateZero();
+                }
+                meshCentroid = meshArea > 0.0f ? meshCentroid / meshArea : Vector3::CreateZero();
+
+                AZStd::vector<float> clusterSortKeys(clusterCount);
+                AZStd::vector<uint32_t> clusterOrder(clusterCount);
+                for (size_t cluster = 0; cluster < clusterCount; ++cluster)
+                {
+                    clusterSortKeys[cluster] = (clusterCentroids[cluster] - meshCentroid).Dot(clusterNormals[cluster].GetNormalizedSafe());
+                    clusterOrder[cluster] = static_cast<uint32_t>(cluster);
+                }
+
+                AZStd::stable_sort(
+                    clusterOrder.begin(), clusterOrder.end(),
+                    [&clusterSortKeys](uint32_t lhs, uint32_t rhs)
+                    {
+                        return clusterSortKeys[lhs] > clusterSortKeys[rhs];
+                    });
+
+                AZStd::vector<uint32_t> sortedIndices;
+                sortedIndices.reserve(triangleCount * 3);
+                for (const uint32_t cluster : clusterOrder)
+                {
+                    sortedIndices.insert(
+                        sortedIndices.end(), indices.data() + clusterStarts[cluster] * 3, indices.data() + clusterStarts[cluster + 1] * 3);
+                }
+                AZStd::copy(sortedIndices.begin(), sortedIndices.end(), indices.begin());
+            }
+
+            AZStd::vector<uint32_t> OptimizeVertexFetch(AZStd::span<uint32_t> indices, size_t vertexCount)
+            {
+                AZStd::vector<uint32_t> remap(vertexCount, InvalidIndex);
+                uint32_t nextVertex = 0;
+                for (uint32_t& index : indices)
+                {
+                    if (remap[index] == InvalidIndex)
+                    {
+                        remap[index] = nextVertex++;
+                    }
+                    index = remap[index];
+                }
+
+                for (uint32_t& newIndex : remap)
+                {
+                    if (newIndex == InvalidIndex)
+                    {
+                        newIndex = nextVertex++;
+                    }
+                }
+                return remap;
+            }
+
+            int16_t QuantizeSnorm16(float value)
+            {
+                const float scaled = AZStd::clamp(value, -1.0f, 1.0f) * 32767.0f;
+                return static_cast<int16_t>(scaled >= 0.0f ? scaled + 0.5f : scaled - 0.5f);
+            }
+
+            uint16_t QuantizeHalf(float value)
+            {
+                uint32_t bits;
+                memcpy(&bits, &value, sizeof(bits));
+
+                const uint32_t sign = (bits >> 16) & 0x8000;
+                const int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xff) - 127 + 15;
+                uint32_t mantissa = bits & 0x7fffff;
+
+                if ((bits & 0x7fffffff) >= 0x7f800000)
+                {
+                    // Infinity or NaN
+                    return static_cast<uint16_t>(sign | 0x7c00 | (mantissa ? 0x200 : 0));
+                }
+                if (exponent >= 31)
+                {
+                    // Too big, becomes infinity
+                    return static_cast<uint16_t>(sign | 0x7c00);
+                }
+                if (exponent <= 0)
+                {
+                    if (exponent < -10)
+                    {
+                        // Too small, becomes zero
+                        return static_cast<uint16_t>(sign);
+                    }
+
+                    // Denormalized half, the implicit leading 1 becomes explicit
+                    mantissa |= 0x800000;
+                    const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+                    uint32_t half = mantissa >> shift;
+                    const uint32_t remainder = mantissa & ((1u << shift) - 1);
+                    const uint32_t halfway = 1u << (shift - 1);
+                    if (remainder > halfway || (remainder == halfway && (half & 1)))
+                    {
+                        ++half;
+                    }
+                    return static_cast<uint16_t>(sign | half);
+                }
+
+                // Rounding up can carry into the exponent, which gives the correct result up to infinity
+                uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+                const uint32_t remainder = mantissa & 0x1fff;
+                if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+                {
+                    ++half;
+                }
+                return static_cast<uint16_t>(sign | half);
+            }
+
+            AZStd::vector<uint16_t> ConvertIndicesTo16Bit(AZStd::span<const uint32_t> indices)
+            {
+                AZStd::vector<uint16_t> indices16(indices.size());
+                for (size_t i = 0; i < indices.size(); ++i)
+                {
+                    AZ_Assert(indices[i] <= 0xffff, "Index %u doesn't fit in 16 bits.", indices[i]);
+                    indices16[i] = static_cast<uint16_t>(indices[i]);
+                }
+                return indices16;
+            }
+
+            AZStd::vector<int16_t> QuantizeSnorm16Stream(
+                AZStd::span<const float> stream, size_t sourceComponentsPerVertex, size_t quantizedComponentsPerVertex)
+            {
+                AZ_Assert(sourceComponentsPerVertex <= quantizedComponentsPerVertex, "The quantized stream can't have less components than the source.");
+                const size_t vertexCount = stream.size() / sourceComponentsPerVertex;
+                AZStd::vector<int16_t> quantizedStream(vertexCount * quantizedComponentsPerVertex, 0);
+                for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    for (size_t component = 0; component < sourceComponentsPerVertex; ++component)
+                    {
+                        quantizedStream[vertex * quantizedComponentsPerVertex + component] =
+                            QuantizeSnorm16(stream[vertex * sourceComponentsPerVertex + component]);
+                    }
+                }
+                return quantizedStream;
+            }
+
+            AZStd::vector<uint16_t> QuantizeHalfStream(AZStd::span<const float> stream)
+            {
+                AZStd::vector<uint16_t> quantizedStream(stream.size());
+                for (size_t i = 0; i < stream.size(); ++i)
+                {
+                    quantizedStream[i] = QuantizeHalf(stream[i]);
+                }
+                return quantizedStream;
+            }
+        } // namespace MeshOptimizer
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Index and vertex buffer optimizations used by the model builder.
+        //! All the functions work on triangle lists, where every 3 indices describe a triangle.
+        namespace MeshOptimizer
+        {
+            //! Size of the FIFO post-transform vertex cache simulated to measure the vertex cache efficiency.
+            //! It is the conservative size used for the hardware that still has a fixed size vertex cache.
+            static constexpr uint32_t VertexCacheSize = 16;
+
+            //! Returns the average cache miss ratio (ACMR) of the triangle list, which is the average number of vertices
+            //! transformed per triangle. It goes from 3.0 (no vertex reused) down to about 0.5 for a regular grid.
+            float CalculateAcmr(AZStd::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize = VertexCacheSize);
+
+            //! Reorders the triangles so the vertices are reused while they are in the post-transform vertex cache.
+            //! This uses Tom Forsyth's linear-speed vertex cache optimization, which doesn't depend on the exact cache size.
+            void OptimizeVertexCache(AZStd::span<uint32_t> indices, size_t vertexCount);
+
+            //! Reorders clusters of triangles so the triangles facing away from the center of the mesh are drawn first,
+            //! which lets the depth test reject more of the occluded pixels.
+            //! The triangles must already be ordered for the vertex cache. Clusters are split where the vertex cache
+            //! is flushed anyway, and at the points where the ACMR stays under the mesh ACMR times the threshold.
+            //! @param positions 3 floats per vertex.
+            //! @param threshold How much the ACMR may degrade. 1.0 only splits the clusters at the natural cache flushes.
+            void OptimizeOverdraw(AZStd::span<uint32_t> indices, AZStd::span<const float> positions, size_t vertexCount, float threshold);
+
+            //! Reorders the vertices in the order they are first referenced by the triangles, and updates the indices.
+            //! The vertices that no triangle references are moved to the end, so the vertex count doesn't change.
+            //! @return The remap table, where remap[oldVertexIndex] is the new index of the vertex. Use it with
+            //! RemapVertexStream() to reorder each vertex stream of the mesh.
+            AZStd::vector<uint32_t> OptimizeVertexFetch(AZStd::span<uint32_t> indices, size_t vertexCount);
+
+            //! Reorders a vertex stream with the remap table returned by OptimizeVertexFetch().
+            //! @param componentsPerVertex The number of elements of the stream per vertex.
+            template<typename T>
+            void RemapVertexStream(AZStd::vector<T>& stream, AZStd::span<const uint32_t> remap, size_t componentsPerVertex)
+            {
+                if (stream.empty())
+                {
+                    return;
+                }
+
+                AZ_Assert(stream.size() == remap.size() * componentsPerVertex, "The vertex stream doesn't match the remap table.");
+                AZStd::vector<T> remappedStream(stream.size());
+                for (size_t vertex = 0; vertex < remap.size(); ++vertex)
+                {
+                    const size_t source = vertex * componentsPerVertex;
+                    const size_t destination = remap[vertex] * componentsPerVertex;
+                    for (size_t component = 0; component < componentsPerVertex; ++component)
+                    {
+                        remappedStream[destination + component] = stream[source + component];
+                    }
+                }
+                stream = AZStd::move(remappedStream);
+            }
+
+            //! Converts a value in [-1, 1] to a 16-bit normalized integer, as read back by the SNORM formats.
+            int16_t QuantizeSnorm16(float value);
+
+            //! Converts a 32-bit float to a 16-bit float, rounding to the nearest even value.
+            uint16_t QuantizeHalf(float value);
+
+            //! Converts 32-bit indices to 16-bit indices. All the indices must be under 65536.
+            AZStd::vector<uint16_t> ConvertIndicesTo16Bit(AZStd::span<const uint32_t> indices);
+
+            //! Converts a stream of floats in [-1, 1] to 16-bit normalized integers.
+            //! The components after the source components of each vertex are set to 0, so 3 component normals can be padded
+            //! to the 4 components of the R16G16B16A16_SNORM format.
+            AZStd::vector<int16_t> QuantizeSnorm16Stream(
+                AZStd::span<const float> stream, size_t sourceComponentsPerVertex, size_t quantizedComponentsPerVertex);
+
+            //! Converts a stream of 32-bit floats to 16-bit floats.
+            AZStd::vector<uint16_t> QuantizeHalfStream(AZStd::span<const float> stream);
+        } // namespace MeshOptimizer
+    } // namespace RPI
+} // namespace AZ
@@ -8,6 +8,7 @@
 
 #include <Model/ModelAssetBuilderComponent.h>
 #include <Model/MaterialAssetBuilderComponent.h>
+#include <Model/MeshOptimizer.h>
 #include <Model/MorphTargetExporter.h>
 #include <Atom/RPI.Edit/Common/AssetUtils.h>
 
@@ -16,6 +17,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/math.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <Atom/RPI.Reflect/Buffer/BufferAssetCreator.h>
@@ -42,6 +44,7 @@
 #include <SceneAPI/SceneCore/Utilities/SceneGraphSelector.h>
 #include <SceneAPI/SceneCore/Utilities/Reporting.h>
 #include <SceneAPI/SceneData/Groups/MeshGroup.h>
+#include <SceneAPI/SceneData/Rules/MeshOptimizationRule.h>
 #include <SceneAPI/SceneData/Rules/StaticMeshAdvancedRule.h>
 #include <SceneAPI/SceneCore/Containers/Utilities/SceneUtilities.h>
 #include <SceneAPI/SceneCore/Containers/Utilities/Filters.h>
@@ -110,12 +113,33 @@ namespace AZ
             return mismatchedVertexStreamsAreErrors;
         }
 
+        //! Returns the ACMR of all the meshes of a LOD, weighted by their number of triangles
+        static float CalculateLodAcmr(const ModelAssetBuilderComponent::ProductMeshContentList& productMeshList)
+        {
+            float weightedAcmr = 0.0f;
+            size_t triangleCount = 0;
+            for (const ModelAssetBuilderComponent::ProductMeshContent& mesh : productMeshList)
+            {
+                const size_t meshTriangleCount = mesh.m_indices.size() / 3;
+                const size_t vertexCount = mesh.m_positions.size() / PositionFloatsPerVert;
+                weightedAcmr += MeshOptimizer::CalculateAcmr(mesh.m_indices, vertexCount) * static_cast<float>(meshTriangleCount);
+                triangleCount += meshTriangleCount;
+            }
+            return triangleCount > 0 ? weightedAcmr / static_cast<float>(triangleCount) : 0.0f;
+        }
+
+        template<typename T>
+        static bool StreamMatchesVertexCount(const AZStd::vector<T>& stream, size_t vertexCount, size_t componentsPerVertex)
+        {
+            return stream.empty() || stream.size() == vertexCount * componentsPerVertex;
+        }
+
         void ModelAssetBuilderComponent::Reflect(ReflectContext* context)
         {
             if (auto* serialize = azrtti_cast<SerializeContext*>(context))
             {
                 serialize->Class<ModelAssetBuilderComponent, SceneAPI::SceneCore::ExportingComponent>()
-                    ->Version(35);  // Fix vertex welding
+                    ->Version(36);  // Optional mesh optimization and quantized vertex streams
             }
         }
 
@@ -396,6 +420,9 @@ namespace AZ
                 }
             }
 
+            AZStd::shared_ptr<const SceneAPI::SceneData::MeshOptimizationRule> meshOptimizationRule =
+                context.m_group.GetRuleContainerConst().FindFirstByType<SceneAPI::SceneData::MeshOptimizationRule>();
+
             uint32_t lodIndex = 0;
             for (const SourceMeshContentList& sourceMeshContentList : sourceMeshContentListsByLod)
             {
@@ -403,6 +430,7 @@ namespace AZ
                 m_lodName = AZStd::string::format("lod%d", lodIndex);
                 AZStd::string lodAssetName = GetAssetFullName(ModelLodAsset::TYPEINFO_Uuid());
                 lodAssetCreator.Begin(CreateAssetId(lodAssetName));
+                m_lodStreamFormats = {};
 
                 {
                     AZ::Outcome<ProductMeshContentList> productMeshListOutcome =
@@ -452,6 +480,27 @@ namespace AZ
                         lodMeshes = productMeshListOutcome.GetValue();
                     }
 
+                    if (meshOptimizationRule)
+                    {
+                        const bool isMorphed = AZStd::any_of(
+                            sourceMeshContentList.begin(), sourceMeshContentList.end(),
+                            [](const SourceMeshContent& sourceMesh)
+                            {
+                                return sourceMesh.m_isMorphed;
+                            });
+
+                        const float acmrBefore = CalculateLodAcmr(lodMeshes);
+                        const size_t bufferSizeBefore = CalculateLodBufferSize(lodMeshes, LodStreamFormats{});
+
+                        OptimizeMeshes(*meshOptimizationRule, lodMeshes, isMorphed);
+                        m_lodStreamFormats = SelectLodStreamFormats(*meshOptimizationRule, lodMeshes, isMorphed);
+
+                        AZ_TracePrintf(
+                            s_builderName, "Optimized %s of '%s': ACMR %.3f -> %.3f, index and vertex buffers %zu -> %zu bytes.\n",
+                            m_lodName.c_str(), m_modelName.c_str(), acmrBefore, CalculateLodAcmr(lodMeshes), bufferSizeBefore,
+                            CalculateLodBufferSize(lodMeshes, m_lodStreamFormats));
+                    }
+
 #if defined(AZ_RPI_MESHES_SHARE_COMMON_BUFFERS)
                     // We shouldn't need a mesh name for the buffer names since meshed are sharing common buffers
                     m_meshName = "";
@@ -1100,6 +1149,189 @@ namespace AZ
             }
         }
 
+        void ModelAssetBuilderComponent::OptimizeMeshes(
+            const SceneAPI::SceneData::MeshOptimizationRule& meshOptimizationRule,
+            ProductMeshContentList& productMeshList,
+            bool isMorphed) const
+        {
+            for (ProductMeshContent& mesh : productMeshList)
+            {
+                const size_t vertexCount = mesh.m_positions.size() / PositionFloatsPerVert;
+                if (mesh.m_indices.size() < 3 || vertexCount == 0)
+                {
+                    continue;
+                }
+
+                if (meshOptimizationRule.GetOptimizeVertexCache())
+                {
+                    MeshOptimizer::OptimizeVertexCache(mesh.m_indices, vertexCount);
+                }
+
+                if (meshOptimizationRule.GetOptimizeOverdraw())
+                {
+                    MeshOptimizer::OptimizeOverdraw(mesh.m_indices, mesh.m_positions, vertexCount, meshOptimizationRule.GetOverdrawThreshold());
+                }
+
+                if (!meshOptimizationRule.GetOptimizeVertexFetch() || isMorphed || !mesh.m_morphTargetVertexData.empty())
+                {
+                    continue;
+                }
+
+                // Only reorder the vertices when every stream has the same number of vertices,
+                // otherwise the streams would no longer match the vertices they were meant for.
+                bool streamsMatch = StreamMatchesVertexCount(mesh.m_normals, vertexCount, NormalFloatsPerVert) &&
+                    StreamMatchesVertexCount(mesh.m_tangents, vertexCount, TangentFloatsPerVert) &&
+                    StreamMatchesVertexCount(mesh.m_bitangents, vertexCount, BitangentFloatsPerVert) &&
+                    StreamMatchesVertexCount(mesh.m_clothData, vertexCount, ClothDataFloatsPerVert) &&
+                    StreamMatchesVertexCount(mesh.m_skinJointIndices, vertexCount, mesh.m_influencesPerVertex) &&
+                    StreamMatchesVertexCount(mesh.m_skinWeights, vertexCount, mesh.m_influencesPerVertex);
+                for (const AZStd::vector<float>& uvSet : mesh.m_uvSets)
+                {
+                    streamsMatch = streamsMatch && StreamMatchesVertexCount(uvSet, vertexCount, UVFloatsPerVert);
+                }
+                for (const AZStd::vector<float>& colorSet : mesh.m_colorSets)
+                {
+                    streamsMatch = streamsMatch && StreamMatchesVertexCount(colorSet, vertexCount, ColorFloatsPerVert);
+                }
+                if (!streamsMatch)
+                {
+                    continue;
+                }
+
+                const AZStd::vector<uint32_t> remap = MeshOptimizer::OptimizeVertexFetch(mesh.m_indices, vertexCount);
+                MeshOptimizer::RemapVertexStream(mesh.m_positions, remap, PositionFloatsPerVert);
+                MeshOptimizer::RemapVertexStream(mesh.m_normals, remap, NormalFloatsPerVert);
+                MeshOptimizer::RemapVertexStream(mesh.m_tangents, remap, TangentFloatsPerVert);
+                MeshOptimizer::RemapVertexStream(mesh.m_bitangents, remap, BitangentFloatsPerVert);
+                for (AZStd::vector<float>& uvSet : mesh.m_uvSets)
+                {
+                    MeshOptimizer::RemapVertexStream(uvSet, remap, UVFloatsPerVert);
+                }
+                for (AZStd::vector<float>& colorSet : mesh.m_colorSets)
+                {
+                    MeshOptimizer::RemapVertexStream(colorSet, remap, ColorFloatsPerVert);
+                }
+                MeshOptimizer::RemapVertexStream(mesh.m_clothData, remap, ClothDataFloatsPerVert);
+                MeshOptimizer::RemapVertexStream(mesh.m_skinJointIndices, remap, mesh.m_influencesPerVertex);
+                MeshOptimizer::RemapVertexStream(mesh.m_skinWeights, remap, mesh.m_influencesPerVertex);
+            }
+        }
+
+        ModelAssetBuilderComponent::LodStreamFormats ModelAssetBuilderComponent::SelectLodStreamFormats(
+            const SceneAPI::SceneData::MeshOptimizationRule& meshOptimizationRule,
+            const ProductMeshContentList& productMeshList,
+            bool isMorphed)
+        {
+            LodStreamFormats streamFormats;
+
+            // Skinning, morph targets and cloth are computed from the 32-bit streams, and the cloth simulation reads
+            // the indices as 32-bit values, so these LODs keep the full precision formats
+            const bool isDeformed = isMorphed || AZStd::any_of(
+                productMeshList.begin(), productMeshList.end(),
+                [](const ProductMeshContent& mesh)
+                {
+                    return mesh.m_influencesPerVertex > 0 || !mesh.m_morphTargetVertexData.empty() || !mesh.m_clothData.empty();
+                });
+            if (isDeformed)
+            {
+                return streamFormats;
+            }
+
+            // Each mesh keeps its own indices when the meshes are merged to the common buffers,
+            // so 16-bit indices only require each mesh to have less than 65536 vertices.
+            const bool indicesFit16Bit = AZStd::all_of(
+                productMeshList.begin(), productMeshList.end(),
+                [](const ProductMeshContent& mesh)
+                {
+                    return mesh.m_positions.size() / PositionFloatsPerVert <= static_cast<size_t>(AZStd::numeric_limits<uint16_t>::max()) + 1;
+                });
+            if (meshOptimizationRule.GetUse16BitIndices() && indicesFit16Bit)
+            {
+                streamFormats.m_indexFormat = RHI::Format::R16_UINT;
+            }
+
+            if (!meshOptimizationRule.GetQuantizeVertexAttributes())
+            {
+                return streamFormats;
+            }
+
+            auto allWithin = [&productMeshList](AZStd::vector<float> ProductMeshContent::*stream, float limit)
+            {
+                return AZStd::all_of(
+                    productMeshList.begin(), productMeshList.end(),
+                    [stream, limit](const ProductMeshContent& mesh)
+                    {
+                        return AZStd::all_of(
+                            (mesh.*stream).begin(), (mesh.*stream).end(),
+                            [limit](float value)
+                            {
+                                return AZStd::abs(value) <= limit;
+                            });
+                    });
+            };
+
+            // The SNORM formats only represent [-1, 1]. The 4th component of the quantized normals and bitangents is unused padding.
+            if (allWithin(&ProductMeshContent::m_normals, 1.0f))
+            {
+                streamFormats.m_normalFormat = RHI::Format::R16G16B16A16_SNORM;
+            }
+            if (allWithin(&ProductMeshContent::m_tangents, 1.0f))
+            {
+                streamFormats.m_tangentFormat = RHI::Format::R16G16B16A16_SNORM;
+            }
+            if (allWithin(&ProductMeshContent::m_bitangents, 1.0f))
+            {
+                streamFormats.m_bitangentFormat = RHI::Format::R16G16B16A16_SNORM;
+            }
+
+            // Half floats have 11 bits of precision, which is 1/1024 of a texel or better on a 1024 texture when the UVs are
+            // within [-2, 2]. Tiled UVs further away lose too much precision.
+            const float uvLimit = 2.0f;
+            const bool uvsFitHalf = AZStd::all_of(
+                productMeshList.begin(), productMeshList.end(),
+                [uvLimit](const ProductMeshContent& mesh)
+                {
+                    return AZStd::all_of(
+                        mesh.m_uvSets.begin(), mesh.m_uvSets.end(),
+                        [uvLimit](const AZStd::vector<float>& uvSet)
+                        {
+                            return AZStd::all_of(
+                                uvSet.begin(), uvSet.end(),
+                                [uvLimit](float value)
+                                {
+                                    return AZStd::abs(value) <= uvLimit;
+                                });
+                        });
+                });
+            if (uvsFitHalf)
+            {
+                streamFormats.m_uvFormat = RHI::Format::R16G16_FLOAT;
+            }
+
+            return streamFormats;
+        }
+
+        size_t ModelAssetBuilderComponent::CalculateLodBufferSize(
+            const ProductMeshContentList& productMeshList, const LodStreamFormats& streamFormats)
+        {
+            size_t bufferSize = 0;
+            for (const ProductMeshContent& mesh : productMeshList)
+            {
+                const size_t vertexCount = mesh.m_positions.size() / PositionFloatsPerVert;
+                bufferSize += mesh.m_indices.size() * RHI::GetFormatSize(streamFormats.m_indexFormat);
+                bufferSize += vertexCount * RHI::GetFormatSize(PositionFormat);
+                bufferSize += mesh.m_normals.empty() ? 0 : vertexCount * RHI::GetFormatSize(streamFormats.m_normalFormat);
+                bufferSize += mesh.m_tangents.empty() ? 0 : vertexCount * RHI::GetFormatSize(streamFormats.m_tangentFormat);
+                bufferSize += mesh.m_bitangents.empty() ? 0 : vertexCount * RHI::GetFormatSize(streamFormats.m_bitangentFormat);
+                bufferSize += mesh.m_uvSets.size() * vertexCount * RHI::GetFormatSize(streamFormats.m_uvFormat);
+                bufferSize += mesh.m_colorSets.size() * vertexCount * RHI::GetFormatSize(ColorFormat);
+                bufferSize += mesh.m_clothData.size() * sizeof(float);
+                bufferSize += mesh.m_skinJointIndices.size() * sizeof(uint16_t) + mesh.m_skinWeights.size() * sizeof(float);
+                bufferSize += mesh.m_morphTargetVertexData.size() * sizeof(PackedCompressedMorphTargetDelta);
+            }
+            return bufferSize;
+        }
+
         AZ::Outcome<ModelAssetBuilderComponent::ProductMeshContentList> ModelAssetBuilderComponent::MergeMeshesByMaterialUid(
             const ProductMeshContentList& productMeshList)
         {
@@ -1351,11 +1583,11 @@ namespace AZ
             auto meshPositionCount = meshPositionsFloatCount / PositionFloatsPerVert;
             auto meshNormalsCount = meshNormalsFloatCount / NormalFloatsPerVert;
 
-            meshView.m_indexView = RHI::BufferViewDescriptor::CreateTyped(0, meshIndexCount, IndicesFormat);
+            meshView.m_indexView = RHI::BufferViewDescriptor::CreateTyped(0, meshIndexCount, m_lodStreamFormats.m_indexFormat);
             meshView.m_positionView = RHI::BufferViewDescriptor::CreateTyped(0, meshPositionCount, PositionFormat);
             if (meshNormalsCount > 0)
             {
-                meshView.m_normalView = RHI::BufferViewDescriptor::CreateTyped(0, meshNormalsCount, NormalFormat);
+                meshView.m_normalView = RHI::BufferViewDescriptor::CreateTyped(0, meshNormalsCount, m_lodStreamFormats.m_normalFormat);
             }
 
             const size_t uvSetCount = mesh.m_uvSets.size();
@@ -1369,7 +1601,7 @@ namespace AZ
                 auto uvFloatCount = static_cast<uint32_t>(uvSet.size());
                 auto uvCount = uvFloatCount / UVFloatsPerVert;
 
-                meshView.m_uvSetViews.push_back(RHI::BufferViewDescriptor::CreateTyped(0, uvCount, UVFormat));
+                meshView.m_uvSetViews.push_back(RHI::BufferViewDescriptor::CreateTyped(0, uvCount, m_lodStreamFormats.m_uvFormat));
                 meshView.m_uvCustomNames.push_back(mesh.m_uvCustomNames[uvSetIndex]);
             }
 
@@ -1387,12 +1619,12 @@ namespace AZ
 
             if (!mesh.m_tangents.empty())
             {
-                meshView.m_tangentView = RHI::BufferViewDescriptor::CreateTyped(0, meshNormalsCount, TangentFormat);
+                meshView.m_tangentView = RHI::BufferViewDescriptor::CreateTyped(0, meshNormalsCount, m_lodStreamFormats.m_tangentFormat);
             }
 
             if (!mesh.m_bitangents.empty())
             {
-                meshView.m_bitangentView = RHI::BufferViewDescriptor::CreateTyped(0, meshNormalsCount, BitangentFormat);
+                meshView.m_bitangentView = RHI::BufferViewDescriptor::CreateTyped(0, meshNormalsCount, m_lodStreamFormats.m_bitangentFormat);
             }
 
             if (!mesh.m_skinJointIndices.empty() && !mesh.m_skinWeights.empty())
@@ -1470,7 +1702,7 @@ namespace AZ
 
                 ProductMeshView meshView;
                 meshView.m_name = mesh.m_name;
-                meshView.m_indexView = RHI::BufferViewDescriptor::CreateTyped(static_cast<uint32_t>(lodBufferInfo.m_indexCount), meshIndexCount, IndicesFormat);
+                meshView.m_indexView = RHI::BufferViewDescriptor::CreateTyped(static_cast<uint32_t>(lodBufferInfo.m_indexCount), meshIndexCount, m_lodStreamFormats.m_indexFormat);
                 lodBufferInfo.m_indexCount += meshIndexCount;
 
                 const uint32_t meshVertexCount = meshPositionsFloatCount / PositionFloatsPerVert;
@@ -1485,21 +1717,21 @@ namespace AZ
                 if (!mesh.m_normals.empty())
                 {
                     const uint32_t elementOffset = static_cast<uint32_t>(lodBufferInfo.m_normalsFloatCount) / NormalFloatsPerVert;
-                    meshView.m_normalView = RHI::BufferViewDescriptor::CreateTyped(elementOffset, meshVertexCount, NormalFormat);
+                    meshView.m_normalView = RHI::BufferViewDescriptor::CreateTyped(elementOffset, meshVertexCount, m_lodStreamFormats.m_normalFormat);
                     lodBufferInfo.m_normalsFloatCount += meshNormalsFloatCount;
                 }
 
                 if (!mesh.m_tangents.empty())
                 {
                     const uint32_t elementOffset = static_cast<uint32_t>(lodBufferInfo.m_tangentsFloatCount) / TangentFloatsPerVert;
-                    meshView.m_tangentView = RHI::BufferViewDescriptor::CreateTyped(elementOffset, meshVertexCount, TangentFormat);
+                    meshView.m_tangentView = RHI::BufferViewDescriptor::CreateTyped(elementOffset, meshVertexCount, m_lodStreamFormats.m_tangentFormat);
                     lodBufferInfo.m_tangentsFloatCount += meshTangentsFloatCount;
                 }
 
                 if (!mesh.m_bitangents.empty())
                 {
                     const uint32_t elementOffset = static_cast<uint32_t>(lodBufferInfo.m_bitangentsFloatCount) / BitangentFloatsPerVert;
-                    meshView.m_bitangentView = RHI::BufferViewDescriptor::CreateTyped(elementOffset, meshVertexCount, BitangentFormat);
+                    meshView.m_bitangentView = RHI::BufferViewDescriptor::CreateTyped(elementOffset, meshVertexCount, m_lodStreamFormats.m_bitangentFormat);
                     lodBufferInfo.m_bitangentsFloatCount += meshBitangentsFloatCount;
                 }
 
@@ -1515,7 +1747,7 @@ namespace AZ
                         auto& uvSetView = meshView.m_uvSetViews[i];
 
                         const uint32_t elementOffset = static_cast<uint32_t>(lodBufferInfo.m_uvSetFloatCounts[i]) / UVFloatsPerVert;
-                        uvSetView = RHI::BufferViewDescriptor::CreateTyped(elementOffset, meshVertexCount, UVFormat);
+                        uvSetView = RHI::BufferViewDescriptor::CreateTyped(elementOffset, meshVertexCount, m_lodStreamFormats.m_uvFormat);
 
                         const auto uvCount = static_cast<uint32_t>(mesh.m_uvSets[i].size());
                         lodBufferInfo.m_uvSetFloatCounts[i] += uvCount;
@@ -1928,7 +2160,16 @@ namespace AZ
 
             // Build Index Buffer ...
             {
-                Outcome<Data::Asset<BufferAsset>> indexBufferOutcome = CreateTypedBufferAsset(indices.data(), indices.size(), IndicesFormat, "index");
+                Outcome<Data::Asset<BufferAsset>> indexBufferOutcome = AZ::Failure();
+                if (m_lodStreamFormats.m_indexFormat == RHI::Format::R16_UINT)
+                {
+                    const AZStd::vector<uint16_t> indices16 = MeshOptimizer::ConvertIndicesTo16Bit(indices);
+                    indexBufferOutcome = CreateTypedBufferAsset(indices16.data(), indices16.size(), RHI::Format::R16_UINT, "index");
+                }
+                else
+                {
+                    indexBufferOutcome = CreateTypedBufferAsset(indices.data(), indices.size(), IndicesFormat, "index");
+                }
                 if (!indexBufferOutcome.IsSuccess())
                 {
                     AZ_Error(s_builderName, false, "Failed to build index stream");
@@ -1944,14 +2185,27 @@ namespace AZ
                 return false;
             }
 
-            if (!BuildTypedStreamBuffer<float>(outStreamBuffers, normals, NormalFormat, RHI::ShaderSemantic{"NORMAL"}))
+            // Builds a stream either with the 32-bit floats, or quantized to 16-bit normalized integers when the LOD uses a SNORM format
+            auto buildNormalizedStreamBuffer = [this, &outStreamBuffers](
+                const AZStd::vector<float>& stream, uint32_t floatsPerVert, RHI::Format fullFormat, RHI::Format lodFormat, const RHI::ShaderSemantic& semantic)
+            {
+                if (lodFormat == fullFormat)
+                {
+                    return BuildTypedStreamBuffer<float>(outStreamBuffers, stream, fullFormat, semantic);
+                }
+                const AZStd::vector<int16_t> quantizedStream =
+                    MeshOptimizer::QuantizeSnorm16Stream(stream, floatsPerVert, RHI::GetFormatComponentCount(lodFormat));
+                return BuildTypedStreamBuffer<int16_t>(outStreamBuffers, quantizedStream, lodFormat, semantic);
+            };
+
+            if (!buildNormalizedStreamBuffer(normals, NormalFloatsPerVert, NormalFormat, m_lodStreamFormats.m_normalFormat, RHI::ShaderSemantic{"NORMAL"}))
             {
                 return false;
             }
 
             if (!tangents.empty())
             {
-                if (!BuildTypedStreamBuffer<float>(outStreamBuffers, tangents, TangentFormat, RHI::ShaderSemantic{"TANGENT"}))
+                if (!buildNormalizedStreamBuffer(tangents, TangentFloatsPerVert, TangentFormat, m_lodStreamFormats.m_tangentFormat, RHI::ShaderSemantic{"TANGENT"}))
                 {
                     return false;
                 }
@@ -1959,7 +2213,7 @@ namespace AZ
 
             if (!bitangents.empty())
             {
-                if (!BuildTypedStreamBuffer<float>(outStreamBuffers, bitangents, BitangentFormat, RHI::ShaderSemantic{"BITANGENT"}))
+                if (!buildNormalizedStreamBuffer(bitangents, BitangentFloatsPerVert, BitangentFormat, m_lodStreamFormats.m_bitangentFormat, RHI::ShaderSemantic{"BITANGENT"}))
                 {
                     return false;
                 }
@@ -1967,7 +2221,19 @@ namespace AZ
             
             for (size_t i = 0; i < uvSets.size(); ++i)
             {
-                if (!BuildTypedStreamBuffer<float>(outStreamBuffers, uvSets[i], UVFormat, RHI::ShaderSemantic{"UV", i}, uvCustomNames[i]))
+                bool uvSetBuilt = false;
+                if (m_lodStreamFormats.m_uvFormat == UVFormat)
+                {
+                    uvSetBuilt = BuildTypedStreamBuffer<float>(outStreamBuffers, uvSets[i], UVFormat, RHI::ShaderSemantic{"UV", i}, uvCustomNames[i]);
+                }
+                else
+                {
+                    const AZStd::vector<uint16_t> quantizedUvSet = MeshOptimizer::QuantizeHalfStream(uvSets[i]);
+                    uvSetBuilt = BuildTypedStreamBuffer<uint16_t>(
+                        outStreamBuffers, quantizedUvSet, m_lodStreamFormats.m_uvFormat, RHI::ShaderSemantic{"UV", i}, uvCustomNames[i]);
+                }
+
+                if (!uvSetBuilt)
                 {
                     return false;
                 }
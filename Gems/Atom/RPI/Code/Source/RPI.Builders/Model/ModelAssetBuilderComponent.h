@@ -30,6 +30,14 @@
 
 namespace AZ
 {
+    namespace SceneAPI
+    {
+        namespace SceneData
+        {
+            class MeshOptimizationRule;
+        }
+    }
+
     namespace RPI
     {
         using MeshData = AZ::SceneAPI::DataTypes::IMeshData;
@@ -208,6 +216,34 @@ namespace AZ
             //! Each vertex stream that is modified by skinning is the same length
             void PadVerticesForSkinning(ProductMeshContentList& productMeshList);
 
+            //! Formats of the index and vertex streams of the LOD being built.
+            //! These are the full precision formats, unless the MeshOptimizationRule of the mesh group allows
+            //! 16-bit indices or quantized attributes and the data of the LOD fits in the smaller formats.
+            struct LodStreamFormats
+            {
+                RHI::Format m_indexFormat = RHI::Format::R32_UINT;
+                RHI::Format m_normalFormat = RHI::Format::R32G32B32_FLOAT;
+                RHI::Format m_tangentFormat = RHI::Format::R32G32B32A32_FLOAT;
+                RHI::Format m_bitangentFormat = RHI::Format::R32G32B32_FLOAT;
+                RHI::Format m_uvFormat = RHI::Format::R32G32_FLOAT;
+            };
+
+            //! Reorders the indices and the vertices of each mesh of the LOD for the vertex cache, overdraw and vertex fetch,
+            //! as enabled by the rule. Morphed meshes keep their vertex order since the morph target deltas refer to the vertices by index.
+            void OptimizeMeshes(
+                const SceneAPI::SceneData::MeshOptimizationRule& meshOptimizationRule,
+                ProductMeshContentList& productMeshList,
+                bool isMorphed) const;
+
+            //! Selects the smallest stream formats allowed by the rule that can represent the data of the LOD.
+            static LodStreamFormats SelectLodStreamFormats(
+                const SceneAPI::SceneData::MeshOptimizationRule& meshOptimizationRule,
+                const ProductMeshContentList& productMeshList,
+                bool isMorphed);
+
+            //! Returns the size in bytes of the index and vertex buffers of the LOD with the given stream formats.
+            static size_t CalculateLodBufferSize(const ProductMeshContentList& productMeshList, const LodStreamFormats& streamFormats);
+
             //! Takes in a ProductMeshContentList and merges all elements that share the same MaterialUid.
             AZ::Outcome<ModelAssetBuilderComponent::ProductMeshContentList> MergeMeshesByMaterialUid(
                 const ProductMeshContentList& productMeshList);
@@ -376,6 +412,9 @@ namespace AZ
 
             SceneAPI::DataTypes::SkinRuleSettings m_skinRuleSettings;
 
+            //! Stream formats of the LOD being built
+            LodStreamFormats m_lodStreamFormats;
+
             AZStd::set<uint32_t> m_createdSubId;
 
             // NOTE: This is explicitly fetched from a filename. In the future, this should be fetched from the RPI system
@@ -256,6 +256,14 @@ namespace AZ
                 m_streamingController->OnSetTargetMip(this, aznumeric_cast<uint16_t>(clampedMipLevel));
             }
         }
+
+        void StreamingImage::ReportScreenSize(float screenSizeInPixels)
+        {
+            if (m_streamingController)
+            {
+                m_streamingController->OnReportScreenSize(this, screenSizeInPixels);
+            }
+        }
         
         uint16_t StreamingImage::GetResidentMipLevel()
         {
@@ -318,7 +326,7 @@ namespace AZ
             return resultCode;
         }
 
-        void StreamingImage::QueueExpandToMipChainLevel(size_t mipChainIndex)
+        void StreamingImage::QueueExpandToMipChainLevel(size_t mipChainIndex, const Data::AssetLoadParameters& loadParams)
         {
             AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded number of mip chains.");
 
@@ -336,7 +344,7 @@ namespace AZ
                 size_t offset = mipChainBegin - mipChainIndex;
                 for (size_t i = 0; i<=offset; i++)
                 {
-                    FetchMipChainAsset(mipChainBegin - i);
+                    FetchMipChainAsset(mipChainBegin - i, loadParams);
                 }
             }
         }
@@ -426,7 +434,7 @@ namespace AZ
             }
         }
 
-        void StreamingImage::FetchMipChainAsset(size_t mipChainIndex)
+        void StreamingImage::FetchMipChainAsset(size_t mipChainIndex, const Data::AssetLoadParameters& loadParams)
         {
             AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded total number of mip chains.");
 
@@ -442,7 +450,7 @@ namespace AZ
                 AZ_Assert(mipChainAsset.Get() == nullptr, "Asset marked as inactive, but has a valid reference.");
 
                 // And we request that the asset be loaded in case it isn't already.
-                mipChainAsset.QueueLoad();
+                mipChainAsset.QueueLoad(loadParams);
 
                 // Connect to the AssetBus so we are ready to receive OnAssetReady(), which will call OnMipChainAssetReady().
                 // If the asset happens to already be loaded, OnAssetReady() will be called immediately.
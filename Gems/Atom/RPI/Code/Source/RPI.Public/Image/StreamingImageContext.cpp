@@ -8,6 +8,11 @@
 
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImageController.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
@@ -28,34 +33,63 @@ namespace AZ
             return m_lastAccessTimestamp;
         }
 
-        void StreamingImageContext::UpdateMipStats()
+        float StreamingImageContext::GetStreamingScore() const
+        {
+            return m_streamingScore;
+        }
+
+        void StreamingImageContext::InitMipChainSizes()
         {
-            m_mipLevelTargetAdjusted = m_streamingImage->m_streamingController->GetImageTargetMip(m_streamingImage);
-            m_residentMip = m_streamingImage->GetResidentMipLevel();
+            const StreamingImageAsset& imageAsset = *m_streamingImage->m_imageAsset;
+            const RHI::ImageDescriptor& imageDescriptor = imageAsset.GetImageDescriptor();
 
-            if (m_residentMip > m_mipLevelTargetAdjusted)
+            m_mipChainSizes.clear();
+            for (size_t mipChainIndex = 0; mipChainIndex < imageAsset.GetMipChainCount(); ++mipChainIndex)
             {
-                m_missingMips = m_residentMip - m_mipLevelTargetAdjusted;
+                size_t mipChainSize = 0;
+                const size_t mipLevelBegin = imageAsset.GetMipLevel(mipChainIndex);
+                const size_t mipLevelEnd = mipLevelBegin + imageAsset.GetMipCount(mipChainIndex);
+                for (size_t mipLevel = mipLevelBegin; mipLevel < mipLevelEnd; ++mipLevel)
+                {
+                    const RHI::Size mipSize = imageDescriptor.m_size.GetReducedMip(aznumeric_cast<uint32_t>(mipLevel));
+                    const RHI::ImageSubresourceLayout layout = RHI::GetImageSubresourceLayout(mipSize, imageDescriptor.m_format);
+                    mipChainSize += layout.m_bytesPerImage * mipSize.m_depth * imageDescriptor.m_arraySize;
+                }
+                m_mipChainSizes.push_back(mipChainSize);
             }
-            else
+        }
+
+        void StreamingImageContext::UpdateScreenSize()
+        {
+            if (!m_hasScreenSize)
             {
-                m_missingMips = 0;
+                return;
             }
 
-            const size_t mipChainTailIndex = m_streamingImage->m_imageAsset->GetMipChainCount() - 1;
-            size_t tailMip = m_streamingImage->m_imageAsset->GetMipLevel(mipChainTailIndex);
-            if (tailMip > m_residentMip)
+            const float frameScreenSize = static_cast<float>(m_frameScreenSize.exchange(0));
+            m_recentScreenSize = AZStd::max(frameScreenSize, m_recentScreenSize * StreamingImageController::ScreenSizeDecay);
+
+            // Select the least detailed mip which still has at least one texel per screen pixel
+            const RHI::ImageDescriptor& imageDescriptor = m_streamingImage->m_imageAsset->GetImageDescriptor();
+            const uint32_t imageMaxSize = AZStd::max(imageDescriptor.m_size.m_width, imageDescriptor.m_size.m_height);
+            const uint16_t lastMipLevel = aznumeric_cast<uint16_t>(imageDescriptor.m_mipLevels - 1);
+            uint16_t mipLevel = 0;
+            while (mipLevel < lastMipLevel && static_cast<float>(imageMaxSize >> (mipLevel + 1)) >= m_recentScreenSize)
             {
-                m_evictableMips = aznumeric_cast<uint16_t>(tailMip) - m_residentMip;
+                ++mipLevel;
             }
-            else
+            m_mipLevelTarget = mipLevel;
+        }
+
+        float StreamingImageContext::GetDemandedSize() const
+        {
+            if (m_hasScreenSize)
             {
-                m_evictableMips = 0;
+                return m_recentScreenSize;
             }
 
-            // get the length of the resident mip
-            RHI::Size mipSize = m_streamingImage->m_imageAsset->GetImageDescriptor().m_size.GetReducedMip(aznumeric_cast<uint32_t>(m_residentMip));
-            m_residentMipSize = mipSize.m_width > mipSize.m_height? mipSize.m_width : mipSize.m_height;
+            const RHI::Size targetMipSize = m_streamingImage->m_imageAsset->GetImageDescriptor().m_size.GetReducedMip(m_mipLevelTarget);
+            return static_cast<float>(AZStd::max(targetMipSize.m_width, targetMipSize.m_height));
         }
     }
 }
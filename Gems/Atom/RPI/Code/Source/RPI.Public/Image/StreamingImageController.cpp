@@ -10,8 +10,12 @@
 #include <Atom/RPI.Public/Image/StreamingImageContext.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 
+#include <AzCore/IO/IStreamerTypes.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Time/ITime.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
 
 AZ_DECLARE_BUDGET(RPI);
 
@@ -27,6 +31,80 @@ namespace AZ
         #define StreamingDebugOutput(window, ...)
 #endif
 
+        size_t StreamingImageController::PlanMipChainTargets(AZStd::span<MipChainPlanEntry> entries, size_t memoryBudget)
+        {
+            AZStd::vector<MipChainUpgrade> upgrades;
+            return PlanMipChainTargets(entries, memoryBudget, upgrades);
+        }
+
+        size_t StreamingImageController::PlanMipChainTargets(
+            AZStd::span<MipChainPlanEntry> entries, size_t memoryBudget, AZStd::vector<MipChainUpgrade>& upgrades)
+        {
+            auto getUpgrade = [&entries](size_t entryIndex)
+            {
+                const MipChainPlanEntry& entry = entries[entryIndex];
+                const size_t upgradeSize = AZStd::max<size_t>(entry.m_mipChainSizes[entry.m_targetMipChain - 1], 1);
+                return MipChainUpgrade{ entry.m_score / static_cast<float>(upgradeSize), entryIndex };
+            };
+
+            // Every image keeps its tail mip chain
+            size_t plannedMemory = 0;
+            upgrades.clear();
+            upgrades.reserve(entries.size());
+            for (size_t entryIndex = 0; entryIndex < entries.size(); ++entryIndex)
+            {
+                MipChainPlanEntry& entry = entries[entryIndex];
+                if (entry.m_mipChainSizes.empty())
+                {
+                    entry.m_targetMipChain = 0;
+                    continue;
+                }
+
+                const uint16_t tailMipChain = aznumeric_cast<uint16_t>(entry.m_mipChainSizes.size() - 1);
+                entry.m_desiredMipChain = AZStd::min(entry.m_desiredMipChain, tailMipChain);
+                entry.m_targetMipChain = tailMipChain;
+                plannedMemory += entry.m_mipChainSizes[tailMipChain];
+
+                if (entry.m_targetMipChain > entry.m_desiredMipChain)
+                {
+                    upgrades.push_back(getUpgrade(entryIndex));
+                }
+            }
+
+            // Add the upgrades with the best score per byte first. The mip chains of an image get bigger as they get more
+            // detailed, so the upgrades of an image are always taken from the least to the most detailed mip chain.
+            AZStd::make_heap(upgrades.begin(), upgrades.end());
+            while (!upgrades.empty())
+            {
+                AZStd::pop_heap(upgrades.begin(), upgrades.end());
+                const size_t entryIndex = upgrades.back().m_entryIndex;
+                upgrades.pop_back();
+
+                MipChainPlanEntry& entry = entries[entryIndex];
+                const size_t upgradeSize = entry.m_mipChainSizes[entry.m_targetMipChain - 1];
+                if (memoryBudget > 0 && plannedMemory + upgradeSize > memoryBudget)
+                {
+                    // The next mip chains of this image are even bigger, so none of them fits either
+                    continue;
+                }
+
+                plannedMemory += upgradeSize;
+                --entry.m_targetMipChain;
+                if (entry.m_targetMipChain > entry.m_desiredMipChain)
+                {
+                    upgrades.push_back(getUpgrade(entryIndex));
+                    AZStd::push_heap(upgrades.begin(), upgrades.end());
+                }
+            }
+
+            return plannedMemory;
+        }
+
+        float StreamingImageController::ComputeStreamingScore(float demandedSize, size_t updatesSinceLastUse)
+        {
+            return demandedSize / (1.0f + static_cast<float>(updatesSinceLastUse) / static_cast<float>(RecentUseUpdateCount));
+        }
+
         AZStd::unique_ptr<StreamingImageController> StreamingImageController::Create(RHI::StreamingImagePool& pool)
         {
             AZStd::unique_ptr<StreamingImageController> controller = AZStd::make_unique<StreamingImageController>();
@@ -55,9 +133,8 @@ namespace AZ
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
                 m_streamableImages.insert(image);
+                image->m_streamingContext->InitMipChainSizes();
             }
-
-            ReinsertImageToLists(image);
         }
 
         void StreamingImageController::DetachImage(StreamingImage* image)
@@ -65,13 +142,11 @@ namespace AZ
             AZ_Assert(image, "Image must not be null.");
 
             // Remove image from the list first before clearing the image streaming context
-            // since the compare functions may use the image's StreamingImageContext
+            // since the update may use the image's StreamingImageContext
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
                 m_streamableImages.erase(image);
                 m_expandingImages.erase(image);
-                m_expandableImages.erase(image);
-                m_evictableImages.erase(image);
             }
 
             const StreamingImageContextPtr& context = image->m_streamingContext;
@@ -88,35 +163,12 @@ namespace AZ
             image->m_streamingContext = nullptr;
         }
 
-        void StreamingImageController::ReinsertImageToLists(StreamingImage* image)
-        {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
-            m_expandableImages.erase(image);
-            m_evictableImages.erase(image);
-
-            if (!image->IsExpanding())
-            {
-                image->m_streamingContext->UpdateMipStats();
-
-                if (NeedExpand(image))
-                {
-                    m_expandableImages.insert(image);
-                }
-                if (image->IsTrimmable())
-                {
-                    m_evictableImages.insert(image);
-                }
-            }
-        }
-
         void StreamingImageController::EndExpandImage(StreamingImage* image)
         {
             // remove unused mips in case global mip bias was changed during expanding
             EvictUnusedMips(image);
 
             image->m_streamingContext->m_queuedForMipExpand = false;
-
-            ReinsertImageToLists(image);
         }
 
         void StreamingImageController::Update()
@@ -191,17 +243,15 @@ namespace AZ
                 m_lastLowMemory = 0;
             }
             
-            // Try to expand if it's not in low memory state
-            jobCount = 0;
-            while (jobCount < c_jobCount && m_lastLowMemory == 0)
+            // Plan the mip chains of all the images under the budget, then trim and expand the images to their planned mip chains.
+            // Don't expand any image while the memory is low.
             {
-                if (ExpandOneMipChain())
-                {
-                    jobCount++;
-                }
-                else
+                AZStd::lock_guard<AZStd::recursive_mutex> imageListAccesslock(m_imageListAccessMutex);
+                UpdateStreamingPlan();
+                EvictToPlannedTargets();
+                if (m_lastLowMemory == 0)
                 {
-                    break;
+                    ExpandToPlannedTargets(c_jobCount);
                 }
             }
 
@@ -220,70 +270,26 @@ namespace AZ
             context->m_mipLevelTarget = mipLevelTarget;
             context->m_lastAccessTimestamp = m_timestamp;
 
-            // update image priority and re-insert the image
+            // evict the mips which are no longer needed right away; the next update expands the image if needed
             if (!context->m_queuedForMipExpand)
             {
                 EvictUnusedMips(image);
             }
-
-            // reinsert the image since the priority might be changed after mip target changed
-            ReinsertImageToLists(image);
         }
 
-        bool StreamingImageController::ExpandPriorityComparator::operator()(const StreamingImage* lhs, const StreamingImage* rhs) const
+        void StreamingImageController::OnReportScreenSize(StreamingImage* image, float screenSizeInPixels)
         {
-            // use the resident mip size and missing mip count to decide the expand priority
-            auto lhsMipSize = lhs->m_streamingContext->m_residentMipSize;
-            auto rhsMipSize = rhs->m_streamingContext->m_residentMipSize;
-
-            if (lhsMipSize == rhsMipSize)
-            {
-                auto lhsMissingMips = lhs->m_streamingContext->m_missingMips;
-                auto rhsMissingMips = rhs->m_streamingContext->m_missingMips;
-                if (lhsMissingMips == rhsMissingMips)
-                {
-                    auto lhsTimestamp = lhs->m_streamingContext->GetLastAccessTimestamp();
-                    auto rhsTimestamp = rhs->m_streamingContext->GetLastAccessTimestamp();
-                    if (lhsTimestamp == rhsTimestamp)
-                    {
-                        // we need this to avoid same key in the AZStd::set
-                        return lhs < rhs;
-                    }
-                    // latest accessed image has higher priority
-                    return lhsTimestamp > rhsTimestamp;
-                }
-                else
-                {
-                    // image with more missing mips has higher priority
-                    return lhsMissingMips > rhsMissingMips; 
-                }
-            }
-
-            // image has smaller resolution has higher priority
-            return lhsMipSize < rhsMipSize;
-        }
-        
-        bool StreamingImageController::EvictPriorityComparator::operator()(const StreamingImage* lhs, const StreamingImage* rhs) const
-        {
-            auto lhsEvictableMips = lhs->m_streamingContext->m_evictableMips;
-            auto rhsEvictableMips = rhs->m_streamingContext->m_evictableMips;
+            StreamingImageContext* context = image->m_streamingContext.get();
 
-            if (lhsEvictableMips == rhsEvictableMips)
+            // Keep the largest size reported during this frame. Views may report from multiple threads.
+            const uint32_t screenSize = aznumeric_cast<uint32_t>(AZStd::ceil(AZStd::clamp(screenSizeInPixels, 0.0f, 65536.0f)));
+            uint32_t frameScreenSize = context->m_frameScreenSize.load();
+            while (frameScreenSize < screenSize && !context->m_frameScreenSize.compare_exchange_weak(frameScreenSize, screenSize))
             {
-                auto lhsTimestamp = lhs->m_streamingContext->GetLastAccessTimestamp();
-                auto rhsTimestamp = rhs->m_streamingContext->GetLastAccessTimestamp();
-                if (lhsTimestamp == rhsTimestamp)
-                {
-                    // we need this to avoid same key in the AZStd::set
-                    return lhs < rhs;
-                }
-
-                // Last visited image will be evicted later
-                return lhsTimestamp < rhsTimestamp;
             }
 
-            // images with higher evictable mip count will be evict first
-            return lhsEvictableMips > rhsEvictableMips; 
+            context->m_hasScreenSize = true;
+            context->m_lastAccessTimestamp = m_timestamp;
         }
 
         void StreamingImageController::OnMipChainAssetReady(StreamingImage* image)
@@ -320,26 +326,11 @@ namespace AZ
 
             m_globalMipBias = mipBias;
 
-            // we need go through all the streamable image to update their streaming context and regenerate the lists
+            // evict the mips which are no longer needed; the next update plans and expands the images with the new bias
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
-            m_expandableImages.clear();
-            m_evictableImages.clear();
-
             for (auto image : m_streamableImages)
             {
                 EvictUnusedMips(image);
-                image->m_streamingContext->UpdateMipStats();
-                if (!image->IsExpanding())
-                {
-                    if (NeedExpand(image))
-                    {
-                        m_expandableImages.insert(image);
-                    }
-                    if (image->IsTrimmable())
-                    {
-                        m_evictableImages.insert(image);
-                    }
-                }
             }
         }
 
@@ -361,58 +352,152 @@ namespace AZ
         bool StreamingImageController::EvictOneMipChain()
         {
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
-            for (auto itr = m_evictableImages.begin(); itr != m_evictableImages.end(); itr++)
-            {
-                StreamingImage* image = *itr;
 
-                RHI::ResultCode success = image->TrimOneMipChain();
+            // Evict from the image with the lowest streaming score, then the least recently used one
+            StreamingImage* evictImage = nullptr;
+            for (StreamingImage* image : m_streamableImages)
+            {
+                if (image->IsExpanding() || !image->IsTrimmable())
+                {
+                    continue;
+                }
 
-                if (success == RHI::ResultCode::Success)
+                if (!evictImage)
                 {
-                    // update the image's priority and re-insert the image
-                    ReinsertImageToLists(image);
-
-                    StreamingDebugOutput(
-                        "StreamingImageController",
-                        "Image [%s] has one mipchain released; Current resident mip: %d\n",
-                        image->GetRHIImage()->GetName().GetCStr(),
-                        image->GetRHIImage()->GetResidentMipLevel());
-                    return true;
+                    evictImage = image;
+                    continue;
                 }
-                else
+
+                const StreamingImageContext* context = image->m_streamingContext.get();
+                const StreamingImageContext* evictContext = evictImage->m_streamingContext.get();
+                if (context->GetStreamingScore() < evictContext->GetStreamingScore() ||
+                    (context->GetStreamingScore() == evictContext->GetStreamingScore() &&
+                     context->GetLastAccessTimestamp() < evictContext->GetLastAccessTimestamp()))
                 {
-                    AZ_Assert(false, "failed to evict an evictable image!");
+                    evictImage = image;
                 }
             }
 
-            return false;
+            if (!evictImage)
+            {
+                return false;
+            }
+
+            [[maybe_unused]] RHI::ResultCode success = evictImage->TrimOneMipChain();
+            AZ_Assert(success == RHI::ResultCode::Success, "failed to evict an evictable image!");
+
+            StreamingDebugOutput(
+                "StreamingImageController",
+                "Image [%s] has one mipchain released; Current resident mip: %d\n",
+                evictImage->GetRHIImage()->GetName().GetCStr(),
+                evictImage->GetRHIImage()->GetResidentMipLevel());
+            return true;
         }
 
-        bool StreamingImageController::NeedExpand(const StreamingImage* image) const
+        void StreamingImageController::UpdateStreamingPlan()
         {
-            uint16_t targetMip = GetImageTargetMip(image);
-            // only need expand if the current expanding target is smaller than final target
-            return image->m_mipChainState.m_streamingTarget > image->m_imageAsset->GetMipChainIndex(targetMip);
+            AZ_PROFILE_FUNCTION(RPI);
+
+            m_planEntries.clear();
+            m_planImages.clear();
+
+            for (StreamingImage* image : m_streamableImages)
+            {
+                StreamingImageContext* context = image->m_streamingContext.get();
+                context->UpdateScreenSize();
+
+                const size_t lastAccessTimestamp = context->GetLastAccessTimestamp();
+                const size_t updatesSinceLastUse = m_timestamp > lastAccessTimestamp ? m_timestamp - lastAccessTimestamp : 0;
+                context->m_streamingScore = ComputeStreamingScore(context->GetDemandedSize(), updatesSinceLastUse);
+
+                MipChainPlanEntry& entry = m_planEntries.emplace_back();
+                entry.m_mipChainSizes = context->m_mipChainSizes;
+                entry.m_desiredMipChain = aznumeric_cast<uint16_t>(image->m_imageAsset->GetMipChainIndex(GetImageTargetMip(image)));
+                entry.m_score = context->m_streamingScore;
+                m_planImages.push_back(image);
+            }
+
+            m_plannedMemoryUsage = PlanMipChainTargets(m_planEntries, GetStreamingBudget(), m_planUpgrades);
+
+            for (size_t index = 0; index < m_planImages.size(); ++index)
+            {
+                m_planImages[index]->m_streamingContext->m_plannedMipChain = m_planEntries[index].m_targetMipChain;
+            }
         }
 
-        bool StreamingImageController::ExpandOneMipChain()
+        void StreamingImageController::EvictToPlannedTargets()
         {
-            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_imageListAccessMutex);
-            if (m_expandableImages.size() == 0)
+            for (StreamingImage* image : m_planImages)
             {
-                return false; 
+                const uint16_t plannedMipChain = image->m_streamingContext->m_plannedMipChain;
+                if (image->m_mipChainState.m_streamingTarget >= plannedMipChain)
+                {
+                    continue;
+                }
+
+                // Cancel the in-flight fetches before trimming, so the image doesn't claim mip chains which aren't loaded yet
+                if (image->IsExpanding())
+                {
+                    image->CancelExpanding();
+                    image->m_streamingContext->m_queuedForMipExpand = false;
+                    m_expandingImages.erase(image);
+                }
+
+                [[maybe_unused]] const RHI::ResultCode resultCode = image->TrimToMipChainLevel(plannedMipChain);
+                AZ_Warning("StreamingImageController", resultCode == RHI::ResultCode::Success, "Failed to trim streaming image to its planned mip chain.");
+
+                StreamingDebugOutput("StreamingImageController", "Image [%s] was trimmed to planned mip chain %d\n",
+                    image->GetRHIImage()->GetName().GetCStr(), plannedMipChain);
             }
-            auto itr = m_expandableImages.begin();
-            StreamingImage* image = *itr;
-            image->QueueExpandToNextMipChainLevel();
-            if (image->IsExpanding())
+        }
+
+        void StreamingImageController::ExpandToPlannedTargets(uint32_t maxCount)
+        {
+            AZ_PROFILE_FUNCTION(RPI);
+
+            AZStd::vector<StreamingImage*>& expandImages = m_expandImages;
+            expandImages.clear();
+            for (StreamingImage* image : m_planImages)
             {
-                StreamingDebugOutput("StreamingImageController", "Image [%s] is expanding mip level to %d\n",
-                    image->GetRHIImage()->GetName().GetCStr(), image->m_imageAsset->GetMipChainIndex(image->m_mipChainState.m_streamingTarget));
-                m_expandingImages.insert(image);
-                ReinsertImageToLists(image);
+                if (!image->IsExpanding() && image->m_mipChainState.m_streamingTarget > image->m_streamingContext->m_plannedMipChain)
+                {
+                    expandImages.push_back(image);
+                }
+            }
+
+            const size_t expandCount = AZStd::min<size_t>(expandImages.size(), maxCount);
+            AZStd::partial_sort(expandImages.begin(), expandImages.begin() + expandCount, expandImages.end(),
+                [](const StreamingImage* lhs, const StreamingImage* rhs)
+                {
+                    const float lhsScore = lhs->m_streamingContext->GetStreamingScore();
+                    const float rhsScore = rhs->m_streamingContext->GetStreamingScore();
+                    if (lhsScore == rhsScore)
+                    {
+                        // latest accessed image has higher priority
+                        return lhs->m_streamingContext->GetLastAccessTimestamp() > rhs->m_streamingContext->GetLastAccessTimestamp();
+                    }
+                    return lhsScore > rhsScore;
+                });
+
+            for (size_t rank = 0; rank < expandCount; ++rank)
+            {
+                StreamingImage* image = expandImages[rank];
+                const StreamingImageContext* context = image->m_streamingContext.get();
+
+                // The images used in the last update are needed right now; the others are prefetched
+                Data::AssetLoadParameters loadParams;
+                loadParams.m_deadline = AZStd::chrono::duration_cast<IO::IStreamerTypes::Deadline>(ExpandDeadlineStep * aznumeric_cast<int64_t>(rank + 1));
+                loadParams.m_priority = (m_timestamp - context->GetLastAccessTimestamp() <= 1) ?
+                    IO::IStreamerTypes::s_priorityHigh : IO::IStreamerTypes::s_priorityMedium;
+
+                image->QueueExpandToMipChainLevel(context->m_plannedMipChain, loadParams);
+                if (image->IsExpanding())
+                {
+                    StreamingDebugOutput("StreamingImageController", "Image [%s] is expanding mip level to %d\n",
+                        image->GetRHIImage()->GetName().GetCStr(), image->m_imageAsset->GetMipChainIndex(image->m_mipChainState.m_streamingTarget));
+                    m_expandingImages.insert(image);
+                }
             }
-            return true;
         }
 
         uint16_t StreamingImageController::GetImageTargetMip(const StreamingImage* image) const
@@ -427,6 +512,21 @@ namespace AZ
             return m_lastLowMemory != 0;
         }
 
+        void StreamingImageController::SetStreamingBudget(size_t budgetInBytes)
+        {
+            m_streamingBudget = budgetInBytes;
+        }
+
+        size_t StreamingImageController::GetStreamingBudget() const
+        {
+            const size_t streamingBudget = m_streamingBudget.load();
+            if (streamingBudget > 0)
+            {
+                return streamingBudget;
+            }
+            return m_pool->GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device).m_budgetInBytes;
+        }
+
         bool StreamingImageController::EvictUnusedMips(StreamingImage* image)
         {
             uint16_t targetMip = GetImageTargetMip(image);
@@ -147,5 +147,15 @@ namespace AZ
         {
             return m_controller->GetMipBias();
         }
+
+        void StreamingImagePool::SetStreamingBudget(size_t budgetInBytes)
+        {
+            m_controller->SetStreamingBudget(budgetInBytes);
+        }
+
+        size_t StreamingImagePool::GetStreamingBudget() const
+        {
+            return m_controller->GetStreamingBudget();
+        }
     }
 }
@@ -252,19 +252,25 @@ namespace AZ
                 bool anyHit = false;
                 float shortestDistanceNormalized = AZStd::numeric_limits<float>::max();
 
-                const AZ::u32* indexPtr = reinterpret_cast<const AZ::u32*>(
-                    indexRawBuffer.data() + (indexBufferViewDesc.m_elementOffset * indexBufferViewDesc.m_elementSize));
+                // Optimized models store 16-bit indices when each mesh has less than 65536 vertices
+                const uint8_t* indexData = indexRawBuffer.data() + (indexBufferViewDesc.m_elementOffset * indexBufferViewDesc.m_elementSize);
+                const bool use16BitIndices = indexBufferViewDesc.m_elementSize == sizeof(AZ::u16);
+                auto getIndex = [indexData, use16BitIndices](uint32_t indexIter) -> AZ::u32
+                {
+                    return use16BitIndices ? reinterpret_cast<const AZ::u16*>(indexData)[indexIter]
+                                           : reinterpret_cast<const AZ::u32*>(indexData)[indexIter];
+                };
                 const float* positionPtr = reinterpret_cast<const float*>(
                     positionRawBuffer.data() + (positionBufferViewDesc.m_elementOffset * positionBufferViewDesc.m_elementSize));
 
                 Intersect::SegmentTriangleHitTester hitTester(rayStart, rayEnd);
 
                 constexpr int StepSize = 3; // number of values per vertex (x, y, z)
-                for (uint32_t indexIter = 0; indexIter < indexBufferViewDesc.m_elementCount; indexIter += StepSize, indexPtr += StepSize)
+                for (uint32_t indexIter = 0; indexIter < indexBufferViewDesc.m_elementCount; indexIter += StepSize)
                 {
-                    AZ::u32 index0 = indexPtr[0];
-                    AZ::u32 index1 = indexPtr[1];
-                    AZ::u32 index2 = indexPtr[2];
+                    AZ::u32 index0 = getIndex(indexIter);
+                    AZ::u32 index1 = getIndex(indexIter + 1);
+                    AZ::u32 index2 = getIndex(indexIter + 2);
 
                     if (index0 >= positionElementCount || index1 >= positionElementCount || index2 >= positionElementCount)
                     {
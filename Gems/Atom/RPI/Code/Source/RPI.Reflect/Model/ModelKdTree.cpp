@@ -120,9 +120,22 @@ namespace AZ
                     entireBoundBox.AddPoint({positionBuffer[positionIndex], positionBuffer[positionIndex + 1], positionBuffer[positionIndex + 2]});
                 }
 
-                for (const TriangleIndices& triangleIndices : GetIndexBuffer(*m_meshes[meshIndex].m_mesh))
+                const ModelLodAsset::Mesh& mesh = *m_meshes[meshIndex].m_mesh;
+                if (mesh.GetIndexBufferAssetView().GetBufferViewDescriptor().m_elementSize == sizeof(uint16_t))
                 {
-                    indices.emplace_back(meshIndex, triangleIndices);
+                    // Optimized models store 16-bit indices when each mesh has less than 65536 vertices
+                    const AZStd::span<const uint16_t> indexBuffer = mesh.GetIndexBufferTyped<uint16_t>();
+                    for (size_t index = 0; index + 2 < indexBuffer.size(); index += 3)
+                    {
+                        indices.emplace_back(meshIndex, TriangleIndices{ indexBuffer[index], indexBuffer[index + 1], indexBuffer[index + 2] });
+                    }
+                }
+                else
+                {
+                    for (const TriangleIndices& triangleIndices : GetIndexBuffer(mesh))
+                    {
+                        indices.emplace_back(meshIndex, triangleIndices);
+                    }
                 }
             }
 
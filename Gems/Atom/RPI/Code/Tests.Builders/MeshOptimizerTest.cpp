@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/sort.h>
+
+#include <Model/MeshOptimizer.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class MeshOptimizerTests
+        : public LeakDetectionFixture
+    {
+    protected:
+        using Triangle = AZStd::array<uint32_t, 3>;
+
+        // Creates a flat grid of size x size quads, with two triangles per quad
+        static void CreateGrid(uint32_t size, AZStd::vector<uint32_t>& indices, AZStd::vector<float>& positions)
+        {
+            for (uint32_t y = 0; y <= size; ++y)
+            {
+                for (uint32_t x = 0; x <= size; ++x)
+                {
+                    positions.push_back(static_cast<float>(x));
+                    positions.push_back(static_cast<float>(y));
+                    positions.push_back(0.0f);
+                }
+            }
+
+            for (uint32_t y = 0; y < size; ++y)
+            {
+                for (uint32_t x = 0; x < size; ++x)
+                {
+                    const uint32_t corner = y * (size + 1) + x;
+                    indices.insert(indices.end(), { corner, corner + 1, corner + size + 1 });
+                    indices.insert(indices.end(), { corner + 1, corner + size + 2, corner + size + 1 });
+                }
+            }
+        }
+
+        // Returns the triangles with their vertices rotated so the smallest index is first, sorted, so two lists
+        // of the same triangles in a different order and with the same winding compare equal
+        static AZStd::vector<Triangle> GetSortedTriangles(const AZStd::vector<uint32_t>& indices)
+        {
+            AZStd::vector<Triangle> triangles;
+            for (size_t i = 0; i < indices.size(); i += 3)
+            {
+                Triangle triangle = { indices[i], indices[i + 1], indices[i + 2] };
+                while (triangle[0] > triangle[1] || triangle[0] > triangle[2])
+                {
+                    triangle = { triangle[1], triangle[2], triangle[0] };
+                }
+                triangles.push_back(triangle);
+            }
+            AZStd::sort(triangles.begin(), triangles.end());
+            return triangles;
+        }
+    };
+
+    TEST_F(MeshOptimizerTests, CalculateAcmr_NoVertexReused_Returns3)
+    {
+        const AZStd::vector<uint32_t> indices = { 0, 1, 2, 3, 4, 5 };
+        EXPECT_FLOAT_EQ(RPI::MeshOptimizer::CalculateAcmr(indices, 6), 3.0f);
+    }
+
+    TEST_F(MeshOptimizerTests, OptimizeVertexCache_Grid_ImprovesAcmrAndKeepsTriangles)
+    {
+        // A grid much wider than the cache, so its rows don't fit in the cache in the source order
+        AZStd::vector<uint32_t> indices;
+        AZStd::vector<float> positions;
+        CreateGrid(64, indices, positions);
+        const size_t vertexCount = positions.size() / 3;
+        const AZStd::vector<Triangle> sourceTriangles = GetSortedTriangles(indices);
+
+        const float sourceAcmr = RPI::MeshOptimizer::CalculateAcmr(indices, vertexCount);
+        RPI::MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+        const float optimizedAcmr = RPI::MeshOptimizer::CalculateAcmr(indices, vertexCount);
+
+        EXPECT_LT(optimizedAcmr, sourceAcmr * 0.8f);
+        EXPECT_EQ(GetSortedTriangles(indices), sourceTriangles);
+    }
+
+    TEST_F(MeshOptimizerTests, OptimizeOverdraw_Grid_KeepsTrianglesWithinThreshold)
+    {
+        AZStd::vector<uint32_t> indices;
+        AZStd::vector<float> positions;
+        CreateGrid(32, indices, positions);
+        const size_t vertexCount = positions.size() / 3;
+        const AZStd::vector<Triangle> sourceTriangles = GetSortedTriangles(indices);
+
+        RPI::MeshOptimizer::OptimizeVertexCache(indices, vertexCount);
+        const float vertexCacheAcmr = RPI::MeshOptimizer::CalculateAcmr(indices, vertexCount);
+
+        const float threshold = 1.05f;
+        RPI::MeshOptimizer::OptimizeOverdraw(indices, positions, vertexCount, threshold);
+
+        EXPECT_LE(RPI::MeshOptimizer::CalculateAcmr(indices, vertexCount), vertexCacheAcmr * threshold + 0.01f);
+        EXPECT_EQ(GetSortedTriangles(indices), sourceTriangles);
+    }
+
+    TEST_F(MeshOptimizerTests, OptimizeVertexFetch_OrdersVerticesByFirstUse)
+    {
+        // Vertex 4 is not used by any triangle
+        AZStd::vector<uint32_t> indices = { 3, 1, 0, 0, 1, 2 };
+        AZStd::vector<float> uvs = { 0.0f, 0.5f, 1.0f, 1.5f, 2.0f, 2.5f, 3.0f, 3.5f, 4.0f, 4.5f };
+
+        const AZStd::vector<uint32_t> remap = RPI::MeshOptimizer::OptimizeVertexFetch(indices, 5);
+        RPI::MeshOptimizer::RemapVertexStream(uvs, remap, 2);
+
+        EXPECT_EQ(indices, AZStd::vector<uint32_t>({ 0, 1, 2, 2, 1, 3 }));
+        EXPECT_EQ(remap, AZStd::vector<uint32_t>({ 2, 1, 3, 0, 4 }));
+        EXPECT_EQ(uvs, AZStd::vector<float>({ 3.0f, 3.5f, 1.0f, 1.5f, 0.0f, 0.5f, 2.0f, 2.5f, 4.0f, 4.5f }));
+    }
+
+    TEST_F(MeshOptimizerTests, QuantizeSnorm16Stream_PadsAndRoundsComponents)
+    {
+        const AZStd::vector<float> normals = { 1.0f, -1.0f, 0.5f, 0.0f, 2.0f, -0.25f };
+        const AZStd::vector<int16_t> quantizedNormals = RPI::MeshOptimizer::QuantizeSnorm16Stream(normals, 3, 4);
+
+        EXPECT_EQ(quantizedNormals, AZStd::vector<int16_t>({ 32767, -32767, 16384, 0, 0, 32767, -8192, 0 }));
+    }
+
+    TEST_F(MeshOptimizerTests, QuantizeHalf_MatchesHalfFloatEncoding)
+    {
+        EXPECT_EQ(RPI::MeshOptimizer::QuantizeHalf(0.0f), 0x0000);
+        EXPECT_EQ(RPI::MeshOptimizer::QuantizeHalf(1.0f), 0x3c00);
+        EXPECT_EQ(RPI::MeshOptimizer::QuantizeHalf(-2.0f), 0xc000);
+        EXPECT_EQ(RPI::MeshOptimizer::QuantizeHalf(0.1f), 0x2e66);
+        EXPECT_EQ(RPI::MeshOptimizer::QuantizeHalf(65504.0f), 0x7bff);
+        EXPECT_EQ(RPI::MeshOptimizer::QuantizeHalf(100000.0f), 0x7c00);
+        // Smallest denormalized half
+        EXPECT_EQ(RPI::MeshOptimizer::QuantizeHalf(5.9604645e-8f), 0x0001);
+    }
+} // namespace UnitTest
@@ -19,6 +19,7 @@
 
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Image/StreamingImageController.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 
@@ -723,4 +724,135 @@ namespace UnitTest
             EXPECT_NEAR(pixelDataValue, pixelExpectedValue, Constants::Tolerance);
         }
     }
+
+    // Builds a planning entry for an image with the given mip chain sizes (from the most detailed to the tail mip chain)
+    static AZ::RPI::StreamingImageController::MipChainPlanEntry CreatePlanEntry(
+        AZStd::initializer_list<size_t> mipChainSizes, uint16_t desiredMipChain, float score)
+    {
+        AZ::RPI::StreamingImageController::MipChainPlanEntry entry;
+        for (size_t mipChainSize : mipChainSizes)
+        {
+            entry.m_mipChainSizes.push_back(mipChainSize);
+        }
+        entry.m_desiredMipChain = desiredMipChain;
+        entry.m_score = score;
+        return entry;
+    }
+
+    TEST_F(StreamingImageTests, PlanMipChainTargets_NoBudget_ReachesDesiredMipChains)
+    {
+        using namespace AZ;
+
+        AZStd::vector<RPI::StreamingImageController::MipChainPlanEntry> entries;
+        entries.push_back(CreatePlanEntry({ 4096, 1024, 256 }, 0, 1.0f));
+        entries.push_back(CreatePlanEntry({ 4096, 1024, 256 }, 1, 1.0f));
+        entries.push_back(CreatePlanEntry({ 4096, 1024, 256 }, 5, 1.0f));
+
+        const size_t plannedMemory = RPI::StreamingImageController::PlanMipChainTargets(entries, 0);
+
+        EXPECT_EQ(entries[0].m_targetMipChain, 0);
+        EXPECT_EQ(entries[1].m_targetMipChain, 1);
+        EXPECT_EQ(entries[2].m_targetMipChain, 2);
+        EXPECT_EQ(plannedMemory, (4096 + 1024 + 256) + (1024 + 256) + 256);
+    }
+
+    TEST_F(StreamingImageTests, PlanMipChainTargets_TightBudget_FavorsHigherScores)
+    {
+        using namespace AZ;
+
+        AZStd::vector<RPI::StreamingImageController::MipChainPlanEntry> entries;
+        entries.push_back(CreatePlanEntry({ 4096, 1024, 256 }, 0, 1.0f));
+        entries.push_back(CreatePlanEntry({ 4096, 1024, 256 }, 0, 8.0f));
+
+        // Enough for both tails, and both middle mip chains, but only one of the most detailed mip chains
+        const size_t budget = 2 * (1024 + 256) + 4096;
+        const size_t plannedMemory = RPI::StreamingImageController::PlanMipChainTargets(entries, budget);
+
+        EXPECT_EQ(entries[0].m_targetMipChain, 1);
+        EXPECT_EQ(entries[1].m_targetMipChain, 0);
+        EXPECT_EQ(plannedMemory, budget);
+    }
+
+    TEST_F(StreamingImageTests, PlanMipChainTargets_BudgetBelowTails_KeepsTails)
+    {
+        using namespace AZ;
+
+        AZStd::vector<RPI::StreamingImageController::MipChainPlanEntry> entries;
+        entries.push_back(CreatePlanEntry({ 4096, 1024, 256 }, 0, 1.0f));
+        entries.push_back(CreatePlanEntry({ 1024, 256 }, 0, 1.0f));
+        entries.push_back(CreatePlanEntry({}, 0, 1.0f));
+
+        const size_t plannedMemory = RPI::StreamingImageController::PlanMipChainTargets(entries, 16);
+
+        EXPECT_EQ(entries[0].m_targetMipChain, 2);
+        EXPECT_EQ(entries[1].m_targetMipChain, 1);
+        EXPECT_EQ(entries[2].m_targetMipChain, 0);
+        EXPECT_EQ(plannedMemory, 256 + 256);
+    }
+
+    TEST_F(StreamingImageTests, PlanMipChainTargets_SmallUpgradesFirst_FitMoreImages)
+    {
+        using namespace AZ;
+
+        // Same score, so the cheaper upgrade of the small image is taken before the large image's upgrade
+        AZStd::vector<RPI::StreamingImageController::MipChainPlanEntry> entries;
+        entries.push_back(CreatePlanEntry({ 16384, 4096 }, 0, 1.0f));
+        entries.push_back(CreatePlanEntry({ 1024, 256 }, 0, 1.0f));
+
+        const size_t plannedMemory = RPI::StreamingImageController::PlanMipChainTargets(entries, 4096 + 256 + 1024);
+
+        EXPECT_EQ(entries[0].m_targetMipChain, 1);
+        EXPECT_EQ(entries[1].m_targetMipChain, 0);
+        EXPECT_EQ(plannedMemory, 4096 + 256 + 1024);
+    }
+
+    TEST_F(StreamingImageTests, PlanMipChainTargets_BudgetLowered_EvictsLeastRecentlyUsedImagesFirst)
+    {
+        using namespace AZ;
+
+        // Two images shown at the same size. Without a budget both stream in fully.
+        AZStd::vector<RPI::StreamingImageController::MipChainPlanEntry> entries;
+        entries.push_back(CreatePlanEntry({ 4096, 1024, 256 }, 0, RPI::StreamingImageController::ComputeStreamingScore(512.0f, 0)));
+        entries.push_back(CreatePlanEntry({ 4096, 1024, 256 }, 0, RPI::StreamingImageController::ComputeStreamingScore(512.0f, 0)));
+        EXPECT_EQ(RPI::StreamingImageController::PlanMipChainTargets(entries, 0), 2 * (4096 + 1024 + 256));
+        EXPECT_EQ(entries[0].m_targetMipChain, 0);
+        EXPECT_EQ(entries[1].m_targetMipChain, 0);
+
+        // The first image hasn't been seen for a while, then the budget drops below what both images use.
+        // Only the image which isn't used anymore is evicted, and the plan fits in the budget.
+        entries[0].m_score = RPI::StreamingImageController::ComputeStreamingScore(512.0f, RPI::StreamingImageController::RecentUseUpdateCount);
+        const size_t budget = (4096 + 1024 + 256) + (1024 + 256);
+        const size_t plannedMemory = RPI::StreamingImageController::PlanMipChainTargets(entries, budget);
+
+        EXPECT_EQ(entries[0].m_targetMipChain, 1);
+        EXPECT_EQ(entries[1].m_targetMipChain, 0);
+        EXPECT_EQ(plannedMemory, budget);
+    }
+
+    TEST_F(StreamingImageTests, ComputeStreamingScore_FavorsLargerAndRecentlyUsedImages)
+    {
+        using namespace AZ;
+
+        const float recentScore = RPI::StreamingImageController::ComputeStreamingScore(512.0f, 0);
+        EXPECT_FLOAT_EQ(recentScore, 512.0f);
+        EXPECT_GT(recentScore, RPI::StreamingImageController::ComputeStreamingScore(256.0f, 0));
+        EXPECT_GT(recentScore, RPI::StreamingImageController::ComputeStreamingScore(512.0f, 1));
+        EXPECT_FLOAT_EQ(
+            RPI::StreamingImageController::ComputeStreamingScore(512.0f, RPI::StreamingImageController::RecentUseUpdateCount),
+            256.0f);
+    }
+
+    TEST_F(StreamingImageTests, PoolStreamingBudget_Override_FallsBackToPoolBudget)
+    {
+        using namespace AZ;
+
+        const size_t poolBudget = m_defaultPool->GetMemoryBudget();
+        EXPECT_EQ(m_defaultPool->GetStreamingBudget(), poolBudget);
+
+        m_defaultPool->SetStreamingBudget(1024 * 1024);
+        EXPECT_EQ(m_defaultPool->GetStreamingBudget(), 1024 * 1024);
+
+        m_defaultPool->SetStreamingBudget(0);
+        EXPECT_EQ(m_defaultPool->GetStreamingBudget(), poolBudget);
+    }
 }
@@ -1108,6 +1108,40 @@ namespace UnitTest
             Add(lodCreator, positions, positionCount, positionOffset, positionBuffer, indices, indexCount, indexOffset, indexBuffer);
         }
 
+        // add a sub mesh with a new position buffer and a new index buffer that stores the indices as 16-bit values
+        void Add16BitIndices(
+            AZ::RPI::ModelLodAssetCreator& lodCreator,
+            const float* positions,
+            size_t positionCount,
+            const uint32_t* indices,
+            size_t indexCount)
+        {
+            AZ::Data::Asset<AZ::RPI::BufferAsset> indexBuffer = BuildTestBuffer(aznumeric_cast<uint32_t>(indexCount), sizeof(uint16_t));
+            AZ::Data::Asset<AZ::RPI::BufferAsset> positionBuffer =
+                BuildTestBuffer(aznumeric_cast<uint32_t>(positionCount / 3), sizeof(float) * 3);
+
+            lodCreator.BeginMesh();
+            lodCreator.SetMeshAabb(AZ::Aabb::CreateFromMinMax({ -1.0f, -1.0f, -1.0f }, { 1.0f, 1.0f, 1.0f }));
+            lodCreator.SetMeshMaterialSlot(AZ::Sfmt::GetInstance().Rand32());
+
+            AZStd::transform(
+                indices, indices + indexCount, reinterpret_cast<uint16_t*>(const_cast<uint8_t*>(indexBuffer->GetBuffer().data())),
+                [](uint32_t index)
+                {
+                    return aznumeric_cast<uint16_t>(index);
+                });
+            lodCreator.SetMeshIndexBuffer(
+                { indexBuffer,
+                  AZ::RHI::BufferViewDescriptor::CreateStructured(0, aznumeric_cast<uint32_t>(indexCount), sizeof(uint16_t)) });
+            AZStd::copy(positions, positions + positionCount, reinterpret_cast<float*>(const_cast<uint8_t*>(positionBuffer->GetBuffer().data())));
+            lodCreator.AddMeshStreamBuffer(
+                AZ::RHI::ShaderSemantic(AZ::Name("POSITION")), AZ::Name(),
+                { positionBuffer,
+                  AZ::RHI::BufferViewDescriptor::CreateStructured(0, aznumeric_cast<uint32_t>(positionCount / 3), sizeof(float) * 3) });
+
+            lodCreator.EndMesh();
+        }
+
         // complete the asset lod creation process
         void End(AZ::RPI::ModelLodAssetCreator& lodCreator)
         {
@@ -1429,4 +1463,44 @@ namespace UnitTest
         EXPECT_THAT(t, testing::FloatEq(0.5f));
         EXPECT_THAT(normal, IsClose(AZ::Vector3::CreateAxisZ()));
     }
+
+    // optimized models store 16-bit indices, which both the brute-force and the kd-tree intersection must read as such
+    TEST_F(ModelTests, BruteForceIntersectsMeshWith16BitIndices)
+    {
+        TestMesh mesh;
+        AZ::RPI::ModelLodAssetCreator lodCreator;
+        mesh.Begin(lodCreator);
+        mesh.Add16BitIndices(lodCreator, CubePositions.data(), CubePositions.size(), CubeIndices.data(), CubeIndices.size());
+        mesh.End(lodCreator);
+
+        float t = 0.0f;
+        AZ::Vector3 normal = AZ::Vector3::CreateOne(); // invalid starting normal
+        constexpr bool AllowBruteForce = false;
+        EXPECT_THAT(
+            mesh.GetModel()->LocalRayIntersectionAgainstModel(
+                AZ::Vector3::CreateAxisZ(5.0f), -AZ::Vector3::CreateAxisZ(10.0f), AllowBruteForce, t, normal),
+            testing::IsTrue());
+        EXPECT_THAT(t, testing::FloatEq(0.4f));
+        EXPECT_THAT(normal, IsClose(AZ::Vector3::CreateAxisZ()));
+    }
+
+    TEST_F(ModelTests, KdTreeIntersectsMeshWith16BitIndices)
+    {
+        TestMesh mesh;
+        AZ::RPI::ModelLodAssetCreator lodCreator;
+        mesh.Begin(lodCreator);
+        mesh.Add16BitIndices(
+            lodCreator, TwoSeparatedPlanesPositions.data(), TwoSeparatedPlanesPositions.size(), TwoSeparatedPlanesIndices.data(),
+            TwoSeparatedPlanesIndices.size());
+        mesh.End(lodCreator);
+
+        AZ::RPI::ModelKdTree kdTree;
+        ASSERT_TRUE(kdTree.Build(mesh.GetModel().Get()));
+
+        float t = AZStd::numeric_limits<float>::max();
+        AZ::Vector3 normal;
+        EXPECT_THAT(
+            kdTree.RayIntersection(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisZ(-100.0f), t, normal), testing::IsTrue());
+        EXPECT_THAT(t, testing::FloatEq(0.005f));
+    }
 } // namespace UnitTest
@@ -84,6 +84,11 @@ namespace EMotionFX
             optimizeSettings.m_maxMorphError = 0.0001f;
             optimizeSettings.m_jointIgnoreList = rootJoints; // Skip optimizing root joints, as that makes the feet jitter.
             optimizeSettings.m_updateDuration = samplingRule ? !samplingRule->GetKeepDuration() : false;
+            if (samplingRule && samplingRule->GetErrorMetric() == Rule::MotionSamplingRule::ErrorMetric::Displacement)
+            {
+                optimizeSettings.m_errorMetric = MotionData::ErrorMetric::Displacement;
+                optimizeSettings.m_displacementDistance = samplingRule->GetDisplacementDistance();
+            }
             finalMotionData->Optimize(optimizeSettings);
         }
 
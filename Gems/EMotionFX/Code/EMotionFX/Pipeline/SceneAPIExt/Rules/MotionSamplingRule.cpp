@@ -112,6 +112,26 @@ namespace EMotionFX
                 m_scaleQualityPercentage = AZ::GetClamp(percentage, 0.0f, 100.0f);
             }
 
+            MotionSamplingRule::ErrorMetric MotionSamplingRule::GetErrorMetric() const
+            {
+                return m_errorMetric;
+            }
+
+            void MotionSamplingRule::SetErrorMetric(ErrorMetric errorMetric)
+            {
+                m_errorMetric = errorMetric;
+            }
+
+            float MotionSamplingRule::GetDisplacementDistance() const
+            {
+                return m_displacementDistance;
+            }
+
+            void MotionSamplingRule::SetDisplacementDistance(float distance)
+            {
+                m_displacementDistance = distance;
+            }
+
             float MotionSamplingRule::GetAllowedSizePercentage() const
             {
                 return m_allowedSizePercentage;
@@ -130,7 +150,7 @@ namespace EMotionFX
                     return;
                 }
 
-                serializeContext->Class<MotionSamplingRule, IRule>()->Version(4)
+                serializeContext->Class<MotionSamplingRule, IRule>()->Version(5)
                     ->Field("motionDataType", &MotionSamplingRule::m_motionDataType)
                     ->Field("sampleRateMethod", &MotionSamplingRule::m_sampleRateMethod)
                     ->Field("customSampleRate", &MotionSamplingRule::m_customSampleRate)
@@ -138,7 +158,9 @@ namespace EMotionFX
                     ->Field("rotationQualityPercentage", &MotionSamplingRule::m_rotationQualityPercentage)
                     ->Field("scaleQualityPercentage", &MotionSamplingRule::m_scaleQualityPercentage)
                     ->Field("allowedSizePercentage", &MotionSamplingRule::m_allowedSizePercentage)
-                    ->Field("keepDuration", &MotionSamplingRule::m_keepDuration);
+                    ->Field("keepDuration", &MotionSamplingRule::m_keepDuration)
+                    ->Field("errorMetric", &MotionSamplingRule::m_errorMetric)
+                    ->Field("displacementDistance", &MotionSamplingRule::m_displacementDistance);
 
                 AZ::EditContext* editContext = serializeContext->GetEditContext();
                 if (editContext)
@@ -194,7 +216,19 @@ namespace EMotionFX
                             ->Attribute(AZ::Edit::Attributes::Decimals, 0)
                             ->Attribute(AZ::Edit::Attributes::DisplayDecimals, 0)
                             ->Attribute(AZ::Edit::Attributes::Suffix, " Percent")
-                            ->Attribute(AZ::Edit::Attributes::Visibility, &MotionSamplingRule::GetVisibilityCompressionSettings);
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &MotionSamplingRule::GetVisibilityCompressionSettings)
+                        ->DataElement(AZ::Edit::UIHandlers::ComboBox, &MotionSamplingRule::m_errorMetric, "Error metric", "How the compression error of joints is measured. "
+                            "Value compares the positions, rotations and scales directly. Displacement compares how far points near the joint move, which results in smaller motions for the compressed motion data type.")
+                            ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                            ->EnumAttribute(ErrorMetric::Value, "Value")
+                            ->EnumAttribute(ErrorMetric::Displacement, "Displacement")
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &MotionSamplingRule::GetVisibilityCompressionSettings)
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &MotionSamplingRule::m_displacementDistance, "Displacement distance", "The distance from the joint at which the displacement error is measured, in units. "
+                            "This is usually about the size of the geometry that is skinned to a joint.")
+                            ->Attribute(AZ::Edit::Attributes::Min, 0.001f)
+                            ->Attribute(AZ::Edit::Attributes::Max, 10.0f)
+                            ->Attribute(AZ::Edit::Attributes::Step, 0.01f)
+                            ->Attribute(AZ::Edit::Attributes::Visibility, &MotionSamplingRule::GetVisibilityDisplacementDistance);
                 }
             }
 
@@ -208,6 +242,15 @@ namespace EMotionFX
                 return m_motionDataType.IsNull() ? AZ::Edit::PropertyVisibility::Show : AZ::Edit::PropertyVisibility::Hide;
             }
 
+            AZ::Crc32 MotionSamplingRule::GetVisibilityDisplacementDistance() const
+            {
+                if (m_errorMetric != ErrorMetric::Displacement)
+                {
+                    return AZ::Edit::PropertyVisibility::Hide;
+                }
+                return GetVisibilityCompressionSettings();
+            }
+
             AZ::Crc32 MotionSamplingRule::GetVisibilityCompressionSettings() const
             {
                 // We selected the 'Automatic' motion data type.
@@ -35,6 +35,12 @@ namespace EMotionFX
                     Custom = 1
                 };
 
+                enum class ErrorMetric : AZ::u8
+                {
+                    Value = 0,
+                    Displacement = 1
+                };
+
                 float GetCustomSampleRate() const;
                 void SetCustomSampleRate(float rate);
 
@@ -56,6 +62,12 @@ namespace EMotionFX
                 void SetScaleQualityPercentage(float value);
                 float GetScaleQualityPercentage() const;
 
+                ErrorMetric GetErrorMetric() const;
+                void SetErrorMetric(ErrorMetric errorMetric);
+
+                float GetDisplacementDistance() const;
+                void SetDisplacementDistance(float distance);
+
                 float GetAllowedSizePercentage() const;
                 void SetAllowedSizePercentage(float percentage);
 
@@ -70,6 +82,7 @@ namespace EMotionFX
                 AZ::Crc32 GetVisibilityCustomSampleRate() const;
                 AZ::Crc32 GetVisibilityCompressionSettings() const;
                 AZ::Crc32 GetVisibilityAllowedSizePercentage() const;
+                AZ::Crc32 GetVisibilityDisplacementDistance() const;
                 
                 float m_customSampleRate = 60.0f;
                 SampleRateMethod m_sampleRateMethod = SampleRateMethod::FromSourceScene;
@@ -80,6 +93,9 @@ namespace EMotionFX
                 float m_rotationQualityPercentage = 75.0f;
                 float m_scaleQualityPercentage = 75.0f;
 
+                ErrorMetric m_errorMetric = ErrorMetric::Value;
+                float m_displacementDistance = 0.1f; // The distance from the joint at which the displacement error metric measures the error, in units.
+
                 float m_allowedSizePercentage = 15.0f; // Allow 15 percent larger size, in trade for performance (in Automatic mode, so when m_motionDataType is a Null typeId).
             };
         } // Rule
@@ -313,6 +313,11 @@ namespace EMotionFX
                 return;
             }
 
+            if (sampleMotions)
+            {
+                UpdateInterpolationPoses();
+            }
+
             m_transformData->GetCurrentPose()->ApplyMorphWeightsToActorInstance();
             ApplyMorphSetup();
 
@@ -370,6 +375,89 @@ namespace EMotionFX
         }
     }
 
+    void ActorInstance::UpdateSkippedTransformations(float timePassedInSeconds, bool updateJointTransforms, float interpolationWeight)
+    {
+        m_skippedUpdateTime += timePassedInSeconds;
+
+        // The anim graph or motion system isn't updated, so there is no motion extraction delta to apply this frame.
+        m_trajectoryDelta.IdentityWithZeroScale();
+
+        Attachment* attachment = GetSelfAttachment();
+        const bool isSkinAttachment = attachment && attachment->GetIsInfluencedByMultipleJoints();
+        if (isSkinAttachment)
+        {
+            m_localTransform.Identity();
+        }
+        UpdateWorldTransform();
+
+        if (!updateJointTransforms)
+        {
+            if (GetBoundsUpdateEnabled() && m_boundsUpdateType == BOUNDS_STATIC_BASED)
+            {
+                UpdateBounds(m_lodLevel, m_boundsUpdateType);
+            }
+            return;
+        }
+
+        Pose* currentPose = m_transformData->GetCurrentPose();
+        if (isSkinAttachment)
+        {
+            // Skin attachments follow the pose of the actor instance they are attached to, which is interpolated already.
+            m_selfAttachment->UpdateJointTransforms(*currentPose);
+        }
+        else if (m_updateRateLodInterpolation && m_hasInterpolationPoses)
+        {
+            currentPose->InitFromPose(m_interpolationSourcePose.get());
+            currentPose->Blend(m_interpolationTargetPose.get(), interpolationWeight);
+            currentPose->InvalidateAllModelSpaceTransforms();
+        }
+
+        currentPose->ApplyMorphWeightsToActorInstance();
+        ApplyMorphSetup();
+        UpdateSkinningMatrices();
+        UpdateAttachments();
+
+        // update the bounds when needed
+        if (GetBoundsUpdateEnabled())
+        {
+            m_boundsUpdatePassedTime += timePassedInSeconds;
+            if (m_boundsUpdatePassedTime >= m_boundsUpdateFrequency)
+            {
+                UpdateBounds(m_lodLevel, m_boundsUpdateType, m_boundsUpdateItemFreq);
+                m_boundsUpdatePassedTime = 0.0f;
+            }
+        }
+    }
+
+    void ActorInstance::UpdateInterpolationPoses()
+    {
+        if (!m_updateRateLodInterpolation)
+        {
+            return;
+        }
+
+        if (!m_interpolationSourcePose)
+        {
+            m_interpolationSourcePose = AZStd::make_unique<Pose>();
+            m_interpolationTargetPose = AZStd::make_unique<Pose>();
+            m_interpolationSourcePose->LinkToActorInstance(this);
+            m_interpolationTargetPose->LinkToActorInstance(this);
+        }
+
+        Pose* currentPose = m_transformData->GetCurrentPose();
+        if (!m_hasInterpolationPoses)
+        {
+            m_interpolationSourcePose->InitFromPose(currentPose);
+            m_interpolationTargetPose->InitFromPose(currentPose);
+            m_hasInterpolationPoses = true;
+            return;
+        }
+
+        AZStd::swap(m_interpolationSourcePose, m_interpolationTargetPose);
+        m_interpolationTargetPose->InitFromPose(currentPose);
+        currentPose->InitFromPose(m_interpolationSourcePose.get());
+    }
+
     // update the world transformation
     void ActorInstance::UpdateWorldTransform()
     {
@@ -1705,6 +1793,40 @@ namespace EMotionFX
         return m_motionSamplingRate;
     }
 
+    void ActorInstance::SetUpdateRateLodImportance(float importance)
+    {
+        m_updateRateLodImportance = importance;
+    }
+
+    float ActorInstance::GetUpdateRateLodImportance() const
+    {
+        return m_updateRateLodImportance;
+    }
+
+    void ActorInstance::SetUpdateRateLodInterpolation(bool enabled)
+    {
+        m_updateRateLodInterpolation = enabled;
+        if (!enabled)
+        {
+            m_hasInterpolationPoses = false;
+        }
+    }
+
+    bool ActorInstance::GetUpdateRateLodInterpolation() const
+    {
+        return m_updateRateLodInterpolation;
+    }
+
+    void ActorInstance::SetSkippedUpdateTime(float timeInSeconds)
+    {
+        m_skippedUpdateTime = timeInSeconds;
+    }
+
+    float ActorInstance::GetSkippedUpdateTime() const
+    {
+        return m_skippedUpdateTime;
+    }
+
     void ActorInstance::IncreaseNumAttachmentRefs(uint8 numToIncreaseWith)
     {
         m_numAttachmentRefs += numToIncreaseWith;
@@ -37,6 +37,7 @@ namespace EMotionFX
     class Attachment;
     class AnimGraphInstance;
     class MorphSetupInstance;
+    class Pose;
     class RagdollInstance;
 
 
@@ -280,6 +281,16 @@ namespace EMotionFX
          */
         void UpdateTransformations(float timePassedInSeconds, bool updateJointTransforms = true, bool sampleMotions = true);
 
+        /**
+         * Update the transformations of this actor instance in a frame that the update rate LOD skips.
+         * This doesn't update the anim graph or motion system. The passed time is accumulated and should be added to the time passed to the next UpdateTransformations() call.
+         * When update rate LOD interpolation is enabled, the current pose is interpolated between the poses of the last two updates.
+         * @param timePassedInSeconds The time passed in seconds, since the last frame or update.
+         * @param updateJointTransforms When set to true the skinning matrices and attachments will be updated.
+         * @param interpolationWeight How far this frame is in between two updates, in range of [0..1].
+         */
+        void UpdateSkippedTransformations(float timePassedInSeconds, bool updateJointTransforms, float interpolationWeight);
+
         /**
          * Update/Process the mesh deformers.
          * This will apply skinning and morphing deformations to the meshes used by the actor instance.
@@ -864,6 +875,24 @@ namespace EMotionFX
         float GetMotionSamplingTimer() const;
         float GetMotionSamplingRate() const;
 
+        /**
+         * Set the importance of this actor instance for the update rate LOD of the actor update scheduler.
+         * The distance to the view is divided by the importance, so a value of 2 makes the actor instance update as if it is at half the distance.
+         * @param importance The importance, where 1 is the default.
+         */
+        void SetUpdateRateLodImportance(float importance);
+        float GetUpdateRateLodImportance() const;
+
+        /**
+         * Enable or disable storing the poses that UpdateSkippedTransformations() interpolates between. This is set by the actor update scheduler.
+         * @param enabled Set to true when frames in between two updates should be interpolated.
+         */
+        void SetUpdateRateLodInterpolation(bool enabled);
+        bool GetUpdateRateLodInterpolation() const;
+
+        void SetSkippedUpdateTime(float timeInSeconds);
+        float GetSkippedUpdateTime() const;
+
         MCORE_INLINE size_t GetNumNodes() const         { return m_actor->GetSkeleton()->GetNumNodes(); }
 
         void UpdateVisualizeScale();                    // not automatically called on creation for performance reasons (this method relatively is slow as it updates all meshes)
@@ -871,6 +900,12 @@ namespace EMotionFX
         void SetVisualizeScale(float factor);
 
     private:
+        /**
+         * Store the current pose as the pose that skipped frames interpolate towards, and output the pose of the previous update,
+         * so that the frames until the next update interpolate from where the previous interval ended.
+         */
+        void UpdateInterpolationPoses();
+
         TransformData*          m_transformData;         /**< The transformation data for this instance. */
         AZ::Aabb                m_aabb;                  /**< The axis aligned bounding box. */
         AZ::Aabb                m_staticAabb;           /**< A static pre-calculated bounding box, which we can move along with the position of the actor instance, and use for visibility checks. */
@@ -899,6 +934,12 @@ namespace EMotionFX
         float                   m_boundsUpdatePassedTime;/**< The time passed since the last bounds update. */
         float                   m_motionSamplingRate;    /**< The motion sampling rate in seconds, where 0.1 would mean to update 10 times per second. A value of 0 or lower means to update every frame. */
         float                   m_motionSamplingTimer;   /**< The time passed since the last time we sampled motions/anim graphs. */
+        float                   m_updateRateLodImportance = 1.0f; /**< The importance for the update rate LOD, which divides the distance to the view. */
+        float                   m_skippedUpdateTime = 0.0f; /**< The time passed in frames that the update rate LOD skipped, since the last update. */
+        AZStd::unique_ptr<Pose> m_interpolationSourcePose; /**< The pose of the update before the last one, which the skipped frames interpolate from. */
+        AZStd::unique_ptr<Pose> m_interpolationTargetPose; /**< The pose of the last update, which the skipped frames interpolate towards. */
+        bool                    m_updateRateLodInterpolation = false; /**< Store the poses of updates, so that skipped frames can interpolate between them. */
+        bool                    m_hasInterpolationPoses = false; /**< True when the interpolation poses contain valid poses. */
         float                   m_visualizeScale;        /**< Some visualization scale factor when rendering for example normals, to be at a nice size, relative to the character. */
         size_t                  m_lodLevel;              /**< The current LOD level, where 0 is the highest detail. */
         size_t                  m_requestedLODLevel;    /**< Requested LOD level. The actual LOD level will be updated as soon as all transforms for the requested LOD level are ready. */
@@ -11,6 +11,7 @@
 // include the required headers
 #include "EMotionFXConfig.h"
 #include "BaseObject.h"
+#include <EMotionFX/Source/UpdateRateLod.h>
 
 
 namespace EMotionFX
@@ -84,10 +85,19 @@ namespace EMotionFX
         size_t GetNumVisibleActorInstances() const                  { return m_numVisible.GetValue(); }
         size_t GetNumSampledActorInstances() const                  { return m_numSampled.GetValue(); }
 
+        /**
+         * Get the update rate level of detail system, which decides how often each actor instance gets updated.
+         * It is disabled on default, in which case all actor instances are updated every frame.
+         * @result The update rate LOD system.
+         */
+        UpdateRateLod& GetUpdateRateLod()                           { return m_updateRateLod; }
+        const UpdateRateLod& GetUpdateRateLod() const               { return m_updateRateLod; }
+
     protected:
         MCore::AtomicSizeT m_numUpdated;
         MCore::AtomicSizeT m_numVisible;
         MCore::AtomicSizeT m_numSampled;
+        UpdateRateLod m_updateRateLod;
 
         /**
          * The constructor.
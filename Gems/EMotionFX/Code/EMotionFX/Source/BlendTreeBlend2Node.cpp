@@ -216,15 +216,7 @@ namespace EMotionFX
         const size_t numNodes = uniqueData->m_mask.size();
         if (numNodes > 0)
         {
-            Transform transform;
-            for (size_t n = 0; n < numNodes; ++n)
-            {
-                const float finalWeight = blendWeight /* * uniqueData->m_weights[n]*/;
-                const size_t nodeIndex = uniqueData->m_mask[n];
-                transform = outputLocalPose.GetLocalSpaceTransform(nodeIndex);
-                transform.Blend(localMaskPose.GetLocalSpaceTransform(nodeIndex), finalWeight);
-                outputLocalPose.SetLocalSpaceTransform(nodeIndex, transform);
-            }
+            outputLocalPose.BlendNodes(&localMaskPose, uniqueData->m_mask.data(), numNodes, blendWeight);
         }
     }
 
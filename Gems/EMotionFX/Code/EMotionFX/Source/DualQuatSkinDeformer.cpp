@@ -56,6 +56,8 @@ namespace EMotionFX
 
         // copy the bone info (for precalc/optimization reasons)
         result->m_bones = m_bones;
+        result->m_boneDualQuats = m_boneDualQuats;
+        result->m_skinningBatches = m_skinningBatches;
 
         // return the result
         return result;
@@ -68,14 +70,25 @@ namespace EMotionFX
         const Pose* pose = actorInstance->GetTransformData()->GetCurrentPose();
 
         // Calculate the skinning matrices based on the current pose.
-        for (BoneInfo& boneInfo : m_bones)
+        const size_t numBones = m_bones.size();
+        for (size_t i = 0; i < numBones; ++i)
         {
+            BoneInfo& boneInfo = m_bones[i];
             const size_t nodeIndex = boneInfo.m_nodeNr;
             const Transform skinTransform = actor->GetInverseBindPoseTransform(nodeIndex) * pose->GetModelSpaceTransform(nodeIndex);
             boneInfo.m_dualQuat.FromRotationTranslation(skinTransform.m_rotation, skinTransform.m_position);
+            m_boneDualQuats[i] = boneInfo.m_dualQuat;
         }
 
-        if (m_useTaskGraph)
+        AZ_Assert(m_skinningBatches.GetNumVertices() == m_mesh->GetNumVertices(), "The skinning batches are out of date, the deformer needs to be reinitialized.");
+        const size_t numBlocks = m_skinningBatches.GetNumBlocks();
+        const size_t numBlocksPerBatch = s_numVerticesPerBatch / SkinningBatches::s_verticesPerBlock;
+        if (numBlocks <= numBlocksPerBatch)
+        {
+            // Small meshes are skinned on the calling thread, as the overhead of a job would outweigh the skinning itself.
+            SkinBlockRange(0, numBlocks);
+        }
+        else if (m_useTaskGraph)
         {
             // Skin the vertices by executing the task graph.
             AZ::TaskGraphEvent finishedEvent{ "DualQuatSkinning Wait" };
@@ -87,18 +100,15 @@ namespace EMotionFX
             AZ::JobCompletion jobCompletion;
 
             // Split up the skinned vertices into batches.
-            const uint32 numVertices = m_mesh->GetNumVertices();
-            const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
-            for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+            for (size_t startBlock = 0; startBlock < numBlocks; startBlock += numBlocksPerBatch)
             {
-                const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
-                const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+                const size_t endBlock = AZStd::min(startBlock + numBlocksPerBatch, numBlocks);
 
                 // Create a job for every batch and skin them simultaneously.
                 AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, startVertex, endVertex]()
+                AZ::Job* job = AZ::CreateJobFunction([this, startBlock, endBlock]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinBlockRange(startBlock, endBlock);
                     }, /*isAutoDelete=*/true, jobContext);
 
                 job->SetDependent(&jobCompletion);
@@ -109,185 +119,14 @@ namespace EMotionFX
         }
     }
 
-    void DualQuatSkinDeformer::SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos)
+    void DualQuatSkinDeformer::SkinBlockRange(size_t startBlock, size_t endBlock)
     {
-        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
-        AZ_Assert(layer, "Cannot find skinning layer.");
-
-        AZ::Vector3 newTangent;
-        AZ::Vector3 vtxPos, normal, tangent, bitangent;
-        AZ::u32 orgVertex;
-        float weight;
-
-        AZ::Vector3* positions = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
-        AZ::Vector3* normals = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
-        AZ::Vector4* tangents = static_cast<AZ::Vector4*>(mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
-        AZ::Vector3* bitangents = static_cast<AZ::Vector3*>(mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
-        AZ::u32* orgVerts = static_cast<AZ::u32*>(mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-
-        // if there are tangents and bitangents to skin
-        if (tangents && bitangents)
-        {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
-            {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-                bitangent = bitangents[v];
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = skinQuat.TransformVector(bitangent);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                    bitangents[v] = bitangent;
-                }
-            }
-        }
-        else if (tangents && !bitangents) // tangents but no bitangents
-        {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
-            {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-                const float tangentW = tangents[v].GetW();
-                tangent.Set(tangents[v].GetX(), tangents[v].GetY(), tangents[v].GetZ());
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                    newTangent = skinQuat.TransformVector(tangent);
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                    newTangent = tangent;
-                    tangents[v].Set(newTangent.GetX(), newTangent.GetY(), newTangent.GetZ(), tangentW);
-                }
-            }
-        }
-        else // there are no tangents and bitangents to skin
-        {
-            for (AZ::u32 v = startVertex; v < endVertex; ++v)
-            {
-                orgVertex = orgVerts[v];
-                vtxPos = positions[v];
-                normal = normals[v];
-
-                // process the skin influences for this vertex
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                if (numInfluences > 0)
-                {
-                    // get the pivot quat, used for the dot product check
-                    const MCore::DualQuaternion& pivotQuat = boneInfos[ layer->GetInfluence(orgVertex, 0)->GetBoneNr() ].m_dualQuat;
-
-                    // our skinning dual quaternion
-                    MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
-
-                    for (size_t i = 0; i < numInfluences; ++i)
-                    {
-                        SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                        weight = influence->GetWeight();
-
-                        // check if we need to invert the dual quat
-                        MCore::DualQuaternion influenceQuat = boneInfos[ influence->GetBoneNr() ].m_dualQuat;
-                        if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
-                        {
-                            influenceQuat *= -1.0f;
-                        }
-
-                        // weighted sum
-                        skinQuat += influenceQuat * weight;
-                    }
-
-                    // normalize the dual quaternion
-                    skinQuat.Normalize();
-
-                    // perform skinning
-                    positions[v] = skinQuat.TransformPoint(vtxPos);
-                    normals[v] = skinQuat.TransformVector(normal);
-                }
-                else
-                {
-                    // no skinning influences, just copy the values
-                    positions[v] = vtxPos;
-                    normals[v] = normal;
-                }
-            }
-        }
+        SkinningKernels::VertexStreams streams;
+        streams.m_positions = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        streams.m_normals = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        streams.m_tangents = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+        streams.m_bitangents = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+        SkinningKernels::SkinDualQuat(m_skinningBatches, startBlock, endBlock, m_boneDualQuats.data(), streams);
     }
 
     // initialize the mesh deformer
@@ -299,6 +138,8 @@ namespace EMotionFX
 
         // clear the bone information array, but don't free the currently allocated/reserved memory
         m_bones.clear();
+        m_boneDualQuats.clear();
+        m_skinningBatches.Clear();
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -335,6 +176,7 @@ namespace EMotionFX
                     lastBone.m_nodeNr = nodeIndex;
                     lastBone.m_dualQuat.Identity();
                     m_bones.emplace_back(lastBone);
+                    m_boneDualQuats.emplace_back(lastBone.m_dualQuat);
                     boneIndex = static_cast<AZ::u16>(m_bones.size() - 1);
                     localBoneMap[nodeIndex] = boneIndex;
                 }
@@ -344,25 +186,28 @@ namespace EMotionFX
             }
         }
 
+        // sort the influences into blocks for the skinning kernels, now that the bone numbers are known
+        const AZ::u32* orgVerts = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        m_skinningBatches.Init(orgVerts, m_mesh->GetNumVertices(), skinningLayer);
+
         if (m_useTaskGraph)
         {
             // Prepare the task graph
-            // Split up the to be skinned vertices into batches. As the mesh does not change at runtime, the task graph can
+            // Split up the to be skinned blocks of vertices into batches. As the mesh does not change at runtime, the task graph can
             // be prepared at init time and be reused at runtime.
-            const uint32 numVertices = m_mesh->GetNumVertices();
-            const AZ::u32 numBatches = aznumeric_caster(ceilf(aznumeric_cast<float>(numVertices) / aznumeric_cast<float>(s_numVerticesPerBatch)));
-            for (AZ::u32 batchIndex = 0; batchIndex < numBatches; ++batchIndex)
+            const size_t numBlocks = m_skinningBatches.GetNumBlocks();
+            const size_t numBlocksPerBatch = s_numVerticesPerBatch / SkinningBatches::s_verticesPerBlock;
+            for (size_t startBlock = 0; startBlock < numBlocks; startBlock += numBlocksPerBatch)
             {
-                const AZ::u32 startVertex = batchIndex * s_numVerticesPerBatch;
-                const AZ::u32 endVertex = AZStd::min(startVertex + s_numVerticesPerBatch, numVertices);
+                const size_t endBlock = AZStd::min(startBlock + numBlocksPerBatch, numBlocks);
 
                 // Create a task for every batch and skin them simultaneously.
                 AZ::TaskDescriptor taskDescriptor{"DualQuatSkinRange", "Animation"};
                 m_taskGraph.AddTask(
                     taskDescriptor,
-                    [this, startVertex, endVertex]()
+                    [this, startBlock, endBlock]()
                     {
-                        SkinRange(m_mesh, startVertex, endVertex, m_bones);
+                        SkinBlockRange(startBlock, endBlock);
                     });
             }
         }
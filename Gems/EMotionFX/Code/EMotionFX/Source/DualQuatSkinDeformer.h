@@ -15,6 +15,7 @@
 #include <MCore/Source/DualQuaternion.h>
 #include "Mesh.h"
 #include "MeshDeformer.h"
+#include "SkinningKernels.h"
 
 namespace EMotionFX
 {
@@ -112,7 +113,7 @@ namespace EMotionFX
          * This does not alter the value returned by GetNumLocalBones().
          * @param numBones The number of bones to pre-allocate space for.
          */
-        MCORE_INLINE void ReserveLocalBones(size_t numBones)                { m_bones.reserve(numBones); }
+        MCORE_INLINE void ReserveLocalBones(size_t numBones)                { m_bones.reserve(numBones); m_boneDualQuats.reserve(numBones); }
 
     protected:
         /**
@@ -127,15 +128,15 @@ namespace EMotionFX
                 : m_nodeNr(InvalidIndex) {}
         };
         AZStd::vector<BoneInfo> m_bones; /**< The array of bone information used for pre-calculation. */
+        AZStd::vector<MCore::DualQuaternion> m_boneDualQuats; /**< The pre-calculated dual quats of the bones, stored contiguously for the skinning kernels. */
+        SkinningBatches m_skinningBatches; /**< The skin influences sorted into blocks of four vertices for the SIMD skinning kernels. */
 
         /**
-         * Skin a part of the mesh.
-         * @param mesh The mesh to be skinned.
-         * @param startVertex The start vertex index to start skinning.
-         * @param endVertex The end vertex index for the range to be skinned.
-         * @param boneInfos The pre-calculated skinning matrices shared across the skinning process.
+         * Skin a range of vertex blocks with the SIMD skinning kernels.
+         * @param startBlock The first block of the range to be skinned.
+         * @param endBlock The end block of the range to be skinned.
          */
-        static void SkinRange(Mesh* mesh, AZ::u32 startVertex, AZ::u32 endVertex, const AZStd::vector<BoneInfo>& boneInfos);
+        void SkinBlockRange(size_t startBlock, size_t endBlock);
 
         //! Number of vertices per batch/job used for multi-threaded software skinning.
         static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
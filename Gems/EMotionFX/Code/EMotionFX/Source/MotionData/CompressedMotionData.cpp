@@ -0,0 +1,1531 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/math.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/AzCoreConversions.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        using Vec4 = AZ::Simd::Vec4;
+        using FloatType = AZ::Simd::Vec4::FloatType;
+        using FloatArgType = AZ::Simd::Vec4::FloatArgType;
+        using QuantizedTrack = CompressedMotionData::QuantizedTrack;
+
+        // ReadBits() always reads four bytes, so the bit stream is padded to never read past its end.
+        constexpr size_t BitStreamPadding = 4;
+
+        // The tolerance used for joints, morphs and floats in the ignore lists of the optimize settings.
+        constexpr float IgnoreListMaxError = 0.00001f;
+
+        // Read numBits bits starting at the given bit position. The bytes are composed manually, so that the stream is endian independent.
+        AZ_FORCE_INLINE AZ::u32 ReadBits(const AZ::u8* data, size_t bitPosition, AZ::u32 numBits)
+        {
+            const AZ::u8* bytes = data + (bitPosition >> 3);
+            const AZ::u32 word = static_cast<AZ::u32>(bytes[0]) |
+                (static_cast<AZ::u32>(bytes[1]) << 8) |
+                (static_cast<AZ::u32>(bytes[2]) << 16) |
+                (static_cast<AZ::u32>(bytes[3]) << 24);
+            return (word >> (bitPosition & 7)) & ((1u << numBits) - 1u);
+        }
+
+        // Decode all four components of a single sample of a track.
+        AZ_FORCE_INLINE FloatType DecodeSample(const AZ::u8* bitStream, const QuantizedTrack& track, size_t sampleIndex)
+        {
+            const AZ::u8* trackData = bitStream + track.m_byteOffset;
+            const size_t sampleBitPosition = sampleIndex * track.m_sampleBits;
+
+            alignas(16) int32_t quantized[4];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                quantized[i] = static_cast<int32_t>(ReadBits(trackData, sampleBitPosition + track.m_bitOffsets[i], track.m_bitCounts[i]));
+            }
+
+            const FloatType values = Vec4::ConvertToFloat(Vec4::LoadAligned(quantized));
+            return Vec4::Madd(values, Vec4::LoadUnaligned(track.m_scales), Vec4::LoadUnaligned(track.m_mins));
+        }
+
+        // Rebuild the w component of a rotation from the decoded x, y and z components. The w lane of the input is zero.
+        AZ_FORCE_INLINE FloatType ReconstructRotation(FloatArgType xyz)
+        {
+            const FloatType lengthSq = Vec4::FromVec1(Vec4::Dot(xyz, xyz));
+            const FloatType w = Vec4::Sqrt(Vec4::Max(Vec4::ZeroFloat(), Vec4::Sub(Vec4::Splat(1.0f), lengthSq)));
+            return Vec4::ReplaceFourth(xyz, w);
+        }
+
+        class BitWriter
+        {
+        public:
+            explicit BitWriter(AZStd::vector<AZ::u8>& bitStream)
+                : m_bitStream(bitStream)
+                , m_numBits(bitStream.size() * 8)
+            {
+            }
+
+            void Write(AZ::u32 value, AZ::u32 numBits)
+            {
+                for (AZ::u32 i = 0; i < numBits; ++i, ++m_numBits)
+                {
+                    if ((m_numBits & 7) == 0)
+                    {
+                        m_bitStream.emplace_back(static_cast<AZ::u8>(0));
+                    }
+
+                    if (value & (1u << i))
+                    {
+                        m_bitStream.back() |= static_cast<AZ::u8>(1u << (m_numBits & 7));
+                    }
+                }
+            }
+
+        private:
+            AZStd::vector<AZ::u8>& m_bitStream;
+            size_t m_numBits = 0;
+        };
+
+        // The samples of a track as they go into the quantizer, with up to four components each.
+        using TrackSamples = AZStd::vector<AZStd::array<float, 4>>;
+
+        AZ::u32 GetMaxQuantizedValue(AZ::u32 numBits)
+        {
+            return (1u << numBits) - 1u;
+        }
+
+        AZ::u32 Quantize(float value, float min, float extent, AZ::u32 numBits)
+        {
+            if (numBits == 0 || extent <= 0.0f)
+            {
+                return 0;
+            }
+
+            const float maxValue = static_cast<float>(GetMaxQuantizedValue(numBits));
+            const float normalized = AZ::GetClamp((value - min) / extent, 0.0f, 1.0f);
+            return static_cast<AZ::u32>(normalized * maxValue + 0.5f);
+        }
+
+        float CalcScale(float extent, AZ::u32 numBits)
+        {
+            return (numBits > 0) ? extent / static_cast<float>(GetMaxQuantizedValue(numBits)) : 0.0f;
+        }
+
+        float Dequantize(AZ::u32 quantized, float min, float scale)
+        {
+            return static_cast<float>(quantized) * scale + min;
+        }
+
+        void CalcRanges(const TrackSamples& samples, size_t numComponents, float* outMins, float* outExtents)
+        {
+            for (size_t c = 0; c < numComponents; ++c)
+            {
+                float minValue = samples[0][c];
+                float maxValue = samples[0][c];
+                for (const AZStd::array<float, 4>& sample : samples)
+                {
+                    minValue = AZStd::min(minValue, sample[c]);
+                    maxValue = AZStd::max(maxValue, sample[c]);
+                }
+                outMins[c] = minValue;
+                outExtents[c] = maxValue - minValue;
+            }
+        }
+
+        // Find the lowest number of bits that keeps every sample of a single component within the given error.
+        AZ::u8 FindComponentBitCount(const TrackSamples& samples, size_t component, float min, float extent, float maxError)
+        {
+            if (extent <= maxError)
+            {
+                return 0; // Storing the minimum for all samples is good enough.
+            }
+
+            for (AZ::u32 numBits = 1; numBits < CompressedMotionData::s_maxBitsPerComponent; ++numBits)
+            {
+                const float scale = CalcScale(extent, numBits);
+                bool withinError = true;
+                for (const AZStd::array<float, 4>& sample : samples)
+                {
+                    const float decoded = Dequantize(Quantize(sample[component], min, extent, numBits), min, scale);
+                    if (AZStd::abs(decoded - sample[component]) > maxError)
+                    {
+                        withinError = false;
+                        break;
+                    }
+                }
+
+                if (withinError)
+                {
+                    return static_cast<AZ::u8>(numBits);
+                }
+            }
+
+            return CompressedMotionData::s_maxBitsPerComponent;
+        }
+
+        AZ::Quaternion DequantizeRotation(const AZStd::array<float, 4>& sample, const float* mins, const float* extents, const AZ::u8* bitCounts)
+        {
+            float xyz[3];
+            for (size_t c = 0; c < 3; ++c)
+            {
+                xyz[c] = Dequantize(Quantize(sample[c], mins[c], extents[c], bitCounts[c]), mins[c], CalcScale(extents[c], bitCounts[c]));
+            }
+            const float w = AZStd::sqrt(AZStd::max(0.0f, 1.0f - (xyz[0] * xyz[0] + xyz[1] * xyz[1] + xyz[2] * xyz[2])));
+            return AZ::Quaternion(xyz[0], xyz[1], xyz[2], w).GetNormalized();
+        }
+
+        // The error of a decoded rotation, using the given error metric.
+        float CalcRotationError(const AZ::Quaternion& original, const AZ::Quaternion& decoded, MotionData::ErrorMetric errorMetric, float displacementDistance)
+        {
+            if (errorMetric == MotionData::ErrorMetric::Displacement)
+            {
+                float maxError = 0.0f;
+                const AZ::Vector3 axes[3] = { AZ::Vector3::CreateAxisX(displacementDistance), AZ::Vector3::CreateAxisY(displacementDistance), AZ::Vector3::CreateAxisZ(displacementDistance) };
+                for (const AZ::Vector3& axis : axes)
+                {
+                    maxError = AZStd::max(maxError, (original.TransformVector(axis) - decoded.TransformVector(axis)).GetLength());
+                }
+                return maxError;
+            }
+
+            // Compare the components, the same way the key reduction of the NonUniformMotionData does.
+            const AZ::Quaternion difference = (original - decoded).GetAbs();
+            return AZStd::max(AZStd::max(difference.GetX(), difference.GetY()), AZStd::max(difference.GetZ(), difference.GetW()));
+        }
+
+        // Find the lowest number of bits for the x, y and z components of a rotation track, that keeps all samples within the given error.
+        // The components influence each other through the reconstructed w component, so they share the same number of bits.
+        void FindRotationBitCounts(const AZStd::vector<AZ::Quaternion>& rotations, const TrackSamples& samples, const float* mins, const float* extents,
+            float maxError, MotionData::ErrorMetric errorMetric, float displacementDistance, AZ::u8* outBitCounts)
+        {
+            for (AZ::u32 numBits = 1; numBits <= CompressedMotionData::s_maxBitsPerComponent; ++numBits)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    outBitCounts[c] = (extents[c] > 0.0f) ? static_cast<AZ::u8>(numBits) : 0;
+                }
+
+                bool withinError = true;
+                for (size_t s = 0; s < samples.size(); ++s)
+                {
+                    const AZ::Quaternion decoded = DequantizeRotation(samples[s], mins, extents, outBitCounts);
+                    if (CalcRotationError(rotations[s], decoded, errorMetric, displacementDistance) > maxError)
+                    {
+                        withinError = false;
+                        break;
+                    }
+                }
+
+                if (withinError)
+                {
+                    return;
+                }
+            }
+        }
+
+        // Quantize the samples with the given bit counts and append them to the bit stream.
+        void WriteTrack(const TrackSamples& samples, const float* mins, const float* extents, const AZ::u8* bitCounts, QuantizedTrack& outTrack, AZStd::vector<AZ::u8>& bitStream)
+        {
+            AZ_Assert(bitStream.size() < InvalidIndex32, "The compressed motion data is too large.");
+            outTrack = QuantizedTrack();
+            outTrack.m_byteOffset = static_cast<AZ::u32>(bitStream.size());
+
+            AZ::u8 bitOffset = 0;
+            for (size_t c = 0; c < 4; ++c)
+            {
+                outTrack.m_mins[c] = mins[c];
+                outTrack.m_scales[c] = CalcScale(extents[c], bitCounts[c]);
+                outTrack.m_bitCounts[c] = bitCounts[c];
+                outTrack.m_bitOffsets[c] = bitOffset;
+                bitOffset += bitCounts[c];
+            }
+            outTrack.m_sampleBits = bitOffset;
+
+            BitWriter writer(bitStream);
+            for (const AZStd::array<float, 4>& sample : samples)
+            {
+                for (size_t c = 0; c < 4; ++c)
+                {
+                    writer.Write(Quantize(sample[c], mins[c], extents[c], bitCounts[c]), bitCounts[c]);
+                }
+            }
+        }
+
+        // Compress a track where every component has its own error, like positions, scales, morphs and floats.
+        void CompressComponentTrack(const TrackSamples& samples, size_t numComponents, float maxError, QuantizedTrack& outTrack, AZStd::vector<AZ::u8>& bitStream)
+        {
+            float mins[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float extents[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            AZ::u8 bitCounts[4] = { 0, 0, 0, 0 };
+            CalcRanges(samples, numComponents, mins, extents);
+            for (size_t c = 0; c < numComponents; ++c)
+            {
+                bitCounts[c] = FindComponentBitCount(samples, c, mins[c], extents[c], maxError);
+            }
+            WriteTrack(samples, mins, extents, bitCounts, outTrack, bitStream);
+        }
+
+        void CompressVector3Track(const AZStd::vector<AZ::Vector3>& values, float maxError, QuantizedTrack& outTrack, AZStd::vector<AZ::u8>& bitStream)
+        {
+            TrackSamples samples(values.size());
+            for (size_t s = 0; s < values.size(); ++s)
+            {
+                samples[s] = { values[s].GetX(), values[s].GetY(), values[s].GetZ(), 0.0f };
+            }
+            CompressComponentTrack(samples, 3, maxError, outTrack, bitStream);
+        }
+
+        void CompressFloatTrack(const AZStd::vector<float>& values, float maxError, QuantizedTrack& outTrack, AZStd::vector<AZ::u8>& bitStream)
+        {
+            TrackSamples samples(values.size());
+            for (size_t s = 0; s < values.size(); ++s)
+            {
+                samples[s] = { values[s], 0.0f, 0.0f, 0.0f };
+            }
+            CompressComponentTrack(samples, 1, maxError, outTrack, bitStream);
+        }
+
+        void CompressRotationTrack(const AZStd::vector<AZ::Quaternion>& values, float maxError, MotionData::ErrorMetric errorMetric, float displacementDistance,
+            QuantizedTrack& outTrack, AZStd::vector<AZ::u8>& bitStream)
+        {
+            // Store the rotations with a positive w, so that only x, y and z have to be stored.
+            AZStd::vector<AZ::Quaternion> rotations(values.size());
+            TrackSamples samples(values.size());
+            for (size_t s = 0; s < values.size(); ++s)
+            {
+                const AZ::Quaternion normalized = values[s].GetNormalized();
+                rotations[s] = (normalized.GetW() < 0.0f) ? -normalized : normalized;
+                samples[s] = { rotations[s].GetX(), rotations[s].GetY(), rotations[s].GetZ(), 0.0f };
+            }
+
+            float mins[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            float extents[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            AZ::u8 bitCounts[4] = { 0, 0, 0, 0 };
+            CalcRanges(samples, 3, mins, extents);
+            FindRotationBitCounts(rotations, samples, mins, extents, maxError, errorMetric, displacementDistance, bitCounts);
+            WriteTrack(samples, mins, extents, bitCounts, outTrack, bitStream);
+        }
+
+        bool IsInList(const AZStd::vector<size_t>& list, size_t index)
+        {
+            return AZStd::find(list.begin(), list.end(), index) != list.end();
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Keyframes (smallest, slightly slower)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        float sampleRate = keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate;
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), sampleRate, numSamples, sampleSpacing);
+
+        Clear();
+        CopyBaseMotionData(motionData);
+        SetSampleRate(sampleRate);
+        m_numSamples = numSamples;
+
+        // Resample all animated tracks uniformly, these are the samples we quantize.
+        m_sourceData = AZStd::make_unique<SourceData>();
+        m_sourceData->m_jointPositions.resize(GetNumJoints());
+        m_sourceData->m_jointRotations.resize(GetNumJoints());
+        m_sourceData->m_jointScales.resize(GetNumJoints());
+        m_sourceData->m_morphValues.resize(GetNumMorphs());
+        m_sourceData->m_floatValues.resize(GetNumFloats());
+
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            const bool posAnimated = motionData->IsJointPositionAnimated(i);
+            const bool rotAnimated = motionData->IsJointRotationAnimated(i);
+            if (posAnimated) { m_sourceData->m_jointPositions[i].resize(m_numSamples); }
+            if (rotAnimated) { m_sourceData->m_jointRotations[i].resize(m_numSamples); }
+            EMFX_SCALECODE
+            (
+                const bool scaleAnimated = motionData->IsJointScaleAnimated(i);
+                if (scaleAnimated) { m_sourceData->m_jointScales[i].resize(m_numSamples); }
+            )
+
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float keyTime = s * sampleSpacing;
+                const Transform transform = motionData->SampleJointTransform(keyTime, i);
+                if (posAnimated) { m_sourceData->m_jointPositions[i][s] = transform.m_position; }
+                if (rotAnimated) { m_sourceData->m_jointRotations[i][s] = transform.m_rotation.GetNormalized(); }
+                EMFX_SCALECODE
+                (
+                    if (scaleAnimated) { m_sourceData->m_jointScales[i][s] = transform.m_scale; }
+                )
+            }
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (motionData->IsMorphAnimated(i))
+            {
+                m_sourceData->m_morphValues[i].resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    m_sourceData->m_morphValues[i][s] = motionData->SampleMorph(s * sampleSpacing, i);
+                }
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (motionData->IsFloatAnimated(i))
+            {
+                m_sourceData->m_floatValues[i].resize(m_numSamples);
+                for (size_t s = 0; s < m_numSamples; ++s)
+                {
+                    m_sourceData->m_floatValues[i][s] = motionData->SampleFloat(s * sampleSpacing, i);
+                }
+            }
+        }
+
+        // Compress with the default settings already, so that the data can be sampled even when Optimize() is never called.
+        // The source samples are kept until Optimize() compressed them with the final settings.
+        Compress(OptimizeSettings());
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        if (!m_sourceData)
+        {
+            AZ_Warning("EMotionFX", false, "Cannot optimize compressed motion data that has no source samples, it has already been optimized or was loaded from disk.");
+            return;
+        }
+
+        Compress(settings);
+        m_sourceData.reset();
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    void CompressedMotionData::Compress(const OptimizeSettings& settings)
+    {
+        AZ_Assert(m_sourceData, "Expected source samples to compress.");
+        const bool useDisplacement = (settings.m_errorMetric == ErrorMetric::Displacement);
+        const float displacementDistance = AZStd::max(settings.m_displacementDistance, AZ::Constants::FloatEpsilon);
+
+        m_bitStream.clear();
+        m_jointData.clear();
+        m_jointData.resize(GetNumJoints());
+        m_morphData.clear();
+        m_morphData.resize(GetNumMorphs());
+        m_floatData.clear();
+        m_floatData.resize(GetNumFloats());
+
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            const bool ignored = IsInList(settings.m_jointIgnoreList, i);
+            const float maxPosError = ignored ? IgnoreListMaxError : settings.m_maxPosError;
+            const float maxRotError = ignored ? IgnoreListMaxError : (useDisplacement ? settings.m_maxPosError : settings.m_maxRotError);
+            const ErrorMetric rotErrorMetric = ignored ? ErrorMetric::Value : settings.m_errorMetric;
+
+            JointData& jointData = m_jointData[i];
+            if (!m_sourceData->m_jointPositions[i].empty())
+            {
+                CompressVector3Track(m_sourceData->m_jointPositions[i], maxPosError, jointData.m_position, m_bitStream);
+            }
+
+            if (!m_sourceData->m_jointRotations[i].empty())
+            {
+                CompressRotationTrack(m_sourceData->m_jointRotations[i], maxRotError, rotErrorMetric, displacementDistance, jointData.m_rotation, m_bitStream);
+            }
+
+#ifndef EMFX_SCALE_DISABLED
+            if (!m_sourceData->m_jointScales[i].empty())
+            {
+                // A scale error moves a point at the displacement distance by the error times that distance.
+                float maxScaleError = useDisplacement ? settings.m_maxPosError / displacementDistance : settings.m_maxScaleError;
+                maxScaleError = ignored ? IgnoreListMaxError : maxScaleError;
+                CompressVector3Track(m_sourceData->m_jointScales[i], maxScaleError, jointData.m_scale, m_bitStream);
+            }
+#endif
+        }
+
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            if (!m_sourceData->m_morphValues[i].empty())
+            {
+                const float maxError = IsInList(settings.m_morphIgnoreList, i) ? IgnoreListMaxError : settings.m_maxMorphError;
+                CompressFloatTrack(m_sourceData->m_morphValues[i], maxError, m_morphData[i], m_bitStream);
+            }
+        }
+
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            if (!m_sourceData->m_floatValues[i].empty())
+            {
+                const float maxError = IsInList(settings.m_floatIgnoreList, i) ? IgnoreListMaxError : settings.m_maxFloatError;
+                CompressFloatTrack(m_sourceData->m_floatValues[i], maxError, m_floatData[i], m_bitStream);
+            }
+        }
+
+        m_bitStream.resize(m_bitStream.size() + BitStreamPadding, 0);
+        m_bitStream.shrink_to_fit();
+    }
+
+    AZ::Vector3 CompressedMotionData::DecodePosition(const QuantizedTrack& track, size_t indexA, size_t indexB, float t) const
+    {
+        const FloatType valueA = DecodeSample(m_bitStream.data(), track, indexA);
+        const FloatType valueB = DecodeSample(m_bitStream.data(), track, indexB);
+        return AZ::Vector3(Vec4::ToVec3(Vec4::Madd(Vec4::Sub(valueB, valueA), Vec4::Splat(t), valueA)));
+    }
+
+    AZ::Quaternion CompressedMotionData::DecodeRotation(const QuantizedTrack& track, size_t indexA, size_t indexB, float t) const
+    {
+        const AZ::Quaternion rotationA(ReconstructRotation(DecodeSample(m_bitStream.data(), track, indexA)));
+        const AZ::Quaternion rotationB(ReconstructRotation(DecodeSample(m_bitStream.data(), track, indexB)));
+        // The samples are stored with a positive w, so two neighboring samples are in opposite hemispheres when the joint rotates
+        // through a half turn between them. Take the shortest path, so that the interpolation does not swing the other way around.
+        return MCore::NLerp(rotationA, rotationB, t);
+    }
+
+    float CompressedMotionData::DecodeFloat(const QuantizedTrack& track, size_t indexA, size_t indexB, float t) const
+    {
+        const AZ::u8* trackData = m_bitStream.data() + track.m_byteOffset;
+        const float valueA = Dequantize(ReadBits(trackData, indexA * track.m_sampleBits, track.m_bitCounts[0]), track.m_mins[0], track.m_scales[0]);
+        const float valueB = Dequantize(ReadBits(trackData, indexB * track.m_sampleBits, track.m_bitCounts[0]), track.m_mins[0], track.m_scales[0]);
+        return AZ::Lerp(valueA, valueB, t);
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const size_t jointDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && jointDataIndex == InvalidIndex)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        const bool inPlace = (settings.m_inPlace && jointSkeletonIndex == actor->GetMotionExtractionNodeIndex());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (jointDataIndex != InvalidIndex && !inPlace)
+        {
+            result = SampleJointTransform(settings.m_sampleTime, jointDataIndex);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.m_axis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).m_sourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.m_flags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // Calculate the sample indices to interpolate between, and the interpolation fraction.
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(settings.m_sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const AZStd::vector<size_t>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const size_t numNodes = actorInstance->GetNumEnabledNodes();
+        for (size_t i = 0; i < numNodes; ++i)
+        {
+            const size_t skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeletonJointIndex == actor->GetMotionExtractionNodeIndex());
+
+            // Decode and interpolate the data.
+            Transform result;
+            const size_t jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex && !inPlace)
+            {
+                const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
+                const JointData& jointData = m_jointData[jointDataIndex];
+                result.m_position = jointData.m_position.IsAnimated() ? DecodePosition(jointData.m_position, indexA, indexB, t) : staticJointData.m_staticTransform.m_position;
+                result.m_rotation = jointData.m_rotation.IsAnimated() ? DecodeRotation(jointData.m_rotation, indexA, indexB, t) : staticJointData.m_staticTransform.m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+                result.m_scale = jointData.m_scale.IsAnimated() ? DecodePosition(jointData.m_scale, indexA, indexB, t) : staticJointData.m_staticTransform.m_scale;
+#endif
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const size_t numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (size_t i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const QuantizedTrack& track = m_morphData[realIndex];
+                outputPose->SetMorphWeight(i, track.IsAnimated() ? DecodeFloat(track, indexA, indexB, t) : m_staticMorphData[realIndex].m_staticValue);
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        const QuantizedTrack& track = m_morphData[morphDataIndex];
+        if (!track.IsAnimated())
+        {
+            return m_staticMorphData[morphDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeFloat(track, indexA, indexB, t);
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        const QuantizedTrack& track = m_floatData[floatDataIndex];
+        if (!track.IsAnimated())
+        {
+            return m_staticFloatData[floatDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeFloat(track, indexA, indexB, t);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const QuantizedTrack& track = m_jointData[jointDataIndex].m_position;
+        if (!track.IsAnimated())
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_position;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodePosition(track, indexA, indexB, t);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const QuantizedTrack& track = m_jointData[jointDataIndex].m_rotation;
+        if (!track.IsAnimated())
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_rotation;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodeRotation(track, indexA, indexB, t);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const QuantizedTrack& track = m_jointData[jointDataIndex].m_scale;
+        if (!track.IsAnimated())
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.m_scale;
+        }
+
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        return DecodePosition(track, indexA, indexB, t);
+    }
+#endif
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+
+        const JointData& jointData = m_jointData[jointDataIndex];
+        const Transform& staticTransform = m_staticJointData[jointDataIndex].m_staticTransform;
+        return Transform
+        (
+            jointData.m_position.IsAnimated() ? DecodePosition(jointData.m_position, indexA, indexB, t) : staticTransform.m_position,
+            jointData.m_rotation.IsAnimated() ? DecodeRotation(jointData.m_rotation, indexA, indexB, t) : staticTransform.m_rotation
+#ifndef EMFX_SCALE_DISABLED
+            ,jointData.m_scale.IsAnimated() ? DecodePosition(jointData.m_scale, indexA, indexB, t) : staticTransform.m_scale
+#endif
+        );
+    }
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointData.resize(numJoints);
+        m_morphData.resize(numMorphs);
+        m_floatData.resize(numFloats);
+        if (m_sourceData)
+        {
+            m_sourceData->m_jointPositions.resize(numJoints);
+            m_sourceData->m_jointRotations.resize(numJoints);
+            m_sourceData->m_jointScales.resize(numJoints);
+            m_sourceData->m_morphValues.resize(numMorphs);
+            m_sourceData->m_floatValues.resize(numFloats);
+        }
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointData.emplace_back();
+        if (m_sourceData)
+        {
+            m_sourceData->m_jointPositions.emplace_back();
+            m_sourceData->m_jointRotations.emplace_back();
+            m_sourceData->m_jointScales.emplace_back();
+        }
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+        if (m_sourceData)
+        {
+            m_sourceData->m_morphValues.emplace_back();
+        }
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+        if (m_sourceData)
+        {
+            m_sourceData->m_floatValues.emplace_back();
+        }
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        // The samples of the removed tracks stay in the bit stream until the data gets compressed again.
+        m_jointData.erase(m_jointData.begin() + jointDataIndex);
+        if (m_sourceData)
+        {
+            m_sourceData->m_jointPositions.erase(m_sourceData->m_jointPositions.begin() + jointDataIndex);
+            m_sourceData->m_jointRotations.erase(m_sourceData->m_jointRotations.begin() + jointDataIndex);
+            m_sourceData->m_jointScales.erase(m_sourceData->m_jointScales.begin() + jointDataIndex);
+        }
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphData.erase(m_morphData.begin() + morphDataIndex);
+        if (m_sourceData)
+        {
+            m_sourceData->m_morphValues.erase(m_sourceData->m_morphValues.begin() + morphDataIndex);
+        }
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatData.erase(m_floatData.begin() + floatDataIndex);
+        if (m_sourceData)
+        {
+            m_sourceData->m_floatValues.erase(m_sourceData->m_floatValues.begin() + floatDataIndex);
+        }
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointData.clear();
+        m_jointData.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+        m_bitStream.clear();
+        m_bitStream.shrink_to_fit();
+        m_sourceData.reset();
+
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        // Quantization is linear, so scaling the range scales all decoded positions.
+        for (JointData& jointData : m_jointData)
+        {
+            for (size_t c = 0; c < 3; ++c)
+            {
+                jointData.m_position.m_mins[c] *= scaleFactor;
+                jointData.m_position.m_scales[c] *= scaleFactor;
+            }
+        }
+
+        if (m_sourceData)
+        {
+            for (AZStd::vector<AZ::Vector3>& positions : m_sourceData->m_jointPositions)
+            {
+                for (AZ::Vector3& position : positions)
+                {
+                    position *= scaleFactor;
+                }
+            }
+        }
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    size_t CompressedMotionData::GetNumCompressedBytes() const
+    {
+        return m_bitStream.size();
+    }
+
+    AZ::u32 CompressedMotionData::GetJointPositionBitsPerSample(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_position.m_sampleBits;
+    }
+
+    AZ::u32 CompressedMotionData::GetJointRotationBitsPerSample(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotation.m_sampleBits;
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_position.IsAnimated();
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotation.IsAnimated();
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scale.IsAnimated();
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+        const JointData& jointData = m_jointData[jointDataIndex];
+#ifndef EMFX_SCALE_DISABLED
+        return (jointData.m_position.IsAnimated() || jointData.m_rotation.IsAnimated() || jointData.m_scale.IsAnimated());
+#else
+        return (jointData.m_position.IsAnimated() || jointData.m_rotation.IsAnimated());
+#endif
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphData[morphDataIndex].IsAnimated();
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatData[floatDataIndex].IsAnimated();
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            ClearJointTransformSamples(i);
+        }
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            ClearMorphSamples(i);
+        }
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            ClearFloatSamples(i);
+        }
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_position = QuantizedTrack();
+        if (m_sourceData)
+        {
+            m_sourceData->m_jointPositions[jointDataIndex].clear();
+        }
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_rotation = QuantizedTrack();
+        if (m_sourceData)
+        {
+            m_sourceData->m_jointRotations[jointDataIndex].clear();
+        }
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_scale = QuantizedTrack();
+        if (m_sourceData)
+        {
+            m_sourceData->m_jointScales[jointDataIndex].clear();
+        }
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        ClearJointPositionSamples(jointDataIndex);
+        ClearJointRotationSamples(jointDataIndex);
+#ifndef EMFX_SCALE_DISABLED
+        ClearJointScaleSamples(jointDataIndex);
+#endif
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphData[morphDataIndex] = QuantizedTrack();
+        if (m_sourceData)
+        {
+            m_sourceData->m_morphValues[morphDataIndex].clear();
+        }
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatData[floatDataIndex] = QuantizedTrack();
+        if (m_sourceData)
+        {
+            m_sourceData->m_floatValues[floatDataIndex].clear();
+        }
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        AZ::u32 m_numBitStreamBytes = 0;
+        float m_sampleRate = 30.0f;
+
+        // Followed by:
+        // AZ::u8[m_numBitStreamBytes]
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+    };
+
+    enum File_CompressedMotionData_Flags : AZ::u8
+    {
+        IsPositionCompressed = 1 << 0,
+        IsRotationCompressed = 1 << 1,
+        IsScaleCompressed = 1 << 2,
+        IsFloatCompressed = 1 << 3
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::FileQuaternion  m_staticRot { 0.0f, 0.0f, 0.0f, 1.0f };   // First frame rotation.
+        FileFormat::FileQuaternion  m_bindPoseRot { 0.0f, 0.0f, 0.0f, 1.0f }; // Bind pose rotation.
+        FileFormat::FileVector3     m_staticPos { 0.0f, 0.0f, 0.0f };         // First frame position.
+        FileFormat::FileVector3     m_staticScale { 1.0f, 1.0f, 1.0f };       // First frame scale.
+        FileFormat::FileVector3     m_bindPosePos { 0.0f, 0.0f, 0.0f };       // Bind pose position.
+        FileFormat::FileVector3     m_bindPoseScale { 1.0f, 1.0f, 1.0f };     // Bind pose scale.
+        AZ::u8                      m_flags = 0; // The flags (see File_CompressedMotionData_Flags).
+
+        // Followed by:
+        // string : The name of the joint.
+        // File_CompressedMotionData_Track (only when (m_flags & File_CompressedMotionData_Flags::IsPositionCompressed) is true).
+        // File_CompressedMotionData_Track (only when (m_flags & File_CompressedMotionData_Flags::IsRotationCompressed) is true).
+        // File_CompressedMotionData_Track (only when (m_flags & File_CompressedMotionData_Flags::IsScaleCompressed) is true).
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f; // The static (first frame) value.
+        AZ::u8 m_flags = 0;         // The flags (see File_CompressedMotionData_Flags).
+
+        // Followed by:
+        // string : The name of the channel.
+        // File_CompressedMotionData_Track (only when (m_flags & File_CompressedMotionData_Flags::IsFloatCompressed) is true).
+    };
+
+    struct File_CompressedMotionData_Track
+    {
+        float m_mins[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float m_scales[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        AZ::u32 m_byteOffset = 0;               // The offset of the first sample inside the bit stream.
+        AZ::u8 m_bitCounts[4] = { 0, 0, 0, 0 }; // The number of bits of each component, the bit offsets are derived from these.
+    };
+    //---------------------------------------------------------------------------------------
+
+    namespace
+    {
+        bool SaveTrack(MCore::Stream* stream, const QuantizedTrack& track, MCore::Endian::EEndianType targetEndianType)
+        {
+            File_CompressedMotionData_Track trackChunk;
+            for (size_t c = 0; c < 4; ++c)
+            {
+                trackChunk.m_mins[c] = track.m_mins[c];
+                trackChunk.m_scales[c] = track.m_scales[c];
+                trackChunk.m_bitCounts[c] = track.m_bitCounts[c];
+                ExporterLib::ConvertFloat(&trackChunk.m_mins[c], targetEndianType);
+                ExporterLib::ConvertFloat(&trackChunk.m_scales[c], targetEndianType);
+            }
+            trackChunk.m_byteOffset = track.m_byteOffset;
+            ExporterLib::ConvertUnsignedInt(&trackChunk.m_byteOffset, targetEndianType);
+            return stream->Write(&trackChunk, sizeof(File_CompressedMotionData_Track)) != 0;
+        }
+
+        bool ReadTrack(MCore::Stream* stream, MCore::Endian::EEndianType sourceEndianType, size_t numSamples, size_t numBitStreamBytes, QuantizedTrack& outTrack)
+        {
+            File_CompressedMotionData_Track trackChunk;
+            if (stream->Read(&trackChunk, sizeof(File_CompressedMotionData_Track)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(trackChunk.m_mins, sourceEndianType, /*numFloats=*/4);
+            MCore::Endian::ConvertFloat(trackChunk.m_scales, sourceEndianType, /*numFloats=*/4);
+            MCore::Endian::ConvertUnsignedInt32(&trackChunk.m_byteOffset, sourceEndianType);
+
+            outTrack = QuantizedTrack();
+            AZ::u8 bitOffset = 0;
+            for (size_t c = 0; c < 4; ++c)
+            {
+                if (trackChunk.m_bitCounts[c] > CompressedMotionData::s_maxBitsPerComponent)
+                {
+                    AZ_Error("EMotionFX", false, "Compressed motion data track uses %d bits per component, while the maximum is %d.",
+                        trackChunk.m_bitCounts[c], CompressedMotionData::s_maxBitsPerComponent);
+                    return false;
+                }
+
+                outTrack.m_mins[c] = trackChunk.m_mins[c];
+                outTrack.m_scales[c] = trackChunk.m_scales[c];
+                outTrack.m_bitCounts[c] = trackChunk.m_bitCounts[c];
+                outTrack.m_bitOffsets[c] = bitOffset;
+                bitOffset += trackChunk.m_bitCounts[c];
+            }
+            outTrack.m_sampleBits = bitOffset;
+            outTrack.m_byteOffset = trackChunk.m_byteOffset;
+
+            // Make sure decoding never reads outside of the bit stream.
+            const size_t numTrackBytes = (numSamples * outTrack.m_sampleBits + 7) / 8;
+            if (outTrack.m_byteOffset + numTrackBytes + BitStreamPadding > numBitStreamBytes)
+            {
+                AZ_Error("EMotionFX", false, "Compressed motion data track is out of the range of the bit stream.");
+                return false;
+            }
+
+            return true;
+        }
+
+        void LogTrackDetails(const char* trackName, const QuantizedTrack& track)
+        {
+            MCore::LogDetailedInfo("   + %s bits:  x=%d y=%d z=%d w=%d", trackName, track.m_bitCounts[0], track.m_bitCounts[1], track.m_bitCounts[2], track.m_bitCounts[3]);
+        }
+    } // namespace
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+        numBytes += m_bitStream.size();
+
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+            numBytes += IsJointPositionAnimated(i) ? sizeof(File_CompressedMotionData_Track) : 0;
+            numBytes += IsJointRotationAnimated(i) ? sizeof(File_CompressedMotionData_Track) : 0;
+            EMFX_SCALECODE
+            (
+                numBytes += IsJointScaleAnimated(i) ? sizeof(File_CompressedMotionData_Track) : 0;
+            )
+        }
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+            numBytes += IsMorphAnimated(i) ? sizeof(File_CompressedMotionData_Track) : 0;
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+            numBytes += IsFloatAnimated(i) ? sizeof(File_CompressedMotionData_Track) : 0;
+        }
+
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+
+        // Write the info chunk, followed by the bit stream, which is endian independent.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_numBitStreamBytes = static_cast<AZ::u32>(m_bitStream.size());
+        info.m_sampleRate = GetSampleRate();
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numBitStreamBytes, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        if (!m_bitStream.empty() && stream->Write(m_bitStream.data(), m_bitStream.size()) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(GetJointStaticPosition(i)));
+            ExporterLib::CopyQuaternion(jointChunk.m_staticRot, GetJointStaticRotation(i));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(GetJointBindPosePosition(i)));
+            ExporterLib::CopyQuaternion(jointChunk.m_bindPoseRot, GetJointBindPoseRotation(i));
+            EMFX_SCALECODE
+            (
+                ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(GetJointStaticScale(i)));
+                ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(GetJointBindPoseScale(i)));
+            )
+
+            const JointData& jointData = m_jointData[i];
+            if (jointData.m_position.IsAnimated()) { jointChunk.m_flags |= File_CompressedMotionData_Flags::IsPositionCompressed; }
+            if (jointData.m_rotation.IsAnimated()) { jointChunk.m_flags |= File_CompressedMotionData_Flags::IsRotationCompressed; }
+            EMFX_SCALECODE
+            (
+                if (jointData.m_scale.IsAnimated()) { jointChunk.m_flags |= File_CompressedMotionData_Flags::IsScaleCompressed; }
+            )
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", GetJointName(i).c_str());
+                LogTrackDetails("Position", jointData.m_position);
+                LogTrackDetails("Rotation", jointData.m_rotation);
+                EMFX_SCALECODE
+                (
+                    LogTrackDetails("Scale", jointData.m_scale);
+                )
+            }
+
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFileQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFileQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(GetJointName(i), stream, targetEndianType);
+
+            if (jointData.m_position.IsAnimated() && !SaveTrack(stream, jointData.m_position, targetEndianType))
+            {
+                return false;
+            }
+            if (jointData.m_rotation.IsAnimated() && !SaveTrack(stream, jointData.m_rotation, targetEndianType))
+            {
+                return false;
+            }
+#ifndef EMFX_SCALE_DISABLED
+            if (jointData.m_scale.IsAnimated() && !SaveTrack(stream, jointData.m_scale, targetEndianType))
+            {
+                return false;
+            }
+#endif
+        }
+
+        // Write the morph and float channels.
+        auto saveFloatChannel = [stream, targetEndianType](const AZStd::string& name, float staticValue, const QuantizedTrack& track)
+        {
+            if (name.empty())
+            {
+                MCore::LogError("Cannot save compressed float or morph channel with empty name.");
+                return false;
+            }
+
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = staticValue;
+            floatChunk.m_flags = track.IsAnimated() ? static_cast<AZ::u8>(File_CompressedMotionData_Flags::IsFloatCompressed) : static_cast<AZ::u8>(0);
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            ExporterLib::SaveString(name, stream, targetEndianType);
+            return !track.IsAnimated() || SaveTrack(stream, track, targetEndianType);
+        };
+
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!saveFloatChannel(GetMorphName(i), GetMorphStaticValue(i), m_morphData[i]))
+            {
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!saveFloatChannel(GetFloatName(i), GetFloatStaticValue(i), m_floatData[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info info;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numBitStreamBytes, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumSamples = %d", info.m_numSamples);
+            MCore::LogDetailedInfo("  + NumBytes   = %d", info.m_numBitStreamBytes);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        Clear();
+        Resize(info.m_numJoints, info.m_numMorphs, info.m_numFloats);
+        m_numSamples = info.m_numSamples;
+        SetSampleRate(info.m_sampleRate);
+        UpdateDuration();
+
+        m_bitStream.resize(info.m_numBitStreamBytes);
+        if (!m_bitStream.empty() && stream->Read(m_bitStream.data(), m_bitStream.size()) == 0)
+        {
+            return false;
+        }
+
+        // Read all joints.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.m_x, jointInfo.m_staticPos.m_y, jointInfo.m_staticPos.m_z);
+            AZ::Quaternion staticRot(jointInfo.m_staticRot.m_x, jointInfo.m_staticRot.m_y, jointInfo.m_staticRot.m_z, jointInfo.m_staticRot.m_w);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.m_x, jointInfo.m_bindPosePos.m_y, jointInfo.m_bindPosePos.m_z);
+            AZ::Quaternion bindPoseRot(jointInfo.m_bindPoseRot.m_x, jointInfo.m_bindPoseRot.m_y, jointInfo.m_bindPoseRot.m_z, jointInfo.m_bindPoseRot.m_w);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::ConvertQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::ConvertQuaternion(&bindPoseRot, sourceEndianType);
+            SetJointStaticPosition(i, staticPos);
+            SetJointStaticRotation(i, staticRot.GetNormalized());
+            SetJointBindPosePosition(i, bindPosePos);
+            SetJointBindPoseRotation(i, bindPoseRot.GetNormalized());
+            EMFX_SCALECODE
+            (
+                AZ::Vector3 staticScale(jointInfo.m_staticScale.m_x, jointInfo.m_staticScale.m_y, jointInfo.m_staticScale.m_z);
+                AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.m_x, jointInfo.m_bindPoseScale.m_y, jointInfo.m_bindPoseScale.m_z);
+                MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+                MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+                SetJointStaticScale(i, staticScale);
+                SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            const AZStd::string name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            SetJointName(i, name);
+
+            JointData& jointData = m_jointData[i];
+            if ((jointInfo.m_flags & File_CompressedMotionData_Flags::IsPositionCompressed) &&
+                !ReadTrack(stream, sourceEndianType, m_numSamples, m_bitStream.size(), jointData.m_position))
+            {
+                return false;
+            }
+            if ((jointInfo.m_flags & File_CompressedMotionData_Flags::IsRotationCompressed) &&
+                !ReadTrack(stream, sourceEndianType, m_numSamples, m_bitStream.size(), jointData.m_rotation))
+            {
+                return false;
+            }
+            if (jointInfo.m_flags & File_CompressedMotionData_Flags::IsScaleCompressed)
+            {
+#ifndef EMFX_SCALE_DISABLED
+                QuantizedTrack& scaleTrack = jointData.m_scale;
+#else
+                QuantizedTrack scaleTrack;
+#endif
+                if (!ReadTrack(stream, sourceEndianType, m_numSamples, m_bitStream.size(), scaleTrack))
+                {
+                    return false;
+                }
+            }
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                LogTrackDetails("Position", jointData.m_position);
+                LogTrackDetails("Rotation", jointData.m_rotation);
+            }
+        }
+
+        // Read the morph and float channels.
+        for (size_t i = 0; i < GetNumMorphs() + GetNumFloats(); ++i)
+        {
+            const bool isMorph = (i < GetNumMorphs());
+            const size_t dataIndex = isMorph ? i : i - GetNumMorphs();
+
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            const AZStd::string name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + %s: '%s'", isMorph ? "Morph" : "Float", name.c_str());
+                MCore::LogDetailedInfo("       + IsAnimated   = %s", (floatInfo.m_flags & File_CompressedMotionData_Flags::IsFloatCompressed) ? "Yes" : "No");
+                MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+            }
+
+            QuantizedTrack& track = isMorph ? m_morphData[dataIndex] : m_floatData[dataIndex];
+            if (isMorph)
+            {
+                SetMorphName(dataIndex, name);
+                SetMorphStaticValue(dataIndex, floatInfo.m_staticValue);
+            }
+            else
+            {
+                SetFloatName(dataIndex, name);
+                SetFloatStaticValue(dataIndex, floatInfo.m_staticValue);
+            }
+
+            if ((floatInfo.m_flags & File_CompressedMotionData_Flags::IsFloatCompressed) &&
+                !ReadTrack(stream, sourceEndianType, m_numSamples, m_bitStream.size(), track))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        switch (readSettings.m_version)
+        {
+            case 1:
+            {
+                return ReadVersion1(stream, readSettings);
+            }
+            break;
+
+            default:
+            {
+                AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            }
+        }
+
+        return false;
+    }
+} // namespace EMotionFX
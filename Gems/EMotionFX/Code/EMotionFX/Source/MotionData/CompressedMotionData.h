@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    /**
+     * Motion data that stores uniformly sampled tracks as bit packed, range reduced integers.
+     * Every animated track stores the minimum and extent of each of its components, and each sample stores the offset from the minimum,
+     * quantized to the lowest number of bits that keeps the track within the error tolerances passed to Optimize().
+     * Rotations are stored as the x, y and z components of a quaternion with a positive w, which is reconstructed while decoding.
+     * Decoding dequantizes all components of a track at once using SIMD, which makes sampling full poses cheap, while the memory
+     * footprint is usually a fraction of the UniformMotionData footprint.
+     */
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator)
+        AZ_RTTI(CompressedMotionData, "{6E0D6A3B-5B7C-4C0F-9A51-0E3C2F1B7D42}", MotionData)
+
+        //! The maximum number of bits a single quantized component can use.
+        static constexpr AZ::u8 s_maxBitsPerComponent = 24;
+
+        // A quantized track with up to four components. Components that are not used, or that are constant, use zero bits.
+        struct EMFX_API QuantizedTrack
+        {
+            float m_mins[4] = { 0.0f, 0.0f, 0.0f, 0.0f };   // The minimum value of each component.
+            float m_scales[4] = { 0.0f, 0.0f, 0.0f, 0.0f }; // The extent of each component divided by the largest quantized value.
+            AZ::u32 m_byteOffset = InvalidIndex32;          // The offset of the first sample in the bit stream, or InvalidIndex32 when not animated.
+            AZ::u8 m_bitOffsets[4] = { 0, 0, 0, 0 };        // The bit offset of each component inside a sample.
+            AZ::u8 m_bitCounts[4] = { 0, 0, 0, 0 };         // The number of bits of each component.
+            AZ::u8 m_sampleBits = 0;                        // The number of bits of a single sample.
+
+            bool IsAnimated() const { return m_byteOffset != InvalidIndex32; }
+        };
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const MotionDataSampleSettings& settings, size_t jointSkeletonIndex) const override;
+        void SamplePose(const MotionDataSampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        size_t GetNumCompressedBytes() const;
+        AZ::u32 GetJointPositionBitsPerSample(size_t jointDataIndex) const;
+        AZ::u32 GetJointRotationBitsPerSample(size_t jointDataIndex) const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+    private:
+        struct EMFX_API JointData
+        {
+            QuantizedTrack m_position;
+            QuantizedTrack m_rotation;
+#ifndef EMFX_SCALE_DISABLED
+            QuantizedTrack m_scale;
+#endif
+        };
+
+        // The uniformly resampled source data, kept from InitFromNonUniformData() until Optimize() quantized it with the final settings.
+        struct EMFX_API SourceData
+        {
+            AZStd::vector<AZStd::vector<AZ::Vector3>> m_jointPositions;
+            AZStd::vector<AZStd::vector<AZ::Quaternion>> m_jointRotations;
+            AZStd::vector<AZStd::vector<AZ::Vector3>> m_jointScales;
+            AZStd::vector<AZStd::vector<float>> m_morphValues;
+            AZStd::vector<AZStd::vector<float>> m_floatValues;
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+
+    private:
+        void ScaleData(float scaleFactor) override;
+        void UpdateSampleSpacing();
+        void Compress(const OptimizeSettings& settings);
+
+        AZ::Vector3 DecodePosition(const QuantizedTrack& track, size_t indexA, size_t indexB, float t) const;
+        AZ::Quaternion DecodeRotation(const QuantizedTrack& track, size_t indexA, size_t indexB, float t) const;
+        float DecodeFloat(const QuantizedTrack& track, size_t indexA, size_t indexB, float t) const;
+
+        bool ReadVersion1(MCore::Stream* stream, const ReadSettings& readSettings);
+
+        AZStd::vector<JointData> m_jointData;
+        AZStd::vector<QuantizedTrack> m_morphData;
+        AZStd::vector<QuantizedTrack> m_floatData;
+        AZStd::vector<AZ::u8> m_bitStream;
+        AZStd::unique_ptr<SourceData> m_sourceData;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
@@ -109,6 +109,13 @@ namespace EMotionFX
         using QuaternionKey = Key<AZ::Quaternion>;
         using FloatKey = Key<float>;
 
+        // How lossy compression measures the error of a joint track.
+        enum class ErrorMetric : AZ::u8
+        {
+            Value = 0,          // Compare the track values themselves against m_maxPosError, m_maxRotError and m_maxScaleError.
+            Displacement = 1    // Compare the displacement of points at m_displacementDistance from the joint against m_maxPosError.
+        };
+
         struct EMFX_API OptimizeSettings
         {
             AZStd::vector<size_t> m_jointIgnoreList; // The joint data indices to skip optimization for.
@@ -119,6 +126,8 @@ namespace EMotionFX
             float m_maxScaleError = 0.001f; // In scale factor.
             float m_maxMorphError = 0.001f; // Morph difference.
             float m_maxFloatError = 0.001f; // Float difference.
+            float m_displacementDistance = 0.1f; // In units, only used by the displacement error metric.
+            ErrorMetric m_errorMetric = ErrorMetric::Value;
             bool m_updateDuration = false;
         };
 
@@ -145,6 +145,7 @@ namespace EMotionFX
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
+        m_updateRateLod.BeginFrame();
 
         for (const ScheduleStep& currentStep : m_steps)
         {
@@ -176,9 +177,21 @@ namespace EMotionFX
                         m_numVisible.Increment();
                     }
 
+                    // skip the update when the update rate LOD doesn't update the actor instance this frame
+                    const UpdateRateLod::Result lodResult = m_updateRateLod.Evaluate(actorInstance);
+                    if (!lodResult.m_update)
+                    {
+                        actorInstance->UpdateSkippedTransformations(timePassedInSeconds, isVisible, lodResult.m_interpolationWeight);
+                        return;
+                    }
+                    actorInstance->SetUpdateRateLodInterpolation(m_updateRateLod.GetSettings().m_interpolate && lodResult.m_updateInterval > 1);
+                    const float updateTimeInSeconds = timePassedInSeconds + actorInstance->GetSkippedUpdateTime();
+                    actorInstance->SetSkippedUpdateTime(0.0f);
+                    m_numUpdated.Increment();
+
                     // check if we want to sample motions
                     bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + updateTimeInSeconds);
                     if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
                     {
                         sampleMotions = true;
@@ -191,17 +204,17 @@ namespace EMotionFX
                     }
 
                     // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                    actorInstance->UpdateTransformations(updateTimeInSeconds, isVisible, sampleMotions);
                 }, true, jobContext);
 
                 job->SetDependent(&jobCompletion);               
                 job->Start();
-
-                m_numUpdated.Increment();
             }
 
             jobCompletion.StartAndWaitForCompletion();
         } // for all steps
+
+        m_updateRateLod.EndFrame();
     }
 
 
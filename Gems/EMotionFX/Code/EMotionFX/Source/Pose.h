@@ -130,6 +130,16 @@ namespace EMotionFX
          */
         void Blend(const Pose* destPose, float weight);
 
+        /**
+         * Blend the transforms for the given nodes only, e.g. the nodes in a feathering mask.
+         * Morph weights and pose datas are left untouched.
+         * @param destPose The destination pose to blend into.
+         * @param nodeIndices The indices of the nodes to blend.
+         * @param numNodes The number of node indices.
+         * @param weight The weight value to use, which must be in range of [0..1], where 1.0 is the dest pose.
+         */
+        void BlendNodes(const Pose* destPose, const size_t* nodeIndices, size_t numNodes, float weight);
+
         /**
          * Additively blend the transforms for all enabled nodes in the actor instance.
          * You can see this as: thisPose += destPose * weight.
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
+#include <EMotionFX/Source/Transform.h>
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(TransformStreams, PoseAllocator)
+
+    namespace PoseBlendKernels
+    {
+        namespace
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            using FloatType = AZ::Simd::Vec4::FloatType;
+            using FloatArgType = AZ::Simd::Vec4::FloatArgType;
+
+            constexpr size_t NumLanes = TransformStreams::s_jointsPerBlock;
+
+            struct LaneWeights
+            {
+                explicit LaneWeights(float weight)
+                    : m_weight(weight)
+                    , m_weights(Vec4::Splat(weight))
+                    , m_negatedWeights(Vec4::Splat(-weight))
+                    , m_oneMinusWeights(Vec4::Splat(1.0f - weight))
+                {
+                }
+
+                float m_weight;
+                FloatType m_weights;
+                FloatType m_negatedWeights;
+                FloatType m_oneMinusWeights;
+            };
+
+            // Lerps four quaternions stored as x, y, z and w lanes with the given weights of the destination and normalizes them.
+            AZ_FORCE_INLINE void NormalizedLerpLanes(FloatType* rotations, const FloatType* destRotations, FloatArgType destWeights, FloatArgType oneMinusWeights)
+            {
+                FloatType lengthSq = Vec4::ZeroFloat();
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    rotations[i] = Vec4::Madd(destRotations[i], destWeights, Vec4::Mul(rotations[i], oneMinusWeights));
+                    lengthSq = Vec4::Madd(rotations[i], rotations[i], lengthSq);
+                }
+
+                const FloatType invLength = Vec4::SqrtInv(lengthSq);
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    rotations[i] = Vec4::Mul(rotations[i], invLength);
+                }
+            }
+
+            // Normalized lerp of four quaternions stored as x, y, z and w lanes, taking the shortest path like MCore::NLerp().
+            AZ_FORCE_INLINE void NLerpLanes(FloatType* rotations, const FloatType* destRotations, const LaneWeights& weights)
+            {
+                const FloatType dot = Vec4::Madd(rotations[0], destRotations[0],
+                    Vec4::Madd(rotations[1], destRotations[1],
+                    Vec4::Madd(rotations[2], destRotations[2],
+                    Vec4::Mul(rotations[3], destRotations[3]))));
+                const FloatType signedWeights = Vec4::Select(weights.m_negatedWeights, weights.m_weights, Vec4::CmpLt(dot, Vec4::ZeroFloat()));
+                NormalizedLerpLanes(rotations, destRotations, signedWeights, weights.m_oneMinusWeights);
+            }
+
+            // Normalized lerp of four quaternions stored as x, y, z and w lanes without a hemisphere check, like AZ::Quaternion::NLerp(),
+            // which the additive blend uses.
+            AZ_FORCE_INLINE void NLerpLanesNoFlip(FloatType* rotations, const FloatType* destRotations, const LaneWeights& weights)
+            {
+                NormalizedLerpLanes(rotations, destRotations, weights.m_weights, weights.m_oneMinusWeights);
+            }
+
+            // Calculates lhs * rhs for four quaternions stored as x, y, z and w lanes.
+            AZ_FORCE_INLINE void QuaternionMultiplyLanes(const FloatType* lhs, const FloatType* rhs, FloatType* result)
+            {
+                const FloatArgType ax = lhs[0], ay = lhs[1], az = lhs[2], aw = lhs[3];
+                const FloatArgType bx = rhs[0], by = rhs[1], bz = rhs[2], bw = rhs[3];
+                result[0] = Vec4::Sub(Vec4::Madd(aw, bx, Vec4::Madd(ax, bw, Vec4::Mul(ay, bz))), Vec4::Mul(az, by));
+                result[1] = Vec4::Sub(Vec4::Madd(aw, by, Vec4::Madd(ay, bw, Vec4::Mul(az, bx))), Vec4::Mul(ax, bz));
+                result[2] = Vec4::Sub(Vec4::Madd(aw, bz, Vec4::Madd(az, bw, Vec4::Mul(ax, by))), Vec4::Mul(ay, bx));
+                result[3] = Vec4::Sub(Vec4::Mul(aw, bw), Vec4::Madd(ax, bx, Vec4::Madd(ay, by, Vec4::Mul(az, bz))));
+            }
+
+            AZ_FORCE_INLINE void LoadRotationLanes(const Transform* transforms, const size_t* indices, FloatType* outLanes)
+            {
+                FloatType rows[NumLanes];
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    rows[lane] = transforms[indices[lane]].m_rotation.GetSimdValue();
+                }
+                Vec4::Mat4x4Transpose(rows, outLanes);
+            }
+
+            void BlendBlock(Transform* transforms, const Transform* destTransforms, const size_t* indices, size_t numLanes, const LaneWeights& weights)
+            {
+                FloatType rotations[4];
+                FloatType destRotations[4];
+                LoadRotationLanes(transforms, indices, rotations);
+                LoadRotationLanes(destTransforms, indices, destRotations);
+                NLerpLanes(rotations, destRotations, weights);
+
+                FloatType rows[NumLanes];
+                Vec4::Mat4x4Transpose(rotations, rows);
+                for (size_t lane = 0; lane < numLanes; ++lane)
+                {
+                    Transform& transform = transforms[indices[lane]];
+                    const Transform& destTransform = destTransforms[indices[lane]];
+                    transform.m_position = transform.m_position.Lerp(destTransform.m_position, weights.m_weight);
+                    transform.m_rotation = AZ::Quaternion(rows[lane]);
+                    EMFX_SCALECODE
+                    (
+                        transform.m_scale = transform.m_scale.Lerp(destTransform.m_scale, weights.m_weight);
+                    )
+                }
+            }
+
+            void ApplyAdditiveBlock(Transform* transforms, const Transform* additiveTransforms, const size_t* indices, size_t numLanes, const LaneWeights& weights)
+            {
+                FloatType rotations[4];
+                FloatType additiveRotations[4];
+                FloatType destRotations[4];
+                LoadRotationLanes(transforms, indices, rotations);
+                LoadRotationLanes(additiveTransforms, indices, additiveRotations);
+                QuaternionMultiplyLanes(additiveRotations, rotations, destRotations);
+                NLerpLanesNoFlip(rotations, destRotations, weights);
+
+                FloatType rows[NumLanes];
+                Vec4::Mat4x4Transpose(rotations, rows);
+                for (size_t lane = 0; lane < numLanes; ++lane)
+                {
+                    Transform& transform = transforms[indices[lane]];
+                    const Transform& additiveTransform = additiveTransforms[indices[lane]];
+                    transform.m_position += additiveTransform.m_position * weights.m_weight;
+                    transform.m_rotation = AZ::Quaternion(rows[lane]);
+                    EMFX_SCALECODE
+                    (
+                        transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weights.m_weight);
+                    )
+                }
+            }
+
+            // Splits the joints into blocks of four. Lanes past the end of the last block repeat its last joint, so the SIMD
+            // math stays valid, but they are not written back.
+            template <typename IndexFunction, typename BlockFunction>
+            void ForEachBlock(size_t numJoints, const IndexFunction& getJointIndex, const BlockFunction& processBlock)
+            {
+                size_t blockIndices[NumLanes];
+                for (size_t first = 0; first < numJoints; first += NumLanes)
+                {
+                    const size_t numLanes = AZStd::min(numJoints - first, NumLanes);
+                    for (size_t lane = 0; lane < NumLanes; ++lane)
+                    {
+                        blockIndices[lane] = getJointIndex(first + AZStd::min(lane, numLanes - 1));
+                    }
+                    processBlock(blockIndices, numLanes);
+                }
+            }
+        } // namespace
+
+        void Blend(Transform* transforms, const Transform* destTransforms, size_t numTransforms, float weight)
+        {
+            const LaneWeights weights(weight);
+            ForEachBlock(numTransforms,
+                [](size_t i) { return i; },
+                [&](const size_t* indices, size_t numLanes) { BlendBlock(transforms, destTransforms, indices, numLanes, weights); });
+        }
+
+        void Blend(Transform* transforms, const Transform* destTransforms, const uint16* indices, size_t numIndices, float weight)
+        {
+            const LaneWeights weights(weight);
+            ForEachBlock(numIndices,
+                [indices](size_t i) { return static_cast<size_t>(indices[i]); },
+                [&](const size_t* blockIndices, size_t numLanes) { BlendBlock(transforms, destTransforms, blockIndices, numLanes, weights); });
+        }
+
+        void Blend(Transform* transforms, const Transform* destTransforms, const size_t* indices, size_t numIndices, float weight)
+        {
+            const LaneWeights weights(weight);
+            ForEachBlock(numIndices,
+                [indices](size_t i) { return indices[i]; },
+                [&](const size_t* blockIndices, size_t numLanes) { BlendBlock(transforms, destTransforms, blockIndices, numLanes, weights); });
+        }
+
+        void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, size_t numTransforms, float weight)
+        {
+            const LaneWeights weights(weight);
+            ForEachBlock(numTransforms,
+                [](size_t i) { return i; },
+                [&](const size_t* indices, size_t numLanes) { ApplyAdditiveBlock(transforms, additiveTransforms, indices, numLanes, weights); });
+        }
+
+        void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, const uint16* indices, size_t numIndices, float weight)
+        {
+            const LaneWeights weights(weight);
+            ForEachBlock(numIndices,
+                [indices](size_t i) { return static_cast<size_t>(indices[i]); },
+                [&](const size_t* blockIndices, size_t numLanes) { ApplyAdditiveBlock(transforms, additiveTransforms, blockIndices, numLanes, weights); });
+        }
+
+        void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, const size_t* indices, size_t numIndices, float weight)
+        {
+            const LaneWeights weights(weight);
+            ForEachBlock(numIndices,
+                [indices](size_t i) { return indices[i]; },
+                [&](const size_t* blockIndices, size_t numLanes) { ApplyAdditiveBlock(transforms, additiveTransforms, blockIndices, numLanes, weights); });
+        }
+    } // namespace PoseBlendKernels
+
+
+    void TransformStreams::Resize(size_t numTransforms)
+    {
+        m_numTransforms = numTransforms;
+        const size_t numBlocks = GetNumBlocks();
+        m_positions.resize(numBlocks * s_numPositionStreams);
+        m_rotations.resize(numBlocks * s_numRotationStreams);
+        m_scales.resize(numBlocks * s_numScaleStreams);
+    }
+
+
+    void TransformStreams::Gather(const Transform* transforms, size_t numTransforms)
+    {
+        using AZ::Simd::Vec4;
+
+        Resize(numTransforms);
+
+        Vec4::FloatType rows[s_jointsPerBlock];
+        Vec4::FloatType lanes[s_jointsPerBlock];
+        const size_t numBlocks = GetNumBlocks();
+        for (size_t block = 0; block < numBlocks; ++block)
+        {
+            // Lanes past the last transform repeat it, so that they hold valid values.
+            const Transform* blockTransforms[s_jointsPerBlock];
+            for (size_t lane = 0; lane < s_jointsPerBlock; ++lane)
+            {
+                blockTransforms[lane] = &transforms[AZStd::min(block * s_jointsPerBlock + lane, numTransforms - 1)];
+            }
+
+            for (size_t lane = 0; lane < s_jointsPerBlock; ++lane)
+            {
+                rows[lane] = Vec4::FromVec3(blockTransforms[lane]->m_position.GetSimdValue());
+            }
+            Vec4::Mat4x4Transpose(rows, lanes);
+            AZStd::copy(lanes, lanes + s_numPositionStreams, &m_positions[block * s_numPositionStreams]);
+
+            for (size_t lane = 0; lane < s_jointsPerBlock; ++lane)
+            {
+                rows[lane] = blockTransforms[lane]->m_rotation.GetSimdValue();
+            }
+            Vec4::Mat4x4Transpose(rows, &m_rotations[block * s_numRotationStreams]);
+
+            EMFX_SCALECODE
+            (
+                for (size_t lane = 0; lane < s_jointsPerBlock; ++lane)
+                {
+                    rows[lane] = Vec4::FromVec3(blockTransforms[lane]->m_scale.GetSimdValue());
+                }
+                Vec4::Mat4x4Transpose(rows, lanes);
+                AZStd::copy(lanes, lanes + s_numScaleStreams, &m_scales[block * s_numScaleStreams]);
+            )
+        }
+    }
+
+
+    void TransformStreams::Scatter(Transform* transforms) const
+    {
+        using AZ::Simd::Vec4;
+
+        Vec4::FloatType lanes[s_jointsPerBlock];
+        Vec4::FloatType rows[s_jointsPerBlock];
+        const size_t numBlocks = GetNumBlocks();
+        for (size_t block = 0; block < numBlocks; ++block)
+        {
+            const size_t first = block * s_jointsPerBlock;
+            const size_t numLanes = AZStd::min(m_numTransforms - first, s_jointsPerBlock);
+
+            AZStd::copy(&m_positions[block * s_numPositionStreams], &m_positions[block * s_numPositionStreams] + s_numPositionStreams, lanes);
+            lanes[3] = Vec4::ZeroFloat();
+            Vec4::Mat4x4Transpose(lanes, rows);
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                transforms[first + lane].m_position = AZ::Vector3(Vec4::ToVec3(rows[lane]));
+            }
+
+            Vec4::Mat4x4Transpose(&m_rotations[block * s_numRotationStreams], rows);
+            for (size_t lane = 0; lane < numLanes; ++lane)
+            {
+                transforms[first + lane].m_rotation = AZ::Quaternion(rows[lane]);
+            }
+
+            EMFX_SCALECODE
+            (
+                AZStd::copy(&m_scales[block * s_numScaleStreams], &m_scales[block * s_numScaleStreams] + s_numScaleStreams, lanes);
+                lanes[3] = Vec4::ZeroFloat();
+                Vec4::Mat4x4Transpose(lanes, rows);
+                for (size_t lane = 0; lane < numLanes; ++lane)
+                {
+                    transforms[first + lane].m_scale = AZ::Vector3(Vec4::ToVec3(rows[lane]));
+                }
+            )
+        }
+    }
+
+
+    void TransformStreams::Blend(const TransformStreams& destStreams, float weight)
+    {
+        using AZ::Simd::Vec4;
+
+        AZ_Assert(m_numTransforms == destStreams.m_numTransforms, "Transform streams must be of the same size");
+        const PoseBlendKernels::LaneWeights weights(weight);
+        const size_t numBlocks = GetNumBlocks();
+        for (size_t block = 0; block < numBlocks; ++block)
+        {
+            for (size_t i = block * s_numPositionStreams; i < (block + 1) * s_numPositionStreams; ++i)
+            {
+                m_positions[i] = Vec4::Madd(Vec4::Sub(destStreams.m_positions[i], m_positions[i]), weights.m_weights, m_positions[i]);
+            }
+
+            PoseBlendKernels::NLerpLanes(&m_rotations[block * s_numRotationStreams], &destStreams.m_rotations[block * s_numRotationStreams], weights);
+
+            EMFX_SCALECODE
+            (
+                for (size_t i = block * s_numScaleStreams; i < (block + 1) * s_numScaleStreams; ++i)
+                {
+                    m_scales[i] = Vec4::Madd(Vec4::Sub(destStreams.m_scales[i], m_scales[i]), weights.m_weights, m_scales[i]);
+                }
+            )
+        }
+    }
+
+
+    void TransformStreams::ApplyAdditive(const TransformStreams& additiveStreams, float weight)
+    {
+        using AZ::Simd::Vec4;
+
+        AZ_Assert(m_numTransforms == additiveStreams.m_numTransforms, "Transform streams must be of the same size");
+        const PoseBlendKernels::LaneWeights weights(weight);
+        const size_t numBlocks = GetNumBlocks();
+        for (size_t block = 0; block < numBlocks; ++block)
+        {
+            for (size_t i = block * s_numPositionStreams; i < (block + 1) * s_numPositionStreams; ++i)
+            {
+                m_positions[i] = Vec4::Madd(additiveStreams.m_positions[i], weights.m_weights, m_positions[i]);
+            }
+
+            Vec4::FloatType* rotations = &m_rotations[block * s_numRotationStreams];
+            Vec4::FloatType destRotations[s_numRotationStreams];
+            PoseBlendKernels::QuaternionMultiplyLanes(&additiveStreams.m_rotations[block * s_numRotationStreams], rotations, destRotations);
+            PoseBlendKernels::NLerpLanesNoFlip(rotations, destRotations, weights);
+
+            EMFX_SCALECODE
+            (
+                const Vec4::FloatType one = Vec4::Splat(1.0f);
+                for (size_t i = block * s_numScaleStreams; i < (block + 1) * s_numScaleStreams; ++i)
+                {
+                    const Vec4::FloatType scaleFactor = Vec4::Madd(Vec4::Sub(additiveStreams.m_scales[i], one), weights.m_weights, one);
+                    m_scales[i] = Vec4::Mul(m_scales[i], scaleFactor);
+                }
+            )
+        }
+    }
+} // namespace EMotionFX
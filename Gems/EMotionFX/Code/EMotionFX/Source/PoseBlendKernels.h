@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+namespace EMotionFX
+{
+    class Transform;
+
+    /**
+     * SIMD kernels that blend local space transforms four joints at a time.
+     * Rotations are transposed into x/y/z/w lanes so that the nlerp of four joints is evaluated in one pass,
+     * without any per joint branches. The results match Transform::Blend() and Pose::ApplyAdditive() within float precision.
+     * The index list variants only touch the listed joints, which is used for enabled nodes and feathering masks.
+     */
+    namespace PoseBlendKernels
+    {
+        //! Blends transforms[i] towards destTransforms[i] for all numTransforms joints, like Transform::Blend() does.
+        EMFX_API void Blend(Transform* transforms, const Transform* destTransforms, size_t numTransforms, float weight);
+        EMFX_API void Blend(Transform* transforms, const Transform* destTransforms, const uint16* indices, size_t numIndices, float weight);
+        EMFX_API void Blend(Transform* transforms, const Transform* destTransforms, const size_t* indices, size_t numIndices, float weight);
+
+        //! Adds the weighted additive transforms on top of the transforms, the same way Pose::ApplyAdditive() does.
+        EMFX_API void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, size_t numTransforms, float weight);
+        EMFX_API void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, const uint16* indices, size_t numIndices, float weight);
+        EMFX_API void ApplyAdditive(Transform* transforms, const Transform* additiveTransforms, const size_t* indices, size_t numIndices, float weight);
+    } // namespace PoseBlendKernels
+
+    /**
+     * Structure of arrays storage for a set of local space transforms.
+     * Positions, rotations and scales live in separate streams, in blocks of four joints where each SIMD register holds
+     * the same component of four joints. This allows blending without transposing the data first, which pays off when the
+     * same set of transforms is blended several times, e.g. a chain of blend nodes. Use Gather() and Scatter() to convert
+     * from and to the array of Transform structs that a Pose stores.
+     */
+    class EMFX_API TransformStreams
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+
+        static constexpr size_t s_jointsPerBlock = 4;
+
+        void Resize(size_t numTransforms);
+        size_t GetNumTransforms() const                         { return m_numTransforms; }
+
+        void Gather(const Transform* transforms, size_t numTransforms);
+        void Scatter(Transform* transforms) const;
+
+        void Blend(const TransformStreams& destStreams, float weight);
+        void ApplyAdditive(const TransformStreams& additiveStreams, float weight);
+
+    private:
+        static constexpr size_t s_numPositionStreams = 3;
+        static constexpr size_t s_numRotationStreams = 4;
+        static constexpr size_t s_numScaleStreams = 3;
+
+        size_t GetNumBlocks() const                             { return (m_numTransforms + s_jointsPerBlock - 1) / s_jointsPerBlock; }
+
+        AZStd::vector<AZ::Simd::Vec4::FloatType> m_positions;  /**< The x, y and z positions of each block of four joints. */
+        AZStd::vector<AZ::Simd::Vec4::FloatType> m_rotations;  /**< The x, y, z and w rotations of each block of four joints. */
+        AZStd::vector<AZ::Simd::Vec4::FloatType> m_scales;     /**< The x, y and z scales of each block of four joints. */
+        size_t m_numTransforms = 0;
+    };
+} // namespace EMotionFX
@@ -48,6 +48,7 @@ namespace EMotionFX
         m_numUpdated.SetValue(0);
         m_numVisible.SetValue(0);
         m_numSampled.SetValue(0);
+        m_updateRateLod.BeginFrame();
 
         // propagate root actor instance visibility to their attachments
         const size_t numRootActorInstances = GetActorManager().GetNumRootActorInstances();
@@ -73,6 +74,8 @@ namespace EMotionFX
 
             RecursiveExecuteActorInstance(rootActorInstance, timePassedInSeconds);
         }
+
+        m_updateRateLod.EndFrame();
     }
 
 
@@ -81,31 +84,42 @@ namespace EMotionFX
     {
         actorInstance->SetThreadIndex(0);
 
-        m_numUpdated.Increment();
-
         const bool isVisible = actorInstance->GetIsVisible();
-
-        // check if we want to sample motions
-        bool sampleMotions = false;
-        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        if (isVisible)
         {
-            sampleMotions = true;
-            actorInstance->SetMotionSamplingTimer(0.0f);
-
-            if (isVisible)
-            {
-                m_numSampled.Increment();
-            }
+            m_numVisible.Increment();
         }
 
-        if (isVisible)
+        // skip the update when the update rate LOD doesn't update the actor instance this frame, the attachments still get processed
+        const UpdateRateLod::Result lodResult = m_updateRateLod.Evaluate(actorInstance);
+        if (!lodResult.m_update)
         {
-            m_numVisible.Increment();
+            actorInstance->UpdateSkippedTransformations(timePassedInSeconds, isVisible, lodResult.m_interpolationWeight);
         }
+        else
+        {
+            actorInstance->SetUpdateRateLodInterpolation(m_updateRateLod.GetSettings().m_interpolate && lodResult.m_updateInterval > 1);
+            const float updateTimeInSeconds = timePassedInSeconds + actorInstance->GetSkippedUpdateTime();
+            actorInstance->SetSkippedUpdateTime(0.0f);
+            m_numUpdated.Increment();
+
+            // check if we want to sample motions
+            bool sampleMotions = false;
+            actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + updateTimeInSeconds);
+            if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+            {
+                sampleMotions = true;
+                actorInstance->SetMotionSamplingTimer(0.0f);
 
-        // update the transformations
-        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                if (isVisible)
+                {
+                    m_numSampled.Increment();
+                }
+            }
+
+            // update the transformations
+            actorInstance->UpdateTransformations(updateTimeInSeconds, isVisible, sampleMotions);
+        }
 
         // recursively process the attachments
         const size_t numAttachments = actorInstance->GetNumAttachments();
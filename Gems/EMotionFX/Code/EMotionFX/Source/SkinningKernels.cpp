@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SkinningKernels.h>
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(SkinningBatches, DeformerAllocator)
+
+    void SkinningBatches::Init(const uint32* orgVertices, uint32 numVertices, SkinningInfoVertexAttributeLayer* layer)
+    {
+        Clear();
+        m_numVertices = numVertices;
+        if (numVertices == 0)
+        {
+            return;
+        }
+
+        AZStd::vector<uint32> numInfluences(numVertices);
+        AZStd::vector<uint32> sortedVertices(numVertices);
+        for (uint32 v = 0; v < numVertices; ++v)
+        {
+            numInfluences[v] = aznumeric_cast<uint32>(layer->GetNumInfluences(orgVertices[v]));
+            sortedVertices[v] = v;
+        }
+
+        // Sort the vertices by their number of influences, keeping the vertex order within the same influence count for better cache locality.
+        AZStd::sort(sortedVertices.begin(), sortedVertices.end(), [&numInfluences](uint32 a, uint32 b)
+            {
+                return numInfluences[a] != numInfluences[b] ? numInfluences[a] < numInfluences[b] : a < b;
+            });
+
+        m_blocks.reserve((numVertices + s_verticesPerBlock - 1) / s_verticesPerBlock);
+        uint32 first = 0;
+        while (first < numVertices)
+        {
+            Block block;
+            block.m_numInfluences = numInfluences[sortedVertices[first]];
+            block.m_firstInfluence = aznumeric_cast<uint32>(m_weights.size());
+            block.m_numVertices = 1;
+            while (block.m_numVertices < s_verticesPerBlock &&
+                first + block.m_numVertices < numVertices &&
+                numInfluences[sortedVertices[first + block.m_numVertices]] == block.m_numInfluences)
+            {
+                block.m_numVertices++;
+            }
+
+            for (uint32 lane = 0; lane < s_verticesPerBlock; ++lane)
+            {
+                block.m_vertices[lane] = sortedVertices[first + AZStd::min(lane, block.m_numVertices - 1)];
+            }
+
+            for (uint32 i = 0; i < block.m_numInfluences; ++i)
+            {
+                for (uint32 lane = 0; lane < s_verticesPerBlock; ++lane)
+                {
+                    const SkinInfluence* influence = layer->GetInfluence(orgVertices[block.m_vertices[lane]], i);
+                    m_boneIndices.emplace_back(influence->GetBoneNr());
+                    m_weights.emplace_back(influence->GetWeight());
+                }
+            }
+
+            m_blocks.emplace_back(block);
+            first += block.m_numVertices;
+        }
+    }
+
+
+    void SkinningBatches::Clear()
+    {
+        m_blocks.clear();
+        m_boneIndices.clear();
+        m_weights.clear();
+        m_numVertices = 0;
+    }
+
+
+    namespace SkinningKernels
+    {
+        namespace
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            using FloatType = AZ::Simd::Vec4::FloatType;
+
+            constexpr size_t NumLanes = SkinningBatches::s_verticesPerBlock;
+
+            // Loads the vectors of the four lanes and transposes them into x, y, z and w registers.
+            AZ_FORCE_INLINE void LoadLanes(const AZ::Vector3* vectors, const uint32* vertices, FloatType* outLanes)
+            {
+                FloatType rows[NumLanes];
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    rows[lane] = Vec4::FromVec3(vectors[vertices[lane]].GetSimdValue());
+                }
+                Vec4::Mat4x4Transpose(rows, outLanes);
+            }
+
+            AZ_FORCE_INLINE void LoadLanes(const AZ::Vector4* vectors, const uint32* vertices, FloatType* outLanes)
+            {
+                FloatType rows[NumLanes];
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    rows[lane] = vectors[vertices[lane]].GetSimdValue();
+                }
+                Vec4::Mat4x4Transpose(rows, outLanes);
+            }
+
+            // Transposes the x, y and z registers back and stores the used lanes.
+            AZ_FORCE_INLINE void StoreLanes(AZ::Vector3* vectors, const uint32* vertices, uint32 numVertices, const FloatType* lanes)
+            {
+                const FloatType columns[4] = { lanes[0], lanes[1], lanes[2], Vec4::ZeroFloat() };
+                FloatType rows[NumLanes];
+                Vec4::Mat4x4Transpose(columns, rows);
+                for (uint32 lane = 0; lane < numVertices; ++lane)
+                {
+                    vectors[vertices[lane]] = AZ::Vector3(Vec4::ToVec3(rows[lane]));
+                }
+            }
+
+            AZ_FORCE_INLINE void StoreLanes(AZ::Vector4* vectors, const uint32* vertices, uint32 numVertices, const FloatType* lanes)
+            {
+                FloatType rows[NumLanes];
+                Vec4::Mat4x4Transpose(lanes, rows);
+                for (uint32 lane = 0; lane < numVertices; ++lane)
+                {
+                    vectors[vertices[lane]] = AZ::Vector4(rows[lane]);
+                }
+            }
+
+            // Transforms four points by four 3x4 matrices, where matrix[row][column] holds that element of the four matrices.
+            AZ_FORCE_INLINE void TransformPointLanes(const FloatType (&matrix)[3][4], const FloatType* point, FloatType* result)
+            {
+                for (size_t row = 0; row < 3; ++row)
+                {
+                    result[row] = Vec4::Madd(matrix[row][0], point[0], Vec4::Madd(matrix[row][1], point[1], Vec4::Madd(matrix[row][2], point[2], matrix[row][3])));
+                }
+            }
+
+            AZ_FORCE_INLINE void TransformVectorLanes(const FloatType (&matrix)[3][4], const FloatType* vector, FloatType* result)
+            {
+                for (size_t row = 0; row < 3; ++row)
+                {
+                    result[row] = Vec4::Madd(matrix[row][0], vector[0], Vec4::Madd(matrix[row][1], vector[1], Vec4::Mul(matrix[row][2], vector[2])));
+                }
+            }
+
+            AZ_FORCE_INLINE void CrossLanes(const FloatType* a, const FloatType* b, FloatType* result)
+            {
+                result[0] = Vec4::Sub(Vec4::Mul(a[1], b[2]), Vec4::Mul(a[2], b[1]));
+                result[1] = Vec4::Sub(Vec4::Mul(a[2], b[0]), Vec4::Mul(a[0], b[2]));
+                result[2] = Vec4::Sub(Vec4::Mul(a[0], b[1]), Vec4::Mul(a[1], b[0]));
+            }
+
+            // Rotates four vectors by the real parts of four dual quaternions, like DualQuaternion::TransformVector().
+            AZ_FORCE_INLINE void RotateLanes(const FloatType* real, const FloatType* vector, FloatType* result)
+            {
+                const FloatType two = Vec4::Splat(2.0f);
+                FloatType temp[3];
+                CrossLanes(real, vector, temp);
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    temp[i] = Vec4::Madd(real[3], vector[i], temp[i]);
+                }
+
+                FloatType cross[3];
+                CrossLanes(real, temp, cross);
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    result[i] = Vec4::Madd(two, cross[i], vector[i]);
+                }
+            }
+
+            // Transforms four points by four dual quaternions, like DualQuaternion::TransformPoint().
+            AZ_FORCE_INLINE void TransformPointLanes(const FloatType* real, const FloatType* dual, const FloatType* point, FloatType* result)
+            {
+                const FloatType two = Vec4::Splat(2.0f);
+                FloatType cross[3];
+                CrossLanes(real, dual, cross);
+                RotateLanes(real, point, result);
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    const FloatType displacement = Vec4::Add(Vec4::Sub(Vec4::Mul(real[3], dual[i]), Vec4::Mul(dual[3], real[i])), cross[i]);
+                    result[i] = Vec4::Madd(two, displacement, result[i]);
+                }
+            }
+
+            AZ_FORCE_INLINE void LoadDualQuatLanes(const MCore::DualQuaternion* dualQuats, const uint16* boneIndices, FloatType* outReal, FloatType* outDual)
+            {
+                FloatType realRows[NumLanes];
+                FloatType dualRows[NumLanes];
+                for (size_t lane = 0; lane < NumLanes; ++lane)
+                {
+                    const MCore::DualQuaternion& dualQuat = dualQuats[boneIndices[lane]];
+                    realRows[lane] = dualQuat.m_real.GetSimdValue();
+                    dualRows[lane] = dualQuat.m_dual.GetSimdValue();
+                }
+                Vec4::Mat4x4Transpose(realRows, outReal);
+                Vec4::Mat4x4Transpose(dualRows, outDual);
+            }
+        } // namespace
+
+        void SkinLinear(const SkinningBatches& batches, size_t startBlock, size_t endBlock, const AZ::Matrix3x4* boneMatrices, const VertexStreams& streams)
+        {
+            for (size_t blockIndex = startBlock; blockIndex < endBlock; ++blockIndex)
+            {
+                const SkinningBatches::Block& block = batches.GetBlock(blockIndex);
+                const uint16* boneIndices = batches.GetBoneIndices(block);
+                const float* weights = batches.GetWeights(block);
+
+                // Blend the rows of the skinning matrices of each lane.
+                FloatType laneRows[3][NumLanes];
+                for (size_t row = 0; row < 3; ++row)
+                {
+                    for (size_t lane = 0; lane < NumLanes; ++lane)
+                    {
+                        laneRows[row][lane] = Vec4::ZeroFloat();
+                    }
+                }
+
+                for (uint32 i = 0; i < block.m_numInfluences; ++i)
+                {
+                    for (size_t lane = 0; lane < NumLanes; ++lane)
+                    {
+                        const FloatType* boneRows = boneMatrices[boneIndices[lane]].GetSimdValues();
+                        const FloatType weight = Vec4::Splat(weights[lane]);
+                        for (size_t row = 0; row < 3; ++row)
+                        {
+                            laneRows[row][lane] = Vec4::Madd(boneRows[row], weight, laneRows[row][lane]);
+                        }
+                    }
+                    boneIndices += NumLanes;
+                    weights += NumLanes;
+                }
+
+                // Transpose the blended matrices, so that each register holds the same element of the four matrices.
+                FloatType matrix[3][4];
+                for (size_t row = 0; row < 3; ++row)
+                {
+                    Vec4::Mat4x4Transpose(laneRows[row], matrix[row]);
+                }
+
+                FloatType lanes[4];
+                FloatType result[4];
+                LoadLanes(streams.m_positions, block.m_vertices, lanes);
+                TransformPointLanes(matrix, lanes, result);
+                StoreLanes(streams.m_positions, block.m_vertices, block.m_numVertices, result);
+
+                LoadLanes(streams.m_normals, block.m_vertices, lanes);
+                TransformVectorLanes(matrix, lanes, result);
+                StoreLanes(streams.m_normals, block.m_vertices, block.m_numVertices, result);
+
+                if (streams.m_tangents)
+                {
+                    // Keep the handedness stored in the w component of the tangents.
+                    LoadLanes(streams.m_tangents, block.m_vertices, lanes);
+                    TransformVectorLanes(matrix, lanes, result);
+                    result[3] = lanes[3];
+                    StoreLanes(streams.m_tangents, block.m_vertices, block.m_numVertices, result);
+
+                    // Bitangents are only skinned together with the tangents.
+                    if (streams.m_bitangents)
+                    {
+                        LoadLanes(streams.m_bitangents, block.m_vertices, lanes);
+                        TransformVectorLanes(matrix, lanes, result);
+                        StoreLanes(streams.m_bitangents, block.m_vertices, block.m_numVertices, result);
+                    }
+                }
+            }
+        }
+
+        void SkinDualQuat(const SkinningBatches& batches, size_t startBlock, size_t endBlock, const MCore::DualQuaternion* boneDualQuats, const VertexStreams& streams)
+        {
+            const FloatType zero = Vec4::ZeroFloat();
+            for (size_t blockIndex = startBlock; blockIndex < endBlock; ++blockIndex)
+            {
+                const SkinningBatches::Block& block = batches.GetBlock(blockIndex);
+                if (block.m_numInfluences == 0)
+                {
+                    // The blocks are sorted by their number of influences, so this only skips the first few blocks.
+                    continue;
+                }
+
+                const uint16* boneIndices = batches.GetBoneIndices(block);
+                const float* weights = batches.GetWeights(block);
+
+                // The first influence is the pivot for the shortest path check, so it is always added with a positive weight.
+                FloatType pivot[4];
+                FloatType dual[4];
+                FloatType real[4];
+                LoadDualQuatLanes(boneDualQuats, boneIndices, pivot, dual);
+                const FloatType pivotWeights = Vec4::LoadUnaligned(weights);
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    real[i] = Vec4::Mul(pivot[i], pivotWeights);
+                    dual[i] = Vec4::Mul(dual[i], pivotWeights);
+                }
+
+                for (uint32 i = 1; i < block.m_numInfluences; ++i)
+                {
+                    boneIndices += NumLanes;
+                    weights += NumLanes;
+
+                    FloatType influenceReal[4];
+                    FloatType influenceDual[4];
+                    LoadDualQuatLanes(boneDualQuats, boneIndices, influenceReal, influenceDual);
+
+                    // Negate the weights of the dual quaternions that are on the other hemisphere than the pivot.
+                    const FloatType dot = Vec4::Madd(influenceReal[0], pivot[0],
+                        Vec4::Madd(influenceReal[1], pivot[1],
+                        Vec4::Madd(influenceReal[2], pivot[2],
+                        Vec4::Mul(influenceReal[3], pivot[3]))));
+                    const FloatType influenceWeights = Vec4::LoadUnaligned(weights);
+                    const FloatType signedWeights = Vec4::Select(Vec4::Sub(zero, influenceWeights), influenceWeights, Vec4::CmpLt(dot, zero));
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        real[j] = Vec4::Madd(influenceReal[j], signedWeights, real[j]);
+                        dual[j] = Vec4::Madd(influenceDual[j], signedWeights, dual[j]);
+                    }
+                }
+
+                // Normalize the blended dual quaternions, like DualQuaternion::Normalize().
+                const FloatType invLength = Vec4::SqrtInv(Vec4::Madd(real[0], real[0], Vec4::Madd(real[1], real[1], Vec4::Madd(real[2], real[2], Vec4::Mul(real[3], real[3])))));
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    real[i] = Vec4::Mul(real[i], invLength);
+                    dual[i] = Vec4::Mul(dual[i], invLength);
+                }
+                const FloatType realDotDual = Vec4::Madd(real[0], dual[0], Vec4::Madd(real[1], dual[1], Vec4::Madd(real[2], dual[2], Vec4::Mul(real[3], dual[3]))));
+                const FloatType negatedRealDotDual = Vec4::Sub(zero, realDotDual);
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    dual[i] = Vec4::Madd(real[i], negatedRealDotDual, dual[i]);
+                }
+
+                FloatType lanes[4];
+                FloatType result[4];
+                LoadLanes(streams.m_positions, block.m_vertices, lanes);
+                TransformPointLanes(real, dual, lanes, result);
+                StoreLanes(streams.m_positions, block.m_vertices, block.m_numVertices, result);
+
+                LoadLanes(streams.m_normals, block.m_vertices, lanes);
+                RotateLanes(real, lanes, result);
+                StoreLanes(streams.m_normals, block.m_vertices, block.m_numVertices, result);
+
+                if (streams.m_tangents)
+                {
+                    // Keep the handedness stored in the w component of the tangents.
+                    LoadLanes(streams.m_tangents, block.m_vertices, lanes);
+                    RotateLanes(real, lanes, result);
+                    result[3] = lanes[3];
+                    StoreLanes(streams.m_tangents, block.m_vertices, block.m_numVertices, result);
+
+                    // Bitangents are only skinned together with the tangents.
+                    if (streams.m_bitangents)
+                    {
+                        LoadLanes(streams.m_bitangents, block.m_vertices, lanes);
+                        RotateLanes(real, lanes, result);
+                        StoreLanes(streams.m_bitangents, block.m_vertices, block.m_numVertices, result);
+                    }
+                }
+            }
+        }
+    } // namespace SkinningKernels
+} // namespace EMotionFX
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <MCore/Source/DualQuaternion.h>
+
+namespace EMotionFX
+{
+    class SkinningInfoVertexAttributeLayer;
+
+    /**
+     * The skin influences of a mesh, rearranged for the SIMD skinning kernels.
+     * The vertices are sorted by their number of influences and grouped into blocks of four vertices that share the same influence count,
+     * so that the influence loop of a block has a fixed trip count and needs no per vertex branches. The bone indices and weights of a block
+     * are stored as structure of arrays, with the four lanes of each influence next to each other. The last block of each influence count
+     * repeats its last vertex in the unused lanes, which are not written back.
+     * The batches only depend on the skinning layer, so they are built once when the deformer gets reinitialized.
+     */
+    class EMFX_API SkinningBatches
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+
+        static constexpr size_t s_verticesPerBlock = 4;
+
+        /**
+         * A block of four vertices that share the same number of influences.
+         */
+        struct EMFX_API Block
+        {
+            uint32 m_vertices[s_verticesPerBlock];  /**< The vertex indices of the lanes. Unused lanes repeat the last used vertex. */
+            uint32 m_numVertices = 0;               /**< The number of used lanes, in range of [1..4]. */
+            uint32 m_numInfluences = 0;             /**< The number of influences of all vertices in the block. */
+            uint32 m_firstInfluence = 0;            /**< The index of the first influence lane of the block in the bone index and weight arrays. */
+        };
+
+        /**
+         * Build the blocks from the skinning layer of a mesh.
+         * The bone numbers of the influences have to be set up already, as the deformers do in Reinitialize().
+         * @param orgVertices The original vertex number of each vertex, the Mesh::ATTRIB_ORGVTXNUMBERS vertex data.
+         * @param numVertices The number of vertices of the mesh.
+         * @param layer The skinning layer to take the influences from.
+         */
+        void Init(const uint32* orgVertices, uint32 numVertices, SkinningInfoVertexAttributeLayer* layer);
+        void Clear();
+
+        size_t GetNumBlocks() const                                 { return m_blocks.size(); }
+        const Block& GetBlock(size_t index) const                   { return m_blocks[index]; }
+        uint32 GetNumVertices() const                               { return m_numVertices; }
+
+        const uint16* GetBoneIndices(const Block& block) const      { return &m_boneIndices[block.m_firstInfluence]; }
+        const float* GetWeights(const Block& block) const           { return &m_weights[block.m_firstInfluence]; }
+
+    private:
+        AZStd::vector<Block> m_blocks;          /**< The blocks, sorted by their number of influences. */
+        AZStd::vector<uint16> m_boneIndices;    /**< The local bone index of each influence lane. */
+        AZStd::vector<float> m_weights;         /**< The weight of each influence lane. */
+        uint32 m_numVertices = 0;
+    };
+
+    /**
+     * SIMD kernels that skin four vertices at a time, using the blocks of a SkinningBatches object.
+     * The vertex attributes stay stored as arrays of AZ::Vector3 and AZ::Vector4 in the mesh. The kernels transpose the four vertices of a
+     * block into x/y/z lanes in registers, so that the transformations of four vertices are evaluated in one pass. The results match
+     * the per vertex skinning with MCore::Skin() and MCore::DualQuaternion within float precision.
+     * The kernels operate on a range of blocks, so that a mesh can be split into batches that are skinned in parallel.
+     */
+    namespace SkinningKernels
+    {
+        /**
+         * The vertex attributes to skin in place. The tangents and bitangents are optional, and the bitangents are only skinned along with the tangents.
+         */
+        struct EMFX_API VertexStreams
+        {
+            AZ::Vector3* m_positions = nullptr;
+            AZ::Vector3* m_normals = nullptr;
+            AZ::Vector4* m_tangents = nullptr;
+            AZ::Vector3* m_bitangents = nullptr;
+        };
+
+        //! Linear blend skinning, like SoftSkinDeformer does. Vertices without influences end up at the origin, the same as before.
+        EMFX_API void SkinLinear(const SkinningBatches& batches, size_t startBlock, size_t endBlock, const AZ::Matrix3x4* boneMatrices, const VertexStreams& streams);
+
+        //! Dual quaternion skinning, like DualQuatSkinDeformer does. Vertices without influences are left untouched.
+        EMFX_API void SkinDualQuat(const SkinningBatches& batches, size_t startBlock, size_t endBlock, const MCore::DualQuaternion* boneDualQuats, const VertexStreams& streams);
+    } // namespace SkinningKernels
+} // namespace EMotionFX
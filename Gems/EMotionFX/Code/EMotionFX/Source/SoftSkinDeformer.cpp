@@ -7,6 +7,8 @@
  */
 
 // include the required headers
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include "EMotionFXConfig.h"
 #include "SoftSkinDeformer.h"
 #include "Mesh.h"
@@ -36,6 +38,7 @@ namespace EMotionFX
     {
         m_nodeNumbers.clear();
         m_boneMatrices.clear();
+        m_skinningBatches.Clear();
     }
 
 
@@ -69,6 +72,7 @@ namespace EMotionFX
         // copy the bone info (for precalc/optimization reasons)
         result->m_nodeNumbers    = m_nodeNumbers;
         result->m_boneMatrices   = m_boneMatrices;
+        result->m_skinningBatches = m_skinningBatches;
 
         // return the result
         return result;
@@ -93,111 +97,39 @@ namespace EMotionFX
             m_boneMatrices[i] = skinningMatrices[nodeIndex];
         }
 
-        // find the skinning layer
-        SkinningInfoVertexAttributeLayer* layer = (SkinningInfoVertexAttributeLayer*)m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID);
-        AZ_Assert(layer, "Cannot find skinning info");
-
-        // Perform the skinning.
-        AZ::Vector3* __restrict positions    = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
-        AZ::Vector3* __restrict normals      = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
-        AZ::Vector4* __restrict tangents     = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
-        AZ::Vector3* __restrict bitangents   = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
-        AZ::u32*     __restrict orgVerts     = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
-        SkinVertexRange(0, m_mesh->GetNumVertices(), positions, normals, tangents, bitangents, orgVerts, layer);
-    }
-
-
-    void SoftSkinDeformer::SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer)
-    {
-        AZ::Vector3 newPos, newNormal;
-        AZ::Vector3 vtxPos, normal;
-        AZ::Vector4 tangent, newTangent;
-        AZ::Vector3 bitangent, newBitangent;
-
-        // if there are tangents and bitangents to skin
-        if (tangents && bitangents)
+        // Perform the skinning, four vertices at a time.
+        SkinningKernels::VertexStreams streams;
+        streams.m_positions     = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_POSITIONS));
+        streams.m_normals       = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_NORMALS));
+        streams.m_tangents      = static_cast<AZ::Vector4*>(m_mesh->FindVertexData(Mesh::ATTRIB_TANGENTS));
+        streams.m_bitangents    = static_cast<AZ::Vector3*>(m_mesh->FindVertexData(Mesh::ATTRIB_BITANGENTS));
+        AZ_Assert(m_skinningBatches.GetNumVertices() == m_mesh->GetNumVertices(), "The skinning batches are out of date, the deformer needs to be reinitialized.");
+
+        // Small meshes are skinned on the calling thread, larger ones get split up into batches that are skinned in parallel.
+        const size_t numBlocks = m_skinningBatches.GetNumBlocks();
+        const size_t numBlocksPerBatch = s_numVerticesPerBatch / SkinningBatches::s_verticesPerBlock;
+        if (numBlocks <= numBlocksPerBatch)
         {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
-                newBitangent = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-                bitangent = bitangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &bitangent, &newPos, &newNormal, &newTangent, &newBitangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
-
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-                bitangents[v]   = newBitangent;
-            }
+            SkinningKernels::SkinLinear(m_skinningBatches, 0, numBlocks, m_boneMatrices.data(), streams);
+            return;
         }
-        else if (tangents) // only tangents but no bitangents
-        {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-                newTangent = AZ::Vector4::CreateZero();
 
-                vtxPos  = positions[v];
-                normal  = normals[v];
-                tangent = tangents[v];
-
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
-                {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &tangent, &newPos, &newNormal, &newTangent, influence->GetWeight());
-                }
-
-                newTangent.SetW(tangents[v].GetW());
-
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-                tangents[v]     = newTangent;
-            }
-        }
-        else // there are no tangents and bitangents to skin
+        AZ::JobCompletion jobCompletion;
+        for (size_t startBlock = 0; startBlock < numBlocks; startBlock += numBlocksPerBatch)
         {
-            for (uint32 v = startVertex; v < endVertex; ++v)
-            {
-                newPos = AZ::Vector3::CreateZero();
-                newNormal = AZ::Vector3::CreateZero();
-
-                vtxPos  = positions[v];
-                normal  = normals[v];
+            const size_t endBlock = AZStd::min(startBlock + numBlocksPerBatch, numBlocks);
 
-                // skin the vertex
-                const uint32 orgVertex = orgVerts[v]; // get the original vertex number
-                const size_t numInfluences = layer->GetNumInfluences(orgVertex);
-                for (size_t i = 0; i < numInfluences; ++i)
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, startBlock, endBlock, streams]()
                 {
-                    const SkinInfluence* influence = layer->GetInfluence(orgVertex, i);
-                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &vtxPos, &normal, &newPos, &newNormal, influence->GetWeight());
-                }
+                    SkinningKernels::SkinLinear(m_skinningBatches, startBlock, endBlock, m_boneMatrices.data(), streams);
+                }, /*isAutoDelete=*/true, jobContext);
 
-                // output the skinned values
-                positions[v]    = newPos;
-                normals[v]      = newNormal;
-            }
+            job->SetDependent(&jobCompletion);
+            job->Start();
         }
+
+        jobCompletion.StartAndWaitForCompletion();
     }
 
 
@@ -212,6 +144,7 @@ namespace EMotionFX
         // clear the bone information array
         m_boneMatrices.clear();
         m_nodeNumbers.clear();
+        m_skinningBatches.Clear();
 
         // if there is no mesh
         if (m_mesh == nullptr)
@@ -257,5 +190,9 @@ namespace EMotionFX
                 influence->SetBoneNr(boneIndex);
             }
         }
+
+        // sort the influences into blocks for the skinning kernels, now that the bone numbers are known
+        const AZ::u32* orgVerts = static_cast<AZ::u32*>(m_mesh->FindVertexData(Mesh::ATTRIB_ORGVTXNUMBERS));
+        m_skinningBatches.Init(orgVerts, m_mesh->GetNumVertices(), skinningLayer);
     }
 } // namespace EMotionFX
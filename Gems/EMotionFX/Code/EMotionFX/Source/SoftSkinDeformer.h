@@ -13,6 +13,7 @@
 #include <AzCore/Math/Transform.h>
 #include "EMotionFXConfig.h"
 #include "MeshDeformer.h"
+#include "SkinningKernels.h"
 
 
 namespace EMotionFX
@@ -120,6 +121,10 @@ namespace EMotionFX
     protected:
         AZStd::vector<AZ::Matrix3x4>    m_boneMatrices;
         AZStd::vector<size_t>           m_nodeNumbers;
+        SkinningBatches                 m_skinningBatches;  /**< The skin influences sorted into blocks of four vertices for the SIMD skinning kernels. */
+
+        //! Number of vertices per batch/job used for multi-threaded software skinning.
+        static constexpr AZ::u32 s_numVerticesPerBatch = 10000;
 
         /**
          * Default constructor.
@@ -142,7 +147,5 @@ namespace EMotionFX
             const auto foundBoneIndex = AZStd::find(begin(m_nodeNumbers), end(m_nodeNumbers), nodeIndex);
             return foundBoneIndex != end(m_nodeNumbers) ? AZStd::distance(begin(m_nodeNumbers), foundBoneIndex) : InvalidIndex;
         }
-
-        void SkinVertexRange(uint32 startVertex, uint32 endVertex, AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents, uint32* orgVerts, SkinningInfoVertexAttributeLayer* layer);
     };
 } // namespace EMotionFX
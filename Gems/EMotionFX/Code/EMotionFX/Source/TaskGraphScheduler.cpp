@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+// include the required headers
+#include "TaskGraphScheduler.h"
+#include "Actor.h"
+#include "ActorManager.h"
+#include "ActorInstance.h"
+#include "Attachment.h"
+#include "EMotionFXManager.h"
+#include <EMotionFX/Source/Allocators.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+
+
+namespace EMotionFX
+{
+    AZ_CLASS_ALLOCATOR_IMPL(TaskGraphScheduler, ActorUpdateAllocator)
+
+    // constructor
+    TaskGraphScheduler::TaskGraphScheduler()
+        : ActorUpdateScheduler()
+    {
+    }
+
+
+    // destructor
+    TaskGraphScheduler::~TaskGraphScheduler()
+    {
+    }
+
+
+    // create
+    TaskGraphScheduler* TaskGraphScheduler::Create()
+    {
+        return aznew TaskGraphScheduler();
+    }
+
+
+    // clear the schedule
+    void TaskGraphScheduler::Clear()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_levels.clear();
+        m_isDirty = true;
+    }
+
+
+    void TaskGraphScheduler::SetChunkCost(size_t numJoints)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+        m_chunkCost = AZStd::max<size_t>(numJoints, 1);
+        m_isDirty = true;
+    }
+
+
+    // log it, for debugging purposes
+    void TaskGraphScheduler::Print()
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        const size_t numLevels = m_levels.size();
+        for (size_t i = 0; i < numLevels; ++i)
+        {
+            const size_t numChunks = AZStd::count_if(m_chunks.begin(), m_chunks.end(), [i](const Chunk& chunk) { return chunk.m_level == i; });
+            AZ_Printf("EMotionFX", "LEVEL %.3zu - %zu actor instances in %zu chunks", i, m_levels[i].size(), numChunks);
+        }
+
+        AZ_Printf("EMotionFX", "---------");
+    }
+
+
+    // split the levels into chunks and build the task graph from them
+    void TaskGraphScheduler::CompileTaskGraph()
+    {
+        m_taskGraph.Reset();
+        m_chunks.clear();
+        m_chunkActorInstances.clear();
+
+        // Remove the levels that got emptied.
+        while (!m_levels.empty() && m_levels.back().empty())
+        {
+            m_levels.pop_back();
+        }
+
+        // Chunks that run at the same time need different thread datas, as these hold the pose pools of the anim graphs.
+        m_numThreadSlots = AZStd::max<size_t>(GetEMotionFX().GetNumThreads(), 1);
+
+        const AZ::TaskDescriptor chunkDescriptor{ "EMotionFX::TaskGraphScheduler::Chunk", "Animation" };
+        const AZ::TaskDescriptor levelDescriptor{ "EMotionFX::TaskGraphScheduler::Level", "Animation" };
+
+        AZStd::vector<AZ::TaskToken> levelTokens;
+        AZStd::vector<AZ::TaskToken> levelDoneTokens;
+        const size_t numLevels = m_levels.size();
+        for (size_t level = 0; level < numLevels; ++level)
+        {
+            const AZStd::vector<ActorInstance*>& actorInstances = m_levels[level];
+            if (actorInstances.empty())
+            {
+                continue;
+            }
+
+            // Group the actor instances of this level into chunks, based on their joint counts.
+            const size_t firstChunk = m_chunks.size();
+            size_t chunkCost = 0;
+            for (ActorInstance* actorInstance : actorInstances)
+            {
+                if (m_chunks.size() == firstChunk || chunkCost >= m_chunkCost)
+                {
+                    Chunk& chunk = m_chunks.emplace_back();
+                    chunk.m_firstActorInstance = m_chunkActorInstances.size();
+                    chunk.m_level = level;
+                    chunk.m_threadIndex = aznumeric_cast<uint32>((m_chunks.size() - 1 - firstChunk) % m_numThreadSlots);
+                    chunkCost = 0;
+                }
+
+                m_chunkActorInstances.emplace_back(actorInstance);
+                m_chunks.back().m_numActorInstances++;
+                chunkCost += AZStd::max<size_t>(actorInstance->GetActor()->GetNumNodes(), 1);
+            }
+
+            // Add a task per chunk. The chunks that share a thread data index run one after the other.
+            levelTokens.clear();
+            levelTokens.reserve(m_chunks.size() - firstChunk);
+            for (size_t chunkIndex = firstChunk; chunkIndex < m_chunks.size(); ++chunkIndex)
+            {
+                AZ::TaskToken& token = levelTokens.emplace_back(m_taskGraph.AddTask(chunkDescriptor, [this, chunkIndex]()
+                {
+                    ExecuteChunk(m_chunks[chunkIndex]);
+                }));
+
+                if (!levelDoneTokens.empty())
+                {
+                    levelDoneTokens.back().Precedes(token);
+                }
+
+                const size_t levelChunkIndex = chunkIndex - firstChunk;
+                if (levelChunkIndex >= m_numThreadSlots)
+                {
+                    levelTokens[levelChunkIndex - m_numThreadSlots].Precedes(token);
+                }
+            }
+
+            // Join the chunks of this level before starting the next, which holds the attachments of the actor instances in this one.
+            if (level + 1 < numLevels)
+            {
+                AZ::TaskToken& levelDoneToken = levelDoneTokens.emplace_back(m_taskGraph.AddTask(levelDescriptor, []() {}));
+                for (AZ::TaskToken& token : levelTokens)
+                {
+                    token.Precedes(levelDoneToken);
+                }
+            }
+        }
+
+        m_isDirty = false;
+    }
+
+
+    // execute the schedule
+    void TaskGraphScheduler::Execute(float timePassedInSeconds)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        if (m_isDirty || m_numThreadSlots != AZStd::max<size_t>(GetEMotionFX().GetNumThreads(), 1))
+        {
+            CompileTaskGraph();
+        }
+
+        if (m_chunks.empty())
+        {
+            return;
+        }
+
+        // propagate root actor instance visibility to their attachments
+        const ActorManager& actorManager = GetActorManager();
+        const size_t numRootActorInstances = actorManager.GetNumRootActorInstances();
+        for (size_t i = 0; i < numRootActorInstances; ++i)
+        {
+            ActorInstance* rootInstance = actorManager.GetRootActorInstance(i);
+            if (rootInstance->GetIsEnabled() == false)
+            {
+                continue;
+            }
+
+            rootInstance->RecursiveSetIsVisible(rootInstance->GetIsVisible());
+        }
+
+        // reset stats
+        m_numUpdated.SetValue(0);
+        m_numVisible.SetValue(0);
+        m_numSampled.SetValue(0);
+        m_updateRateLod.BeginFrame();
+
+        // The tasks read the time from the scheduler, so that the compiled task graph can be reused.
+        m_timePassedInSeconds = timePassedInSeconds;
+
+        AZ::TaskGraphActiveInterface* taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool useTaskGraph = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        if (useTaskGraph)
+        {
+            AZ::TaskGraphEvent finishedEvent{ "EMotionFX::TaskGraphScheduler Wait" };
+            m_taskGraph.Submit(&finishedEvent);
+            finishedEvent.Wait();
+        }
+        else
+        {
+            // The chunks are sorted by level, so executing them in order respects the attachment dependencies.
+            for (const Chunk& chunk : m_chunks)
+            {
+                ExecuteChunk(chunk);
+            }
+        }
+
+        m_updateRateLod.EndFrame();
+    }
+
+
+    // update the actor instances of a chunk
+    void TaskGraphScheduler::ExecuteChunk(const Chunk& chunk)
+    {
+        AZ_PROFILE_SCOPE(Animation, "TaskGraphScheduler::ExecuteChunk");
+
+        const size_t endActorInstance = chunk.m_firstActorInstance + chunk.m_numActorInstances;
+        for (size_t i = chunk.m_firstActorInstance; i < endActorInstance; ++i)
+        {
+            ActorInstance* actorInstance = m_chunkActorInstances[i];
+            if (actorInstance->GetIsEnabled())
+            {
+                ExecuteActorInstance(actorInstance, chunk.m_threadIndex);
+            }
+        }
+    }
+
+
+    // update a single actor instance
+    void TaskGraphScheduler::ExecuteActorInstance(ActorInstance* actorInstance, uint32 threadIndex)
+    {
+        actorInstance->SetThreadIndex(threadIndex);
+
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            m_numVisible.Increment();
+        }
+
+        // skip the update when the update rate LOD doesn't update the actor instance this frame
+        const UpdateRateLod::Result lodResult = m_updateRateLod.Evaluate(actorInstance);
+        if (!lodResult.m_update)
+        {
+            actorInstance->UpdateSkippedTransformations(m_timePassedInSeconds, isVisible, lodResult.m_interpolationWeight);
+            return;
+        }
+        actorInstance->SetUpdateRateLodInterpolation(m_updateRateLod.GetSettings().m_interpolate && lodResult.m_updateInterval > 1);
+        const float updateTimeInSeconds = m_timePassedInSeconds + actorInstance->GetSkippedUpdateTime();
+        actorInstance->SetSkippedUpdateTime(0.0f);
+        m_numUpdated.Increment();
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + updateTimeInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                m_numSampled.Increment();
+            }
+        }
+
+        // update the actor instance
+        actorInstance->UpdateTransformations(updateTimeInSeconds, isVisible, sampleMotions);
+    }
+
+
+    void TaskGraphScheduler::RecursiveInsertActorInstance(ActorInstance* actorInstance, size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        if (m_levels.size() <= startStep)
+        {
+            m_levels.resize(startStep + 1);
+        }
+
+        AZStd::vector<ActorInstance*>& level = m_levels[startStep];
+        AZ_Assert(AZStd::find(level.begin(), level.end(), actorInstance) == level.end(), "Expected the actor instance not being part of the level already.");
+        level.emplace_back(actorInstance);
+        m_isDirty = true;
+
+        // recursively add all attachments too
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveInsertActorInstance(attachment, startStep + 1);
+            }
+        }
+    }
+
+
+    // remove the actor instance from the schedule (excluding attachments)
+    size_t TaskGraphScheduler::RemoveActorInstance(ActorInstance* actorInstance, size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        const size_t numLevels = m_levels.size();
+        for (size_t i = startStep; i < numLevels; ++i)
+        {
+            AZStd::vector<ActorInstance*>& level = m_levels[i];
+            const auto it = AZStd::find(level.begin(), level.end(), actorInstance);
+            if (it != level.end())
+            {
+                level.erase(it);
+                m_isDirty = true;
+                return i;
+            }
+        }
+
+        return 0;
+    }
+
+
+    // remove the actor instance (including all of its attachments)
+    void TaskGraphScheduler::RecursiveRemoveActorInstance(ActorInstance* actorInstance, size_t startStep)
+    {
+        MCore::LockGuardRecursive guard(m_mutex);
+
+        // remove the actual actor instance
+        const size_t level = RemoveActorInstance(actorInstance, startStep);
+
+        // recursively remove all attachments as well
+        const size_t numAttachments = actorInstance->GetNumAttachments();
+        for (size_t i = 0; i < numAttachments; ++i)
+        {
+            ActorInstance* attachment = actorInstance->GetAttachment(i)->GetAttachmentActorInstance();
+            if (attachment)
+            {
+                RecursiveRemoveActorInstance(attachment, level);
+            }
+        }
+    }
+
+
+    void TaskGraphScheduler::Lock()
+    {
+        m_mutex.Lock();
+    }
+
+
+    void TaskGraphScheduler::Unlock()
+    {
+        m_mutex.Unlock();
+    }
+}   // namespace EMotionFX
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+// include the required headers
+#include "EMotionFXConfig.h"
+#include "ActorUpdateScheduler.h"
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/vector.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+namespace EMotionFX
+{
+    // forward declarations
+    class ActorInstance;
+
+
+    /**
+     * The task graph scheduler.
+     * This scheduler updates the actor instances in parallel using the task graph, rather than creating a job per actor instance each frame.
+     * The actor instances are sorted into levels by their attachment depth, as attachments have to be updated after the actor instance they are attached to.
+     * Each level gets split into chunks, where small actor instances get grouped together until the chunk cost is reached, so that the task overhead
+     * of lightweight characters gets amortized. The task graph is only recompiled when actor instances are inserted or removed, and gets resubmitted
+     * every frame without allocating any memory.
+     * When the task graph system is not active, the chunks are executed on the calling thread.
+     */
+    class EMFX_API TaskGraphScheduler
+        : public ActorUpdateScheduler
+    {
+        AZ_CLASS_ALLOCATOR_DECL
+    public:
+        /**
+         * The unique type ID of this scheduler, as returned by the GetType() method.
+         */
+        enum
+        {
+            TYPE_ID = 0x00000003
+        };
+
+        /**
+         * A chunk of actor instances that gets updated by a single task.
+         */
+        struct EMFX_API Chunk
+        {
+            size_t m_firstActorInstance = 0;    /**< The index of the first actor instance of the chunk in the flattened actor instance array. */
+            size_t m_numActorInstances = 0;     /**< The number of actor instances in the chunk. */
+            size_t m_level = 0;                 /**< The attachment depth of the actor instances in the chunk. */
+            uint32 m_threadIndex = 0;           /**< The thread data index used by the actor instances in the chunk. */
+        };
+
+        /**
+         * The creation method.
+         */
+        static TaskGraphScheduler* Create();
+
+        /**
+         * Get the name of this class, or a description.
+         * @result The string containing the name of the scheduler.
+         */
+        const char* GetName() const override        { return "TaskGraphScheduler"; }
+
+        /**
+         * Get the unique type ID of the scheduler type.
+         * All schedulers will have another ID, so that you can use this to identify what scheduler you are dealing with.
+         * @result The unique ID of the scheduler type.
+         */
+        uint32 GetType() const override             { return TYPE_ID; }
+
+        /**
+         * The main method which will execute all callbacks, which on their turn will check for visibilty, perform updates and render.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void Execute(float timePassedInSeconds) override;
+
+        /**
+         * LOG the schedule using the LOG method.
+         * This shows the number of actor instances and chunks in each level.
+         */
+        void Print() override;
+
+        /**
+         * Clear the schedule.
+         */
+        void Clear() override;
+
+        /**
+         * Recursively insert an actor instance into the schedule, including all its attachments.
+         * @param actorInstance The actor instance to insert.
+         * @param startStep The level to insert the actor instance in. Its attachments are inserted into the levels after it.
+         */
+        void RecursiveInsertActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Recursively remove an actor instance and its attachments from the schedule.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep The level to start trying to remove from.
+         */
+        void RecursiveRemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Remove a single actor instance from the schedule. This will not remove its attachments.
+         * @param actorInstance The actor instance to remove.
+         * @param startStep The level to start trying to remove from.
+         * @result Returns the level the actor instance was removed from.
+         */
+        size_t RemoveActorInstance(ActorInstance* actorInstance, size_t startStep = 0) override;
+
+        /**
+         * Set the cost at which a chunk gets closed, in number of joints.
+         * Actor instances are added to a chunk until the sum of their joint counts reaches this value, so an actor instance
+         * with more joints than this always gets a chunk of its own. The default is 256.
+         * @param numJoints The chunk cost, in number of joints.
+         */
+        void SetChunkCost(size_t numJoints);
+        size_t GetChunkCost() const                 { return m_chunkCost; }
+
+        size_t GetNumLevels() const                 { return m_levels.size(); }
+        size_t GetNumActorInstancesInLevel(size_t level) const { return m_levels[level].size(); }
+
+        /**
+         * Get the chunks the task graph was compiled from. These are only valid after a call to Execute().
+         * @result The chunks, sorted by level.
+         */
+        const AZStd::vector<Chunk>& GetChunks() const { return m_chunks; }
+
+        void Lock();
+        void Unlock();
+
+    protected:
+        AZStd::vector<AZStd::vector<ActorInstance*>> m_levels;   /**< The actor instances, sorted into levels by their attachment depth. */
+        AZStd::vector<ActorInstance*>   m_chunkActorInstances;  /**< The actor instances of all chunks, in the order of the chunks. */
+        AZStd::vector<Chunk>            m_chunks;               /**< The chunks that the task graph got compiled from. */
+        AZ::TaskGraph                   m_taskGraph{ "EMotionFX::TaskGraphScheduler" };
+        MCore::MutexRecursive           m_mutex;
+        float                           m_timePassedInSeconds = 0.0f;
+        size_t                          m_chunkCost = 256;
+        size_t                          m_numThreadSlots = 0;
+        bool                            m_isDirty = true;
+
+        /**
+         * The constructor.
+         */
+        TaskGraphScheduler();
+
+        /**
+         * The destructor.
+         */
+        virtual ~TaskGraphScheduler();
+
+        /**
+         * Split the levels into chunks, and record the tasks and their dependencies in the task graph.
+         * The chunks within a level run in parallel, except for chunks that share a thread data index, which run one after the other.
+         * All chunks of a level wait for the chunks of the previous level.
+         */
+        void CompileTaskGraph();
+
+        /**
+         * Update all enabled actor instances of a chunk.
+         * @param chunk The chunk to update.
+         */
+        void ExecuteChunk(const Chunk& chunk);
+
+        /**
+         * Update a single actor instance.
+         * @param actorInstance The actor instance to update.
+         * @param threadIndex The thread data index to use for the update.
+         */
+        void ExecuteActorInstance(ActorInstance* actorInstance, uint32 threadIndex);
+    };
+}   // namespace EMotionFX
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/UpdateRateLod.h>
+
+namespace EMotionFX
+{
+    void UpdateRateLod::SetSettings(const UpdateRateLodSettings& settings)
+    {
+        m_settings = settings;
+    }
+
+    const UpdateRateLodSettings& UpdateRateLod::GetSettings() const
+    {
+        return m_settings;
+    }
+
+    bool UpdateRateLod::GetIsEnabled() const
+    {
+        return m_settings.m_enabled && !m_settings.m_levels.empty();
+    }
+
+    void UpdateRateLod::SetViewPosition(const AZ::Vector3& position)
+    {
+        m_viewPosition = position;
+    }
+
+    const AZ::Vector3& UpdateRateLod::GetViewPosition() const
+    {
+        return m_viewPosition;
+    }
+
+    void UpdateRateLod::BeginFrame()
+    {
+        m_frameNumber++;
+
+        for (MCore::AtomicSizeT& numInLevel : m_numPerLevel)
+        {
+            numInLevel.SetValue(0);
+        }
+        m_numSkipped.SetValue(0);
+    }
+
+    void UpdateRateLod::EndFrame() const
+    {
+        if (!GetIsEnabled())
+        {
+            return;
+        }
+
+        static const wchar_t* levelCounterNames[s_maxStatLevels] =
+        {
+            L"EMotionFX/UpdateRateLod/Level0",
+            L"EMotionFX/UpdateRateLod/Level1",
+            L"EMotionFX/UpdateRateLod/Level2",
+            L"EMotionFX/UpdateRateLod/Level3",
+            L"EMotionFX/UpdateRateLod/Level4",
+            L"EMotionFX/UpdateRateLod/Level5",
+            L"EMotionFX/UpdateRateLod/Level6",
+            L"EMotionFX/UpdateRateLod/Level7"
+        };
+
+        const size_t numLevels = AZStd::min(m_settings.m_levels.size(), s_maxStatLevels);
+        for (size_t i = 0; i < numLevels; ++i)
+        {
+            AZ_PROFILE_DATAPOINT(Animation, static_cast<AZ::s64>(m_numPerLevel[i].GetValue()), levelCounterNames[i]);
+        }
+        AZ_PROFILE_DATAPOINT(Animation, static_cast<AZ::s64>(m_numSkipped.GetValue()), L"EMotionFX/UpdateRateLod/Skipped");
+    }
+
+    AZ::u32 UpdateRateLod::CalcLevel(float distance) const
+    {
+        const size_t numLevels = m_settings.m_levels.size();
+        for (size_t i = 0; i < numLevels; ++i)
+        {
+            if (distance < m_settings.m_levels[i].m_maxDistance)
+            {
+                return static_cast<AZ::u32>(i);
+            }
+        }
+
+        return numLevels > 0 ? static_cast<AZ::u32>(numLevels - 1) : 0;
+    }
+
+    UpdateRateLod::Result UpdateRateLod::Evaluate(const ActorInstance* actorInstance)
+    {
+        Result result;
+        if (!GetIsEnabled())
+        {
+            m_numPerLevel[0].Increment();
+            return result;
+        }
+
+        // Attachments use the level and frames of the actor instance they are attached to, as they depend on its pose.
+        const ActorInstance* lodActorInstance = actorInstance->FindAttachmentRoot();
+
+        // A higher importance makes the actor instance behave as if it is closer to the view.
+        const float importance = AZStd::max(lodActorInstance->GetUpdateRateLodImportance(), AZ::Constants::FloatEpsilon);
+        const float distance = lodActorInstance->GetWorldSpaceTransform().m_position.GetDistance(m_viewPosition) / importance;
+        result.m_level = CalcLevel(distance);
+        result.m_updateInterval = AZStd::max(m_settings.m_levels[result.m_level].m_updateInterval, 1u);
+        if (!lodActorInstance->GetIsVisible())
+        {
+            result.m_updateInterval = AZStd::max(result.m_updateInterval, m_settings.m_invisibleUpdateInterval);
+        }
+
+        // Offset the frames by the actor instance id, so that not all actor instances in the same level update in the same frame.
+        const AZ::u32 framesSinceUpdate = (m_frameNumber + lodActorInstance->GetID()) % result.m_updateInterval;
+        result.m_update = (framesSinceUpdate == 0);
+        result.m_interpolationWeight = static_cast<float>(framesSinceUpdate) / static_cast<float>(result.m_updateInterval);
+
+        m_numPerLevel[AZStd::min(static_cast<size_t>(result.m_level), s_maxStatLevels - 1)].Increment();
+        if (!result.m_update)
+        {
+            m_numSkipped.Increment();
+        }
+
+        return result;
+    }
+
+    size_t UpdateRateLod::GetNumActorInstancesInLevel(size_t level) const
+    {
+        return (level < s_maxStatLevels) ? m_numPerLevel[level].GetValue() : 0;
+    }
+
+    size_t UpdateRateLod::GetNumSkippedActorInstances() const
+    {
+        return m_numSkipped.GetValue();
+    }
+
+    AZ::u32 UpdateRateLod::GetFrameNumber() const
+    {
+        return m_frameNumber;
+    }
+} // namespace EMotionFX
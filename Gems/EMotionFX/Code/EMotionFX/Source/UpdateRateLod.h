@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <MCore/Source/MultiThreadManager.h>
+
+namespace EMotionFX
+{
+    class ActorInstance;
+
+    /**
+     * The update rate level of detail settings.
+     * Each level specifies up to which distance from the view it is used, and how many frames pass between two full updates of the actor instances in it.
+     * Actor instances further away than the max distance of the last level use the last level.
+     */
+    struct EMFX_API UpdateRateLodSettings
+    {
+        struct EMFX_API Level
+        {
+            float m_maxDistance = 0.0f;         /**< The distance from the view, in units, up to which this level is used. */
+            AZ::u32 m_updateInterval = 1;       /**< The number of frames between two updates, where 1 means every frame. */
+        };
+
+        AZStd::vector<Level> m_levels =
+        {
+            { 15.0f, 1 },
+            { 30.0f, 2 },
+            { 60.0f, 4 },
+            { 120.0f, 8 }
+        };
+        AZ::u32 m_invisibleUpdateInterval = 8;  /**< The minimum number of frames between two updates of actor instances that are not visible. */
+        bool m_interpolate = true;              /**< Interpolate the poses of the frames in between two updates, rather than holding the last pose. */
+        bool m_enabled = false;                 /**< Update all actor instances every frame when disabled. */
+    };
+
+    /**
+     * The update rate level of detail system, which is used by the actor update schedulers.
+     * It picks a level for each actor instance, based on the distance to the view, the visibility and the update rate LOD importance of the actor instance,
+     * and decides whether the actor instance is updated in the current frame. The frames in which actor instances are updated are spread using the actor instance id,
+     * so that the update costs of the actor instances that share a level are distributed over the frames of their update interval.
+     * Attachments always use the level and frames of the actor instance they are attached to.
+     */
+    class EMFX_API UpdateRateLod
+    {
+    public:
+        /**
+         * The maximum number of levels that the statistics are gathered for. Levels above that are counted as the last level.
+         */
+        static constexpr size_t s_maxStatLevels = 8;
+
+        /**
+         * The result of evaluating an actor instance.
+         */
+        struct EMFX_API Result
+        {
+            float m_interpolationWeight = 1.0f; /**< How far the current frame is in between two updates, in range of [0..1]. */
+            AZ::u32 m_level = 0;                /**< The picked level. */
+            AZ::u32 m_updateInterval = 1;       /**< The number of frames between two updates. */
+            bool m_update = true;               /**< True when the actor instance has to be fully updated this frame. */
+        };
+
+        void SetSettings(const UpdateRateLodSettings& settings);
+        const UpdateRateLodSettings& GetSettings() const;
+        bool GetIsEnabled() const;
+
+        /**
+         * Set the position of the view that the distances are measured from. This is usually the camera position.
+         * @param position The world space position of the view.
+         */
+        void SetViewPosition(const AZ::Vector3& position);
+        const AZ::Vector3& GetViewPosition() const;
+
+        /**
+         * Start a new frame. This resets the statistics and should be called once per scheduler execution, before evaluating any actor instances.
+         */
+        void BeginFrame();
+
+        /**
+         * Report the statistics of the current frame to the profiler.
+         */
+        void EndFrame() const;
+
+        /**
+         * Pick the level of an actor instance, and decide whether it should be updated this frame.
+         * This is thread safe and can be called from the scheduler jobs.
+         * @param actorInstance The actor instance to evaluate.
+         * @result The level, and whether to update or to interpolate.
+         */
+        Result Evaluate(const ActorInstance* actorInstance);
+
+        /**
+         * Calculate the level for a given distance.
+         * @param distance The distance to the view, already divided by the importance of the actor instance.
+         * @result The index of the level.
+         */
+        AZ::u32 CalcLevel(float distance) const;
+
+        size_t GetNumActorInstancesInLevel(size_t level) const;
+        size_t GetNumSkippedActorInstances() const;
+        AZ::u32 GetFrameNumber() const;
+
+    private:
+        UpdateRateLodSettings m_settings;
+        AZ::Vector3 m_viewPosition = AZ::Vector3::CreateZero();
+        MCore::AtomicSizeT m_numPerLevel[s_maxStatLevels];
+        MCore::AtomicSizeT m_numSkipped;
+        AZ::u32 m_frameNumber = 0;
+    };
+} // namespace EMotionFX
@@ -97,6 +97,8 @@ set(FILES
     Source/PhysicsSetup.h
     Source/Pose.cpp
     Source/Pose.h
+    Source/PoseBlendKernels.cpp
+    Source/PoseBlendKernels.h
     Source/PoseData.cpp
     Source/PoseData.h
     Source/PoseDataFactory.cpp
@@ -123,6 +125,8 @@ set(FILES
     Source/Skeleton.h
     Source/SkinningInfoVertexAttributeLayer.cpp
     Source/SkinningInfoVertexAttributeLayer.h
+    Source/SkinningKernels.cpp
+    Source/SkinningKernels.h
     Source/SoftSkinDeformer.cpp
     Source/SoftSkinDeformer.h
     Source/SoftSkinManager.cpp
@@ -131,6 +135,8 @@ set(FILES
     Source/SpringSolver.h
     Source/SubMesh.cpp
     Source/SubMesh.h
+    Source/TaskGraphScheduler.cpp
+    Source/TaskGraphScheduler.h
     Source/ThreadData.cpp
     Source/ThreadData.h
     Source/Transform.cpp
@@ -139,6 +145,8 @@ set(FILES
     Source/TransformData.h
     Source/TriggerActionSetup.cpp
     Source/TriggerActionSetup.h
+    Source/UpdateRateLod.cpp
+    Source/UpdateRateLod.h
     Source/Velocity.cpp
     Source/Velocity.h
     Source/VertexAttributeLayer.cpp
@@ -345,6 +353,8 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
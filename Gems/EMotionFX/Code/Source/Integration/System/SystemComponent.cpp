@@ -64,6 +64,9 @@
 
 #include <Integration/MotionExtractionBus.h>
 
+#include <Atom/RPI.Public/ViewportContext.h>
+#include <Atom/RPI.Public/ViewportContextBus.h>
+
 
 #if defined(EMOTIONFXANIMATION_EDITOR) // EMFX tools / editor includes
 // Qt
@@ -588,6 +591,9 @@ namespace EMotionFX
             REGISTER_CVAR2(
                 "emfx_ragdollManipulatorsEnabled", &CVars::emfx_ragdollManipulatorsEnabled, 1, VF_DEV_ONLY,
                 "Feature flag for in development ragdoll manipulators");
+            REGISTER_CVAR2(
+                "emfx_updateRateLodEnabled", &CVars::emfx_updateRateLodEnabled, 0, VF_NULL,
+                "Update actor instances that are far away from the camera or not visible at a lower rate");
         }
 
         //////////////////////////////////////////////////////////////////////////
@@ -595,12 +601,40 @@ namespace EMotionFX
         {
             gEnv->pConsole->UnregisterVariable("emfx_updateEnabled");
             gEnv->pConsole->UnregisterVariable("emfx_ragdollManipulatorsEnabled");
+            gEnv->pConsole->UnregisterVariable("emfx_updateRateLodEnabled");
 
 #if !defined(AZ_MONOLITHIC_BUILD)
             gEnv = nullptr;
 #endif
         }
 
+        //////////////////////////////////////////////////////////////////////////
+        void SystemComponent::SyncUpdateRateLod()
+        {
+            UpdateRateLod& updateRateLod = GetEMotionFX().GetActorManager()->GetScheduler()->GetUpdateRateLod();
+            UpdateRateLodSettings settings = updateRateLod.GetSettings();
+            settings.m_enabled = (CVars::emfx_updateRateLodEnabled != 0);
+            updateRateLod.SetSettings(settings);
+            if (!settings.m_enabled)
+            {
+                return;
+            }
+
+            // Measure the update rate LOD distances from the camera of the default viewport.
+            auto viewportContextManager = AZ::Interface<AZ::RPI::ViewportContextRequestsInterface>::Get();
+            if (!viewportContextManager)
+            {
+                return;
+            }
+
+            AZ::RPI::ViewportContextPtr defaultViewportContext =
+                viewportContextManager->GetViewportContextByName(viewportContextManager->GetDefaultViewportContextName());
+            if (defaultViewportContext)
+            {
+                updateRateLod.SetViewPosition(defaultViewportContext->GetCameraTransform().GetTranslation());
+            }
+        }
+
         //////////////////////////////////////////////////////////////////////////
         void SystemComponent::OnTick(float delta, [[maybe_unused]]AZ::ScriptTimePoint timePoint)
         {
@@ -609,6 +643,8 @@ namespace EMotionFX
 
             if (CVars::emfx_updateEnabled)
             {
+                SyncUpdateRateLod();
+
                 // Main EMotionFX runtime update.
                 GetEMotionFX().Update(delta);
 
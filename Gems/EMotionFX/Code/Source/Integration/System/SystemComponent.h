@@ -138,6 +138,10 @@ namespace EMotionFX
             //! velocity will be applied to it to move it towards the actor instance.
             void ApplyMotionExtraction(const ActorInstance* actorInstance, float timeDelta);
 
+            //! Enable or disable the update rate LOD of the actor update scheduler based on the emfx_updateRateLodEnabled cvar,
+            //! and pass it the position of the camera that the distances are measured from.
+            void SyncUpdateRateLod();
+
             AZStd::vector<AZStd::unique_ptr<AZ::Data::AssetHandler> > m_assetHandlers;
             AZStd::unique_ptr<EMotionFXEventHandler> m_eventHandler;
             AZStd::unique_ptr<RenderBackendManager> m_renderBackendManager;
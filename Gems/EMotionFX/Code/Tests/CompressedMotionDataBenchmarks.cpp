@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+namespace EMotionFX
+{
+    // Compares the memory footprint and the sampling throughput of the UniformMotionData and the CompressedMotionData.
+    // Every iteration samples all joints at a new time, which is the decoding work SamplePose() does for a full skeleton.
+    class CompressedMotionDataBenchmarkFixture
+        : public benchmark::Fixture
+    {
+        void internalSetUp(int64_t numJoints)
+        {
+            m_numJoints = static_cast<size_t>(numJoints);
+
+            // Five seconds of random smooth curves at 30 frames per second.
+            const size_t numSamples = 151;
+            const float sampleSpacing = 1.0f / 30.0f;
+            AZ::SimpleLcgRandom random;
+            NonUniformMotionData source;
+            source.Resize(m_numJoints, 0, 0);
+            for (size_t j = 0; j < m_numJoints; ++j)
+            {
+                const float frequency = 1.0f + random.GetRandomFloat() * 4.0f;
+                const float phase = random.GetRandomFloat() * AZ::Constants::TwoPi;
+                const AZ::Vector3 axis = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat() + 0.1f).GetNormalized();
+                source.AllocateJointPositionSamples(j, numSamples);
+                source.AllocateJointRotationSamples(j, numSamples);
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    const float time = s * sampleSpacing;
+                    const float wave = AZStd::sin(time * frequency + phase);
+                    source.SetJointPositionSample(j, s, { time, AZ::Vector3(wave, 0.5f * wave, 0.1f * static_cast<float>(j)) });
+                    source.SetJointRotationSample(j, s, { time, AZ::Quaternion::CreateFromAxisAngle(axis, wave * AZ::Constants::HalfPi) });
+                }
+            }
+            source.SetSampleRate(30.0f);
+            source.UpdateDuration();
+
+            // The default quality of the motion sampling rule.
+            MotionData::OptimizeSettings optimizeSettings;
+            optimizeSettings.m_maxPosError = 0.0225f * 0.25f;
+            optimizeSettings.m_maxRotError = 0.0225f * 0.25f;
+            optimizeSettings.m_maxScaleError = 0.0225f * 0.25f;
+
+            m_uniformData = AZStd::make_unique<UniformMotionData>();
+            m_uniformData->InitFromNonUniformData(&source);
+            m_uniformData->Optimize(optimizeSettings);
+
+            m_compressedData = AZStd::make_unique<CompressedMotionData>();
+            m_compressedData->InitFromNonUniformData(&source);
+            m_compressedData->Optimize(optimizeSettings);
+        }
+
+        void internalTearDown()
+        {
+            m_uniformData.reset();
+            m_compressedData.reset();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void SampleAllJoints(benchmark::State& state, const MotionData& motionData)
+        {
+            const float duration = motionData.GetDuration();
+            float time = 0.0f;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t j = 0; j < m_numJoints; ++j)
+                {
+                    Transform transform = motionData.SampleJointTransform(time, j);
+                    benchmark::DoNotOptimize(transform);
+                }
+
+                // Step with an uneven time, so that most samples interpolate.
+                time += 0.0123f;
+                if (time > duration)
+                {
+                    time -= duration;
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+
+            MotionData::SaveSettings saveSettings;
+            state.counters["Bytes"] = static_cast<double>(motionData.CalcStreamSaveSizeInBytes(saveSettings));
+        }
+
+        size_t m_numJoints = 0;
+        AZStd::unique_ptr<UniformMotionData> m_uniformData;
+        AZStd::unique_ptr<CompressedMotionData> m_compressedData;
+    };
+
+    BENCHMARK_DEFINE_F(CompressedMotionDataBenchmarkFixture, Uniform)(benchmark::State& state)
+    {
+        SampleAllJoints(state, *m_uniformData);
+    }
+
+    BENCHMARK_DEFINE_F(CompressedMotionDataBenchmarkFixture, Compressed)(benchmark::State& state)
+    {
+        SampleAllJoints(state, *m_compressedData);
+    }
+
+    BENCHMARK_REGISTER_F(CompressedMotionDataBenchmarkFixture, Uniform)->Arg(64)->Arg(200);
+    BENCHMARK_REGISTER_F(CompressedMotionDataBenchmarkFixture, Compressed)->Arg(64)->Arg(200);
+} // namespace EMotionFX
+
+#endif // HAVE_BENCHMARK
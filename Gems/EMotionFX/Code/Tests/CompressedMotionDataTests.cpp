@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/MotionData/UniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/ActorFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataTests
+        : public ActorFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp()
+        {
+            UnitTest::TraceBusRedirector::BusConnect();
+            ActorFixture::SetUp();
+        }
+
+        void TearDown()
+        {
+            ActorFixture::TearDown();
+            UnitTest::TraceBusRedirector::BusDisconnect();
+        }
+
+        // Fill the source data with two seconds of smooth curves, sampled at 30 frames per second.
+        // The joints are named after the joints in the actor, so that the data can be used to sample poses.
+        void InitSourceData(NonUniformMotionData& motionData, size_t numJoints) const
+        {
+            const size_t numSamples = 61;
+            const float sampleSpacing = 1.0f / 30.0f;
+            motionData.Resize(numJoints, 1, 1);
+            for (size_t j = 0; j < numJoints; ++j)
+            {
+                motionData.SetJointName(j, GetActor()->GetSkeleton()->GetNode(j)->GetNameString());
+                motionData.AllocateJointPositionSamples(j, numSamples);
+                motionData.AllocateJointRotationSamples(j, numSamples);
+                const float phase = static_cast<float>(j) * 0.3f;
+                for (size_t s = 0; s < numSamples; ++s)
+                {
+                    const float time = s * sampleSpacing;
+                    const AZ::Vector3 position(AZStd::sin(time * 3.0f + phase), 0.5f * AZStd::cos(time * 2.0f), static_cast<float>(j));
+                    const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(
+                        AZ::Vector3(1.0f, 2.0f, 0.5f).GetNormalized(), AZStd::sin(time * 2.0f + phase) * AZ::Constants::Pi);
+                    motionData.SetJointPositionSample(j, s, { time, position });
+                    motionData.SetJointRotationSample(j, s, { time, rotation });
+                }
+            }
+
+            motionData.SetMorphName(0, "Morph");
+            motionData.AllocateMorphSamples(0, numSamples);
+            motionData.SetFloatName(0, "Float");
+            motionData.AllocateFloatSamples(0, numSamples);
+            for (size_t s = 0; s < numSamples; ++s)
+            {
+                const float time = s * sampleSpacing;
+                motionData.SetMorphSample(0, s, { time, 0.5f + 0.5f * AZStd::sin(time * 4.0f) });
+                motionData.SetFloatSample(0, s, { time, 10.0f * time });
+            }
+
+            motionData.SetSampleRate(30.0f);
+            motionData.UpdateDuration();
+        }
+
+        static MotionData::OptimizeSettings CreateOptimizeSettings()
+        {
+            MotionData::OptimizeSettings settings;
+            settings.m_maxPosError = 0.001f;
+            settings.m_maxRotError = 0.001f;
+            settings.m_maxScaleError = 0.001f;
+            settings.m_maxMorphError = 0.0001f;
+            settings.m_maxFloatError = 0.0001f;
+            return settings;
+        }
+
+        // Compare the compressed data against the source at and in between the samples.
+        // The tolerance includes the error of the linear interpolation between two decoded samples.
+        static void CompareWithSource(const MotionData& compressed, const NonUniformMotionData& source, float tolerance)
+        {
+            ASSERT_EQ(compressed.GetNumJoints(), source.GetNumJoints());
+            for (float time = 0.0f; time <= source.GetDuration(); time += 1.0f / 60.0f)
+            {
+                for (size_t j = 0; j < source.GetNumJoints(); ++j)
+                {
+                    const Transform expected = source.SampleJointTransform(time, j);
+                    const Transform actual = compressed.SampleJointTransform(time, j);
+                    EXPECT_TRUE(actual.m_position.IsClose(expected.m_position, tolerance)) << "Position of joint " << j << " differs at time " << time;
+
+                    // Rotations are stored with a positive w, so compare them in the same hemisphere.
+                    const AZ::Quaternion expectedRotation = (expected.m_rotation.Dot(actual.m_rotation) < 0.0f) ? -expected.m_rotation : expected.m_rotation;
+                    EXPECT_TRUE(actual.m_rotation.IsClose(expectedRotation, tolerance)) << "Rotation of joint " << j << " differs at time " << time;
+                }
+
+                EXPECT_NEAR(compressed.SampleMorph(time, 0), source.SampleMorph(time, 0), tolerance);
+                EXPECT_NEAR(compressed.SampleFloat(time, 0), source.SampleFloat(time, 0), tolerance);
+            }
+        }
+    };
+
+    TEST_F(CompressedMotionDataTests, InitAndOptimize)
+    {
+        NonUniformMotionData source;
+        InitSourceData(source, 3);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&source);
+        EXPECT_EQ(motionData.GetNumSamples(), 61u);
+        EXPECT_FLOAT_EQ(motionData.GetSampleRate(), 30.0f);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 2.0f);
+        EXPECT_EQ(motionData.GetNumJoints(), 3u);
+        EXPECT_EQ(motionData.GetNumMorphs(), 1u);
+        EXPECT_EQ(motionData.GetNumFloats(), 1u);
+
+        motionData.Optimize(CreateOptimizeSettings());
+        for (size_t j = 0; j < motionData.GetNumJoints(); ++j)
+        {
+            EXPECT_TRUE(motionData.IsJointPositionAnimated(j));
+            EXPECT_TRUE(motionData.IsJointRotationAnimated(j));
+
+            // The z position is constant, so it should not use any bits.
+            EXPECT_LT(motionData.GetJointPositionBitsPerSample(j), 3u * CompressedMotionData::s_maxBitsPerComponent);
+        }
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_TRUE(motionData.IsFloatAnimated(0));
+
+        CompareWithSource(motionData, source, 0.01f);
+    }
+
+    TEST_F(CompressedMotionDataTests, HigherErrorUsesFewerBits)
+    {
+        NonUniformMotionData source;
+        InitSourceData(source, 1);
+
+        CompressedMotionData lowError;
+        lowError.InitFromNonUniformData(&source);
+        lowError.Optimize(CreateOptimizeSettings());
+
+        MotionData::OptimizeSettings highErrorSettings = CreateOptimizeSettings();
+        highErrorSettings.m_maxPosError = 0.02f;
+        highErrorSettings.m_maxRotError = 0.02f;
+        CompressedMotionData highError;
+        highError.InitFromNonUniformData(&source);
+        highError.Optimize(highErrorSettings);
+
+        EXPECT_LT(highError.GetJointPositionBitsPerSample(0), lowError.GetJointPositionBitsPerSample(0));
+        EXPECT_LT(highError.GetJointRotationBitsPerSample(0), lowError.GetJointRotationBitsPerSample(0));
+        EXPECT_LT(highError.GetNumCompressedBytes(), lowError.GetNumCompressedBytes());
+    }
+
+    TEST_F(CompressedMotionDataTests, DisplacementErrorMetric)
+    {
+        NonUniformMotionData source;
+        InitSourceData(source, 1);
+
+        MotionData::OptimizeSettings settings = CreateOptimizeSettings();
+        settings.m_errorMetric = MotionData::ErrorMetric::Displacement;
+        settings.m_displacementDistance = 0.5f;
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&source);
+        motionData.Optimize(settings);
+
+        // Points at the displacement distance should not move more than the position error on the samples.
+        for (size_t s = 0; s < motionData.GetNumSamples(); ++s)
+        {
+            const float time = s * motionData.GetSampleSpacing();
+            const AZ::Quaternion expected = source.SampleJointRotation(time, 0);
+            const AZ::Quaternion actual = motionData.SampleJointRotation(time, 0);
+            const AZ::Vector3 point = AZ::Vector3::CreateAxisX(settings.m_displacementDistance);
+            EXPECT_LE((expected.TransformVector(point) - actual.TransformVector(point)).GetLength(), settings.m_maxPosError + AZ::Constants::Tolerance);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, RotationThroughHalfTurn)
+    {
+        // The rotation passes a half turn in between two samples, where the w component of the source changes its sign.
+        NonUniformMotionData source;
+        const size_t numSamples = 31;
+        const float sampleSpacing = 1.0f / 30.0f;
+        source.Resize(1, 0, 0);
+        source.SetJointName(0, GetActor()->GetSkeleton()->GetNode(0)->GetNameString());
+        source.AllocateJointRotationSamples(0, numSamples);
+        for (size_t s = 0; s < numSamples; ++s)
+        {
+            const float time = s * sampleSpacing;
+            const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3::CreateAxisZ(), AZ::Constants::Pi * (0.5f + 1.1f * time));
+            source.SetJointRotationSample(0, s, { time, rotation });
+        }
+        source.SetSampleRate(30.0f);
+        source.UpdateDuration();
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&source);
+        motionData.Optimize(CreateOptimizeSettings());
+        ASSERT_TRUE(motionData.IsJointRotationAnimated(0));
+
+        for (float time = 0.0f; time <= source.GetDuration(); time += 1.0f / 120.0f)
+        {
+            const AZ::Quaternion expected = source.SampleJointRotation(time, 0);
+            const AZ::Quaternion actual = motionData.SampleJointRotation(time, 0);
+            EXPECT_GT(AZStd::abs(actual.Dot(expected)), 0.999f) << "Rotation differs at time " << time;
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, SmallerThanUniform)
+    {
+        NonUniformMotionData source;
+        InitSourceData(source, 5);
+
+        UniformMotionData uniform;
+        uniform.InitFromNonUniformData(&source);
+        uniform.Optimize(CreateOptimizeSettings());
+
+        CompressedMotionData compressed;
+        compressed.InitFromNonUniformData(&source);
+        compressed.Optimize(CreateOptimizeSettings());
+
+        MotionData::SaveSettings saveSettings;
+        EXPECT_LT(compressed.CalcStreamSaveSizeInBytes(saveSettings), uniform.CalcStreamSaveSizeInBytes(saveSettings));
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead)
+    {
+        NonUniformMotionData source;
+        InitSourceData(source, 3);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&source);
+        motionData.Optimize(CreateOptimizeSettings());
+
+        MotionData::SaveSettings saveSettings;
+        MCore::MemoryFile file;
+        file.Open();
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        file.Seek(0);
+        CompressedMotionData loaded;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loaded.Read(&file, readSettings));
+
+        EXPECT_EQ(loaded.GetNumSamples(), motionData.GetNumSamples());
+        EXPECT_FLOAT_EQ(loaded.GetDuration(), motionData.GetDuration());
+        EXPECT_EQ(loaded.GetNumCompressedBytes(), motionData.GetNumCompressedBytes());
+        EXPECT_STREQ(loaded.GetJointName(1).c_str(), motionData.GetJointName(1).c_str());
+        EXPECT_STREQ(loaded.GetMorphName(0).c_str(), "Morph");
+        EXPECT_STREQ(loaded.GetFloatName(0).c_str(), "Float");
+        for (float time = 0.0f; time <= motionData.GetDuration(); time += 0.1f)
+        {
+            for (size_t j = 0; j < motionData.GetNumJoints(); ++j)
+            {
+                EXPECT_THAT(loaded.SampleJointPosition(time, j), IsClose(motionData.SampleJointPosition(time, j)));
+                EXPECT_THAT(loaded.SampleJointRotation(time, j), IsClose(motionData.SampleJointRotation(time, j)));
+            }
+            EXPECT_FLOAT_EQ(loaded.SampleMorph(time, 0), motionData.SampleMorph(time, 0));
+            EXPECT_FLOAT_EQ(loaded.SampleFloat(time, 0), motionData.SampleFloat(time, 0));
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, SamplePose)
+    {
+        NonUniformMotionData source;
+        InitSourceData(source, GetActor()->GetSkeleton()->GetNumNodes());
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&source);
+        motionData.Optimize(CreateOptimizeSettings());
+
+        Pose pose;
+        pose.LinkToActorInstance(m_actorInstance);
+        for (float time = 0.0f; time <= motionData.GetDuration(); time += 0.25f)
+        {
+            MotionData::SampleSettings sampleSettings;
+            sampleSettings.m_actorInstance = m_actorInstance;
+            sampleSettings.m_sampleTime = time;
+            motionData.SamplePose(sampleSettings, &pose);
+
+            for (size_t i = 0; i < m_actorInstance->GetNumEnabledNodes(); ++i)
+            {
+                const size_t jointIndex = m_actorInstance->GetEnabledNode(i);
+                const Transform expected = motionData.SampleJointTransform(sampleSettings, jointIndex);
+                const Transform& actual = pose.GetLocalSpaceTransform(jointIndex);
+                EXPECT_THAT(actual.m_position, IsClose(expected.m_position));
+                EXPECT_THAT(actual.m_rotation, IsClose(expected.m_rotation));
+            }
+        }
+    }
+} // namespace EMotionFX
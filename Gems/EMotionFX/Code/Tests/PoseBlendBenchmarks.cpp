@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
+#include <EMotionFX/Source/Transform.h>
+
+namespace EMotionFX
+{
+    // Compares the per joint Transform::Blend() loops blend trees used to run with the SIMD kernels and the structure of arrays
+    // storage, for the typical blend tree shapes: a Blend2 node, a BlendN node blending three poses, an additive layer and a
+    // feathered Blend2 node that only blends the joints in its mask.
+    class PoseBlendBenchmarkFixture
+        : public benchmark::Fixture
+    {
+        void internalSetUp(int64_t numJoints)
+        {
+            m_numJoints = static_cast<size_t>(numJoints);
+            AZ::SimpleLcgRandom random;
+            for (AZStd::vector<Transform>& pose : m_inputPoses)
+            {
+                pose.resize(m_numJoints);
+                for (Transform& transform : pose)
+                {
+                    const AZ::Vector3 axis = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat() + 0.1f).GetNormalized();
+                    transform.Set(
+                        AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat()),
+                        AZ::Quaternion::CreateFromAxisAngle(axis, random.GetRandomFloat() * AZ::Constants::TwoPi),
+                        AZ::Vector3::CreateOne());
+                }
+            }
+
+            for (size_t i = 0; i < InputPoseCount; ++i)
+            {
+                m_inputStreams[i].Gather(m_inputPoses[i].data(), m_numJoints);
+            }
+
+            // Feathering masks usually cover one limb or the upper body, use every other joint.
+            for (size_t i = 0; i < m_numJoints; i += 2)
+            {
+                m_mask.emplace_back(i);
+            }
+        }
+
+        void internalTearDown()
+        {
+            for (size_t i = 0; i < InputPoseCount; ++i)
+            {
+                m_inputPoses[i] = {};
+                m_inputStreams[i] = {};
+            }
+            m_outputPose = {};
+            m_outputStreams = {};
+            m_mask = {};
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        static constexpr size_t InputPoseCount = 3;
+        size_t m_numJoints = 0;
+        AZStd::vector<Transform> m_inputPoses[InputPoseCount];
+        AZStd::vector<Transform> m_outputPose;
+        TransformStreams m_inputStreams[InputPoseCount];
+        TransformStreams m_outputStreams;
+        AZStd::vector<size_t> m_mask;
+    };
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, Blend2_Scalar)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputPose = m_inputPoses[0];
+            for (size_t i = 0; i < m_numJoints; ++i)
+            {
+                m_outputPose[i].Blend(m_inputPoses[1][i], 0.3f);
+            }
+            benchmark::DoNotOptimize(m_outputPose.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, Blend2_Kernel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputPose = m_inputPoses[0];
+            PoseBlendKernels::Blend(m_outputPose.data(), m_inputPoses[1].data(), m_numJoints, 0.3f);
+            benchmark::DoNotOptimize(m_outputPose.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, Blend2_Streams)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputStreams = m_inputStreams[0];
+            m_outputStreams.Blend(m_inputStreams[1], 0.3f);
+            benchmark::DoNotOptimize(&m_outputStreams);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, BlendN_Scalar)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputPose = m_inputPoses[0];
+            for (size_t pose = 1; pose < InputPoseCount; ++pose)
+            {
+                for (size_t i = 0; i < m_numJoints; ++i)
+                {
+                    m_outputPose[i].Blend(m_inputPoses[pose][i], 0.5f);
+                }
+            }
+            benchmark::DoNotOptimize(m_outputPose.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, BlendN_Kernel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputPose = m_inputPoses[0];
+            for (size_t pose = 1; pose < InputPoseCount; ++pose)
+            {
+                PoseBlendKernels::Blend(m_outputPose.data(), m_inputPoses[pose].data(), m_numJoints, 0.5f);
+            }
+            benchmark::DoNotOptimize(m_outputPose.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, BlendN_Streams)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputStreams = m_inputStreams[0];
+            for (size_t pose = 1; pose < InputPoseCount; ++pose)
+            {
+                m_outputStreams.Blend(m_inputStreams[pose], 0.5f);
+            }
+            benchmark::DoNotOptimize(&m_outputStreams);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, Additive_Scalar)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputPose = m_inputPoses[0];
+            for (size_t i = 0; i < m_numJoints; ++i)
+            {
+                Transform& transform = m_outputPose[i];
+                const Transform& additiveTransform = m_inputPoses[1][i];
+                transform.m_position += additiveTransform.m_position * 0.3f;
+                transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, 0.3f);
+                EMFX_SCALECODE
+                (
+                    transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, 0.3f);
+                )
+                transform.m_rotation.Normalize();
+            }
+            benchmark::DoNotOptimize(m_outputPose.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, Additive_Kernel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputPose = m_inputPoses[0];
+            PoseBlendKernels::ApplyAdditive(m_outputPose.data(), m_inputPoses[1].data(), m_numJoints, 0.3f);
+            benchmark::DoNotOptimize(m_outputPose.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, Additive_Streams)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputStreams = m_inputStreams[0];
+            m_outputStreams.ApplyAdditive(m_inputStreams[1], 0.3f);
+            benchmark::DoNotOptimize(&m_outputStreams);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, Feathered_Scalar)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputPose = m_inputPoses[0];
+            for (const size_t nodeIndex : m_mask)
+            {
+                m_outputPose[nodeIndex].Blend(m_inputPoses[1][nodeIndex], 0.3f);
+            }
+            benchmark::DoNotOptimize(m_outputPose.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(m_mask.size()));
+    }
+
+    BENCHMARK_DEFINE_F(PoseBlendBenchmarkFixture, Feathered_Kernel)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_outputPose = m_inputPoses[0];
+            PoseBlendKernels::Blend(m_outputPose.data(), m_inputPoses[1].data(), m_mask.data(), m_mask.size(), 0.3f);
+            benchmark::DoNotOptimize(m_outputPose.data());
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(m_mask.size()));
+    }
+
+    // Typical character skeletons, the 200 joint case being the main target.
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, Blend2_Scalar)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, Blend2_Kernel)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, Blend2_Streams)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, BlendN_Scalar)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, BlendN_Kernel)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, BlendN_Streams)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, Additive_Scalar)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, Additive_Kernel)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, Additive_Streams)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, Feathered_Scalar)->Arg(64)->Arg(200)->Arg(1000);
+    BENCHMARK_REGISTER_F(PoseBlendBenchmarkFixture, Feathered_Kernel)->Arg(64)->Arg(200)->Arg(1000);
+} // namespace EMotionFX
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/PoseBlendKernels.h>
+#include <EMotionFX/Source/Transform.h>
+
+namespace EMotionFX
+{
+    // The parameters are the number of transforms and the blend weight.
+    class PoseBlendKernelsTests
+        : public ::testing::TestWithParam<::testing::tuple<size_t, float>>
+    {
+    public:
+        void SetUp() override
+        {
+            m_numTransforms = ::testing::get<0>(GetParam());
+            m_weight = ::testing::get<1>(GetParam());
+
+            AZ::SimpleLcgRandom random(m_numTransforms);
+            m_sourceTransforms = CreateRandomTransforms(random);
+            m_destTransforms = CreateRandomTransforms(random);
+
+            // Every third joint, so the mask ends with a partial block for most sizes.
+            for (size_t i = 0; i < m_numTransforms; i += 3)
+            {
+                m_mask.emplace_back(i);
+                m_enabledNodes.emplace_back(static_cast<uint16>(i));
+            }
+        }
+
+        AZStd::vector<Transform> CreateRandomTransforms(AZ::SimpleLcgRandom& random) const
+        {
+            AZStd::vector<Transform> transforms(m_numTransforms);
+            for (Transform& transform : transforms)
+            {
+                const AZ::Vector3 position(random.GetRandomFloat() * 2.0f - 1.0f, random.GetRandomFloat() * 2.0f - 1.0f, random.GetRandomFloat() * 2.0f - 1.0f);
+                const AZ::Vector3 axis = AZ::Vector3(random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f, random.GetRandomFloat() - 0.5f).GetNormalizedSafe();
+                AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(axis.IsZero() ? AZ::Vector3::CreateAxisZ() : axis, random.GetRandomFloat() * AZ::Constants::TwoPi);
+                if (random.GetRandomFloat() < 0.5f)
+                {
+                    // Make sure both hemispheres get tested.
+                    rotation = -rotation;
+                }
+                const AZ::Vector3 scale(0.5f + random.GetRandomFloat(), 0.5f + random.GetRandomFloat(), 0.5f + random.GetRandomFloat());
+                transform.Set(position, rotation, scale);
+            }
+            return transforms;
+        }
+
+        static void ApplyAdditiveReference(Transform& transform, const Transform& additiveTransform, float weight)
+        {
+            transform.m_position += additiveTransform.m_position * weight;
+            transform.m_rotation = transform.m_rotation.NLerp(additiveTransform.m_rotation * transform.m_rotation, weight);
+            EMFX_SCALECODE
+            (
+                transform.m_scale *= AZ::Vector3::CreateOne().Lerp(additiveTransform.m_scale, weight);
+            )
+            transform.m_rotation.Normalize();
+        }
+
+        static void CompareTransforms(const AZStd::vector<Transform>& actual, const AZStd::vector<Transform>& expected)
+        {
+            ASSERT_EQ(actual.size(), expected.size());
+            const float tolerance = 1e-4f;
+            for (size_t i = 0; i < actual.size(); ++i)
+            {
+                EXPECT_TRUE(actual[i].m_position.IsClose(expected[i].m_position, tolerance)) << "Position of joint " << i << " differs.";
+                EXPECT_TRUE(actual[i].m_rotation.IsClose(expected[i].m_rotation, tolerance)) << "Rotation of joint " << i << " differs.";
+                EMFX_SCALECODE
+                (
+                    EXPECT_TRUE(actual[i].m_scale.IsClose(expected[i].m_scale, tolerance)) << "Scale of joint " << i << " differs.";
+                )
+            }
+        }
+
+    protected:
+        size_t m_numTransforms = 0;
+        float m_weight = 0.0f;
+        AZStd::vector<Transform> m_sourceTransforms;
+        AZStd::vector<Transform> m_destTransforms;
+        AZStd::vector<size_t> m_mask;
+        AZStd::vector<uint16> m_enabledNodes;
+    };
+
+    TEST_P(PoseBlendKernelsTests, Blend)
+    {
+        AZStd::vector<Transform> expected = m_sourceTransforms;
+        for (size_t i = 0; i < m_numTransforms; ++i)
+        {
+            expected[i].Blend(m_destTransforms[i], m_weight);
+        }
+
+        AZStd::vector<Transform> actual = m_sourceTransforms;
+        PoseBlendKernels::Blend(actual.data(), m_destTransforms.data(), m_numTransforms, m_weight);
+        CompareTransforms(actual, expected);
+    }
+
+    TEST_P(PoseBlendKernelsTests, BlendMasked)
+    {
+        AZStd::vector<Transform> expected = m_sourceTransforms;
+        for (const size_t nodeIndex : m_mask)
+        {
+            expected[nodeIndex].Blend(m_destTransforms[nodeIndex], m_weight);
+        }
+
+        AZStd::vector<Transform> actual = m_sourceTransforms;
+        PoseBlendKernels::Blend(actual.data(), m_destTransforms.data(), m_mask.data(), m_mask.size(), m_weight);
+        CompareTransforms(actual, expected);
+
+        // The enabled nodes variant has to give the same result.
+        actual = m_sourceTransforms;
+        PoseBlendKernels::Blend(actual.data(), m_destTransforms.data(), m_enabledNodes.data(), m_enabledNodes.size(), m_weight);
+        CompareTransforms(actual, expected);
+    }
+
+    TEST_P(PoseBlendKernelsTests, ApplyAdditive)
+    {
+        AZStd::vector<Transform> expected = m_sourceTransforms;
+        for (size_t i = 0; i < m_numTransforms; ++i)
+        {
+            ApplyAdditiveReference(expected[i], m_destTransforms[i], m_weight);
+        }
+
+        AZStd::vector<Transform> actual = m_sourceTransforms;
+        PoseBlendKernels::ApplyAdditive(actual.data(), m_destTransforms.data(), m_numTransforms, m_weight);
+        CompareTransforms(actual, expected);
+    }
+
+    TEST_P(PoseBlendKernelsTests, ApplyAdditiveMasked)
+    {
+        AZStd::vector<Transform> expected = m_sourceTransforms;
+        for (const size_t nodeIndex : m_mask)
+        {
+            ApplyAdditiveReference(expected[nodeIndex], m_destTransforms[nodeIndex], m_weight);
+        }
+
+        AZStd::vector<Transform> actual = m_sourceTransforms;
+        PoseBlendKernels::ApplyAdditive(actual.data(), m_destTransforms.data(), m_mask.data(), m_mask.size(), m_weight);
+        CompareTransforms(actual, expected);
+
+        actual = m_sourceTransforms;
+        PoseBlendKernels::ApplyAdditive(actual.data(), m_destTransforms.data(), m_enabledNodes.data(), m_enabledNodes.size(), m_weight);
+        CompareTransforms(actual, expected);
+    }
+
+    TEST_P(PoseBlendKernelsTests, TransformStreamsGatherScatter)
+    {
+        TransformStreams streams;
+        streams.Gather(m_sourceTransforms.data(), m_numTransforms);
+        EXPECT_EQ(streams.GetNumTransforms(), m_numTransforms);
+
+        AZStd::vector<Transform> actual(m_numTransforms, Transform::CreateIdentity());
+        streams.Scatter(actual.data());
+        CompareTransforms(actual, m_sourceTransforms);
+    }
+
+    TEST_P(PoseBlendKernelsTests, TransformStreamsBlend)
+    {
+        AZStd::vector<Transform> expected = m_sourceTransforms;
+        for (size_t i = 0; i < m_numTransforms; ++i)
+        {
+            expected[i].Blend(m_destTransforms[i], m_weight);
+        }
+
+        TransformStreams streams;
+        TransformStreams destStreams;
+        streams.Gather(m_sourceTransforms.data(), m_numTransforms);
+        destStreams.Gather(m_destTransforms.data(), m_numTransforms);
+        streams.Blend(destStreams, m_weight);
+
+        AZStd::vector<Transform> actual(m_numTransforms);
+        streams.Scatter(actual.data());
+        CompareTransforms(actual, expected);
+    }
+
+    TEST_P(PoseBlendKernelsTests, TransformStreamsApplyAdditive)
+    {
+        AZStd::vector<Transform> expected = m_sourceTransforms;
+        for (size_t i = 0; i < m_numTransforms; ++i)
+        {
+            ApplyAdditiveReference(expected[i], m_destTransforms[i], m_weight);
+        }
+
+        TransformStreams streams;
+        TransformStreams additiveStreams;
+        streams.Gather(m_sourceTransforms.data(), m_numTransforms);
+        additiveStreams.Gather(m_destTransforms.data(), m_numTransforms);
+        streams.ApplyAdditive(additiveStreams, m_weight);
+
+        AZStd::vector<Transform> actual(m_numTransforms);
+        streams.Scatter(actual.data());
+        CompareTransforms(actual, expected);
+    }
+
+    INSTANTIATE_TEST_CASE_P(PoseBlendKernels, PoseBlendKernelsTests,
+        ::testing::Combine(
+            ::testing::Values(size_t{ 1 }, size_t{ 4 }, size_t{ 7 }, size_t{ 200 }),
+            ::testing::Values(0.0f, 0.1f, 0.5f, 0.75f, 1.0f)));
+} // namespace EMotionFX
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SkinningKernels.h>
+#include <MCore/Source/AzCoreConversions.h>
+#include <MCore/Source/MCoreSystem.h>
+
+namespace EMotionFX
+{
+    // Compares the per vertex and per influence skinning loops of SoftSkinDeformer and DualQuatSkinDeformer with the SIMD kernels,
+    // for a typical character mesh with up to four influences per vertex and a few hundred vertices per joint.
+    // Each iteration restores the original vertex data first, like the mesh does before running its deformers.
+    class SkinningKernelsBenchmarkFixture
+        : public benchmark::Fixture
+    {
+        static constexpr uint32 NumBones = 64;
+        static constexpr uint32 MaxInfluences = 4;
+
+        void internalSetUp(int64_t numVertices)
+        {
+            MCore::Initializer::Init();
+            EMotionFX::Initializer::Init();
+
+            const uint32 vertexCount = static_cast<uint32>(numVertices);
+            AZ::SimpleLcgRandom random;
+            m_layer = SkinningInfoVertexAttributeLayer::Create(vertexCount);
+            for (uint32 v = 0; v < vertexCount; ++v)
+            {
+                // Normalized weights of neighbouring bones, as exported from a DCC tool.
+                const uint32 numInfluences = 1 + random.GetRandom() % MaxInfluences;
+                const uint32 firstBone = random.GetRandom() % (NumBones - MaxInfluences);
+                for (uint32 i = 0; i < numInfluences; ++i)
+                {
+                    m_layer->AddInfluence(v, firstBone + i, 1.0f / aznumeric_cast<float>(numInfluences), firstBone + i);
+                }
+            }
+
+            m_orgVertices.resize(vertexCount);
+            m_orgPositions.resize(vertexCount);
+            m_orgNormals.resize(vertexCount);
+            m_orgTangents.resize(vertexCount);
+            m_orgBitangents.resize(vertexCount);
+            for (uint32 v = 0; v < vertexCount; ++v)
+            {
+                m_orgVertices[v] = v;
+                m_orgPositions[v] = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat());
+                m_orgNormals[v] = AZ::Vector3::CreateAxisZ();
+                m_orgTangents[v] = AZ::Vector4(1.0f, 0.0f, 0.0f, 1.0f);
+                m_orgBitangents[v] = AZ::Vector3::CreateAxisY();
+            }
+            m_positions = m_orgPositions;
+            m_normals = m_orgNormals;
+            m_tangents = m_orgTangents;
+            m_bitangents = m_orgBitangents;
+
+            m_boneMatrices.resize(NumBones);
+            m_boneDualQuats.resize(NumBones);
+            for (uint32 i = 0; i < NumBones; ++i)
+            {
+                const AZ::Vector3 axis = AZ::Vector3(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat() + 0.1f).GetNormalized();
+                const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(axis, random.GetRandomFloat() * AZ::Constants::TwoPi);
+                const AZ::Vector3 translation(random.GetRandomFloat(), random.GetRandomFloat(), random.GetRandomFloat());
+                m_boneMatrices[i] = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(rotation, translation);
+                m_boneDualQuats[i].FromRotationTranslation(rotation, translation);
+            }
+
+            m_batches.Init(m_orgVertices.data(), vertexCount, m_layer);
+        }
+
+        void internalTearDown()
+        {
+            m_layer->Destroy();
+            m_layer = nullptr;
+            m_batches.Clear();
+            m_orgVertices = {};
+            m_orgPositions = {};
+            m_orgNormals = {};
+            m_orgTangents = {};
+            m_orgBitangents = {};
+            m_positions = {};
+            m_normals = {};
+            m_tangents = {};
+            m_bitangents = {};
+            m_boneMatrices = {};
+            m_boneDualQuats = {};
+
+            EMotionFX::Initializer::Shutdown();
+            MCore::Initializer::Shutdown();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void ResetVertices()
+        {
+            AZStd::copy(m_orgPositions.begin(), m_orgPositions.end(), m_positions.begin());
+            AZStd::copy(m_orgNormals.begin(), m_orgNormals.end(), m_normals.begin());
+            AZStd::copy(m_orgTangents.begin(), m_orgTangents.end(), m_tangents.begin());
+            AZStd::copy(m_orgBitangents.begin(), m_orgBitangents.end(), m_bitangents.begin());
+        }
+
+        SkinningKernels::VertexStreams GetVertexStreams()
+        {
+            SkinningKernels::VertexStreams streams;
+            streams.m_positions = m_positions.data();
+            streams.m_normals = m_normals.data();
+            streams.m_tangents = m_tangents.data();
+            streams.m_bitangents = m_bitangents.data();
+            return streams;
+        }
+
+        SkinningInfoVertexAttributeLayer* m_layer = nullptr;
+        SkinningBatches m_batches;
+        AZStd::vector<uint32> m_orgVertices;
+        AZStd::vector<AZ::Vector3> m_orgPositions;
+        AZStd::vector<AZ::Vector3> m_orgNormals;
+        AZStd::vector<AZ::Vector4> m_orgTangents;
+        AZStd::vector<AZ::Vector3> m_orgBitangents;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        AZStd::vector<AZ::Vector4> m_tangents;
+        AZStd::vector<AZ::Vector3> m_bitangents;
+        AZStd::vector<AZ::Matrix3x4> m_boneMatrices;
+        AZStd::vector<MCore::DualQuaternion> m_boneDualQuats;
+    };
+
+    BENCHMARK_DEFINE_F(SkinningKernelsBenchmarkFixture, SkinLinearPerVertex)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ResetVertices();
+            const size_t numVertices = m_orgVertices.size();
+            for (size_t v = 0; v < numVertices; ++v)
+            {
+                AZ::Vector3 newPos = AZ::Vector3::CreateZero();
+                AZ::Vector3 newNormal = AZ::Vector3::CreateZero();
+                AZ::Vector4 newTangent = AZ::Vector4::CreateZero();
+                AZ::Vector3 newBitangent = AZ::Vector3::CreateZero();
+                const uint32 orgVertex = m_orgVertices[v];
+                const size_t numInfluences = m_layer->GetNumInfluences(orgVertex);
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    const SkinInfluence* influence = m_layer->GetInfluence(orgVertex, i);
+                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &m_positions[v], &m_normals[v], &m_tangents[v], &m_bitangents[v], &newPos, &newNormal, &newTangent, &newBitangent, influence->GetWeight());
+                }
+                newTangent.SetW(m_tangents[v].GetW());
+
+                m_positions[v] = newPos;
+                m_normals[v] = newNormal;
+                m_tangents[v] = newTangent;
+                m_bitangents[v] = newBitangent;
+            }
+            benchmark::DoNotOptimize(m_positions.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(SkinningKernelsBenchmarkFixture, SkinLinearKernel)(benchmark::State& state)
+    {
+        const SkinningKernels::VertexStreams streams = GetVertexStreams();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ResetVertices();
+            SkinningKernels::SkinLinear(m_batches, 0, m_batches.GetNumBlocks(), m_boneMatrices.data(), streams);
+            benchmark::DoNotOptimize(m_positions.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(SkinningKernelsBenchmarkFixture, SkinDualQuatPerVertex)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ResetVertices();
+            const size_t numVertices = m_orgVertices.size();
+            for (size_t v = 0; v < numVertices; ++v)
+            {
+                const uint32 orgVertex = m_orgVertices[v];
+                const size_t numInfluences = m_layer->GetNumInfluences(orgVertex);
+                const MCore::DualQuaternion& pivotQuat = m_boneDualQuats[m_layer->GetInfluence(orgVertex, 0)->GetBoneNr()];
+                MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    const SkinInfluence* influence = m_layer->GetInfluence(orgVertex, i);
+                    MCore::DualQuaternion influenceQuat = m_boneDualQuats[influence->GetBoneNr()];
+                    if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
+                    {
+                        influenceQuat *= -1.0f;
+                    }
+                    skinQuat += influenceQuat * influence->GetWeight();
+                }
+                skinQuat.Normalize();
+
+                m_positions[v] = skinQuat.TransformPoint(m_positions[v]);
+                m_normals[v] = skinQuat.TransformVector(m_normals[v]);
+                m_tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(skinQuat.TransformVector(m_tangents[v].GetAsVector3()), m_tangents[v].GetW());
+                m_bitangents[v] = skinQuat.TransformVector(m_bitangents[v]);
+            }
+            benchmark::DoNotOptimize(m_positions.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_DEFINE_F(SkinningKernelsBenchmarkFixture, SkinDualQuatKernel)(benchmark::State& state)
+    {
+        const SkinningKernels::VertexStreams streams = GetVertexStreams();
+        for ([[maybe_unused]] auto _ : state)
+        {
+            ResetVertices();
+            SkinningKernels::SkinDualQuat(m_batches, 0, m_batches.GetNumBlocks(), m_boneDualQuats.data(), streams);
+            benchmark::DoNotOptimize(m_positions.data());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(SkinningKernelsBenchmarkFixture, SkinLinearPerVertex)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SkinningKernelsBenchmarkFixture, SkinLinearKernel)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SkinningKernelsBenchmarkFixture, SkinDualQuatPerVertex)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SkinningKernelsBenchmarkFixture, SkinDualQuatKernel)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+} // namespace EMotionFX
+
+#endif // HAVE_BENCHMARK
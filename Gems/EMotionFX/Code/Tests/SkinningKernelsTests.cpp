@@ -0,0 +1,458 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/DualQuatSkinDeformer.h>
+#include <EMotionFX/Source/Mesh.h>
+#include <EMotionFX/Source/MeshDeformerStack.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/SkinningInfoVertexAttributeLayer.h>
+#include <EMotionFX/Source/SkinningKernels.h>
+#include <EMotionFX/Source/SoftSkinDeformer.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <MCore/Source/AzCoreConversions.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/MeshFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class SkinningKernelsFixture
+        : public SystemComponentFixture
+    {
+    public:
+        static constexpr uint32 NumBones = 6;
+        static constexpr uint32 MaxInfluences = 4;
+
+        void TearDown() override
+        {
+            if (m_layer)
+            {
+                m_layer->Destroy();
+                m_layer = nullptr;
+            }
+
+            SystemComponentFixture::TearDown();
+        }
+
+        // Creates random vertices, where every other render vertex shares its original vertex with the previous one.
+        // The number of influences is random, including vertices without any influence.
+        void CreateMesh(uint32 numVertices)
+        {
+            AZ::SimpleLcgRandom random(numVertices);
+            const uint32 numOrgVertices = (numVertices + 1) / 2;
+            m_layer = SkinningInfoVertexAttributeLayer::Create(numOrgVertices);
+            for (uint32 orgVertex = 0; orgVertex < numOrgVertices; ++orgVertex)
+            {
+                const uint32 numInfluences = random.GetRandom() % (MaxInfluences + 1);
+                for (uint32 i = 0; i < numInfluences; ++i)
+                {
+                    const uint32 boneNr = random.GetRandom() % NumBones;
+                    m_layer->AddInfluence(orgVertex, boneNr, 0.1f + random.GetRandomFloat(), boneNr);
+                }
+            }
+
+            m_orgVertices.resize(numVertices);
+            m_positions.resize(numVertices);
+            m_normals.resize(numVertices);
+            m_tangents.resize(numVertices);
+            m_bitangents.resize(numVertices);
+            for (uint32 v = 0; v < numVertices; ++v)
+            {
+                m_orgVertices[v] = v / 2;
+                m_positions[v] = CreateRandomVector(random) * 10.0f;
+                m_normals[v] = CreateRandomVector(random).GetNormalizedSafe();
+                m_tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(CreateRandomVector(random).GetNormalizedSafe(), random.GetRandomFloat() < 0.5f ? -1.0f : 1.0f);
+                m_bitangents[v] = CreateRandomVector(random).GetNormalizedSafe();
+            }
+
+            m_boneMatrices.resize(NumBones);
+            m_boneDualQuats.resize(NumBones);
+            for (uint32 i = 0; i < NumBones; ++i)
+            {
+                AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(CreateRandomVector(random).GetNormalizedSafe(), random.GetRandomFloat() * AZ::Constants::TwoPi);
+                if (random.GetRandomFloat() < 0.5f)
+                {
+                    // Make sure the shortest path check of the dual quaternion skinning gets tested.
+                    rotation = -rotation;
+                }
+                const AZ::Vector3 translation = CreateRandomVector(random) * 5.0f;
+                m_boneMatrices[i] = AZ::Matrix3x4::CreateFromQuaternionAndTranslation(rotation, translation);
+                m_boneDualQuats[i].FromRotationTranslation(rotation, translation);
+            }
+
+            m_batches.Init(m_orgVertices.data(), numVertices, m_layer);
+        }
+
+        static AZ::Vector3 CreateRandomVector(AZ::SimpleLcgRandom& random)
+        {
+            return AZ::Vector3(random.GetRandomFloat() * 2.0f - 1.0f, random.GetRandomFloat() * 2.0f - 1.0f, random.GetRandomFloat() * 2.0f - 1.0f);
+        }
+
+        // The per vertex linear blend skinning that the SIMD kernels replace.
+        void SkinLinearReference(AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const
+        {
+            for (size_t v = 0; v < m_orgVertices.size(); ++v)
+            {
+                AZ::Vector3 newPos = AZ::Vector3::CreateZero();
+                AZ::Vector3 newNormal = AZ::Vector3::CreateZero();
+                AZ::Vector4 newTangent = AZ::Vector4::CreateZero();
+                AZ::Vector3 newBitangent = AZ::Vector3::CreateZero();
+                const uint32 orgVertex = m_orgVertices[v];
+                for (size_t i = 0; i < m_layer->GetNumInfluences(orgVertex); ++i)
+                {
+                    const SkinInfluence* influence = m_layer->GetInfluence(orgVertex, i);
+                    MCore::Skin(m_boneMatrices[influence->GetBoneNr()], &positions[v], &normals[v], &tangents[v], &bitangents[v], &newPos, &newNormal, &newTangent, &newBitangent, influence->GetWeight());
+                }
+                newTangent.SetW(tangents[v].GetW());
+
+                positions[v] = newPos;
+                normals[v] = newNormal;
+                tangents[v] = newTangent;
+                bitangents[v] = newBitangent;
+            }
+        }
+
+        // The per vertex dual quaternion skinning that the SIMD kernels replace.
+        void SkinDualQuatReference(AZ::Vector3* positions, AZ::Vector3* normals, AZ::Vector4* tangents, AZ::Vector3* bitangents) const
+        {
+            for (size_t v = 0; v < m_orgVertices.size(); ++v)
+            {
+                const uint32 orgVertex = m_orgVertices[v];
+                const size_t numInfluences = m_layer->GetNumInfluences(orgVertex);
+                if (numInfluences == 0)
+                {
+                    continue;
+                }
+
+                const MCore::DualQuaternion& pivotQuat = m_boneDualQuats[m_layer->GetInfluence(orgVertex, 0)->GetBoneNr()];
+                MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
+                for (size_t i = 0; i < numInfluences; ++i)
+                {
+                    const SkinInfluence* influence = m_layer->GetInfluence(orgVertex, i);
+                    MCore::DualQuaternion influenceQuat = m_boneDualQuats[influence->GetBoneNr()];
+                    if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
+                    {
+                        influenceQuat *= -1.0f;
+                    }
+                    skinQuat += influenceQuat * influence->GetWeight();
+                }
+                skinQuat.Normalize();
+
+                positions[v] = skinQuat.TransformPoint(positions[v]);
+                normals[v] = skinQuat.TransformVector(normals[v]);
+                tangents[v] = AZ::Vector4::CreateFromVector3AndFloat(skinQuat.TransformVector(tangents[v].GetAsVector3()), tangents[v].GetW());
+                bitangents[v] = skinQuat.TransformVector(bitangents[v]);
+            }
+        }
+
+        template <typename VectorType>
+        static void CompareVectors(const AZStd::vector<VectorType>& actual, const AZStd::vector<VectorType>& expected, const char* name)
+        {
+            ASSERT_EQ(actual.size(), expected.size());
+            const float tolerance = 1e-3f;
+            for (size_t i = 0; i < actual.size(); ++i)
+            {
+                EXPECT_TRUE(actual[i].IsClose(expected[i], tolerance)) << name << " of vertex " << i << " differs.";
+            }
+        }
+
+    protected:
+        SkinningInfoVertexAttributeLayer* m_layer = nullptr;
+        SkinningBatches m_batches;
+        AZStd::vector<uint32> m_orgVertices;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        AZStd::vector<AZ::Vector4> m_tangents;
+        AZStd::vector<AZ::Vector3> m_bitangents;
+        AZStd::vector<AZ::Matrix3x4> m_boneMatrices;
+        AZStd::vector<MCore::DualQuaternion> m_boneDualQuats;
+    };
+
+    TEST_F(SkinningKernelsFixture, BatchesAreSortedByInfluenceCount)
+    {
+        CreateMesh(101);
+
+        EXPECT_EQ(m_batches.GetNumVertices(), 101u);
+        AZStd::vector<uint32> numVisits(101, 0);
+        uint32 lastNumInfluences = 0;
+        for (size_t blockIndex = 0; blockIndex < m_batches.GetNumBlocks(); ++blockIndex)
+        {
+            const SkinningBatches::Block& block = m_batches.GetBlock(blockIndex);
+            ASSERT_GE(block.m_numVertices, 1u);
+            ASSERT_LE(block.m_numVertices, 4u);
+            EXPECT_GE(block.m_numInfluences, lastNumInfluences);
+            lastNumInfluences = block.m_numInfluences;
+
+            const uint16* boneIndices = m_batches.GetBoneIndices(block);
+            const float* weights = m_batches.GetWeights(block);
+            for (uint32 lane = 0; lane < 4; ++lane)
+            {
+                const uint32 vertex = block.m_vertices[lane];
+                EXPECT_EQ(m_layer->GetNumInfluences(m_orgVertices[vertex]), block.m_numInfluences);
+                for (uint32 i = 0; i < block.m_numInfluences; ++i)
+                {
+                    const SkinInfluence* influence = m_layer->GetInfluence(m_orgVertices[vertex], i);
+                    EXPECT_EQ(boneIndices[i * 4 + lane], influence->GetBoneNr());
+                    EXPECT_FLOAT_EQ(weights[i * 4 + lane], influence->GetWeight());
+                }
+
+                if (lane < block.m_numVertices)
+                {
+                    numVisits[vertex]++;
+                }
+                else
+                {
+                    EXPECT_EQ(vertex, block.m_vertices[block.m_numVertices - 1]) << "Unused lanes should repeat the last vertex.";
+                }
+            }
+        }
+
+        for (uint32 v = 0; v < 101; ++v)
+        {
+            EXPECT_EQ(numVisits[v], 1u) << "Vertex " << v << " should be in exactly one block.";
+        }
+    }
+
+    TEST_F(SkinningKernelsFixture, SkinLinearMatchesReference)
+    {
+        for (uint32 numVertices : { 1u, 7u, 64u, 333u })
+        {
+            CreateMesh(numVertices);
+
+            AZStd::vector<AZ::Vector3> expectedPositions = m_positions;
+            AZStd::vector<AZ::Vector3> expectedNormals = m_normals;
+            AZStd::vector<AZ::Vector4> expectedTangents = m_tangents;
+            AZStd::vector<AZ::Vector3> expectedBitangents = m_bitangents;
+            SkinLinearReference(expectedPositions.data(), expectedNormals.data(), expectedTangents.data(), expectedBitangents.data());
+
+            // Skin in two ranges, the way the deformer splits the blocks into batches.
+            SkinningKernels::VertexStreams streams;
+            streams.m_positions = m_positions.data();
+            streams.m_normals = m_normals.data();
+            streams.m_tangents = m_tangents.data();
+            streams.m_bitangents = m_bitangents.data();
+            const size_t numBlocks = m_batches.GetNumBlocks();
+            SkinningKernels::SkinLinear(m_batches, 0, numBlocks / 2, m_boneMatrices.data(), streams);
+            SkinningKernels::SkinLinear(m_batches, numBlocks / 2, numBlocks, m_boneMatrices.data(), streams);
+
+            CompareVectors(m_positions, expectedPositions, "Position");
+            CompareVectors(m_normals, expectedNormals, "Normal");
+            CompareVectors(m_tangents, expectedTangents, "Tangent");
+            CompareVectors(m_bitangents, expectedBitangents, "Bitangent");
+
+            m_layer->Destroy();
+            m_layer = nullptr;
+        }
+    }
+
+    TEST_F(SkinningKernelsFixture, SkinDualQuatMatchesReference)
+    {
+        for (uint32 numVertices : { 1u, 7u, 64u, 333u })
+        {
+            CreateMesh(numVertices);
+
+            AZStd::vector<AZ::Vector3> expectedPositions = m_positions;
+            AZStd::vector<AZ::Vector3> expectedNormals = m_normals;
+            AZStd::vector<AZ::Vector4> expectedTangents = m_tangents;
+            AZStd::vector<AZ::Vector3> expectedBitangents = m_bitangents;
+            SkinDualQuatReference(expectedPositions.data(), expectedNormals.data(), expectedTangents.data(), expectedBitangents.data());
+
+            SkinningKernels::VertexStreams streams;
+            streams.m_positions = m_positions.data();
+            streams.m_normals = m_normals.data();
+            streams.m_tangents = m_tangents.data();
+            streams.m_bitangents = m_bitangents.data();
+            SkinningKernels::SkinDualQuat(m_batches, 0, m_batches.GetNumBlocks(), m_boneDualQuats.data(), streams);
+
+            CompareVectors(m_positions, expectedPositions, "Position");
+            CompareVectors(m_normals, expectedNormals, "Normal");
+            CompareVectors(m_tangents, expectedTangents, "Tangent");
+            CompareVectors(m_bitangents, expectedBitangents, "Bitangent");
+
+            m_layer->Destroy();
+            m_layer = nullptr;
+        }
+    }
+
+    TEST_F(SkinningKernelsFixture, OptionalStreamsAreNotTouched)
+    {
+        CreateMesh(33);
+        const AZStd::vector<AZ::Vector3> bitangents = m_bitangents;
+
+        // Bitangents without tangents are not skinned, the same as in the deformers.
+        SkinningKernels::VertexStreams streams;
+        streams.m_positions = m_positions.data();
+        streams.m_normals = m_normals.data();
+        streams.m_bitangents = m_bitangents.data();
+        SkinningKernels::SkinLinear(m_batches, 0, m_batches.GetNumBlocks(), m_boneMatrices.data(), streams);
+        SkinningKernels::SkinDualQuat(m_batches, 0, m_batches.GetNumBlocks(), m_boneDualQuats.data(), streams);
+
+        for (size_t i = 0; i < bitangents.size(); ++i)
+        {
+            EXPECT_TRUE(m_bitangents[i] == bitangents[i]) << "Bitangent of vertex " << i << " should not be skinned.";
+        }
+    }
+
+    // Skins a mesh on a posed actor instance with the deformers, which pick up the bones, sort the influences into batches and
+    // split larger meshes into jobs.
+    class SkinDeformerFixture
+        : public SkinningKernelsFixture
+        , public ::testing::WithParamInterface<uint32>
+    {
+    public:
+        static constexpr size_t NumJoints = 5;
+
+        void SetUp() override
+        {
+            SkinningKernelsFixture::SetUp();
+
+            // Every vertex except the last one is influenced by up to four random joints.
+            const uint32 numVertices = GetParam();
+            AZ::SimpleLcgRandom random(numVertices);
+            AZStd::vector<AZ::u32> indices(numVertices);
+            AZStd::vector<AZ::Vector3> positions(numVertices);
+            AZStd::vector<AZ::Vector3> normals(numVertices);
+            AZStd::vector<MeshFactory::VertexSkinInfluences> influences(numVertices);
+            for (uint32 v = 0; v < numVertices; ++v)
+            {
+                indices[v] = v;
+                positions[v] = CreateRandomVector(random) * 10.0f;
+                normals[v] = CreateRandomVector(random).GetNormalizedSafe();
+                const uint32 numInfluences = (v + 1 == numVertices) ? 0 : 1 + random.GetRandom() % MaxInfluences;
+                for (uint32 i = 0; i < numInfluences; ++i)
+                {
+                    influences[v].emplace_back(random.GetRandom() % NumJoints, 0.1f + random.GetRandomFloat());
+                }
+            }
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(NumJoints);
+            m_mesh = MeshFactory::Create(indices, positions, normals, {}, influences);
+            m_actor->SetMesh(0, 0, m_mesh);
+            m_actor->SetMeshDeformerStack(0, 0, MeshDeformerStack::Create(m_mesh));
+
+            m_actorInstance = ActorInstance::Create(m_actor.get());
+            Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+            for (size_t j = 0; j < NumJoints; ++j)
+            {
+                const AZ::Quaternion rotation = AZ::Quaternion::CreateFromAxisAngle(CreateRandomVector(random).GetNormalizedSafe(), random.GetRandomFloat() * AZ::Constants::TwoPi);
+                pose->SetLocalSpaceTransform(j, Transform(CreateRandomVector(random), rotation));
+            }
+            m_actorInstance->UpdateSkinningMatrices();
+
+            m_positions.assign(positions.begin(), positions.end());
+            m_normals.assign(normals.begin(), normals.end());
+        }
+
+        void TearDown() override
+        {
+            m_actorInstance->Destroy();
+            m_actor.reset();
+
+            SkinningKernelsFixture::TearDown();
+        }
+
+        void UpdateDeformer(MeshDeformer* deformer)
+        {
+            m_actor->GetMeshDeformerStack(0, 0)->AddDeformer(deformer);
+            Node* node = m_actor->GetSkeleton()->GetNode(0);
+            deformer->Reinitialize(m_actor.get(), node, /*lodLevel=*/0, static_cast<uint16>(NumJoints - 1));
+            deformer->Update(m_actorInstance, node, 0.0f);
+        }
+
+        SkinningInfoVertexAttributeLayer* GetSkinningLayer() const
+        {
+            return static_cast<SkinningInfoVertexAttributeLayer*>(m_mesh->FindSharedVertexAttributeLayer(SkinningInfoVertexAttributeLayer::TYPE_ID));
+        }
+
+        AZStd::vector<AZ::Vector3> GetMeshData(uint32 attributeType) const
+        {
+            const AZ::Vector3* data = static_cast<const AZ::Vector3*>(m_mesh->FindVertexData(attributeType));
+            return AZStd::vector<AZ::Vector3>(data, data + m_mesh->GetNumVertices());
+        }
+
+    protected:
+        AZStd::unique_ptr<Actor> m_actor;
+        ActorInstance* m_actorInstance = nullptr;
+        Mesh* m_mesh = nullptr;
+    };
+
+    TEST_P(SkinDeformerFixture, SoftSkinUpdateMatchesReference)
+    {
+        const AZ::Matrix3x4* skinningMatrices = m_actorInstance->GetTransformData()->GetSkinningMatrices();
+        SkinningInfoVertexAttributeLayer* layer = GetSkinningLayer();
+        AZStd::vector<AZ::Vector3> expectedPositions(m_positions.size(), AZ::Vector3::CreateZero());
+        AZStd::vector<AZ::Vector3> expectedNormals(m_normals.size(), AZ::Vector3::CreateZero());
+        for (size_t v = 0; v < m_positions.size(); ++v)
+        {
+            for (size_t i = 0; i < layer->GetNumInfluences(v); ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(v, i);
+                MCore::Skin(skinningMatrices[influence->GetNodeNr()], &m_positions[v], &m_normals[v], &expectedPositions[v], &expectedNormals[v], influence->GetWeight());
+            }
+        }
+
+        UpdateDeformer(SoftSkinDeformer::Create(m_mesh));
+
+        CompareVectors(GetMeshData(Mesh::ATTRIB_POSITIONS), expectedPositions, "Position");
+        CompareVectors(GetMeshData(Mesh::ATTRIB_NORMALS), expectedNormals, "Normal");
+    }
+
+    TEST_P(SkinDeformerFixture, DualQuatSkinUpdateMatchesReference)
+    {
+        const Pose* pose = m_actorInstance->GetTransformData()->GetCurrentPose();
+        AZStd::vector<MCore::DualQuaternion> jointDualQuats(NumJoints);
+        for (size_t j = 0; j < NumJoints; ++j)
+        {
+            const Transform skinTransform = m_actor->GetInverseBindPoseTransform(j) * pose->GetModelSpaceTransform(j);
+            jointDualQuats[j].FromRotationTranslation(skinTransform.m_rotation, skinTransform.m_position);
+        }
+
+        SkinningInfoVertexAttributeLayer* layer = GetSkinningLayer();
+        AZStd::vector<AZ::Vector3> expectedPositions = m_positions;
+        AZStd::vector<AZ::Vector3> expectedNormals = m_normals;
+        for (size_t v = 0; v < m_positions.size(); ++v)
+        {
+            const size_t numInfluences = layer->GetNumInfluences(v);
+            if (numInfluences == 0)
+            {
+                continue;
+            }
+
+            const MCore::DualQuaternion& pivotQuat = jointDualQuats[layer->GetInfluence(v, 0)->GetNodeNr()];
+            MCore::DualQuaternion skinQuat(AZ::Quaternion(0, 0, 0, 0), AZ::Quaternion(0, 0, 0, 0));
+            for (size_t i = 0; i < numInfluences; ++i)
+            {
+                const SkinInfluence* influence = layer->GetInfluence(v, i);
+                MCore::DualQuaternion influenceQuat = jointDualQuats[influence->GetNodeNr()];
+                if (influenceQuat.m_real.Dot(pivotQuat.m_real) < 0.0f)
+                {
+                    influenceQuat *= -1.0f;
+                }
+                skinQuat += influenceQuat * influence->GetWeight();
+            }
+            skinQuat.Normalize();
+
+            expectedPositions[v] = skinQuat.TransformPoint(m_positions[v]);
+            expectedNormals[v] = skinQuat.TransformVector(m_normals[v]);
+        }
+
+        UpdateDeformer(DualQuatSkinDeformer::Create(m_mesh));
+
+        CompareVectors(GetMeshData(Mesh::ATTRIB_POSITIONS), expectedPositions, "Position");
+        CompareVectors(GetMeshData(Mesh::ATTRIB_NORMALS), expectedNormals, "Normal");
+    }
+
+    // The larger mesh is split into several batches that are skinned in parallel.
+    INSTANTIATE_TEST_CASE_P(SkinDeformer, SkinDeformerFixture, ::testing::Values(39u, 30003u));
+} // namespace EMotionFX
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/parallel/thread.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/MultiThreadScheduler.h>
+#include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
+#include <MCore/Source/MCoreSystem.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/JackActor.h>
+
+namespace EMotionFX
+{
+    // Compares the frame cost of the actor update schedulers for increasing numbers of lightweight actor instances, where the
+    // dispatch overhead per actor instance is most visible.
+    class TaskGraphSchedulerBenchmarkFixture
+        : public benchmark::Fixture
+    {
+        class TaskGraphActive
+            : public AZ::TaskGraphActiveInterface
+        {
+        public:
+            bool IsTaskGraphActive() const override
+            {
+                return true;
+            }
+        };
+
+        void internalSetUp()
+        {
+            AZ::JobManagerDesc jobManagerDesc;
+            for (AZ::u32 i = 0; i < AZStd::thread::hardware_concurrency(); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_jobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_jobContext = AZStd::make_unique<AZ::JobContext>(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext.get());
+
+            m_taskExecutor = AZStd::make_unique<AZ::TaskExecutor>();
+            AZ::TaskExecutor::SetInstance(m_taskExecutor.get());
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Register(&m_taskGraphActive);
+
+            MCore::Initializer::Init();
+            EMotionFX::Initializer::Init();
+        }
+
+        void internalTearDown()
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+
+            EMotionFX::Initializer::Shutdown();
+            MCore::Initializer::Shutdown();
+
+            AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(&m_taskGraphActive);
+            AZ::TaskExecutor::SetInstance(nullptr);
+            m_taskExecutor.reset();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            m_jobContext.reset();
+            m_jobManager.reset();
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void UpdateActorInstances(benchmark::State& state, ActorUpdateScheduler* scheduler)
+        {
+            // The scheduler has to be set before creating the actor instances, as these insert themselves into it.
+            GetEMotionFX().GetActorManager()->SetScheduler(scheduler);
+
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+            const size_t numActorInstances = static_cast<size_t>(state.range(0));
+            m_actorInstances.reserve(numActorInstances);
+            for (size_t i = 0; i < numActorInstances; ++i)
+            {
+                ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+                actorInstance->SetIsVisible(true);
+                m_actorInstances.emplace_back(actorInstance);
+            }
+
+            // Run one frame up front, so that the task graph compilation is not part of the measurements.
+            const float timeDelta = 1.0f / 60.0f;
+            scheduler->Execute(timeDelta);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                scheduler->Execute(timeDelta);
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        AZStd::unique_ptr<AZ::JobManager> m_jobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_jobContext;
+        AZStd::unique_ptr<AZ::TaskExecutor> m_taskExecutor;
+        TaskGraphActive m_taskGraphActive;
+        AZStd::unique_ptr<JackNoMeshesActor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    BENCHMARK_DEFINE_F(TaskGraphSchedulerBenchmarkFixture, SingleThreadScheduler)(benchmark::State& state)
+    {
+        UpdateActorInstances(state, SingleThreadScheduler::Create());
+    }
+
+    BENCHMARK_DEFINE_F(TaskGraphSchedulerBenchmarkFixture, MultiThreadScheduler)(benchmark::State& state)
+    {
+        UpdateActorInstances(state, MultiThreadScheduler::Create());
+    }
+
+    BENCHMARK_DEFINE_F(TaskGraphSchedulerBenchmarkFixture, TaskGraphScheduler)(benchmark::State& state)
+    {
+        UpdateActorInstances(state, TaskGraphScheduler::Create());
+    }
+
+    BENCHMARK_REGISTER_F(TaskGraphSchedulerBenchmarkFixture, SingleThreadScheduler)->Arg(10)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(TaskGraphSchedulerBenchmarkFixture, MultiThreadScheduler)->Arg(10)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(TaskGraphSchedulerBenchmarkFixture, TaskGraphScheduler)->Arg(10)->Arg(100)->Arg(500)->Arg(2000)->Unit(benchmark::kMicrosecond);
+} // namespace EMotionFX
+
+#endif // HAVE_BENCHMARK
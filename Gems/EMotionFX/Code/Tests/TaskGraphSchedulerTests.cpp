@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/AttachmentNode.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/TaskGraphScheduler.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    class TaskGraphSchedulerFixture
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_scheduler = TaskGraphScheduler::Create();
+            GetEMotionFX().GetActorManager()->SetScheduler(m_scheduler);
+            m_actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        }
+
+        void TearDown() override
+        {
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_actorInstances.clear();
+            m_actor.reset();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        ActorInstance* CreateActorInstance()
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(m_actor.get());
+            m_actorInstances.emplace_back(actorInstance);
+            return actorInstance;
+        }
+
+    protected:
+        TaskGraphScheduler* m_scheduler = nullptr;
+        AZStd::unique_ptr<JackNoMeshesActor> m_actor;
+        AZStd::vector<ActorInstance*> m_actorInstances;
+    };
+
+    TEST_F(TaskGraphSchedulerFixture, ChunksGroupActorInstancesByCost)
+    {
+        for (size_t i = 0; i < 10; ++i)
+        {
+            CreateActorInstance();
+        }
+
+        // Close a chunk after every two actor instances.
+        const size_t numJoints = m_actor->GetNumNodes();
+        m_scheduler->SetChunkCost(numJoints * 2);
+        m_scheduler->Execute(1.0f / 60.0f);
+
+        EXPECT_EQ(m_scheduler->GetNumLevels(), 1u);
+        EXPECT_EQ(m_scheduler->GetNumActorInstancesInLevel(0), 10u);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 10u);
+
+        const AZStd::vector<TaskGraphScheduler::Chunk>& chunks = m_scheduler->GetChunks();
+        ASSERT_EQ(chunks.size(), 5u);
+        const size_t numThreads = GetEMotionFX().GetNumThreads();
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            EXPECT_EQ(chunks[i].m_numActorInstances, 2u);
+            EXPECT_EQ(chunks[i].m_firstActorInstance, i * 2);
+            EXPECT_EQ(chunks[i].m_threadIndex, i % numThreads);
+        }
+
+        // Actor instances with more joints than the chunk cost get a chunk of their own.
+        m_scheduler->SetChunkCost(1);
+        m_scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetChunks().size(), 10u);
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, AttachmentsAreUpdatedInLaterLevels)
+    {
+        ActorInstance* root = CreateActorInstance();
+        ActorInstance* attachment = CreateActorInstance();
+        ActorInstance* attachmentOfAttachment = CreateActorInstance();
+        attachment->AddAttachment(AttachmentNode::Create(attachment, 0, attachmentOfAttachment));
+        root->AddAttachment(AttachmentNode::Create(root, 0, attachment));
+
+        m_scheduler->Execute(1.0f / 60.0f);
+        ASSERT_EQ(m_scheduler->GetNumLevels(), 3u);
+        EXPECT_EQ(m_scheduler->GetNumActorInstancesInLevel(0), 1u);
+        EXPECT_EQ(m_scheduler->GetNumActorInstancesInLevel(1), 1u);
+        EXPECT_EQ(m_scheduler->GetNumActorInstancesInLevel(2), 1u);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 3u);
+
+        const AZStd::vector<TaskGraphScheduler::Chunk>& chunks = m_scheduler->GetChunks();
+        ASSERT_EQ(chunks.size(), 3u);
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            EXPECT_EQ(chunks[i].m_level, i);
+        }
+
+        // Removing the attachments makes them roots again.
+        root->RemoveAttachment(attachment);
+        attachment->RemoveAttachment(attachmentOfAttachment);
+        m_scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumLevels(), 1u);
+        EXPECT_EQ(m_scheduler->GetNumActorInstancesInLevel(0), 3u);
+    }
+
+    TEST_F(TaskGraphSchedulerFixture, RemovedActorInstancesAreNotUpdated)
+    {
+        CreateActorInstance();
+        CreateActorInstance();
+        m_scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 2u);
+
+        m_actorInstances.back()->Destroy();
+        m_actorInstances.pop_back();
+        m_scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 1u);
+
+        // Disabled actor instances stay in the schedule, but are skipped.
+        m_actorInstances[0]->SetIsEnabled(false);
+        m_scheduler->Execute(1.0f / 60.0f);
+        EXPECT_EQ(m_scheduler->GetNumUpdatedActorInstances(), 0u);
+        EXPECT_EQ(m_scheduler->GetNumActorInstancesInLevel(0), 1u);
+    }
+} // namespace EMotionFX
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/ActorManager.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/SingleThreadScheduler.h>
+#include <EMotionFX/Source/UpdateRateLod.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/JackActor.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+
+namespace EMotionFX
+{
+    static UpdateRateLodSettings CreateEnabledUpdateRateLodSettings()
+    {
+        UpdateRateLodSettings settings;
+        settings.m_enabled = true;
+        return settings;
+    }
+
+    TEST_F(SystemComponentFixture, UpdateRateLod_CalcLevel)
+    {
+        UpdateRateLod updateRateLod;
+        updateRateLod.SetSettings(CreateEnabledUpdateRateLodSettings());
+
+        EXPECT_EQ(updateRateLod.CalcLevel(0.0f), 0u);
+        EXPECT_EQ(updateRateLod.CalcLevel(14.9f), 0u);
+        EXPECT_EQ(updateRateLod.CalcLevel(15.0f), 1u);
+        EXPECT_EQ(updateRateLod.CalcLevel(59.0f), 2u);
+        EXPECT_EQ(updateRateLod.CalcLevel(119.0f), 3u);
+        EXPECT_EQ(updateRateLod.CalcLevel(10000.0f), 3u) << "Distances beyond the last level should use the last level.";
+    }
+
+    TEST_F(SystemComponentFixture, UpdateRateLod_DisabledAlwaysUpdates)
+    {
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+
+        UpdateRateLod updateRateLod;
+        updateRateLod.SetViewPosition(AZ::Vector3(1000.0f, 0.0f, 0.0f));
+        for (AZ::u32 frame = 0; frame < 16; ++frame)
+        {
+            updateRateLod.BeginFrame();
+            const UpdateRateLod::Result result = updateRateLod.Evaluate(actorInstance);
+            EXPECT_TRUE(result.m_update);
+            EXPECT_EQ(result.m_updateInterval, 1u);
+            EXPECT_EQ(updateRateLod.GetNumSkippedActorInstances(), 0u);
+        }
+
+        actorInstance->Destroy();
+    }
+
+    TEST_F(SystemComponentFixture, UpdateRateLod_UpdatesOncePerInterval)
+    {
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+        actorInstance->SetIsVisible(true);
+
+        UpdateRateLod updateRateLod;
+        updateRateLod.SetSettings(CreateEnabledUpdateRateLodSettings());
+        updateRateLod.SetViewPosition(AZ::Vector3(45.0f, 0.0f, 0.0f));
+
+        AZ::u32 numUpdates = 0;
+        float lastWeight = -1.0f;
+        for (AZ::u32 frame = 0; frame < 4; ++frame)
+        {
+            updateRateLod.BeginFrame();
+            const UpdateRateLod::Result result = updateRateLod.Evaluate(actorInstance);
+            EXPECT_EQ(result.m_level, 2u);
+            EXPECT_EQ(result.m_updateInterval, 4u);
+            EXPECT_EQ(updateRateLod.GetNumActorInstancesInLevel(2), 1u);
+            if (result.m_update)
+            {
+                numUpdates++;
+                EXPECT_FLOAT_EQ(result.m_interpolationWeight, 0.0f);
+            }
+            else
+            {
+                EXPECT_EQ(updateRateLod.GetNumSkippedActorInstances(), 1u);
+                EXPECT_GT(result.m_interpolationWeight, 0.0f);
+                EXPECT_LT(result.m_interpolationWeight, 1.0f);
+                if (lastWeight >= 0.0f)
+                {
+                    EXPECT_GT(result.m_interpolationWeight, lastWeight) << "The interpolation weight should progress towards the next update.";
+                }
+            }
+            lastWeight = result.m_interpolationWeight;
+        }
+        EXPECT_EQ(numUpdates, 1u) << "Expected exactly one update within the update interval.";
+
+        // A higher importance should pull the actor instance into a closer level.
+        actorInstance->SetUpdateRateLodImportance(4.0f);
+        updateRateLod.BeginFrame();
+        EXPECT_EQ(updateRateLod.Evaluate(actorInstance).m_level, 0u);
+
+        // Invisible actor instances should be updated at most at the invisible update rate.
+        actorInstance->SetIsVisible(false);
+        updateRateLod.BeginFrame();
+        EXPECT_EQ(updateRateLod.Evaluate(actorInstance).m_updateInterval, 8u);
+
+        actorInstance->Destroy();
+    }
+
+    TEST_F(SystemComponentFixture, UpdateRateLod_StaggersActorInstances)
+    {
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        AZStd::vector<ActorInstance*> actorInstances;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+            actorInstance->SetID(aznumeric_cast<uint32>(i));
+            actorInstance->SetIsVisible(true);
+            actorInstances.emplace_back(actorInstance);
+        }
+
+        UpdateRateLod updateRateLod;
+        updateRateLod.SetSettings(CreateEnabledUpdateRateLodSettings());
+        updateRateLod.SetViewPosition(AZ::Vector3(45.0f, 0.0f, 0.0f));
+
+        // Eight actor instances with consecutive ids and an update interval of four frames update two at a time.
+        for (AZ::u32 frame = 0; frame < 4; ++frame)
+        {
+            updateRateLod.BeginFrame();
+            size_t numUpdates = 0;
+            for (const ActorInstance* actorInstance : actorInstances)
+            {
+                numUpdates += updateRateLod.Evaluate(actorInstance).m_update ? 1 : 0;
+            }
+            EXPECT_EQ(numUpdates, 2u);
+            EXPECT_EQ(updateRateLod.GetNumSkippedActorInstances(), 6u);
+        }
+
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+    }
+
+    TEST_F(SystemComponentFixture, UpdateRateLod_SingleThreadSchedulerOnlySamplesOnUpdates)
+    {
+        SingleThreadScheduler* scheduler = SingleThreadScheduler::Create();
+        GetEMotionFX().GetActorManager()->SetScheduler(scheduler);
+        scheduler->GetUpdateRateLod().SetSettings(CreateEnabledUpdateRateLodSettings());
+        scheduler->GetUpdateRateLod().SetViewPosition(AZ::Vector3(45.0f, 0.0f, 0.0f));
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        ActorInstance* actorInstance = ActorInstance::Create(actor.get());
+        actorInstance->SetIsVisible(true);
+        actorInstance->SetMotionSamplingRate(1.0f);
+
+        // The actor instance is updated once every four frames, and the sampling timer only advances on those updates, by the
+        // time of all the frames since the previous update.
+        constexpr float timeDelta = 1.0f / 60.0f;
+        AZ::u32 numUpdates = 0;
+        for (AZ::u32 frame = 0; frame < 8; ++frame)
+        {
+            const float samplingTimer = actorInstance->GetMotionSamplingTimer();
+            scheduler->Execute(timeDelta);
+
+            EXPECT_EQ(scheduler->GetNumVisibleActorInstances(), 1u);
+            EXPECT_EQ(scheduler->GetNumSampledActorInstances(), 0u);
+            if (scheduler->GetNumUpdatedActorInstances() == 1)
+            {
+                EXPECT_GT(actorInstance->GetMotionSamplingTimer(), samplingTimer);
+                numUpdates++;
+            }
+            else
+            {
+                EXPECT_FLOAT_EQ(actorInstance->GetMotionSamplingTimer(), samplingTimer) << "Skipped frames shouldn't advance the sampling timer.";
+            }
+        }
+        EXPECT_EQ(numUpdates, 2u);
+        EXPECT_LE(actorInstance->GetMotionSamplingTimer(), timeDelta * 8.0f + AZ::Constants::Tolerance);
+
+        actorInstance->Destroy();
+    }
+} // namespace EMotionFX
@@ -78,6 +78,8 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedMotionDataBenchmarks.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -97,6 +99,8 @@ set(FILES
     Tests/MotionInstanceTests.cpp
     Tests/MotionLayerSystemTests.cpp
     Tests/MultiThreadSchedulerTests.cpp
+    Tests/PoseBlendBenchmarks.cpp
+    Tests/PoseBlendKernelsTests.cpp
     Tests/PoseTests.cpp
     Tests/Printers.cpp
     Tests/QuaternionParameterTests.cpp
@@ -109,10 +113,15 @@ set(FILES
     Tests/SimulatedObjectSerializeTests.cpp
     Tests/SkeletalLODTests.cpp
     Tests/SkeletonNodeSearchTests.cpp
+    Tests/SkinningKernelsBenchmarks.cpp
+    Tests/SkinningKernelsTests.cpp
     Tests/SyncingSystemTests.cpp
     Tests/SystemComponentFixture.h
     Tests/SystemComponentTests.cpp
+    Tests/TaskGraphSchedulerBenchmarks.cpp
+    Tests/TaskGraphSchedulerTests.cpp
     Tests/TransformUnitTests.cpp
+    Tests/UpdateRateLodTests.cpp
     Tests/Vector2ToVector3CompatibilityTests.cpp
     Tests/Vector3ParameterTests.cpp
     Tests/PhysicsSetupUtils.h
@@ -67,6 +67,7 @@ namespace GradientSignal
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
         void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const override;
+        bool CompileGradient(GradientProgramBuilder& builder) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
     protected:
@@ -15,6 +15,8 @@
 
 namespace GradientSignal
 {
+    class GradientProgramBuilder;
+
     struct GradientSampleParams final
     {
         AZ_CLASS_ALLOCATOR(GradientSampleParams, AZ::SystemAllocator);
@@ -75,6 +77,15 @@ namespace GradientSignal
             }
         }
 
+        /**
+         * Appends the operations that compute this gradient's values to a gradient program that's being compiled, so that
+         * the gradient can be evaluated without dispatching through this bus. Gradients that return false get sampled through
+         * GetValues() by the program instead, so this must only return false if nothing was added to the builder.
+         * \param builder The builder of the program, which writes the output of this gradient to its current output register.
+         * \return True if the gradient was compiled into the program, false if it should be sampled through GetValues().
+         */
+        virtual bool CompileGradient([[maybe_unused]] GradientProgramBuilder& builder) const { return false; }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Matrix3x4.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace GradientSignal
+{
+    class GradientSampler;
+    class MixedGradientLayer;
+    class PosterizeGradientConfig;
+    class SmoothStep;
+
+    /**
+     * A gradient hierarchy flattened into a linear list of operations that run over a whole batch of positions at a time.
+     * Each operation reads and writes a value register (one float per position) or a position register, so evaluating the
+     * program doesn't dispatch through GradientRequestBus or allocate intermediate buffers for every gradient in the hierarchy.
+     * Gradients that can't be compiled are sampled through GradientRequestBus::GetValues() as leaves of the program, so a program
+     * always produces the same values as querying the hierarchy directly.
+     */
+    class GradientProgram final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(GradientProgram, AZ::SystemAllocator);
+
+        using Register = AZ::u16;
+
+        enum class OpCode : AZ::u8
+        {
+            Fill,               //!< Sets the target values to m_params[0].
+            Sample,             //!< Samples the gradient on m_entityId at the source positions into the target values.
+            TransformPositions, //!< Transforms the source positions by m_transforms[m_index] into the target positions.
+            Invert,             //!< Inverts the target values after clamping them to 0-1 (Invert Gradient).
+            InvertInput,        //!< Inverts the target values without clamping them (GradientSampler "Invert Input").
+            Levels,             //!< Applies levels to the target values (Levels Gradient).
+            SamplerLevels,      //!< Applies levels to the target values one at a time (GradientSampler "Enable Levels").
+            SmoothStep,         //!< Smooths the target values with the falloff midpoint, range and strength in m_params.
+            Threshold,          //!< Sets the target values to 0 at or below m_params[0] and to 1 above it.
+            Posterize,          //!< Quantizes the target values into m_params[0] bands using the posterize mode in m_mode.
+            Scale,              //!< Multiplies the target values by m_params[0].
+            Mix,                //!< Blends the source values into the target values with the mixing operation in m_mode.
+            Clamp,              //!< Clamps the target values to 0-1.
+        };
+
+        struct Instruction
+        {
+            OpCode m_opCode = OpCode::Fill;
+            AZ::u8 m_mode = 0;
+            Register m_target = 0;
+            Register m_source = 0;
+            AZ::u16 m_index = 0;
+            AZ::EntityId m_entityId;
+            AZStd::array<float, 5> m_params = {};
+        };
+
+        //! Evaluates the program for a list of positions.
+        //! \param positions The input list of positions to query.
+        //! \param outValues The output list of values. This list is expected to be the same size as the positions list.
+        void GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const;
+
+        AZStd::span<const Instruction> GetInstructions() const { return m_instructions; }
+
+        //! The entities whose gradients were flattened into the program.
+        AZStd::span<const AZ::EntityId> GetCompiledEntities() const { return m_compiledEntities; }
+
+        //! The number of operations that sample a gradient through GradientRequestBus.
+        size_t GetLeafCount() const { return m_leafCount; }
+
+    private:
+        friend class GradientProgramBuilder;
+
+        AZStd::vector<Instruction> m_instructions;
+        AZStd::vector<AZ::Matrix3x4> m_transforms;
+        AZStd::vector<AZ::EntityId> m_compiledEntities;
+        Register m_valueRegisterCount = 1;
+        Register m_positionRegisterCount = 1;
+        size_t m_leafCount = 0;
+    };
+
+    /**
+     * Builds a GradientProgram by walking a gradient hierarchy through GradientRequests::CompileGradient().
+     * Each gradient writes its values to the current output register, reading the current position register. The output of the
+     * root gradient is value register 0, and position register 0 holds the positions that the program is evaluated with.
+     */
+    class GradientProgramBuilder final
+    {
+    public:
+        //! Called with every entity in the hierarchy, before its gradient gets compiled.
+        using EntityVisitor = AZStd::function<void(const AZ::EntityId& entityId)>;
+
+        //! Compiles the gradient on the given entity and every gradient it references.
+        //! \return The compiled program, or nullptr if the hierarchy has a cycle or the root gradient can't be compiled.
+        static AZStd::shared_ptr<const GradientProgram> Compile(const AZ::EntityId& gradientId, const EntityVisitor& visitor = {});
+
+        //! Compiles a referenced gradient, including the sampler's transform, invert, levels and opacity settings, into the
+        //! current output register.
+        void AddSampler(const GradientSampler& sampler);
+
+        //! Adds the operations that process the values in the current output register.
+        void AddInvert();
+        void AddLevels(float inputMid, float inputMin, float inputMax, float outputMin, float outputMax);
+        void AddSmoothStep(const SmoothStep& smoothStep);
+        void AddThreshold(float threshold);
+        void AddPosterize(const PosterizeGradientConfig& config);
+
+        //! Compiles the layers of a Mixed Gradient and blends them together into the current output register.
+        void AddMixedLayers(const AZStd::vector<MixedGradientLayer>& layers);
+
+    private:
+        explicit GradientProgramBuilder(const EntityVisitor& visitor);
+
+        void AddEntity(const AZ::EntityId& entityId);
+        GradientProgram::Instruction& AddInstruction(GradientProgram::OpCode opCode);
+
+        GradientProgram::Register AllocateValueRegister();
+        void ReleaseValueRegister();
+
+        AZStd::shared_ptr<GradientProgram> m_program;
+        const EntityVisitor& m_visitor;
+        AZStd::vector<AZ::EntityId> m_entityStack;
+        GradientProgram::Register m_output = 0;
+        GradientProgram::Register m_positions = 0;
+        GradientProgram::Register m_nextValueRegister = 1;
+        bool m_failed = false;
+    };
+
+    /**
+     * Caches the compiled programs of the gradients that get queried through a GradientSampler, and recompiles them
+     * whenever one of the gradients in their hierarchy notifies that its composition changed.
+     */
+    class GradientProgramRequests
+    {
+    public:
+        AZ_RTTI(GradientProgramRequests, "{1887B44B-CB6D-4130-AAA3-AB6FB5561A85}");
+
+        virtual ~GradientProgramRequests() = default;
+
+        //! Get the compiled program for the gradient on the given entity, compiling it if needed.
+        //! \return The compiled program, or nullptr if the gradient should be queried through GradientRequestBus instead.
+        virtual AZStd::shared_ptr<const GradientProgram> GetProgram(const AZ::EntityId& gradientId) = 0;
+    };
+} // namespace GradientSignal
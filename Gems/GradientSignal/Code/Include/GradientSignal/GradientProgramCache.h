@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <GradientSignal/GradientProgram.h>
+#include <LmbrCentral/Dependency/DependencyNotificationBus.h>
+
+namespace GradientSignal
+{
+    /**
+     * The GradientProgramRequests implementation, which keeps one compiled program per queried gradient entity.
+     * Instead of connecting to the buses of every entity in a hierarchy (which would have to happen on whichever thread is
+     * querying the gradient), the cache routes every DependencyNotificationBus and EntityBus event once, and drops any program
+     * whose hierarchy contains the entity that the event was sent to.
+     */
+    class GradientProgramCache final
+        : public GradientProgramRequests
+        , private LmbrCentral::DependencyNotificationBus::Router
+        , private AZ::EntityBus::Router
+    {
+    public:
+        AZ_RTTI(GradientProgramCache, "{0F1E2B5A-6D0C-4B7E-9A43-1C8F5E2D7B69}", GradientProgramRequests);
+        AZ_CLASS_ALLOCATOR(GradientProgramCache, AZ::SystemAllocator);
+
+        GradientProgramCache() = default;
+        ~GradientProgramCache() override;
+
+        //! Registers the cache as the GradientProgramRequests interface and starts listening for changes to the gradients.
+        void Activate();
+        void Deactivate();
+
+        //! Drops every compiled program.
+        void Clear();
+
+        //////////////////////////////////////////////////////////////////////////
+        // GradientProgramRequests
+        AZStd::shared_ptr<const GradientProgram> GetProgram(const AZ::EntityId& gradientId) override;
+
+    private:
+        //////////////////////////////////////////////////////////////////////////
+        // DependencyNotificationBus
+        void OnCompositionChanged() override;
+        void OnCompositionRegionChanged(const AZ::Aabb& dirtyRegion) override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // EntityBus
+        void OnEntityActivated(const AZ::EntityId& entityId) override;
+        void OnEntityDeactivated(const AZ::EntityId& entityId) override;
+
+        void InvalidateEntity(const AZ::EntityId& entityId);
+
+        struct CachedProgram
+        {
+            //! The compiled program, or nullptr if the gradient is queried through GradientRequestBus.
+            AZStd::shared_ptr<const GradientProgram> m_program;
+            //! Every entity that was visited while compiling the program.
+            AZStd::vector<AZ::EntityId> m_entities;
+        };
+
+        mutable AZStd::shared_mutex m_cacheMutex;
+        AZStd::unordered_map<AZ::EntityId, CachedProgram> m_programs;
+        //! Incremented by every invalidation, so that programs that were compiled while their hierarchy changed don't get cached.
+        AZ::u64 m_invalidationCount = 0;
+        bool m_active = false;
+    };
+} // namespace GradientSignal
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/RTTI/ReflectContext.h>
@@ -18,6 +19,7 @@
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Util.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 
@@ -63,6 +65,8 @@ namespace GradientSignal
         bool ValidateGradientEntityId();
 
     private:
+        friend class GradientProgramBuilder;
+
         AZ::Matrix3x4 GetTransformMatrix() const;
 
         // Pass-through for UIElement attribute
@@ -193,9 +197,19 @@ namespace GradientSignal
             }
             else
             {
-                GradientRequestBus::Event(
-                    m_gradientId, &GradientRequestBus::Events::GetValues, useTransformedPositions ? transformedPositions : positions,
-                    outValues);
+                // Evaluate the whole hierarchy at once if it has been compiled, instead of querying each gradient in it.
+                auto* programRequests = AZ::Interface<GradientProgramRequests>::Get();
+                auto program = programRequests ? programRequests->GetProgram(m_gradientId) : nullptr;
+                if (program)
+                {
+                    program->GetValues(useTransformedPositions ? transformedPositions : positions, outValues);
+                }
+                else
+                {
+                    GradientRequestBus::Event(
+                        m_gradientId, &GradientRequestBus::Events::GetValues,
+                        useTransformedPositions ? transformedPositions : positions, outValues);
+                }
             }
         }
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/std/containers/span.h>
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -37,6 +38,15 @@ namespace GradientSignal
         */
         float GenerateOctaveNoise(float x, float y, float z, int octaves, float persistence, float initialFrequency = 1.0f);
 
+        /**
+        * Creates Perlin 'natural' noise factor values for a list of positions, four positions at a time with SIMD math.
+        * Produces the same values as calling the single position version for each position.
+        * The output list is expected to be the same size as the positions list.
+        */
+        void GenerateOctaveNoise(
+            AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence,
+            float initialFrequency = 1.0f) const;
+
         /**
         * Creates a Perlin noise factor value based on a position
         */
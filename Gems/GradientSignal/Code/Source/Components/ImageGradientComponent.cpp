@@ -13,6 +13,7 @@
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -21,6 +22,61 @@
 
 namespace GradientSignal
 {
+    namespace ImageGradientSimd
+    {
+        using AZ::Simd::Vec4;
+
+        constexpr size_t Width = 4;
+
+        // The filters below match the scalar ones in ImageGradientComponent::GetValueForSamplingType(), operation for operation.
+        // The samples are laid out the same way as the values from Get4x4Neighborhood(), as [x * 4 + y][lane].
+
+        Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType t)
+        {
+            return Vec4::Add(a, Vec4::Mul(Vec4::Sub(b, a), t));
+        }
+
+        Vec4::FloatType CubicInterpolate(
+            Vec4::FloatArgType p0, Vec4::FloatArgType p1, Vec4::FloatArgType p2, Vec4::FloatArgType p3, Vec4::FloatArgType delta)
+        {
+            // p1 + 0.5f * delta * (p2 - p0 + delta * (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3 + delta * (3.0f * (p1 - p2) + p3 - p0)))
+            const Vec4::FloatType innerTerm = Vec4::Sub(Vec4::Add(Vec4::Mul(Vec4::Splat(3.0f), Vec4::Sub(p1, p2)), p3), p0);
+            const Vec4::FloatType middleTerm = Vec4::Add(
+                Vec4::Sub(
+                    Vec4::Add(Vec4::Sub(Vec4::Mul(Vec4::Splat(2.0f), p0), Vec4::Mul(Vec4::Splat(5.0f), p1)), Vec4::Mul(Vec4::Splat(4.0f), p2)),
+                    p3),
+                Vec4::Mul(delta, innerTerm));
+            const Vec4::FloatType outerTerm = Vec4::Add(Vec4::Sub(p2, p0), Vec4::Mul(delta, middleTerm));
+            return Vec4::Add(p1, Vec4::Mul(Vec4::Mul(Vec4::Splat(0.5f), delta), outerTerm));
+        }
+
+        Vec4::FloatType Bilinear(const float (&samples)[16][Width], Vec4::FloatArgType pixelX, Vec4::FloatArgType pixelY)
+        {
+            // Bilinear samples are stored as X0Y0, X1Y0, X0Y1, X1Y1.
+            const Vec4::FloatType deltaX = Vec4::Sub(pixelX, Vec4::Floor(pixelX));
+            const Vec4::FloatType deltaY = Vec4::Sub(pixelY, Vec4::Floor(pixelY));
+            const Vec4::FloatType valueXY0 = Lerp(Vec4::LoadAligned(samples[0]), Vec4::LoadAligned(samples[1]), deltaX);
+            const Vec4::FloatType valueXY1 = Lerp(Vec4::LoadAligned(samples[2]), Vec4::LoadAligned(samples[3]), deltaX);
+            return Lerp(valueXY0, valueXY1, deltaY);
+        }
+
+        Vec4::FloatType Bicubic(const float (&samples)[16][Width], Vec4::FloatArgType pixelX, Vec4::FloatArgType pixelY)
+        {
+            const Vec4::FloatType deltaX = Vec4::Sub(pixelX, Vec4::Floor(pixelX));
+            const Vec4::FloatType deltaY = Vec4::Sub(pixelY, Vec4::Floor(pixelY));
+
+            Vec4::FloatType rows[4];
+            for (size_t y = 0; y < 4; ++y)
+            {
+                rows[y] = CubicInterpolate(
+                    Vec4::LoadAligned(samples[0 * 4 + y]), Vec4::LoadAligned(samples[1 * 4 + y]), Vec4::LoadAligned(samples[2 * 4 + y]),
+                    Vec4::LoadAligned(samples[3 * 4 + y]), deltaX);
+            }
+
+            return CubicInterpolate(rows[0], rows[1], rows[2], rows[3], deltaY);
+        }
+    } // namespace ImageGradientSimd
+
     AZ::JsonSerializationResult::Result JsonImageGradientConfigSerializer::Load(
         void* outputValue, [[maybe_unused]] const AZ::Uuid& outputValueTypeId,
         const rapidjson::Value& inputValue, AZ::JsonDeserializerContext& context)
@@ -862,11 +918,14 @@ namespace GradientSignal
 
     float ImageGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
     {
-        AZ::Vector3 position(sampleParams.m_position);
-        float value = 0.0f;
-        GetValuesInternal(m_currentSamplingType, AZStd::span<AZ::Vector3>(&position, 1), AZStd::span<float>(&value, 1));
+        AZStd::shared_lock lock(m_queryMutex);
 
-        return value;
+        AZ::Vector3 uvw;
+        bool wasPointRejected = false;
+        m_gradientTransform.TransformPositionToUVWNormalized(sampleParams.m_position, uvw, wasPointRejected);
+
+        // GetValueFromImageData() returns the default value if our cached image data hasn't been retrieved yet.
+        return wasPointRejected ? 0.0f : GetValueFromImageData(m_currentSamplingType, uvw, 0.0f);
     }
 
     void ImageGradientComponent::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
@@ -892,20 +951,99 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
+        const auto width = m_imageDescriptor.m_size.m_width;
+        const auto height = m_imageDescriptor.m_size.m_height;
+        if (width == 0 || height == 0)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
 
-        for (size_t index = 0; index < positions.size(); index++)
+        // This produces the same values as calling GetValueFromImageData() for each position, but processes the positions
+        // in batches of four. The pixel lookups still happen one at a time since they depend on the image format and the
+        // wrapping rules, but the filtering and the scaling into the output range run on all four values at once.
+        using ImageGradientSimd::Vec4;
+        using ImageGradientSimd::Width;
+
+        const float tiledWidth = width * GetTilingX();
+        const float tiledHeight = height * GetTilingY();
+        const Vec4::FloatType offset = Vec4::Splat(m_offset);
+        const Vec4::FloatType multiplier = Vec4::Splat(m_multiplier);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+
+        for (size_t batchStart = 0; batchStart < positions.size(); batchStart += Width)
         {
-            m_gradientTransform.TransformPositionToUVWNormalized(positions[index], uvw, wasPointRejected);
+            const size_t batchSize = AZStd::min(Width, positions.size() - batchStart);
+
+            // Every unused or rejected lane samples zeros, and gets skipped or cleared when the results are written out.
+            alignas(16) float pixelX[Width] = {};
+            alignas(16) float pixelY[Width] = {};
+            alignas(16) float samples[16][Width] = {};
+            bool wasPointRejected[Width] = { true, true, true, true };
+
+            for (size_t lane = 0; lane < batchSize; ++lane)
+            {
+                AZ::Vector3 uvw;
+                m_gradientTransform.TransformPositionToUVWNormalized(positions[batchStart + lane], uvw, wasPointRejected[lane]);
+                if (wasPointRejected[lane])
+                {
+                    continue;
+                }
+
+                // See GetValueFromImageData() for how uvs map to pixels.
+                pixelX[lane] = uvw.GetX() * tiledWidth;
+                pixelY[lane] = uvw.GetY() * tiledHeight;
+                const auto x = aznumeric_cast<AZ::u32>(pixelX[lane]) % width;
+                const auto y = aznumeric_cast<AZ::u32>(pixelY[lane]) % height;
 
-            if (!wasPointRejected)
+                switch (samplingType)
+                {
+                case SamplingType::Point:
+                default:
+                    samples[0][lane] = InvertYAndGetPixelValue(x, y);
+                    break;
+                case SamplingType::Bilinear:
+                    samples[0][lane] = GetClampedValue(x, y);
+                    samples[1][lane] = GetClampedValue(x + 1, y);
+                    samples[2][lane] = GetClampedValue(x, y + 1);
+                    samples[3][lane] = GetClampedValue(x + 1, y + 1);
+                    break;
+                case SamplingType::Bicubic:
+                {
+                    AZStd::array<AZStd::array<float, 4>, 4> values;
+                    Get4x4Neighborhood(x, y, values);
+                    for (size_t sampleIndex = 0; sampleIndex < 16; ++sampleIndex)
+                    {
+                        samples[sampleIndex][lane] = values[sampleIndex / 4][sampleIndex % 4];
+                    }
+                    break;
+                }
+                }
+            }
+
+            Vec4::FloatType value;
+            switch (samplingType)
             {
-                outValues[index] = GetValueFromImageData(samplingType, uvw, 0.0f);
+            case SamplingType::Point:
+            default:
+                value = Vec4::LoadAligned(samples[0]);
+                break;
+            case SamplingType::Bilinear:
+                value = ImageGradientSimd::Bilinear(samples, Vec4::LoadAligned(pixelX), Vec4::LoadAligned(pixelY));
+                break;
+            case SamplingType::Bicubic:
+                value = ImageGradientSimd::Bicubic(samples, Vec4::LoadAligned(pixelX), Vec4::LoadAligned(pixelY));
+                break;
             }
-            else
+
+            // Scale (inverse lerp) the value into a 0 - 1 range, the same way GetValueFromImageData() does.
+            alignas(16) float results[Width];
+            Vec4::StoreAligned(results, Vec4::Clamp(Vec4::Mul(Vec4::Sub(value, offset), multiplier), zero, one));
+
+            for (size_t lane = 0; lane < batchSize; ++lane)
             {
-                outValues[index] = 0.0f;
+                outValues[batchStart + lane] = wasPointRejected[lane] ? 0.0f : results[lane];
             }
         }
     }
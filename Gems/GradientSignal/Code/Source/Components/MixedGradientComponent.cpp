@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -366,6 +367,14 @@ namespace GradientSignal
 
 
 
+    bool MixedGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddMixedLayers(m_configuration.m_layers);
+        return true;
+    }
+
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         for (const auto& layer : m_configuration.m_layers)
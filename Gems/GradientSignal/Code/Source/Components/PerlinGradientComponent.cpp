@@ -215,24 +215,40 @@ namespace GradientSignal
             return;
         }
 
-        AZ::Vector3 uvw;
-        bool wasPointRejected = false;
-
         AZStd::shared_lock lock(m_queryMutex);
 
-        for (size_t index = 0; index < positions.size(); index++)
+        if (!m_perlinImprovedNoise)
         {
-            m_gradientTransform.TransformPositionToUVW(positions[index], uvw, wasPointRejected);
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
 
-            if (!wasPointRejected)
+        // Transform the positions in fixed-size chunks so that the noise can be generated for a whole chunk at a time with the
+        // SIMD version of GenerateOctaveNoise(), without allocating a buffer for the uvw values.
+        constexpr size_t ChunkSize = 256;
+        AZStd::array<AZ::Vector3, ChunkSize> uvws;
+        AZStd::array<bool, ChunkSize> wasPointRejected;
+
+        for (size_t chunkStart = 0; chunkStart < positions.size(); chunkStart += ChunkSize)
+        {
+            const size_t chunkSize = AZStd::min(ChunkSize, positions.size() - chunkStart);
+
+            for (size_t index = 0; index < chunkSize; index++)
             {
-                outValues[index] = m_perlinImprovedNoise->GenerateOctaveNoise(
-                    uvw.GetX(), uvw.GetY(), uvw.GetZ(), m_configuration.m_octave, m_configuration.m_amplitude,
-                    m_configuration.m_frequency);
+                m_gradientTransform.TransformPositionToUVW(positions[chunkStart + index], uvws[index], wasPointRejected[index]);
             }
-            else
+
+            AZStd::span<float> chunkValues = outValues.subspan(chunkStart, chunkSize);
+            m_perlinImprovedNoise->GenerateOctaveNoise(
+                AZStd::span<const AZ::Vector3>(uvws.data(), chunkSize), chunkValues, m_configuration.m_octave,
+                m_configuration.m_amplitude, m_configuration.m_frequency);
+
+            for (size_t index = 0; index < chunkSize; index++)
             {
-                outValues[index] = 0.0f;
+                if (wasPointRejected[index])
+                {
+                    chunkValues[index] = 0.0f;
+                }
             }
         }
     }
@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -183,6 +184,15 @@ namespace GradientSignal
         }
     }
 
+    bool PosterizeGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddSampler(m_configuration.m_gradientSampler);
+        builder.AddPosterize(m_configuration);
+        return true;
+    }
+
     bool PosterizeGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
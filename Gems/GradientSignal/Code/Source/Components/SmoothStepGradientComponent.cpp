@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Util.h>
 
@@ -192,6 +193,15 @@ namespace GradientSignal
         m_configuration.m_smoothStep.GetSmoothedValues(outValues);
     }
 
+    bool SmoothStepGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddSampler(m_configuration.m_gradientSampler);
+        builder.AddSmoothStep(m_configuration.m_smoothStep);
+        return true;
+    }
+
     bool SmoothStepGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
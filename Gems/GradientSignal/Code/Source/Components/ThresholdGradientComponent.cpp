@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <GradientSignal/GradientProgram.h>
 
 namespace GradientSignal
 {
@@ -164,6 +165,15 @@ namespace GradientSignal
         }
     }
 
+    bool ThresholdGradientComponent::CompileGradient(GradientProgramBuilder& builder) const
+    {
+        AZStd::shared_lock lock(m_queryMutex);
+
+        builder.AddSampler(m_configuration.m_gradientSampler);
+        builder.AddThreshold(m_configuration.m_threshold);
+        return true;
+    }
+
     bool ThresholdGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientProgram.h>
+#include <GradientSignal/GradientSampler.h>
+#include <GradientSignal/SmoothStep.h>
+#include <GradientSignal/Util.h>
+#include <GradientSignal/Components/MixedGradientComponent.h>
+#include <GradientSignal/Components/PosterizeGradientComponent.h>
+#include <GradientSignal/Ebuses/GradientRequestBus.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace GradientSignal
+{
+    namespace GradientProgramKernels
+    {
+        using AZ::Simd::Vec4;
+
+        // Every value register is padded to a multiple of the SIMD width, so the kernels never need a scalar tail loop.
+        constexpr size_t Width = 4;
+
+        template<typename Kernel>
+        void ForEach(float* values, size_t paddedCount, Kernel&& kernel)
+        {
+            for (size_t index = 0; index < paddedCount; index += Width)
+            {
+                Vec4::StoreUnaligned(&values[index], kernel(Vec4::LoadUnaligned(&values[index])));
+            }
+        }
+
+        // Matches GradientSignal::GetRatio(). The a == b case is resolved when the kernel is set up, since a and b are constants.
+        Vec4::FloatType Ratio(float a, float b, Vec4::FloatArgType t)
+        {
+            if (a == b)
+            {
+                return Vec4::Select(Vec4::ZeroFloat(), Vec4::Splat(1.0f), Vec4::CmpLtEq(t, Vec4::Splat(a)));
+            }
+
+            return Vec4::Clamp(Vec4::Div(Vec4::Sub(t, Vec4::Splat(a)), Vec4::Splat(b - a)), Vec4::ZeroFloat(), Vec4::Splat(1.0f));
+        }
+
+        // Matches GradientSignal::GetSmoothStep().
+        Vec4::FloatType SmoothStepCurve(Vec4::FloatArgType t)
+        {
+            return Vec4::Mul(Vec4::Mul(t, t), Vec4::Sub(Vec4::Splat(3.0f), Vec4::Mul(Vec4::Splat(2.0f), t)));
+        }
+
+        void InvertValues(float* values, size_t paddedCount)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            ForEach(values, paddedCount, [&](Vec4::FloatArgType value)
+            {
+                return Vec4::Sub(one, Vec4::Clamp(value, zero, one));
+            });
+        }
+
+        void InvertInputValues(float* values, size_t paddedCount)
+        {
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            ForEach(values, paddedCount, [&](Vec4::FloatArgType value)
+            {
+                return Vec4::Sub(one, value);
+            });
+        }
+
+        void ScaleValues(float* values, size_t paddedCount, float scale)
+        {
+            const Vec4::FloatType scaleVec = Vec4::Splat(scale);
+            ForEach(values, paddedCount, [&](Vec4::FloatArgType value)
+            {
+                return Vec4::Mul(value, scaleVec);
+            });
+        }
+
+        void ClampValues(float* values, size_t paddedCount)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            ForEach(values, paddedCount, [&](Vec4::FloatArgType value)
+            {
+                return Vec4::Clamp(value, zero, one);
+            });
+        }
+
+        void ThresholdValues(float* values, size_t paddedCount, float threshold)
+        {
+            const Vec4::FloatType thresholdVec = Vec4::Splat(threshold);
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            ForEach(values, paddedCount, [&](Vec4::FloatArgType value)
+            {
+                return Vec4::Select(zero, one, Vec4::CmpLtEq(value, thresholdVec));
+            });
+        }
+
+        // Matches SmoothStep::GetSmoothedValues().
+        void SmoothStepValues(float* values, size_t paddedCount, float min, float max, float falloffStrength)
+        {
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            ForEach(values, paddedCount, [&](Vec4::FloatArgType inputValue)
+            {
+                const Vec4::FloatType value = Vec4::Clamp(inputValue, zero, one);
+                const Vec4::FloatType result1 = SmoothStepCurve(Ratio(min, min + falloffStrength, value));
+                const Vec4::FloatType result2 = SmoothStepCurve(Ratio(max - falloffStrength, max, value));
+                return Vec4::Mul(result1, Vec4::Sub(one, result2));
+            });
+        }
+
+        // Matches PosterizeGradientComponent::PosterizeValue().
+        void PosterizeValues(float* values, size_t paddedCount, float bands, PosterizeGradientConfig::ModeType mode)
+        {
+            // Each mode maps a band to (band + offset) / divisor.
+            float offset = 0.0f;
+            float divisor = bands;
+            switch (mode)
+            {
+            default:
+            case PosterizeGradientConfig::ModeType::Floor:
+                break;
+            case PosterizeGradientConfig::ModeType::Round:
+                offset = 0.5f;
+                break;
+            case PosterizeGradientConfig::ModeType::Ceiling:
+                offset = 1.0f;
+                break;
+            case PosterizeGradientConfig::ModeType::Ps:
+                divisor = bands - 1.0f;
+                break;
+            }
+
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType bandsVec = Vec4::Splat(bands);
+            const Vec4::FloatType lastBand = Vec4::Splat(bands - 1.0f);
+            const Vec4::FloatType offsetVec = Vec4::Splat(offset);
+            const Vec4::FloatType divisorVec = Vec4::Splat(divisor);
+            ForEach(values, paddedCount, [&](Vec4::FloatArgType value)
+            {
+                const Vec4::FloatType band = Vec4::Min(Vec4::Floor(Vec4::Mul(Vec4::Clamp(value, zero, one), bandsVec)), lastBand);
+                return Vec4::Min(Vec4::Div(Vec4::Add(band, offsetVec), divisorVec), one);
+            });
+        }
+
+        // Matches MixedGradientComponent::PerformMixingOperation().
+        Vec4::FloatType PerformMixingOperation(
+            MixedGradientLayer::MixingOperation operation, Vec4::FloatArgType prevValue, Vec4::FloatArgType currentUnpremultiplied)
+        {
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType two = Vec4::Splat(2.0f);
+            switch (operation)
+            {
+            case MixedGradientLayer::MixingOperation::Multiply:
+                return Vec4::Mul(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Screen:
+                return Vec4::Sub(one, Vec4::Mul(Vec4::Sub(one, prevValue), Vec4::Sub(one, currentUnpremultiplied)));
+            case MixedGradientLayer::MixingOperation::Add:
+                return Vec4::Add(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Subtract:
+                return Vec4::Sub(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Min:
+                return Vec4::Min(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Max:
+                return Vec4::Max(prevValue, currentUnpremultiplied);
+            case MixedGradientLayer::MixingOperation::Average:
+                return Vec4::Div(Vec4::Add(prevValue, currentUnpremultiplied), two);
+            case MixedGradientLayer::MixingOperation::Overlay:
+                return Vec4::Select(
+                    Vec4::Sub(one, Vec4::Mul(Vec4::Mul(two, Vec4::Sub(one, prevValue)), Vec4::Sub(one, currentUnpremultiplied))),
+                    Vec4::Mul(Vec4::Mul(two, prevValue), currentUnpremultiplied),
+                    Vec4::CmpGtEq(prevValue, Vec4::Splat(0.5f)));
+            case MixedGradientLayer::MixingOperation::Initialize:
+            case MixedGradientLayer::MixingOperation::Normal:
+            default:
+                return currentUnpremultiplied;
+            }
+        }
+
+        template<MixedGradientLayer::MixingOperation Operation>
+        void MixValues(float* values, const float* layerValues, size_t paddedCount, float opacity)
+        {
+            // In the one case of "Initialize" blending, the inverse opacity is 0 so that we erase any accumulated values.
+            const Vec4::FloatType inverseOpacity = Vec4::Splat(
+                (Operation == MixedGradientLayer::MixingOperation::Initialize) ? 0.0f : (1.0f - opacity));
+            const Vec4::FloatType opacityVec = Vec4::Splat(opacity);
+            for (size_t index = 0; index < paddedCount; index += Width)
+            {
+                const Vec4::FloatType prevValue = Vec4::LoadUnaligned(&values[index]);
+                const Vec4::FloatType currentUnpremultiplied = Vec4::Div(Vec4::LoadUnaligned(&layerValues[index]), opacityVec);
+                const Vec4::FloatType operationResult = PerformMixingOperation(Operation, prevValue, currentUnpremultiplied);
+                Vec4::StoreUnaligned(
+                    &values[index], Vec4::Add(Vec4::Mul(prevValue, inverseOpacity), Vec4::Mul(operationResult, opacityVec)));
+            }
+        }
+
+        void MixValues(
+            float* values, const float* layerValues, size_t paddedCount, MixedGradientLayer::MixingOperation operation, float opacity)
+        {
+            // Dispatch once per batch so that the per-value loop doesn't branch on the operation.
+            using MixingOperation = MixedGradientLayer::MixingOperation;
+            switch (operation)
+            {
+            case MixingOperation::Initialize: MixValues<MixingOperation::Initialize>(values, layerValues, paddedCount, opacity); break;
+            case MixingOperation::Multiply: MixValues<MixingOperation::Multiply>(values, layerValues, paddedCount, opacity); break;
+            case MixingOperation::Add: MixValues<MixingOperation::Add>(values, layerValues, paddedCount, opacity); break;
+            case MixingOperation::Subtract: MixValues<MixingOperation::Subtract>(values, layerValues, paddedCount, opacity); break;
+            case MixingOperation::Min: MixValues<MixingOperation::Min>(values, layerValues, paddedCount, opacity); break;
+            case MixingOperation::Max: MixValues<MixingOperation::Max>(values, layerValues, paddedCount, opacity); break;
+            case MixingOperation::Average: MixValues<MixingOperation::Average>(values, layerValues, paddedCount, opacity); break;
+            case MixingOperation::Overlay: MixValues<MixingOperation::Overlay>(values, layerValues, paddedCount, opacity); break;
+            case MixingOperation::Screen: MixValues<MixingOperation::Screen>(values, layerValues, paddedCount, opacity); break;
+            case MixingOperation::Normal:
+            default: MixValues<MixingOperation::Normal>(values, layerValues, paddedCount, opacity); break;
+            }
+        }
+
+        // The registers of the programs that are running on this thread. Programs can run inside of each other when one of their
+        // leaves queries a gradient that samples another gradient, so every nested program gets its own frame of registers.
+        struct RegisterFrame
+        {
+            AZStd::vector<float> m_values;
+            AZStd::vector<AZ::Vector3> m_positions;
+        };
+        thread_local AZStd::vector<RegisterFrame> s_registerFrames;
+        thread_local size_t s_registerFrameDepth = 0;
+    } // namespace GradientProgramKernels
+
+    void GradientProgram::GetValues(AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        using namespace GradientProgramKernels;
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        const size_t count = positions.size();
+        const size_t paddedCount = (count + Width - 1) & ~(Width - 1);
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Grab the register frame for this nesting depth. Nested programs can grow s_registerFrames, which moves the frames but
+        // not the buffers they own, so only raw pointers to the buffers are kept below.
+        const size_t frameDepth = s_registerFrameDepth++;
+        if (s_registerFrames.size() <= frameDepth)
+        {
+            s_registerFrames.resize(frameDepth + 1);
+        }
+        RegisterFrame& frame = s_registerFrames[frameDepth];
+        frame.m_values.resize(paddedCount * m_valueRegisterCount);
+        frame.m_positions.resize(count * (m_positionRegisterCount - 1));
+        float* const valueRegisters = frame.m_values.data();
+        AZ::Vector3* const positionRegisters = frame.m_positions.data();
+
+        auto GetValueRegister = [valueRegisters, paddedCount](Register valueRegister)
+        {
+            return valueRegisters + (valueRegister * paddedCount);
+        };
+        auto GetPositionRegister = [positionRegisters, positions, count](Register positionRegister) -> const AZ::Vector3*
+        {
+            // Position register 0 is always the input positions, so it never needs to be copied.
+            return (positionRegister == 0) ? positions.data() : positionRegisters + ((positionRegister - 1) * count);
+        };
+
+        for (const Instruction& instruction : m_instructions)
+        {
+            float* target = GetValueRegister(instruction.m_target);
+            switch (instruction.m_opCode)
+            {
+            case OpCode::Fill:
+                AZStd::fill(target, target + paddedCount, instruction.m_params[0]);
+                break;
+            case OpCode::Sample:
+                // Leaves that don't have a gradient to sample produce zeros.
+                AZStd::fill(target, target + paddedCount, 0.0f);
+                GradientRequestBus::Event(
+                    instruction.m_entityId, &GradientRequestBus::Events::GetValues,
+                    AZStd::span<const AZ::Vector3>(GetPositionRegister(instruction.m_source), count), AZStd::span<float>(target, count));
+                break;
+            case OpCode::TransformPositions:
+            {
+                const AZ::Matrix3x4& transform = m_transforms[instruction.m_index];
+                const AZ::Vector3* sourcePositions = GetPositionRegister(instruction.m_source);
+                AZ::Vector3* targetPositions = const_cast<AZ::Vector3*>(GetPositionRegister(instruction.m_target));
+                for (size_t index = 0; index < count; ++index)
+                {
+                    targetPositions[index] = transform * sourcePositions[index];
+                }
+                break;
+            }
+            case OpCode::Invert:
+                InvertValues(target, paddedCount);
+                break;
+            case OpCode::InvertInput:
+                InvertInputValues(target, paddedCount);
+                break;
+            case OpCode::Levels:
+                GetLevels(
+                    AZStd::span<float>(target, count), instruction.m_params[0], instruction.m_params[1], instruction.m_params[2],
+                    instruction.m_params[3], instruction.m_params[4]);
+                break;
+            case OpCode::SamplerLevels:
+                for (size_t index = 0; index < count; ++index)
+                {
+                    target[index] = GetLevels(
+                        target[index], instruction.m_params[0], instruction.m_params[1], instruction.m_params[2], instruction.m_params[3],
+                        instruction.m_params[4]);
+                }
+                break;
+            case OpCode::SmoothStep:
+                SmoothStepValues(target, paddedCount, instruction.m_params[0], instruction.m_params[1], instruction.m_params[2]);
+                break;
+            case OpCode::Threshold:
+                ThresholdValues(target, paddedCount, instruction.m_params[0]);
+                break;
+            case OpCode::Posterize:
+                PosterizeValues(
+                    target, paddedCount, instruction.m_params[0], static_cast<PosterizeGradientConfig::ModeType>(instruction.m_mode));
+                break;
+            case OpCode::Scale:
+                ScaleValues(target, paddedCount, instruction.m_params[0]);
+                break;
+            case OpCode::Mix:
+                MixValues(target, GetValueRegister(instruction.m_source), paddedCount,
+                    static_cast<MixedGradientLayer::MixingOperation>(instruction.m_mode), instruction.m_params[0]);
+                break;
+            case OpCode::Clamp:
+                ClampValues(target, paddedCount);
+                break;
+            }
+        }
+
+        const float* result = GetValueRegister(0);
+        AZStd::copy(result, result + count, outValues.begin());
+
+        --s_registerFrameDepth;
+    }
+
+    GradientProgramBuilder::GradientProgramBuilder(const EntityVisitor& visitor)
+        : m_program(AZStd::make_shared<GradientProgram>())
+        , m_visitor(visitor)
+    {
+    }
+
+    AZStd::shared_ptr<const GradientProgram> GradientProgramBuilder::Compile(const AZ::EntityId& gradientId, const EntityVisitor& visitor)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        GradientProgramBuilder builder(visitor);
+        builder.AddEntity(gradientId);
+
+        // There's nothing to gain from a program that only samples the root gradient through the bus.
+        if (builder.m_failed || builder.m_program->m_compiledEntities.empty())
+        {
+            return {};
+        }
+
+        builder.m_program->m_valueRegisterCount = builder.m_nextValueRegister;
+        return builder.m_program;
+    }
+
+    void GradientProgramBuilder::AddEntity(const AZ::EntityId& entityId)
+    {
+        if (AZStd::find(m_entityStack.begin(), m_entityStack.end(), entityId) != m_entityStack.end())
+        {
+            // Leave the cycle for the uncompiled queries to report.
+            m_failed = true;
+            return;
+        }
+
+        if (m_visitor)
+        {
+            m_visitor(entityId);
+        }
+
+        m_entityStack.push_back(entityId);
+        bool compiled = false;
+        GradientRequestBus::EventResult(compiled, entityId, &GradientRequestBus::Events::CompileGradient, *this);
+        m_entityStack.pop_back();
+
+        if (compiled)
+        {
+            m_program->m_compiledEntities.push_back(entityId);
+        }
+        else
+        {
+            GradientProgram::Instruction& instruction = AddInstruction(GradientProgram::OpCode::Sample);
+            instruction.m_source = m_positions;
+            instruction.m_entityId = entityId;
+            ++m_program->m_leafCount;
+        }
+    }
+
+    GradientProgram::Instruction& GradientProgramBuilder::AddInstruction(GradientProgram::OpCode opCode)
+    {
+        GradientProgram::Instruction& instruction = m_program->m_instructions.emplace_back();
+        instruction.m_opCode = opCode;
+        instruction.m_target = m_output;
+        return instruction;
+    }
+
+    GradientProgram::Register GradientProgramBuilder::AllocateValueRegister()
+    {
+        const GradientProgram::Register valueRegister = m_nextValueRegister++;
+        m_program->m_valueRegisterCount = AZStd::max(m_program->m_valueRegisterCount, m_nextValueRegister);
+        return valueRegister;
+    }
+
+    void GradientProgramBuilder::ReleaseValueRegister()
+    {
+        --m_nextValueRegister;
+    }
+
+    void GradientProgramBuilder::AddSampler(const GradientSampler& sampler)
+    {
+        // This mirrors GradientSampler::GetValues().
+        if (sampler.m_opacity <= 0.0f || !sampler.m_gradientId.IsValid())
+        {
+            AddInstruction(GradientProgram::OpCode::Fill).m_params[0] = 0.0f;
+            return;
+        }
+
+        const GradientProgram::Register inputPositions = m_positions;
+        if (sampler.m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(sampler))
+        {
+            // We use the inverse here because we're going from world space to gradient space.
+            GradientProgram::Instruction& instruction = AddInstruction(GradientProgram::OpCode::TransformPositions);
+            instruction.m_source = inputPositions;
+            instruction.m_target = m_program->m_positionRegisterCount++;
+            instruction.m_index = aznumeric_cast<AZ::u16>(m_program->m_transforms.size());
+            m_program->m_transforms.push_back(sampler.GetTransformMatrix().GetInverseFull());
+            m_positions = instruction.m_target;
+        }
+
+        AddEntity(sampler.m_gradientId);
+        m_positions = inputPositions;
+
+        if (sampler.m_invertInput)
+        {
+            AddInstruction(GradientProgram::OpCode::InvertInput);
+        }
+
+        if (sampler.m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(sampler))
+        {
+            GradientProgram::Instruction& instruction = AddInstruction(GradientProgram::OpCode::SamplerLevels);
+            instruction.m_params = { sampler.m_inputMid, sampler.m_inputMin, sampler.m_inputMax, sampler.m_outputMin, sampler.m_outputMax };
+        }
+
+        if (sampler.m_opacity != 1.0f)
+        {
+            AddInstruction(GradientProgram::OpCode::Scale).m_params[0] = sampler.m_opacity;
+        }
+    }
+
+    void GradientProgramBuilder::AddInvert()
+    {
+        AddInstruction(GradientProgram::OpCode::Invert);
+    }
+
+    void GradientProgramBuilder::AddLevels(float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    {
+        GradientProgram::Instruction& instruction = AddInstruction(GradientProgram::OpCode::Levels);
+        instruction.m_params = { inputMid, inputMin, inputMax, outputMin, outputMax };
+    }
+
+    void GradientProgramBuilder::AddSmoothStep(const SmoothStep& smoothStep)
+    {
+        // This mirrors SmoothStep::GetSmoothedValues().
+        GradientProgram::Instruction& instruction = AddInstruction(GradientProgram::OpCode::SmoothStep);
+        instruction.m_params[0] = smoothStep.m_falloffMidpoint - smoothStep.m_falloffRange / 2.0f;
+        instruction.m_params[1] = smoothStep.m_falloffMidpoint + smoothStep.m_falloffRange / 2.0f;
+        instruction.m_params[2] = AZ::GetClamp(smoothStep.m_falloffStrength, 0.0f, 1.0f);
+    }
+
+    void GradientProgramBuilder::AddThreshold(float threshold)
+    {
+        AddInstruction(GradientProgram::OpCode::Threshold).m_params[0] = threshold;
+    }
+
+    void GradientProgramBuilder::AddPosterize(const PosterizeGradientConfig& config)
+    {
+        GradientProgram::Instruction& instruction = AddInstruction(GradientProgram::OpCode::Posterize);
+        instruction.m_params[0] = AZ::GetMax(static_cast<float>(config.m_bands), 2.0f);
+        instruction.m_mode = static_cast<AZ::u8>(config.m_mode);
+    }
+
+    void GradientProgramBuilder::AddMixedLayers(const AZStd::vector<MixedGradientLayer>& layers)
+    {
+        // This mirrors MixedGradientComponent::GetValues().
+        const GradientProgram::Register output = m_output;
+        AddInstruction(GradientProgram::OpCode::Fill).m_params[0] = 0.0f;
+
+        m_output = AllocateValueRegister();
+        for (const auto& layer : layers)
+        {
+            // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                AddSampler(layer.m_gradientSampler);
+
+                GradientProgram::Instruction& instruction = AddInstruction(GradientProgram::OpCode::Mix);
+                instruction.m_target = output;
+                instruction.m_source = m_output;
+                instruction.m_mode = static_cast<AZ::u8>(layer.m_operation);
+                instruction.m_params[0] = layer.m_gradientSampler.m_opacity;
+            }
+        }
+        ReleaseValueRegister();
+        m_output = output;
+
+        AddInstruction(GradientProgram::OpCode::Clamp);
+    }
+} // namespace GradientSignal
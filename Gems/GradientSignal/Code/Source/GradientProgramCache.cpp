@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <GradientSignal/GradientProgramCache.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+
+namespace GradientSignal
+{
+    AZ_CVAR(
+        bool,
+        gradient_compilePrograms,
+        true,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Evaluates gradient hierarchies as compiled programs instead of querying every gradient in them through GradientRequestBus.");
+
+    GradientProgramCache::~GradientProgramCache()
+    {
+        Deactivate();
+    }
+
+    void GradientProgramCache::Activate()
+    {
+        if (m_active)
+        {
+            return;
+        }
+
+        m_active = true;
+        LmbrCentral::DependencyNotificationBus::Router::BusRouterConnect();
+        AZ::EntityBus::Router::BusRouterConnect();
+        AZ::Interface<GradientProgramRequests>::Register(this);
+    }
+
+    void GradientProgramCache::Deactivate()
+    {
+        if (!m_active)
+        {
+            return;
+        }
+
+        AZ::Interface<GradientProgramRequests>::Unregister(this);
+        AZ::EntityBus::Router::BusRouterDisconnect();
+        LmbrCentral::DependencyNotificationBus::Router::BusRouterDisconnect();
+        m_active = false;
+
+        Clear();
+    }
+
+    void GradientProgramCache::Clear()
+    {
+        AZStd::unique_lock lock(m_cacheMutex);
+        m_programs.clear();
+        ++m_invalidationCount;
+    }
+
+    AZStd::shared_ptr<const GradientProgram> GradientProgramCache::GetProgram(const AZ::EntityId& gradientId)
+    {
+        if (!gradient_compilePrograms)
+        {
+            return {};
+        }
+
+        AZ::u64 invalidationCount = 0;
+        {
+            AZStd::shared_lock lock(m_cacheMutex);
+            if (auto programIt = m_programs.find(gradientId); programIt != m_programs.end())
+            {
+                return programIt->second.m_program;
+            }
+            invalidationCount = m_invalidationCount;
+        }
+
+        AZ_PROFILE_SCOPE(Entity, "GradientProgramCache::GetProgram - Compile");
+
+        // Compile without holding the cache lock, since compiling queries the gradients in the hierarchy, and they can send
+        // notifications that need to lock the cache.
+        CachedProgram cachedProgram;
+        cachedProgram.m_program = GradientProgramBuilder::Compile(
+            gradientId,
+            [&cachedProgram](const AZ::EntityId& entityId)
+            {
+                cachedProgram.m_entities.push_back(entityId);
+            });
+        AZStd::sort(cachedProgram.m_entities.begin(), cachedProgram.m_entities.end());
+
+        AZStd::unique_lock lock(m_cacheMutex);
+
+        // If any gradient changed while this one was compiling, the program might be out of date already, so it only gets used
+        // for this query. The next query will compile it again.
+        if (invalidationCount == m_invalidationCount)
+        {
+            auto programIt = m_programs.emplace(gradientId, AZStd::move(cachedProgram)).first;
+            return programIt->second.m_program;
+        }
+
+        return cachedProgram.m_program;
+    }
+
+    void GradientProgramCache::OnCompositionChanged()
+    {
+        if (const AZ::EntityId* entityId = LmbrCentral::DependencyNotificationBus::GetCurrentBusId())
+        {
+            InvalidateEntity(*entityId);
+        }
+    }
+
+    void GradientProgramCache::OnCompositionRegionChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    {
+        // Programs don't keep any gradient data that depends on the region, so the whole program needs to be compiled again.
+        OnCompositionChanged();
+    }
+
+    void GradientProgramCache::OnEntityActivated(const AZ::EntityId& entityId)
+    {
+        InvalidateEntity(entityId);
+    }
+
+    void GradientProgramCache::OnEntityDeactivated(const AZ::EntityId& entityId)
+    {
+        InvalidateEntity(entityId);
+    }
+
+    void GradientProgramCache::InvalidateEntity(const AZ::EntityId& entityId)
+    {
+        AZStd::unique_lock lock(m_cacheMutex);
+        ++m_invalidationCount;
+
+        for (auto programIt = m_programs.begin(); programIt != m_programs.end();)
+        {
+            const auto& entities = programIt->second.m_entities;
+            if (AZStd::binary_search(entities.begin(), entities.end(), entityId))
+            {
+                programIt = m_programs.erase(programIt);
+            }
+            else
+            {
+                ++programIt;
+            }
+        }
+    }
+} // namespace GradientSignal
@@ -77,9 +77,11 @@ namespace GradientSignal
 
     void GradientSignalSystemComponent::Activate()
     {
+        m_programCache.Activate();
     }
 
     void GradientSignalSystemComponent::Deactivate()
     {
+        m_programCache.Deactivate();
     }
 }
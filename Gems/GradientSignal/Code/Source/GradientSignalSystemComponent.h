@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <GradientSignal/GradientProgramCache.h>
 
 namespace GradientSignal
 {
@@ -31,5 +32,8 @@ namespace GradientSignal
         void Activate() override;
         void Deactivate() override;
         ////////////////////////////////////////////////////////////////////////
+
+    private:
+        GradientProgramCache m_programCache;
     };
 }
@@ -9,6 +9,9 @@
 
 #include <GradientSignal/PerlinImprovedNoise.h>
 
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
 
@@ -60,6 +63,108 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // Four-wide versions of the functions above, used to generate noise for batches of positions.
+        // They perform the same operations in the same order, so they produce the same values as the scalar versions.
+        namespace Simd
+        {
+            using AZ::Simd::Vec4;
+
+            constexpr size_t Width = 4;
+
+            AZ_FORCE_INLINE Vec4::FloatType Gradient(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+            {
+                // Branchless form of the switch table in Gradient(): u is x for the first 8 hashes and y for the rest, v is y for
+                // the first 4 hashes, x for hashes 12 and 14, and z for the rest. Bit 0 negates u and bit 1 negates v.
+                const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+                const Vec4::FloatType uIsX = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(8)));
+                const Vec4::FloatType vIsY = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(4)));
+                const Vec4::FloatType vIsX =
+                    Vec4::CastToFloat(Vec4::Or(Vec4::CmpEq(h, Vec4::Splat(12)), Vec4::CmpEq(h, Vec4::Splat(14))));
+
+                const Vec4::FloatType u = Vec4::Select(x, y, uIsX);
+                const Vec4::FloatType v = Vec4::Select(y, Vec4::Select(x, z, vIsX), vIsY);
+
+                // Flip the sign bits instead of negating, so that the sums match the scalar ones exactly.
+                const Vec4::Int32Type signBit = Vec4::Splat(static_cast<int32_t>(0x80000000));
+                const Vec4::Int32Type one = Vec4::Splat(1);
+                const Vec4::Int32Type two = Vec4::Splat(2);
+                const Vec4::FloatType uSign = Vec4::CastToFloat(Vec4::And(signBit, Vec4::CmpEq(Vec4::And(h, one), one)));
+                const Vec4::FloatType vSign = Vec4::CastToFloat(Vec4::And(signBit, Vec4::CmpEq(Vec4::And(h, two), two)));
+
+                return Vec4::Add(Vec4::Xor(u, uSign), Vec4::Xor(v, vSign));
+            }
+
+            AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+            {
+                // t * t * t * (t * (t * 6 - 15) + 10)
+                const Vec4::FloatType inner =
+                    Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f));
+                return Vec4::Mul(Vec4::Mul(Vec4::Mul(t, t), t), inner);
+            }
+
+            AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+            {
+                return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+            }
+
+            Vec4::FloatType GenerateNoise(
+                const AZStd::array<int, 512>& p, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+            {
+                const Vec4::FloatType floorX = Vec4::Floor(x);
+                const Vec4::FloatType floorY = Vec4::Floor(y);
+                const Vec4::FloatType floorZ = Vec4::Floor(z);
+                const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+                const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+                const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+
+                const Vec4::Int32Type mask = Vec4::Splat(255);
+                alignas(16) int32_t xi0[Width];
+                alignas(16) int32_t yi0[Width];
+                alignas(16) int32_t zi0[Width];
+                Vec4::StoreAligned(xi0, Vec4::And(Vec4::ConvertToInt(floorX), mask));
+                Vec4::StoreAligned(yi0, Vec4::And(Vec4::ConvertToInt(floorY), mask));
+                Vec4::StoreAligned(zi0, Vec4::And(Vec4::ConvertToInt(floorZ), mask));
+
+                // The permutation table lookups are gathers, so they're done one lane at a time.
+                alignas(16) int32_t hashes[8][Width];
+                for (size_t lane = 0; lane < Width; ++lane)
+                {
+                    const int xa = p[xi0[lane]];
+                    const int xb = p[xi0[lane] + 1];
+                    const int yaa = p[xa + yi0[lane]];
+                    const int yab = p[xa + yi0[lane] + 1];
+                    const int yba = p[xb + yi0[lane]];
+                    const int ybb = p[xb + yi0[lane] + 1];
+                    hashes[0][lane] = p[yaa + zi0[lane]];     // aaa
+                    hashes[1][lane] = p[yba + zi0[lane]];     // baa
+                    hashes[2][lane] = p[yab + zi0[lane]];     // aba
+                    hashes[3][lane] = p[ybb + zi0[lane]];     // bba
+                    hashes[4][lane] = p[yaa + zi0[lane] + 1]; // aab
+                    hashes[5][lane] = p[yba + zi0[lane] + 1]; // bab
+                    hashes[6][lane] = p[yab + zi0[lane] + 1]; // abb
+                    hashes[7][lane] = p[ybb + zi0[lane] + 1]; // bbb
+                }
+
+                const Vec4::FloatType u = Fade(xf);
+                const Vec4::FloatType v = Fade(yf);
+                const Vec4::FloatType w = Fade(zf);
+
+                const Vec4::FloatType one = Vec4::Splat(1.0f);
+                const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+                const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+                const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+                Vec4::FloatType x1 = Lerp(Gradient(Vec4::LoadAligned(hashes[0]), xf, yf, zf), Gradient(Vec4::LoadAligned(hashes[1]), xf1, yf, zf), u);
+                Vec4::FloatType x2 = Lerp(Gradient(Vec4::LoadAligned(hashes[2]), xf, yf1, zf), Gradient(Vec4::LoadAligned(hashes[3]), xf1, yf1, zf), u);
+                const Vec4::FloatType y1 = Lerp(x1, x2, v);
+                x1 = Lerp(Gradient(Vec4::LoadAligned(hashes[4]), xf, yf, zf1), Gradient(Vec4::LoadAligned(hashes[5]), xf1, yf, zf1), u);
+                x2 = Lerp(Gradient(Vec4::LoadAligned(hashes[6]), xf, yf1, zf1), Gradient(Vec4::LoadAligned(hashes[7]), xf1, yf1, zf1), u);
+                const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+                return Vec4::Div(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(2.0f));
+            }
+        } // namespace Simd
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -92,6 +197,73 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        AZStd::span<const AZ::Vector3> positions, AZStd::span<float> outValues, int octaves, float persistence, float initialFrequency) const
+    {
+        using PerlinImprovedNoiseDetails::Simd::Vec4;
+        using PerlinImprovedNoiseDetails::Simd::Width;
+
+        if (positions.size() != outValues.size())
+        {
+            AZ_Assert(false, "input and output lists are different sizes (%zu vs %zu).", positions.size(), outValues.size());
+            return;
+        }
+
+        // The normalization factor only depends on the octave settings, so it's the same for every position.
+        float maxValue = 0.0f;
+        float octaveAmplitude = 1.0f;
+        for (int i = 0; i < octaves; ++i)
+        {
+            maxValue += octaveAmplitude;
+            octaveAmplitude *= persistence;
+        }
+
+        if (maxValue <= 0.0f)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        for (size_t batchStart = 0; batchStart < positions.size(); batchStart += Width)
+        {
+            const size_t batchSize = AZStd::min(Width, positions.size() - batchStart);
+
+            // Unused lanes in the last batch generate noise at the origin, and their results get discarded.
+            alignas(16) float x[Width] = {};
+            alignas(16) float y[Width] = {};
+            alignas(16) float z[Width] = {};
+            for (size_t lane = 0; lane < batchSize; ++lane)
+            {
+                const AZ::Vector3& position = positions[batchStart + lane];
+                x[lane] = position.GetX();
+                y[lane] = position.GetY();
+                z[lane] = position.GetZ();
+            }
+
+            const Vec4::FloatType positionX = Vec4::LoadAligned(x);
+            const Vec4::FloatType positionY = Vec4::LoadAligned(y);
+            const Vec4::FloatType positionZ = Vec4::LoadAligned(z);
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            float amplitude = 1.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType octaveFrequency = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = PerlinImprovedNoiseDetails::Simd::GenerateNoise(
+                    m_permutationTable, Vec4::Mul(positionX, octaveFrequency), Vec4::Mul(positionY, octaveFrequency),
+                    Vec4::Mul(positionZ, octaveFrequency));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            alignas(16) float results[Width];
+            Vec4::StoreAligned(results, Vec4::Div(total, Vec4::Splat(maxValue)));
+            AZStd::copy(results, results + batchSize, outValues.begin() + batchStart);
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
@@ -20,6 +20,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <GradientSignal/Components/ConstantGradientComponent.h>
 #include <GradientSignal/Components/GradientSurfaceDataComponent.h>
+#include <GradientSignal/GradientProgramCache.h>
 #include <LmbrCentral/Shape/BoxShapeComponentBus.h>
 #include <LmbrCentral/Shape/SphereShapeComponentBus.h>
 #include <SurfaceData/Components/SurfaceDataShapeComponent.h>
@@ -49,6 +50,17 @@ namespace UnitTest
         GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(state, entity->GetId());
     }
 
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_ImageGradientBilinear)(benchmark::State& state)
+    {
+        auto entity = BuildTestImageGradient(TestShapeHalfBounds, GradientSignal::SamplingType::Bilinear);
+        GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(state, entity->GetId());
+    }
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_ImageGradientBicubic)(benchmark::State& state)
+    {
+        auto entity = BuildTestImageGradient(TestShapeHalfBounds, GradientSignal::SamplingType::Bicubic);
+        GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(state, entity->GetId());
+    }
 
     BENCHMARK_DEFINE_F(GradientGetValues, BM_PerlinGradient)(benchmark::State& state)
     {
@@ -70,6 +82,8 @@ namespace UnitTest
 
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ConstantGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ImageGradient);
+    GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ImageGradientBilinear);
+    GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ImageGradientBicubic);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_PerlinGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_RandomGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_ShapeAreaFalloffGradient);
@@ -168,6 +182,34 @@ namespace UnitTest
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceMaskGradient);
     GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_SurfaceSlopeGradient);
 
+    // --------------------------------------------------------------------------------------
+    // Gradient Stacks
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_GradientStack)(benchmark::State& state)
+    {
+        auto entities = BuildTestGradientStack(TestShapeHalfBounds);
+        GradientSignalTestHelpers::RunGetValueOrGetValuesBenchmark(state, entities.back()->GetId());
+    }
+
+    BENCHMARK_DEFINE_F(GradientGetValues, BM_CompiledGradientStack)(benchmark::State& state)
+    {
+        // With the program cache active, the gradient sampler evaluates the whole stack as a single compiled program.
+        GradientSignal::GradientProgramCache programCache;
+        programCache.Activate();
+
+        auto entities = BuildTestGradientStack(TestShapeHalfBounds);
+        GradientSignalTestHelpers::RunSamplerGetValuesBenchmark(state, entities.back()->GetId(), state.range(0));
+
+        programCache.Deactivate();
+    }
+
+    GRADIENT_SIGNAL_GET_VALUES_BENCHMARK_REGISTER_F(GradientGetValues, BM_GradientStack);
+    BENCHMARK_REGISTER_F(GradientGetValues, BM_CompiledGradientStack)
+        ->Arg(1024)
+        ->Arg(2048)
+        ->ArgName("size")
+        ->Unit(::benchmark::kMillisecond);
+
     // --------------------------------------------------------------------------------------
     // Gradient Surface Data
 
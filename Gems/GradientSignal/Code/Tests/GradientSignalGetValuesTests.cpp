@@ -10,6 +10,9 @@
 #include <Tests/GradientSignalTestFixtures.h>
 #include <Tests/GradientSignalTestHelpers.h>
 #include <AzTest/AzTest.h>
+#include <GradientSignal/GradientProgramCache.h>
+#include <GradientSignal/GradientSampler.h>
+#include <GradientSignal/Ebuses/LevelsGradientRequestBus.h>
 
 namespace UnitTest
 {
@@ -27,6 +30,18 @@ namespace UnitTest
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
     }
 
+    TEST_F(GradientSignalGetValuesTestsFixture, ImageGradientComponentBilinear_VerifyGetValueAndGetValuesMatch)
+    {
+        auto entity = BuildTestImageGradient(TestShapeHalfBounds, GradientSignal::SamplingType::Bilinear);
+        GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, ImageGradientComponentBicubic_VerifyGetValueAndGetValuesMatch)
+    {
+        auto entity = BuildTestImageGradient(TestShapeHalfBounds, GradientSignal::SamplingType::Bicubic);
+        GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
     TEST_F(GradientSignalGetValuesTestsFixture, PerlinGradientComponent_VerifyGetValueAndGetValuesMatch)
     {
         auto entity = BuildTestPerlinGradient(TestShapeHalfBounds);
@@ -128,6 +143,82 @@ namespace UnitTest
         auto entity = BuildTestSurfaceSlopeGradient(TestShapeHalfBounds);
         GradientSignalTestHelpers::CompareGetValueAndGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
     }
-}
 
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientProgram_VerifyCompiledModifierGradientsMatch)
+    {
+        auto baseEntity = BuildTestRandomGradient(TestShapeHalfBounds);
+        auto mixedEntity = BuildTestPerlinGradient(TestShapeHalfBounds);
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        entities.push_back(BuildTestInvertGradient(TestShapeHalfBounds, baseEntity->GetId()));
+        entities.push_back(BuildTestLevelsGradient(TestShapeHalfBounds, baseEntity->GetId()));
+        entities.push_back(BuildTestMixedGradient(TestShapeHalfBounds, baseEntity->GetId(), mixedEntity->GetId()));
+        entities.push_back(BuildTestPosterizeGradient(TestShapeHalfBounds, baseEntity->GetId()));
+        entities.push_back(BuildTestReferenceGradient(TestShapeHalfBounds, baseEntity->GetId()));
+        entities.push_back(BuildTestSmoothStepGradient(TestShapeHalfBounds, baseEntity->GetId()));
+        entities.push_back(BuildTestThresholdGradient(TestShapeHalfBounds, baseEntity->GetId()));
+
+        for (const auto& entity : entities)
+        {
+            GradientSignalTestHelpers::CompareCompiledAndUncompiledGetValues(entity->GetId(), 0.0f, TestShapeHalfBounds * 2.0f);
+        }
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientProgram_VerifyCompiledGradientStackMatches)
+    {
+        auto entities = BuildTestGradientStack(TestShapeHalfBounds);
+        const AZ::EntityId rootId = entities.back()->GetId();
+
+        auto program = GradientSignal::GradientProgramBuilder::Compile(rootId);
+        ASSERT_NE(program, nullptr);
+
+        // Only the two noise gradients at the bottom of the stack should still get queried through the bus.
+        const size_t expectedLeafCount = 2;
+        EXPECT_EQ(program->GetLeafCount(), expectedLeafCount);
+        EXPECT_EQ(program->GetCompiledEntities().size(), entities.size() - expectedLeafCount);
 
+        GradientSignalTestHelpers::CompareCompiledAndUncompiledGetValues(rootId, 0.0f, TestShapeHalfBounds * 2.0f);
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientProgramCache_LeafGradientsAreNotCompiled)
+    {
+        GradientSignal::GradientProgramCache programCache;
+        programCache.Activate();
+
+        auto entity = BuildTestRandomGradient(TestShapeHalfBounds);
+        EXPECT_EQ(programCache.GetProgram(entity->GetId()), nullptr);
+
+        programCache.Deactivate();
+    }
+
+    TEST_F(GradientSignalGetValuesTestsFixture, GradientProgramCache_RecompilesWhenGradientChanges)
+    {
+        GradientSignal::GradientProgramCache programCache;
+        programCache.Activate();
+
+        auto entities = BuildTestGradientStack(TestShapeHalfBounds);
+        const AZ::EntityId rootId = entities.back()->GetId();
+
+        // The program should get compiled once and then reused.
+        auto program = programCache.GetProgram(rootId);
+        ASSERT_NE(program, nullptr);
+        EXPECT_EQ(programCache.GetProgram(rootId), program);
+
+        // Changing a gradient in the middle of the stack should cause the program to get compiled again.
+        const AZ::EntityId levelsId = entities[2]->GetId();
+        GradientSignal::LevelsGradientRequestBus::Event(levelsId, &GradientSignal::LevelsGradientRequestBus::Events::SetInputMin, 0.2f);
+        auto recompiledProgram = programCache.GetProgram(rootId);
+        ASSERT_NE(recompiledProgram, nullptr);
+        EXPECT_NE(recompiledProgram, program);
+
+        // Deactivating a gradient in the stack should also cause the program to get compiled again.
+        entities[4]->Deactivate();
+        EXPECT_NE(programCache.GetProgram(rootId), recompiledProgram);
+        entities[4]->Activate();
+
+        // Gradient samplers use the cached program, which needs to produce the same values as the uncompiled hierarchy.
+        GradientSignalTestHelpers::CompareGetValueAndGetValues(rootId, 0.0f, TestShapeHalfBounds * 2.0f);
+
+        programCache.Deactivate();
+    }
+}
@@ -219,6 +219,37 @@ namespace UnitTest
         TestFixedDataSampler(expectedOutput, dataSize, entity->GetId());
     }
 
+    TEST_F(GradientSignalTestGeneratorFixture, PerlinImprovedNoise_BatchAndSingleNoiseMatch)
+    {
+        // Make sure the SIMD batch version of GenerateOctaveNoise produces the same values as the single position version,
+        // including negative and non-integer positions, and a position count that isn't a multiple of the SIMD width.
+
+        constexpr int octaves = 4;
+        constexpr float persistence = 0.7f;
+        constexpr float frequency = 1.13f;
+        constexpr size_t positionCount = 1023;
+
+        GradientSignal::PerlinImprovedNoise noise(7878);
+
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(positionCount);
+        for (size_t index = 0; index < positionCount; ++index)
+        {
+            const float offset = aznumeric_cast<float>(index);
+            positions.emplace_back(offset * 0.37f - 150.0f, offset * -0.21f + 40.0f, offset * 0.013f - 3.5f);
+        }
+
+        AZStd::vector<float> batchValues(positionCount);
+        noise.GenerateOctaveNoise(positions, batchValues, octaves, persistence, frequency);
+
+        for (size_t index = 0; index < positionCount; ++index)
+        {
+            const float value = noise.GenerateOctaveNoise(
+                positions[index].GetX(), positions[index].GetY(), positions[index].GetZ(), octaves, persistence, frequency);
+            EXPECT_NEAR(value, batchValues[index], 1.0e-6f);
+        }
+    }
+
     TEST_F(GradientSignalTestGeneratorFixture, RandomGradientComponent_GoldenTest)
     {
         // Make sure RandomGradientComponent returns back a "golden" set
@@ -181,7 +181,8 @@ namespace UnitTest
         return entity;
     }
 
-    AZStd::unique_ptr<AZ::Entity> GradientSignalBaseFixture::BuildTestImageGradient(float shapeHalfBounds)
+    AZStd::unique_ptr<AZ::Entity> GradientSignalBaseFixture::BuildTestImageGradient(
+        float shapeHalfBounds, GradientSignal::SamplingType samplingType)
     {
         // Create an Image Gradient Component with arbitrary sizes and parameters.
         auto entity = CreateTestEntity(shapeHalfBounds);
@@ -190,6 +191,7 @@ namespace UnitTest
         const int32_t imageSeed = 12345;
         config.m_imageAsset = UnitTest::CreateImageAsset(imageSize, imageSize, imageSeed);
         config.m_tiling = AZ::Vector2::CreateOne();
+        config.m_samplingType = samplingType;
         entity->CreateComponent<GradientSignal::ImageGradientComponent>(config);
 
         // Create a Gradient Transform Component with arbitrary parameters.
@@ -386,6 +388,29 @@ namespace UnitTest
         return entity;
     }
 
+    AZStd::vector<AZStd::unique_ptr<AZ::Entity>> GradientSignalBaseFixture::BuildTestGradientStack(float shapeHalfBounds)
+    {
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+        auto AddGradient = [&entities](AZStd::unique_ptr<AZ::Entity>&& entity)
+        {
+            entities.push_back(AZStd::move(entity));
+            return entities.back()->GetId();
+        };
+
+        const AZ::EntityId randomId = AddGradient(BuildTestRandomGradient(shapeHalfBounds));
+        const AZ::EntityId perlinId = AddGradient(BuildTestPerlinGradient(shapeHalfBounds));
+        const AZ::EntityId levelsId = AddGradient(BuildTestLevelsGradient(shapeHalfBounds, randomId));
+        const AZ::EntityId posterizeId = AddGradient(BuildTestPosterizeGradient(shapeHalfBounds, levelsId));
+        const AZ::EntityId smoothStepId = AddGradient(BuildTestSmoothStepGradient(shapeHalfBounds, perlinId));
+        const AZ::EntityId mixedId = AddGradient(BuildTestMixedGradient(shapeHalfBounds, posterizeId, smoothStepId));
+        const AZ::EntityId referenceId = AddGradient(BuildTestReferenceGradient(shapeHalfBounds, mixedId));
+        const AZ::EntityId outerLevelsId = AddGradient(BuildTestLevelsGradient(shapeHalfBounds, referenceId));
+        const AZ::EntityId invertId = AddGradient(BuildTestInvertGradient(shapeHalfBounds, outerLevelsId));
+        AddGradient(BuildTestSmoothStepGradient(shapeHalfBounds, invertId));
+
+        return entities;
+    }
+
     AZStd::unique_ptr<AZ::Entity> GradientSignalBaseFixture::BuildTestSurfaceAltitudeGradient(float shapeHalfBounds)
     {
         // Create a Surface Altitude Gradient Component with arbitrary parameters.
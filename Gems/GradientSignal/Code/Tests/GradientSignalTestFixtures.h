@@ -8,6 +8,7 @@
 #pragma once
 
 #include <Tests/GradientSignalTestMocks.h>
+#include <GradientSignal/Components/ImageGradientComponent.h>
 #include <LmbrCentral/Shape/MockShapes.h>
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <AzTest/GemTestEnvironment.h>
@@ -86,7 +87,8 @@ namespace UnitTest
 
         // Create and activate an entity with a gradient component of the requested type, initialized with test data.
         AZStd::unique_ptr<AZ::Entity> BuildTestConstantGradient(float shapeHalfBounds, float value = 0.75f);
-        AZStd::unique_ptr<AZ::Entity> BuildTestImageGradient(float shapeHalfBounds);
+        AZStd::unique_ptr<AZ::Entity> BuildTestImageGradient(
+            float shapeHalfBounds, GradientSignal::SamplingType samplingType = GradientSignal::SamplingType::Point);
         AZStd::unique_ptr<AZ::Entity> BuildTestPerlinGradient(float shapeHalfBounds);
         AZStd::unique_ptr<AZ::Entity> BuildTestRandomGradient(float shapeHalfBounds);
         AZStd::unique_ptr<AZ::Entity> BuildTestShapeAreaFalloffGradient(float shapeHalfBounds);
@@ -101,6 +103,10 @@ namespace UnitTest
         AZStd::unique_ptr<AZ::Entity> BuildTestSmoothStepGradient(float shapeHalfBounds, const AZ::EntityId& inputGradientId);
         AZStd::unique_ptr<AZ::Entity> BuildTestThresholdGradient(float shapeHalfBounds, const AZ::EntityId& inputGradientId);
 
+        // Create and activate a hierarchy of ten gradients that layers several gradient modifiers and a mix on top of two noise
+        // gradients. The root of the hierarchy is the last entity in the list.
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> BuildTestGradientStack(float shapeHalfBounds);
+
         AZStd::unique_ptr<AZ::Entity> BuildTestSurfaceAltitudeGradient(float shapeHalfBounds);
         AZStd::unique_ptr<AZ::Entity> BuildTestSurfaceMaskGradient(float shapeHalfBounds);
         AZStd::unique_ptr<AZ::Entity> BuildTestSurfaceSlopeGradient(float shapeHalfBounds);
@@ -11,6 +11,7 @@
 #include <Atom/RPI.Reflect/Image/ImageMipChainAssetCreator.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAssetCreator.h>
 #include <AzCore/Math/Aabb.h>
+#include <GradientSignal/GradientProgram.h>
 #include <GradientSignal/GradientSampler.h>
 
 namespace UnitTest
@@ -207,6 +208,38 @@ namespace UnitTest
         }
     }
 
+    void GradientSignalTestHelpers::CompareCompiledAndUncompiledGetValues(AZ::EntityId gradientEntityId, float queryMin, float queryMax)
+    {
+        // Compile the gradient hierarchy and verify that the program produces the same values as querying every gradient in it.
+
+        auto program = GradientSignal::GradientProgramBuilder::Compile(gradientEntityId);
+        ASSERT_NE(program, nullptr);
+
+        // Query a count that isn't a multiple of the SIMD width to make sure that the program handles the leftover values.
+        const size_t numSamples = aznumeric_cast<size_t>(queryMax - queryMin);
+        AZStd::vector<AZ::Vector3> positions;
+        positions.reserve(numSamples * numSamples - 1);
+        for (size_t yIndex = 0; yIndex < numSamples; yIndex++)
+        {
+            for (size_t xIndex = 0; (xIndex < numSamples) && (positions.size() < (numSamples * numSamples - 1)); xIndex++)
+            {
+                positions.emplace_back(queryMin + aznumeric_cast<float>(xIndex), queryMin + aznumeric_cast<float>(yIndex), 0.0f);
+            }
+        }
+
+        AZStd::vector<float> uncompiledResults(positions.size());
+        GradientSignal::GradientRequestBus::Event(
+            gradientEntityId, &GradientSignal::GradientRequestBus::Events::GetValues, positions, uncompiledResults);
+
+        AZStd::vector<float> compiledResults(positions.size());
+        program->GetValues(positions, compiledResults);
+
+        for (size_t positionIndex = 0; positionIndex < positions.size(); positionIndex++)
+        {
+            ASSERT_NEAR(uncompiledResults[positionIndex], compiledResults[positionIndex], 0.000001f);
+        }
+    }
+
 #ifdef HAVE_BENCHMARK
 
     void GradientSignalTestHelpers::FillQueryPositions(AZStd::vector<AZ::Vector3>& positions, float height, float width)
@@ -94,6 +94,7 @@ namespace UnitTest
     {
     public:
         static void CompareGetValueAndGetValues(AZ::EntityId gradientEntityId, float queryMin, float queryMax);
+        static void CompareCompiledAndUncompiledGetValues(AZ::EntityId gradientEntityId, float queryMin, float queryMax);
 
 #ifdef HAVE_BENCHMARK
         // We use an enum to list out the different types of GetValue() benchmarks to run so that way we can condense our test cases
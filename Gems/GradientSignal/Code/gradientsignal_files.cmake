@@ -7,6 +7,8 @@
 #
 
 set(FILES
+    Include/GradientSignal/GradientProgram.h
+    Include/GradientSignal/GradientProgramCache.h
     Include/GradientSignal/GradientSampler.h
     Include/GradientSignal/GradientTransform.h
     Include/GradientSignal/SmoothStep.h
@@ -75,6 +77,8 @@ set(FILES
     Source/Components/SurfaceMaskGradientComponent.cpp
     Source/Components/SurfaceSlopeGradientComponent.cpp
     Source/Components/ThresholdGradientComponent.cpp
+    Source/GradientProgram.cpp
+    Source/GradientProgramCache.cpp
     Source/GradientSampler.cpp
     Source/GradientSignalSystemComponent.cpp
     Source/GradientSignalSystemComponent.h
@@ -133,6 +133,10 @@ namespace EMotionFX::MotionMatching
         settings.m_importMirrored = animGraphNode->m_mirror;
         settings.m_maxKdTreeDepth = animGraphNode->m_maxKdTreeDepth;
         settings.m_minFramesPerKdTreeNode = animGraphNode->m_minFramesPerKdTreeNode;
+        settings.m_broadPhaseType = animGraphNode->m_broadPhaseType;
+        settings.m_searchIndexSettings.m_numCandidates = animGraphNode->m_searchIndexNumCandidates;
+        settings.m_searchIndexSettings.m_numPcaComponents = animGraphNode->m_searchIndexNumPcaComponents;
+        settings.m_searchIndexSettings.m_quantize = animGraphNode->m_quantizeSearchIndex;
         settings.m_motionList.reserve(animGraphNode->m_motionIds.size());
         settings.m_normalizeData = animGraphNode->m_normalizeData;
         settings.m_featureScalerType = animGraphNode->m_featureScalerType;
@@ -345,6 +349,26 @@ namespace EMotionFX::MotionMatching
         return AZ::Edit::PropertyVisibility::Hide;
     }
 
+    AZ::Crc32 BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility() const
+    {
+        if (m_broadPhaseType == MotionMatchingData::KdTreeBroadPhase)
+        {
+            return AZ::Edit::PropertyVisibility::Show;
+        }
+
+        return AZ::Edit::PropertyVisibility::Hide;
+    }
+
+    AZ::Crc32 BlendTreeMotionMatchNode::GetSearchIndexSettingsVisibility() const
+    {
+        if (m_broadPhaseType == MotionMatchingData::SearchIndexBroadPhase)
+        {
+            return AZ::Edit::PropertyVisibility::Show;
+        }
+
+        return AZ::Edit::PropertyVisibility::Hide;
+    }
+
     AZ::Crc32 BlendTreeMotionMatchNode::OnVisualizeSchemaButtonClicked()
     {
         FeatureSchema* usedSchema = nullptr;
@@ -382,7 +406,7 @@ namespace EMotionFX::MotionMatching
         }
 
         serializeContext->Class<BlendTreeMotionMatchNode, AnimGraphNode>()
-            ->Version(11)
+            ->Version(12)
             ->Field("lowestCostSearchFrequency", &BlendTreeMotionMatchNode::m_lowestCostSearchFrequency)
             ->Field("sampleRate", &BlendTreeMotionMatchNode::m_sampleRate)
             ->Field("controlSplineMode", &BlendTreeMotionMatchNode::m_trajectoryQueryMode)
@@ -394,6 +418,10 @@ namespace EMotionFX::MotionMatching
             ->Field("clipFeatures", &BlendTreeMotionMatchNode::m_clipFeatures)
             ->Field("maxKdTreeDepth", &BlendTreeMotionMatchNode::m_maxKdTreeDepth)
             ->Field("minFramesPerKdTreeNode", &BlendTreeMotionMatchNode::m_minFramesPerKdTreeNode)
+            ->Field("broadPhaseType", &BlendTreeMotionMatchNode::m_broadPhaseType)
+            ->Field("searchIndexNumCandidates", &BlendTreeMotionMatchNode::m_searchIndexNumCandidates)
+            ->Field("searchIndexNumPcaComponents", &BlendTreeMotionMatchNode::m_searchIndexNumPcaComponents)
+            ->Field("quantizeSearchIndex", &BlendTreeMotionMatchNode::m_quantizeSearchIndex)
             ->Field("mirror", &BlendTreeMotionMatchNode::m_mirror)
             ->Field("featureSchema", &BlendTreeMotionMatchNode::m_featureSchema)
             ->Field("motionIds", &BlendTreeMotionMatchNode::m_motionIds)
@@ -454,14 +482,34 @@ namespace EMotionFX::MotionMatching
                 ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetMinMaxSettingsVisibility)
             ->ClassElement(AZ::Edit::ClassElements::Group, "Acceleration Structure")
                 ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+            ->DataElement(AZ::Edit::UIHandlers::ComboBox, &BlendTreeMotionMatchNode::m_broadPhaseType, "Type", "The acceleration structure used to find the frames that are passed on to the brute-force narrow-phase search.")
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, AZ::Edit::PropertyRefreshLevels::EntireTree)
+                ->EnumAttribute(MotionMatchingData::KdTreeBroadPhase, "Kd-tree")
+                ->EnumAttribute(MotionMatchingData::SearchIndexBroadPhase, "Search index")
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_maxKdTreeDepth, "Max kd-tree depth", "The maximum number of hierarchy levels in the kdTree.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 20)
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility)
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_minFramesPerKdTreeNode, "Min kd-tree node size", "The minimum number of frames to store per kdTree node.")
                 ->Attribute(AZ::Edit::Attributes::Min, 1)
                 ->Attribute(AZ::Edit::Attributes::Max, 100000)
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetKdTreeSettingsVisibility)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_searchIndexNumCandidates, "Candidates", "The number of nearest frames the search index passes on to the narrow-phase.")
+                ->Attribute(AZ::Edit::Attributes::Min, 1)
+                ->Attribute(AZ::Edit::Attributes::Max, 10000)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetSearchIndexSettingsVisibility)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_searchIndexNumPcaComponents, "PCA dimensions", "Reduce the search index to the given number of principal components, for big motion databases. Zero keeps all dimensions.")
+                ->Attribute(AZ::Edit::Attributes::Min, 0)
+                ->Attribute(AZ::Edit::Attributes::Max, 48)
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetSearchIndexSettingsVisibility)
+            ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_quantizeSearchIndex, "Quantize", "Store the search index values as 16-bit integers, halving its memory usage at a small loss of precision.")
+                ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
+                ->Attribute(AZ::Edit::Attributes::Visibility, &BlendTreeMotionMatchNode::GetSearchIndexSettingsVisibility)
             ->EndGroup()
             ->DataElement(AZ::Edit::UIHandlers::Default, &BlendTreeMotionMatchNode::m_featureSchema, "FeatureSchema", "")
                 ->Attribute(AZ::Edit::Attributes::ChangeNotify, &BlendTreeMotionMatchNode::Reinit)
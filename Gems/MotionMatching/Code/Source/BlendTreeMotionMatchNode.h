@@ -94,6 +94,8 @@ namespace EMotionFX::MotionMatching
         AZ::Crc32 GetTrajectoryPathSettingsVisibility() const;
         AZ::Crc32 GetFeatureScalerTypeSettingsVisibility() const;
         AZ::Crc32 GetMinMaxSettingsVisibility() const;
+        AZ::Crc32 GetKdTreeSettingsVisibility() const;
+        AZ::Crc32 GetSearchIndexSettingsVisibility() const;
         AZ::Crc32 OnVisualizeSchemaButtonClicked();
         AZStd::string OnVisualizeSchemaButtonText() const;
 
@@ -106,6 +108,10 @@ namespace EMotionFX::MotionMatching
         AZ::u32 m_sampleRate = 30;
         AZ::u32 m_maxKdTreeDepth = 15;
         AZ::u32 m_minFramesPerKdTreeNode = 1000;
+        MotionMatchingData::BroadPhaseType m_broadPhaseType = MotionMatchingData::KdTreeBroadPhase;
+        AZ::u32 m_searchIndexNumCandidates = 64;
+        AZ::u32 m_searchIndexNumPcaComponents = 0;
+        bool m_quantizeSearchIndex = false;
         TrajectoryQuery::EMode m_trajectoryQueryMode = TrajectoryQuery::MODE_TARGETDRIVEN;
         bool m_mirror = false;
 
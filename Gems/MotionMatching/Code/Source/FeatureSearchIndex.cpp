@@ -0,0 +1,567 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Timer.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/numeric.h>
+#include <AzCore/std/sort.h>
+
+#include <EMotionFX/Source/Motion.h>
+
+#include <Allocators.h>
+#include <FeatureSearchIndex.h>
+
+namespace EMotionFX::MotionMatching
+{
+    AZ_CLASS_ALLOCATOR_IMPL(FeatureSearchIndex, MotionMatchAllocator);
+
+    // Number of frames per SIMD register.
+    static constexpr size_t s_framesPerBlock = 4;
+
+    // Number of blocks that get searched for all queries of a batch before moving on to the next blocks. The values of 256 frames
+    // with up to 48 dimensions stay within the first or second level cache, so that a batch only reads the index from memory once.
+    static constexpr size_t s_blocksPerTile = 64;
+
+    static constexpr float s_maxQuantizedValue = 32767.0f;
+
+    FeatureSearchIndex::~FeatureSearchIndex()
+    {
+        Clear();
+    }
+
+    bool FeatureSearchIndex::Init(const FrameDatabase& frameDatabase,
+        const FeatureMatrix& featureMatrix,
+        const AZStd::vector<Feature*>& features,
+        const Settings& settings)
+    {
+        // Use the same column order as the KD-tree, so that both share the same query vector.
+        AZStd::vector<size_t> columns;
+        AZStd::vector<float> columnWeights;
+        for (const Feature* feature : features)
+        {
+            const size_t numDimensions = feature->GetNumDimensions();
+            const size_t featureColumnOffset = feature->GetColumnOffset();
+            for (size_t i = 0; i < numDimensions; ++i)
+            {
+                columns.emplace_back(featureColumnOffset + i);
+                columnWeights.emplace_back(feature->GetCostFactor());
+            }
+        }
+
+        // Skip the frames the narrow-phase discards anyway, else they would occupy the candidate slots.
+        AZStd::vector<size_t> frameIndices;
+        frameIndices.reserve(frameDatabase.GetNumFrames());
+        for (size_t frameIndex = 0; frameIndex < frameDatabase.GetNumFrames(); ++frameIndex)
+        {
+            const Frame& frame = frameDatabase.GetFrame(frameIndex);
+            if (frame.GetSampleTime() < frame.GetSourceMotion()->GetDuration() - 1.0f)
+            {
+                frameIndices.emplace_back(frameIndex);
+            }
+        }
+
+        if (frameIndices.empty() && frameDatabase.GetNumFrames() > 0)
+        {
+            AZ_Warning("Motion Matching", false, "All motions are shorter than a second. Adding all frames to the search index.");
+            frameIndices.resize(frameDatabase.GetNumFrames());
+            AZStd::iota(frameIndices.begin(), frameIndices.end(), size_t{ 0 });
+        }
+
+        return Init(featureMatrix, columns, columnWeights, frameIndices, settings);
+    }
+
+    bool FeatureSearchIndex::Init(const FeatureMatrix& featureMatrix,
+        const AZStd::vector<size_t>& columns,
+        const AZStd::vector<float>& columnWeights,
+        const AZStd::vector<size_t>& frameIndices,
+        const Settings& settings)
+    {
+        AZ_PROFILE_SCOPE(Animation, "FeatureSearchIndex::Init");
+
+#if !defined(_RELEASE)
+        AZ::Debug::Timer timer;
+        timer.Stamp();
+#endif
+
+        Clear();
+
+        if (columns.empty() || columns.size() != columnWeights.size())
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize search index. Expected a weight for each of the %zu columns.", columns.size());
+            return false;
+        }
+
+        if (settings.m_numCandidates == 0)
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize search index. The number of candidates cannot be zero.");
+            return false;
+        }
+
+        if (settings.m_numPcaComponents > columns.size())
+        {
+            AZ_Error("Motion Matching", false, "Cannot initialize search index. The number of principal components (%zu) cannot exceed the number of dimensions (%zu).",
+                settings.m_numPcaComponents, columns.size());
+            return false;
+        }
+
+        if (frameIndices.empty())
+        {
+            AZ_Error("Motion Matching", false, "Skipping to initialize search index. No frames in the motion database.");
+            return true;
+        }
+
+        m_settings = settings;
+        m_numDimensions = columns.size();
+        m_numIndexDimensions = (settings.m_numPcaComponents > 0) ? settings.m_numPcaComponents : m_numDimensions;
+        m_frameIndices = frameIndices;
+
+        // Scale the columns by the square root of their weight, so that the squared distances are weighted by the cost factors.
+        m_columnWeights.resize(m_numDimensions);
+        for (size_t i = 0; i < m_numDimensions; ++i)
+        {
+            m_columnWeights[i] = AZ::Sqrt(AZ::GetMax(columnWeights[i], 0.0f));
+        }
+
+        const size_t numRows = frameIndices.size();
+        AZStd::vector<float> rowValues(numRows * m_numDimensions);
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            for (size_t i = 0; i < m_numDimensions; ++i)
+            {
+                rowValues[row * m_numDimensions + i] = featureMatrix(frameIndices[row], columns[i]) * m_columnWeights[i];
+            }
+        }
+
+        if (settings.m_numPcaComponents > 0)
+        {
+            InitPrincipalComponents(rowValues, numRows);
+
+            AZStd::vector<float> projectedValues(numRows * m_numIndexDimensions);
+            for (size_t row = 0; row < numRows; ++row)
+            {
+                ProjectQuery(&rowValues[row * m_numDimensions], &projectedValues[row * m_numIndexDimensions]);
+            }
+            rowValues = AZStd::move(projectedValues);
+        }
+
+        InitColumns(rowValues, numRows);
+
+#if !defined(_RELEASE)
+        const float initTime = timer.GetDeltaTimeInSeconds();
+        AZ_TracePrintf("Motion Matching", "Search index initialized in %.2f ms (numFrames = %zu  numDims = %zu  numIndexDims = %zu  explainedVariance = %.3f  quantized = %s  Memory used = %.2f MB).",
+            initTime * 1000.0f,
+            m_numFrames,
+            m_numDimensions,
+            m_numIndexDimensions,
+            m_explainedVariance,
+            m_settings.m_quantize ? "yes" : "no",
+            static_cast<float>(CalcMemoryUsageInBytes()) / 1024.0f / 1024.0f);
+#endif
+        return true;
+    }
+
+    void FeatureSearchIndex::InitPrincipalComponents(const AZStd::vector<float>& rowValues, size_t numRows)
+    {
+        const size_t n = m_numDimensions;
+
+        // Mean and covariance of the weighted columns, accumulated in double precision as databases can hold hundreds of thousands of frames.
+        AZStd::vector<double> mean(n, 0.0);
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                mean[i] += rowValues[row * n + i];
+            }
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            mean[i] /= aznumeric_cast<double>(numRows);
+        }
+
+        AZStd::vector<double> covariance(n * n, 0.0);
+        AZStd::vector<double> centered(n);
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                centered[i] = rowValues[row * n + i] - mean[i];
+            }
+            for (size_t i = 0; i < n; ++i)
+            {
+                for (size_t j = i; j < n; ++j)
+                {
+                    covariance[i * n + j] += centered[i] * centered[j];
+                }
+            }
+        }
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (size_t j = i; j < n; ++j)
+            {
+                covariance[i * n + j] /= aznumeric_cast<double>(numRows);
+                covariance[j * n + i] = covariance[i * n + j];
+            }
+        }
+
+        // Eigen decomposition of the symmetric covariance matrix using cyclic Jacobi rotations.
+        // The columns of the eigenvector matrix are the principal axes, the diagonal converges to their variances.
+        AZStd::vector<double> eigenVectors(n * n, 0.0);
+        for (size_t i = 0; i < n; ++i)
+        {
+            eigenVectors[i * n + i] = 1.0;
+        }
+
+        double totalVariance = 0.0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            totalVariance += covariance[i * n + i];
+        }
+
+        const size_t maxSweeps = 64;
+        for (size_t sweep = 0; sweep < maxSweeps; ++sweep)
+        {
+            double offDiagonal = 0.0;
+            for (size_t p = 0; p < n; ++p)
+            {
+                for (size_t q = p + 1; q < n; ++q)
+                {
+                    offDiagonal += covariance[p * n + q] * covariance[p * n + q];
+                }
+            }
+            if (offDiagonal <= 1e-24 * (totalVariance * totalVariance) || offDiagonal == 0.0)
+            {
+                break;
+            }
+
+            for (size_t p = 0; p < n; ++p)
+            {
+                for (size_t q = p + 1; q < n; ++q)
+                {
+                    const double apq = covariance[p * n + q];
+                    if (apq == 0.0)
+                    {
+                        continue;
+                    }
+
+                    const double theta = (covariance[q * n + q] - covariance[p * n + p]) / (2.0 * apq);
+                    const double t = (theta >= 0.0 ? 1.0 : -1.0) / (AZStd::abs(theta) + AZStd::sqrt(theta * theta + 1.0));
+                    const double c = 1.0 / AZStd::sqrt(t * t + 1.0);
+                    const double s = t * c;
+
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        const double akp = covariance[k * n + p];
+                        const double akq = covariance[k * n + q];
+                        covariance[k * n + p] = c * akp - s * akq;
+                        covariance[k * n + q] = s * akp + c * akq;
+                    }
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        const double apk = covariance[p * n + k];
+                        const double aqk = covariance[q * n + k];
+                        covariance[p * n + k] = c * apk - s * aqk;
+                        covariance[q * n + k] = s * apk + c * aqk;
+                    }
+                    for (size_t k = 0; k < n; ++k)
+                    {
+                        const double vkp = eigenVectors[k * n + p];
+                        const double vkq = eigenVectors[k * n + q];
+                        eigenVectors[k * n + p] = c * vkp - s * vkq;
+                        eigenVectors[k * n + q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+
+        // Keep the axes with the largest variances.
+        AZStd::vector<size_t> order(n);
+        AZStd::iota(order.begin(), order.end(), size_t{ 0 });
+        AZStd::sort(order.begin(), order.end(),
+            [&covariance, n](size_t a, size_t b)
+            {
+                return covariance[a * n + a] > covariance[b * n + b];
+            });
+
+        double keptVariance = 0.0;
+        m_components.resize(m_numIndexDimensions * n);
+        for (size_t k = 0; k < m_numIndexDimensions; ++k)
+        {
+            const size_t axis = order[k];
+            keptVariance += AZ::GetMax(covariance[axis * n + axis], 0.0);
+            for (size_t i = 0; i < n; ++i)
+            {
+                m_components[k * n + i] = aznumeric_cast<float>(eigenVectors[i * n + axis]);
+            }
+        }
+
+        m_mean.resize(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            m_mean[i] = aznumeric_cast<float>(mean[i]);
+        }
+
+        m_explainedVariance = (totalVariance > 0.0) ? aznumeric_cast<float>(AZ::GetMin(keptVariance / totalVariance, 1.0)) : 1.0f;
+    }
+
+    void FeatureSearchIndex::InitColumns(const AZStd::vector<float>& rowValues, size_t numRows)
+    {
+        m_numFrames = numRows;
+        m_numPaddedFrames = ((numRows + s_framesPerBlock - 1) / s_framesPerBlock) * s_framesPerBlock;
+
+        // Transpose to column-major. The padding lanes repeat the last frame and are never reported.
+        m_values.resize(m_numIndexDimensions * m_numPaddedFrames);
+        for (size_t i = 0; i < m_numIndexDimensions; ++i)
+        {
+            float* column = &m_values[i * m_numPaddedFrames];
+            for (size_t row = 0; row < m_numPaddedFrames; ++row)
+            {
+                column[row] = rowValues[AZ::GetMin(row, numRows - 1) * m_numIndexDimensions + i];
+            }
+        }
+
+        if (!m_settings.m_quantize)
+        {
+            return;
+        }
+
+        // Map the value range of each dimension symmetrically onto the 16-bit integer range.
+        m_quantizedValues.resize(m_values.size());
+        m_quantizationScales.resize(m_numIndexDimensions);
+        m_quantizationOffsets.resize(m_numIndexDimensions);
+        for (size_t i = 0; i < m_numIndexDimensions; ++i)
+        {
+            const float* column = &m_values[i * m_numPaddedFrames];
+            const auto minMaxValue = AZStd::minmax_element(column, column + m_numPaddedFrames);
+            const float minValue = *minMaxValue.first;
+            const float maxValue = *minMaxValue.second;
+            const float range = maxValue - minValue;
+            const float scale = (range > 0.0f) ? (range / (2.0f * s_maxQuantizedValue)) : 1.0f;
+            const float offset = (minValue + maxValue) * 0.5f;
+            m_quantizationScales[i] = scale;
+            m_quantizationOffsets[i] = offset;
+
+            AZ::s16* quantizedColumn = &m_quantizedValues[i * m_numPaddedFrames];
+            for (size_t row = 0; row < m_numPaddedFrames; ++row)
+            {
+                const float quantized = AZ::GetClamp(AZStd::round((column[row] - offset) / scale), -s_maxQuantizedValue, s_maxQuantizedValue);
+                quantizedColumn[row] = aznumeric_cast<AZ::s16>(quantized);
+            }
+        }
+
+        m_values.clear();
+        m_values.shrink_to_fit();
+    }
+
+    void FeatureSearchIndex::Clear()
+    {
+        m_numFrames = 0;
+        m_numPaddedFrames = 0;
+        m_numDimensions = 0;
+        m_numIndexDimensions = 0;
+        m_explainedVariance = 1.0f;
+        m_frameIndices.clear();
+        m_columnWeights.clear();
+        m_mean.clear();
+        m_components.clear();
+        m_values.clear();
+        m_quantizedValues.clear();
+        m_quantizationScales.clear();
+        m_quantizationOffsets.clear();
+    }
+
+    size_t FeatureSearchIndex::CalcMemoryUsageInBytes() const
+    {
+        size_t totalBytes = sizeof(FeatureSearchIndex);
+        totalBytes += m_frameIndices.capacity() * sizeof(size_t);
+        totalBytes += m_columnWeights.capacity() * sizeof(float);
+        totalBytes += m_mean.capacity() * sizeof(float);
+        totalBytes += m_components.capacity() * sizeof(float);
+        totalBytes += m_values.capacity() * sizeof(float);
+        totalBytes += m_quantizedValues.capacity() * sizeof(AZ::s16);
+        totalBytes += m_quantizationScales.capacity() * sizeof(float);
+        totalBytes += m_quantizationOffsets.capacity() * sizeof(float);
+        return totalBytes;
+    }
+
+    void FeatureSearchIndex::ProjectQuery(const float* query, float* result) const
+    {
+        if (m_components.empty())
+        {
+            for (size_t i = 0; i < m_numDimensions; ++i)
+            {
+                result[i] = query[i];
+            }
+            return;
+        }
+
+        for (size_t k = 0; k < m_numIndexDimensions; ++k)
+        {
+            const float* component = &m_components[k * m_numDimensions];
+            float value = 0.0f;
+            for (size_t i = 0; i < m_numDimensions; ++i)
+            {
+                value += component[i] * (query[i] - m_mean[i]);
+            }
+            result[k] = value;
+        }
+    }
+
+    void FeatureSearchIndex::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices, SearchBuffers& searchBuffers) const
+    {
+        AZ_Assert(frameFloats.size() == m_numDimensions || !IsInitialized(), "Expected %zu query values, got %zu.", m_numDimensions, frameFloats.size());
+        FindNearestNeighbors(frameFloats.data(), 1, &resultFrameIndices, searchBuffers);
+    }
+
+    void FeatureSearchIndex::FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const
+    {
+        SearchBuffers searchBuffers;
+        FindNearestNeighbors(frameFloats, resultFrameIndices, searchBuffers);
+    }
+
+    void FeatureSearchIndex::FindNearestNeighbors(const float* queries, size_t numQueries, AZStd::vector<size_t>* resultFrameIndices) const
+    {
+        SearchBuffers searchBuffers;
+        FindNearestNeighbors(queries, numQueries, resultFrameIndices, searchBuffers);
+    }
+
+    void FeatureSearchIndex::FindNearestNeighbors(const float* queries, size_t numQueries, AZStd::vector<size_t>* resultFrameIndices, SearchBuffers& searchBuffers) const
+    {
+        AZ_PROFILE_SCOPE(Animation, "FeatureSearchIndex::FindNearestNeighbors");
+
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            resultFrameIndices[q].clear();
+        }
+
+        if (!IsInitialized() || numQueries == 0)
+        {
+            return;
+        }
+
+        // Weight and project the queries into the space of the index values.
+        AZStd::vector<float>& weightedQuery = searchBuffers.m_weightedQuery;
+        AZStd::vector<float>& projectedQueries = searchBuffers.m_projectedQueries;
+        weightedQuery.resize(m_numDimensions);
+        projectedQueries.resize(numQueries * m_numIndexDimensions);
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            const float* query = &queries[q * m_numDimensions];
+            for (size_t i = 0; i < m_numDimensions; ++i)
+            {
+                weightedQuery[i] = query[i] * m_columnWeights[i];
+            }
+
+            float* projectedQuery = &projectedQueries[q * m_numIndexDimensions];
+            ProjectQuery(weightedQuery.data(), projectedQuery);
+
+            if (m_settings.m_quantize)
+            {
+                // Compare against the integers directly by moving the query into the quantized space instead.
+                for (size_t i = 0; i < m_numIndexDimensions; ++i)
+                {
+                    projectedQuery[i] = (projectedQuery[i] - m_quantizationOffsets[i]) / m_quantizationScales[i];
+                }
+            }
+        }
+
+        const size_t numCandidates = AZ::GetMin(m_settings.m_numCandidates, m_numFrames);
+        // The candidate lists keep their capacity between searches, only the outer list grows with the number of queries.
+        AZStd::vector<AZStd::vector<Candidate>>& candidates = searchBuffers.m_candidates;
+        if (candidates.size() < numQueries)
+        {
+            candidates.resize(numQueries);
+        }
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            candidates[q].clear();
+            candidates[q].reserve(numCandidates);
+        }
+
+        const size_t numBlocks = m_numPaddedFrames / s_framesPerBlock;
+        for (size_t startBlock = 0; startBlock < numBlocks; startBlock += s_blocksPerTile)
+        {
+            const size_t endBlock = AZ::GetMin(startBlock + s_blocksPerTile, numBlocks);
+            FindNearestNeighborsInBlocks(projectedQueries.data(), numQueries, startBlock, endBlock, candidates.data());
+        }
+
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            AZStd::vector<Candidate>& queryCandidates = candidates[q];
+            AZStd::sort_heap(queryCandidates.begin(), queryCandidates.end());
+
+            AZStd::vector<size_t>& result = resultFrameIndices[q];
+            result.reserve(queryCandidates.size());
+            for (const Candidate& candidate : queryCandidates)
+            {
+                result.emplace_back(m_frameIndices[candidate.m_row]);
+            }
+        }
+    }
+
+    void FeatureSearchIndex::FindNearestNeighborsInBlocks(const float* projectedQueries, size_t numQueries, size_t startBlock, size_t endBlock, AZStd::vector<Candidate>* candidates) const
+    {
+        using namespace AZ::Simd;
+
+        const size_t numCandidates = AZ::GetMin(m_settings.m_numCandidates, m_numFrames);
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            const float* query = &projectedQueries[q * m_numIndexDimensions];
+            AZStd::vector<Candidate>& queryCandidates = candidates[q];
+
+            for (size_t block = startBlock; block < endBlock; ++block)
+            {
+                const size_t firstRow = block * s_framesPerBlock;
+
+                // Weighted squared distance of four frames at once.
+                Vec4::FloatType distance = Vec4::ZeroFloat();
+                if (m_settings.m_quantize)
+                {
+                    for (size_t i = 0; i < m_numIndexDimensions; ++i)
+                    {
+                        const AZ::s16* values = &m_quantizedValues[i * m_numPaddedFrames + firstRow];
+                        const Vec4::FloatType frameValues = Vec4::ConvertToFloat(Vec4::LoadImmediate(aznumeric_cast<int32_t>(values[0]), aznumeric_cast<int32_t>(values[1]), aznumeric_cast<int32_t>(values[2]), aznumeric_cast<int32_t>(values[3])));
+                        const Vec4::FloatType diff = Vec4::Sub(frameValues, Vec4::Splat(query[i]));
+                        const float scale = m_quantizationScales[i];
+                        distance = Vec4::Madd(Vec4::Mul(diff, diff), Vec4::Splat(scale * scale), distance);
+                    }
+                }
+                else
+                {
+                    for (size_t i = 0; i < m_numIndexDimensions; ++i)
+                    {
+                        const Vec4::FloatType diff = Vec4::Sub(Vec4::LoadUnaligned(&m_values[i * m_numPaddedFrames + firstRow]), Vec4::Splat(query[i]));
+                        distance = Vec4::Madd(diff, diff, distance);
+                    }
+                }
+
+                float distances[s_framesPerBlock];
+                Vec4::StoreUnaligned(distances, distance);
+
+                // Keep the nearest frames in a max-heap, so that the farthest candidate is the one to be replaced.
+                const size_t numLanes = AZ::GetMin(s_framesPerBlock, m_numFrames - firstRow);
+                for (size_t lane = 0; lane < numLanes; ++lane)
+                {
+                    if (queryCandidates.size() < numCandidates)
+                    {
+                        queryCandidates.push_back({ distances[lane], firstRow + lane });
+                        AZStd::push_heap(queryCandidates.begin(), queryCandidates.end());
+                    }
+                    else if (distances[lane] < queryCandidates.front().m_distance)
+                    {
+                        AZStd::pop_heap(queryCandidates.begin(), queryCandidates.end());
+                        queryCandidates.back() = { distances[lane], firstRow + lane };
+                        AZStd::push_heap(queryCandidates.begin(), queryCandidates.end());
+                    }
+                }
+            }
+        }
+    }
+} // namespace EMotionFX::MotionMatching
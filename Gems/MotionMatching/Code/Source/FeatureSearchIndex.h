@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <EMotionFX/Source/EMotionFXConfig.h>
+
+#include <Feature.h>
+#include <FeatureMatrix.h>
+#include <FrameDatabase.h>
+
+namespace EMotionFX::MotionMatching
+{
+    //! Broad-phase search structure and alternative to the KD-tree.
+    //! The index stores the feature columns used for the broad-phase column-major, so that the values of four consecutive frames
+    //! can be loaded into a single SIMD register. A search evaluates the weighted squared distance of four frames at a time and returns
+    //! the frames with the lowest distances, which are then passed on to the narrow-phase. Compared to the KD-tree, which returns all
+    //! frames of the leaf node the query falls into, the result is a fixed and usually much smaller number of actual nearest frames.
+    //! For big databases, the columns can be quantized to 16-bit integers and/or reduced to their principal components to lower the
+    //! memory footprint and bandwidth of the search.
+    class EMFX_API FeatureSearchIndex
+    {
+    public:
+        AZ_RTTI(FeatureSearchIndex, "{5B0C9E4A-3D61-4F7E-9A28-6C1E7D4B2F93}");
+        AZ_CLASS_ALLOCATOR_DECL;
+
+        struct EMFX_API Settings
+        {
+            size_t m_numCandidates = 64; //!< The number of nearest frames returned by a search, which are passed on to the narrow-phase.
+            size_t m_numPcaComponents = 0; //!< Project the feature columns onto the given number of principal components. Zero disables the reduction.
+            bool m_quantize = false; //!< Store the (projected) feature columns as 16-bit integers, which halves the memory used by the index.
+        };
+
+        struct Candidate
+        {
+            float m_distance;
+            size_t m_row;
+
+            bool operator<(const Candidate& other) const { return m_distance < other.m_distance; }
+        };
+
+        //! Temporary buffers used by a search. Callers that search every frame keep these around, so that the searches don't allocate.
+        struct EMFX_API SearchBuffers
+        {
+            AZStd::vector<float> m_weightedQuery; //!< The query scaled by the column weights.
+            AZStd::vector<float> m_projectedQueries; //!< The queries in the space of the index values.
+            AZStd::vector<AZStd::vector<Candidate>> m_candidates; //!< The max-heap of the nearest frames of each query.
+        };
+
+        FeatureSearchIndex() = default;
+        virtual ~FeatureSearchIndex();
+
+        //! Build the index for the given features. Frames that the narrow-phase discards, the ones in the last second of their motion,
+        //! are not added to the index. The columns are weighted by the cost factors of their features.
+        bool Init(const FrameDatabase& frameDatabase,
+            const FeatureMatrix& featureMatrix,
+            const AZStd::vector<Feature*>& features,
+            const Settings& settings);
+
+        //! Build the index from the given feature matrix columns and rows.
+        //! @param featureMatrix The feature matrix holding the feature values.
+        //! @param columns The feature matrix columns to index. The query vectors contain the values for these columns in the same order.
+        //! @param columnWeights The weight of each column in the distance, holding a value for each of the columns.
+        //! @param frameIndices The feature matrix rows or frames to index.
+        //! @param settings The index settings.
+        bool Init(const FeatureMatrix& featureMatrix,
+            const AZStd::vector<size_t>& columns,
+            const AZStd::vector<float>& columnWeights,
+            const AZStd::vector<size_t>& frameIndices,
+            const Settings& settings);
+
+        void Clear();
+
+        //! Find the nearest frames for a single query, holding the values of the indexed columns.
+        //! The resulting frames are sorted by their distance, nearest first.
+        //! @param searchBuffers Temporary buffers for the search, reused between searches.
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices, SearchBuffers& searchBuffers) const;
+        //! Same as above, using temporary buffers that get allocated for this search only.
+        void FindNearestNeighbors(const AZStd::vector<float>& frameFloats, AZStd::vector<size_t>& resultFrameIndices) const;
+
+        //! Find the nearest frames for a batch of queries at once.
+        //! The index is streamed through the cache once per batch rather than once per query, which pays off when searching for several
+        //! queries against the same database in the same frame.
+        //! @param queries The query values, GetNumDimensions() consecutive values for each of the queries.
+        //! @param numQueries The number of queries.
+        //! @param resultFrameIndices Array of numQueries vectors that receive the nearest frames of each query, nearest first.
+        //! @param searchBuffers Temporary buffers for the search, reused between searches.
+        void FindNearestNeighbors(const float* queries, size_t numQueries, AZStd::vector<size_t>* resultFrameIndices, SearchBuffers& searchBuffers) const;
+        //! Same as above, using temporary buffers that get allocated for this search only.
+        void FindNearestNeighbors(const float* queries, size_t numQueries, AZStd::vector<size_t>* resultFrameIndices) const;
+
+        bool IsInitialized() const { return m_numFrames > 0; }
+        size_t GetNumFrames() const { return m_numFrames; }
+        size_t GetNumDimensions() const { return m_numDimensions; }
+        size_t GetNumIndexDimensions() const { return m_numIndexDimensions; }
+        size_t GetNumCandidates() const { return m_settings.m_numCandidates; }
+        bool IsQuantized() const { return m_settings.m_quantize; }
+
+        //! The fraction of the variance of the indexed columns that is kept by the principal components, in range [0, 1].
+        //! This is 1.0 in case the dimensions are not reduced.
+        float GetExplainedVariance() const { return m_explainedVariance; }
+
+        size_t CalcMemoryUsageInBytes() const;
+
+    private:
+        void InitPrincipalComponents(const AZStd::vector<float>& rowValues, size_t numRows);
+        void InitColumns(const AZStd::vector<float>& rowValues, size_t numRows);
+        void ProjectQuery(const float* query, float* result) const;
+        void FindNearestNeighborsInBlocks(const float* projectedQueries, size_t numQueries, size_t startBlock, size_t endBlock, AZStd::vector<Candidate>* candidates) const;
+
+        Settings m_settings;
+        size_t m_numFrames = 0; //!< The number of indexed frames.
+        size_t m_numPaddedFrames = 0; //!< The number of indexed frames rounded up to a multiple of four.
+        size_t m_numDimensions = 0; //!< The number of values per query.
+        size_t m_numIndexDimensions = 0; //!< The number of values per frame stored in the index, which is less than the query dimensions when using PCA.
+        float m_explainedVariance = 1.0f;
+
+        AZStd::vector<size_t> m_frameIndices; //!< The frame index for each of the rows in the index.
+        AZStd::vector<float> m_columnWeights; //!< The square root of the column weights, which the queries get scaled with.
+        AZStd::vector<float> m_mean; //!< The mean of the weighted columns, subtracted before projecting onto the principal components.
+        AZStd::vector<float> m_components; //!< The principal components as rows of m_numDimensions values each.
+
+        AZStd::vector<float> m_values; //!< The column-major index values, m_numPaddedFrames values per dimension.
+        AZStd::vector<AZ::s16> m_quantizedValues; //!< The column-major quantized index values, in case quantization is enabled.
+        AZStd::vector<float> m_quantizationScales; //!< The quantization step size for each of the index dimensions.
+        AZStd::vector<float> m_quantizationOffsets; //!< The value the quantized zero maps to for each of the index dimensions.
+    };
+} // namespace EMotionFX::MotionMatching
@@ -23,6 +23,7 @@
 #include <Feature.h>
 #include <FeatureMatrixMinMaxScaler.h>
 #include <FeatureMatrixStandardScaler.h>
+#include <FeatureSearchIndex.h>
 #include <FeatureSchemaDefault.h>
 #include <FeatureTrajectory.h>
 #include <FrameDatabase.h>
@@ -39,6 +40,7 @@ namespace EMotionFX::MotionMatching
         : m_featureSchema(featureSchema)
     {
         m_kdTree = AZStd::make_unique<KdTree>();
+        m_searchIndex = AZStd::make_unique<FeatureSearchIndex>();
     }
 
     MotionMatchingData::~MotionMatchingData()
@@ -260,7 +262,7 @@ namespace EMotionFX::MotionMatching
         }
 
         ///////////////////////////////////////////////////////////////////////
-        // 4. Initialize the kd-tree used to accelerate the searches
+        // 4. Initialize the kd-tree or search index used to accelerate the searches
         {
             // Use all features other than the trajectory for the broad-phase search using the KD-Tree.
             for (Feature* feature : m_featureSchema.GetFeatures())
@@ -271,10 +273,24 @@ namespace EMotionFX::MotionMatching
                 }
             }
 
-            if (!m_kdTree->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
+            m_broadPhaseType = settings.m_broadPhaseType;
+            if (m_broadPhaseType == SearchIndexBroadPhase)
             {
-                AZ_Error("EMotionFX", false, "Failed to initialize KdTree acceleration structure.");
-                return false;
+                m_kdTree->Clear();
+                if (!m_searchIndex->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_searchIndexSettings)) // Internally automatically clears any existing contents.
+                {
+                    AZ_Error("EMotionFX", false, "Failed to initialize search index acceleration structure.");
+                    return false;
+                }
+            }
+            else
+            {
+                m_searchIndex->Clear();
+                if (!m_kdTree->Init(m_frameDatabase, m_featureMatrix, m_featuresInKdTree, settings.m_maxKdTreeDepth, settings.m_minFramesPerKdTreeNode)) // Internally automatically clears any existing contents.
+                {
+                    AZ_Error("EMotionFX", false, "Failed to initialize KdTree acceleration structure.");
+                    return false;
+                }
             }
         }
 
@@ -293,6 +309,7 @@ namespace EMotionFX::MotionMatching
         m_frameDatabase.Clear();
         m_featureMatrix.Clear();
         m_kdTree->Clear();
+        m_searchIndex->Clear();
         m_featuresInKdTree.clear();
     }
 } // namespace EMotionFX::MotionMatching
@@ -18,6 +18,7 @@
 #include <FeatureSchema.h>
 #include <FrameDatabase.h>
 #include <FeatureMatrixTransformer.h>
+#include <FeatureSearchIndex.h>
 #include <KdTree.h>
 
 namespace AZ
@@ -47,6 +48,13 @@ namespace EMotionFX::MotionMatching
             MinMaxScalerType = 1
         };
 
+        //! The acceleration structure used for the broad-phase search.
+        enum BroadPhaseType
+        {
+            KdTreeBroadPhase = 0,
+            SearchIndexBroadPhase = 1
+        };
+
         struct EMFX_API InitSettings
         {
             ActorInstance* m_actorInstance = nullptr;
@@ -54,6 +62,8 @@ namespace EMotionFX::MotionMatching
             FrameDatabase::FrameImportSettings m_frameImportSettings;
             size_t m_maxKdTreeDepth = 20;
             size_t m_minFramesPerKdTreeNode = 1000;
+            BroadPhaseType m_broadPhaseType = KdTreeBroadPhase;
+            FeatureSearchIndex::Settings m_searchIndexSettings = {};
             bool m_importMirrored = false;
 
             bool m_normalizeData = false;
@@ -70,6 +80,8 @@ namespace EMotionFX::MotionMatching
         const FeatureMatrix& GetFeatureMatrix() const { return m_featureMatrix; }
         FeatureMatrixTransformer* GetFeatureTransformer() { return m_featureTransformer.get(); }
         const KdTree& GetKdTree() const { return *m_kdTree.get(); }
+        const FeatureSearchIndex& GetSearchIndex() const { return *m_searchIndex.get(); }
+        BroadPhaseType GetBroadPhaseType() const { return m_broadPhaseType; }
         const AZStd::vector<Feature*>& GetFeaturesInKdTree() const { return m_featuresInKdTree; }
 
     protected:
@@ -88,6 +100,8 @@ namespace EMotionFX::MotionMatching
         AZStd::unique_ptr<FeatureMatrixTransformer> m_featureTransformer;
 
         AZStd::unique_ptr<KdTree> m_kdTree; //< The acceleration structure to speed up the search for lowest cost frames.
+        AZStd::unique_ptr<FeatureSearchIndex> m_searchIndex; //< Alternative acceleration structure, used instead of the KD-tree depending on the broad-phase type.
+        BroadPhaseType m_broadPhaseType = KdTreeBroadPhase;
         AZStd::vector<Feature*> m_featuresInKdTree;
     };
 } // namespace EMotionFX::MotionMatching
@@ -507,10 +507,10 @@ namespace EMotionFX::MotionMatching
             }
         }
 
-        // 2. Broad-phase search using KD-tree
+        // 2. Broad-phase search using the KD-tree or the search index
         if (mm_useKdTree)
         {
-            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhaseKDTree");
+            AZ_PROFILE_SCOPE(Animation, "MM::BroadPhase");
 
             AZStd::vector<float>& kdTreeQueryVector = m_kdTreeQueryVector.GetData();
             const AZStd::vector<float>& queryVectorData = m_queryVector.GetData();
@@ -525,7 +525,14 @@ namespace EMotionFX::MotionMatching
             AZ_Assert(startOffset == kdTreeQueryVector.size(), "Frame float vector is not the expected size.");
 
             // Find our nearest frames.
-            m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            if (m_data->GetBroadPhaseType() == MotionMatchingData::SearchIndexBroadPhase)
+            {
+                m_data->GetSearchIndex().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames, m_searchIndexBuffers);
+            }
+            else
+            {
+                m_data->GetKdTree().FindNearestNeighbors(kdTreeQueryVector, m_nearestFrames);
+            }
         }
 
         // 2. Narrow-phase, brute force find the actual best matching frame (frame with the minimal cost).
@@ -14,6 +14,7 @@
 
 #include <EMotionFX/Source/EMotionFXConfig.h>
 #include <Feature.h>
+#include <FeatureSearchIndex.h>
 #include <TrajectoryHistory.h>
 #include <TrajectoryQuery.h>
 
@@ -105,6 +106,7 @@ namespace EMotionFX::MotionMatching
         /// Buffers used for the broad-phase KD-tree search.
         QueryVector m_kdTreeQueryVector; //!< The input query for only the features that are present in the KD-tree.
         AZStd::vector<size_t> m_nearestFrames; //!< Stores the nearest matching frames / search result from the KD-tree.
+        FeatureSearchIndex::SearchBuffers m_searchIndexBuffers; //!< Temporary buffers reused by the search index broad-phase.
 
         FeatureTrajectory* m_cachedTrajectoryFeature = nullptr; //< Cached pointer to the trajectory feature in the feature schema.
         TrajectoryQuery m_trajectoryQuery;
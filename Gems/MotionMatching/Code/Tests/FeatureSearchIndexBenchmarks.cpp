@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/numeric.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <MCore/Source/MCoreSystem.h>
+
+#include <FeaturePosition.h>
+#include <FeatureSearchIndex.h>
+#include <FeatureVelocity.h>
+#include <FrameDatabase.h>
+#include <KdTree.h>
+
+namespace EMotionFX::MotionMatching
+{
+    // Compares the broad-phase search structures on a synthetic database with the layout of the default feature schema, positions and
+    // velocities of four joints. Each iteration searches a set of queries and runs a narrow-phase over the returned frames, so that the
+    // time includes the cost of the number of frames each structure passes on. The recall counter is the fraction of queries for which
+    // the narrow-phase ends up with the same frame as an exhaustive search.
+    class FeatureSearchIndexBenchmarkFixture
+        : public benchmark::Fixture
+    {
+    public:
+        static constexpr size_t NumJoints = 4;
+        static constexpr size_t NumLatentDimensions = 6;
+        static constexpr size_t NumQueries = 64;
+        static constexpr AZ::u32 SampleRate = 30;
+
+    private:
+        void internalSetUp(int64_t numFrames)
+        {
+            MCore::Initializer::Init();
+            EMotionFX::Initializer::Init();
+
+            m_motion = aznew Motion("FeatureSearchIndexBenchmark");
+            m_motion->SetMotionData(aznew NonUniformMotionData());
+            m_motion->GetMotionData()->SetDuration(aznumeric_cast<float>(numFrames) / aznumeric_cast<float>(SampleRate));
+
+            FrameDatabase::FrameImportSettings importSettings;
+            importSettings.m_sampleRate = SampleRate;
+            m_frameDatabase.ImportFrames(m_motion, importSettings, /*mirrored=*/false);
+
+            size_t numColumns = 0;
+            for (size_t i = 0; i < NumJoints; ++i)
+            {
+                m_features.emplace_back(aznew FeaturePosition());
+                m_features.emplace_back(aznew FeatureVelocity());
+            }
+            for (Feature* feature : m_features)
+            {
+                feature->SetColumnOffset(numColumns);
+                numColumns += feature->GetNumDimensions();
+            }
+
+            // Motion capture data is smooth and the joints move together, so the columns are mixed from a few slowly changing values.
+            AZ::SimpleLcgRandom random;
+            AZStd::vector<float> mixing(numColumns * NumLatentDimensions);
+            for (float& value : mixing)
+            {
+                value = random.GetRandomFloat() * 2.0f - 1.0f;
+            }
+
+            float latent[NumLatentDimensions] = {};
+            const size_t numRows = m_frameDatabase.GetNumFrames();
+            m_featureMatrix.resize(numRows, numColumns);
+            for (size_t row = 0; row < numRows; ++row)
+            {
+                for (float& value : latent)
+                {
+                    value = AZ::GetClamp(value + (random.GetRandomFloat() - 0.5f) * 0.1f, -1.0f, 1.0f);
+                }
+                for (size_t column = 0; column < numColumns; ++column)
+                {
+                    float value = (random.GetRandomFloat() - 0.5f) * 0.02f;
+                    for (size_t i = 0; i < NumLatentDimensions; ++i)
+                    {
+                        value += mixing[column * NumLatentDimensions + i] * latent[i];
+                    }
+                    m_featureMatrix(row, column) = value;
+                }
+            }
+
+            // Queries close to, but not exactly at, frames in the database.
+            m_queries.resize(NumQueries);
+            m_queryValues.clear();
+            for (AZStd::vector<float>& query : m_queries)
+            {
+                const size_t row = random.GetRandom() % numRows;
+                query.resize(numColumns);
+                for (size_t column = 0; column < numColumns; ++column)
+                {
+                    query[column] = m_featureMatrix(row, column) + (random.GetRandomFloat() - 0.5f) * 0.1f;
+                }
+                m_queryValues.insert(m_queryValues.end(), query.begin(), query.end());
+            }
+        }
+
+        void internalTearDown()
+        {
+            m_kdTree.Clear();
+            m_searchIndex.Clear();
+            m_frameDatabase.Clear();
+            m_featureMatrix.Clear();
+            for (Feature* feature : m_features)
+            {
+                delete feature;
+            }
+            m_features.clear();
+            m_queries = {};
+            m_queryValues = {};
+            delete m_motion;
+            m_motion = nullptr;
+
+            EMotionFX::Initializer::Shutdown();
+            MCore::Initializer::Shutdown();
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state.range(0));
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        // Simplified version of the narrow-phase in MotionMatchingInstance::FindLowestCostFrameIndex(), reading the candidate rows from the feature matrix.
+        size_t FindLowestCostFrame(const AZStd::vector<float>& query, const AZStd::vector<size_t>& frames) const
+        {
+            float minCost = FLT_MAX;
+            size_t minCostFrameIndex = 0;
+            for (const size_t frameIndex : frames)
+            {
+                const Frame& frame = m_frameDatabase.GetFrame(frameIndex);
+                if (frame.GetSampleTime() >= frame.GetSourceMotion()->GetDuration() - 1.0f)
+                {
+                    continue;
+                }
+
+                float cost = 0.0f;
+                for (size_t column = 0; column < query.size(); ++column)
+                {
+                    const float diff = m_featureMatrix(frameIndex, column) - query[column];
+                    cost += diff * diff;
+                }
+
+                if (cost < minCost)
+                {
+                    minCost = cost;
+                    minCostFrameIndex = frameIndex;
+                }
+            }
+            return minCostFrameIndex;
+        }
+
+        using SearchFunction = AZStd::function<void(const AZStd::vector<float>& query, AZStd::vector<size_t>& result)>;
+
+        void RunSearch(benchmark::State& state, const SearchFunction& search)
+        {
+            AZStd::vector<size_t> nearestFrames;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (const AZStd::vector<float>& query : m_queries)
+                {
+                    search(query, nearestFrames);
+                    benchmark::DoNotOptimize(FindLowestCostFrame(query, nearestFrames));
+                }
+            }
+            state.SetItemsProcessed(state.iterations() * NumQueries);
+
+            // Measure the quality outside of the timed loop.
+            AZStd::vector<size_t> allFrames(m_frameDatabase.GetNumFrames());
+            AZStd::iota(allFrames.begin(), allFrames.end(), size_t{ 0 });
+            size_t numCandidates = 0;
+            size_t numFound = 0;
+            for (const AZStd::vector<float>& query : m_queries)
+            {
+                search(query, nearestFrames);
+                numCandidates += nearestFrames.size();
+                if (FindLowestCostFrame(query, nearestFrames) == FindLowestCostFrame(query, allFrames))
+                {
+                    numFound++;
+                }
+            }
+            state.counters["candidates"] = aznumeric_cast<double>(numCandidates) / aznumeric_cast<double>(NumQueries);
+            state.counters["recall"] = aznumeric_cast<double>(numFound) / aznumeric_cast<double>(NumQueries);
+        }
+
+        void RunSearchIndex(benchmark::State& state, const FeatureSearchIndex::Settings& settings)
+        {
+            m_searchIndex.Init(m_frameDatabase, m_featureMatrix, m_features, settings);
+            RunSearch(state,
+                [this](const AZStd::vector<float>& query, AZStd::vector<size_t>& result)
+                {
+                    m_searchIndex.FindNearestNeighbors(query, result, m_searchBuffers);
+                });
+            state.counters["memory"] = aznumeric_cast<double>(m_searchIndex.CalcMemoryUsageInBytes());
+        }
+
+        Motion* m_motion = nullptr;
+        FrameDatabase m_frameDatabase;
+        FeatureMatrix m_featureMatrix;
+        AZStd::vector<Feature*> m_features;
+        AZStd::vector<AZStd::vector<float>> m_queries;
+        AZStd::vector<float> m_queryValues;
+        KdTree m_kdTree;
+        FeatureSearchIndex m_searchIndex;
+        FeatureSearchIndex::SearchBuffers m_searchBuffers;
+    };
+
+    BENCHMARK_DEFINE_F(FeatureSearchIndexBenchmarkFixture, KdTree)(benchmark::State& state)
+    {
+        // The default settings of the motion matching node.
+        m_kdTree.Init(m_frameDatabase, m_featureMatrix, m_features, /*maxDepth=*/15, /*minFramesPerLeaf=*/1000);
+        RunSearch(state,
+            [this](const AZStd::vector<float>& query, AZStd::vector<size_t>& result)
+            {
+                m_kdTree.FindNearestNeighbors(query, result);
+            });
+        state.counters["memory"] = aznumeric_cast<double>(m_kdTree.CalcMemoryUsageInBytes());
+    }
+
+    BENCHMARK_DEFINE_F(FeatureSearchIndexBenchmarkFixture, SearchIndex)(benchmark::State& state)
+    {
+        RunSearchIndex(state, FeatureSearchIndex::Settings{});
+    }
+
+    BENCHMARK_DEFINE_F(FeatureSearchIndexBenchmarkFixture, SearchIndexQuantized)(benchmark::State& state)
+    {
+        FeatureSearchIndex::Settings settings;
+        settings.m_quantize = true;
+        RunSearchIndex(state, settings);
+    }
+
+    BENCHMARK_DEFINE_F(FeatureSearchIndexBenchmarkFixture, SearchIndexPca)(benchmark::State& state)
+    {
+        FeatureSearchIndex::Settings settings;
+        settings.m_numPcaComponents = 8;
+        RunSearchIndex(state, settings);
+    }
+
+    BENCHMARK_DEFINE_F(FeatureSearchIndexBenchmarkFixture, SearchIndexPcaQuantized)(benchmark::State& state)
+    {
+        FeatureSearchIndex::Settings settings;
+        settings.m_numPcaComponents = 8;
+        settings.m_quantize = true;
+        RunSearchIndex(state, settings);
+    }
+
+    // Searches all queries with a single call, which reads the index once for the whole batch.
+    BENCHMARK_DEFINE_F(FeatureSearchIndexBenchmarkFixture, SearchIndexBatched)(benchmark::State& state)
+    {
+        m_searchIndex.Init(m_frameDatabase, m_featureMatrix, m_features, FeatureSearchIndex::Settings{});
+
+        AZStd::vector<size_t> nearestFrames[NumQueries];
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_searchIndex.FindNearestNeighbors(m_queryValues.data(), NumQueries, nearestFrames, m_searchBuffers);
+            for (size_t q = 0; q < NumQueries; ++q)
+            {
+                benchmark::DoNotOptimize(FindLowestCostFrame(m_queries[q], nearestFrames[q]));
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * NumQueries);
+    }
+
+    BENCHMARK_REGISTER_F(FeatureSearchIndexBenchmarkFixture, KdTree)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(FeatureSearchIndexBenchmarkFixture, SearchIndex)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(FeatureSearchIndexBenchmarkFixture, SearchIndexQuantized)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(FeatureSearchIndexBenchmarkFixture, SearchIndexPca)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(FeatureSearchIndexBenchmarkFixture, SearchIndexPcaQuantized)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(FeatureSearchIndexBenchmarkFixture, SearchIndexBatched)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+} // namespace EMotionFX::MotionMatching
+
+#endif // HAVE_BENCHMARK
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Random.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/numeric.h>
+#include <AzCore/std/sort.h>
+#include <Fixture.h>
+#include <FeatureSearchIndex.h>
+
+namespace EMotionFX::MotionMatching
+{
+    class FeatureSearchIndexFixture
+        : public Fixture
+    {
+    public:
+        static constexpr size_t NumFrames = 1001;
+        static constexpr size_t NumColumns = 8;
+
+        void SetUp() override
+        {
+            Fixture::SetUp();
+
+            // Index the columns [1, 6], so that the mapping to the feature matrix columns gets tested as well.
+            m_columns = { 1, 2, 3, 4, 5, 6 };
+            m_columnWeights = { 1.0f, 1.0f, 1.0f, 2.0f, 2.0f, 0.5f };
+            m_frameIndices.resize(NumFrames);
+            AZStd::iota(m_frameIndices.begin(), m_frameIndices.end(), size_t{ 0 });
+
+            m_featureMatrix.resize(NumFrames, NumColumns);
+            for (size_t row = 0; row < NumFrames; ++row)
+            {
+                for (size_t column = 0; column < NumColumns; ++column)
+                {
+                    m_featureMatrix(row, column) = m_random.GetRandomFloat() * 2.0f - 1.0f;
+                }
+            }
+        }
+
+        AZStd::vector<float> CreateQuery()
+        {
+            AZStd::vector<float> query(m_columns.size());
+            for (float& value : query)
+            {
+                value = m_random.GetRandomFloat() * 2.0f - 1.0f;
+            }
+            return query;
+        }
+
+        // Reference result, sorting all indexed frames by their weighted squared distance.
+        AZStd::vector<size_t> FindNearestBruteForce(const AZStd::vector<float>& query, size_t numCandidates) const
+        {
+            AZStd::vector<AZStd::pair<float, size_t>> distances;
+            for (const size_t frameIndex : m_frameIndices)
+            {
+                float distance = 0.0f;
+                for (size_t i = 0; i < m_columns.size(); ++i)
+                {
+                    const float diff = m_featureMatrix(frameIndex, m_columns[i]) - query[i];
+                    distance += diff * diff * m_columnWeights[i];
+                }
+                distances.emplace_back(distance, frameIndex);
+            }
+            AZStd::sort(distances.begin(), distances.end());
+
+            AZStd::vector<size_t> result;
+            for (size_t i = 0; i < AZ::GetMin(numCandidates, distances.size()); ++i)
+            {
+                result.emplace_back(distances[i].second);
+            }
+            return result;
+        }
+
+        static bool Contains(const AZStd::vector<size_t>& frames, size_t frameIndex)
+        {
+            return AZStd::find(frames.begin(), frames.end(), frameIndex) != frames.end();
+        }
+
+        AZ::SimpleLcgRandom m_random;
+        FeatureMatrix m_featureMatrix;
+        AZStd::vector<size_t> m_columns;
+        AZStd::vector<float> m_columnWeights;
+        AZStd::vector<size_t> m_frameIndices;
+    };
+
+    TEST_F(FeatureSearchIndexFixture, MatchesBruteForce)
+    {
+        FeatureSearchIndex::Settings settings;
+        settings.m_numCandidates = 16;
+
+        FeatureSearchIndex index;
+        ASSERT_TRUE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+        EXPECT_EQ(index.GetNumFrames(), NumFrames);
+        EXPECT_EQ(index.GetNumDimensions(), m_columns.size());
+        EXPECT_EQ(index.GetNumIndexDimensions(), m_columns.size());
+
+        AZStd::vector<size_t> result;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            const AZStd::vector<float> query = CreateQuery();
+            index.FindNearestNeighbors(query, result);
+            EXPECT_EQ(result, FindNearestBruteForce(query, settings.m_numCandidates));
+        }
+    }
+
+    TEST_F(FeatureSearchIndexFixture, BatchedMatchesSingleQueries)
+    {
+        FeatureSearchIndex::Settings settings;
+        settings.m_numCandidates = 8;
+
+        FeatureSearchIndex index;
+        ASSERT_TRUE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+
+        constexpr size_t numQueries = 7;
+        AZStd::vector<float> queries;
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            const AZStd::vector<float> query = CreateQuery();
+            queries.insert(queries.end(), query.begin(), query.end());
+        }
+
+        AZStd::vector<size_t> batchResults[numQueries];
+        index.FindNearestNeighbors(queries.data(), numQueries, batchResults);
+
+        AZStd::vector<size_t> result;
+        for (size_t q = 0; q < numQueries; ++q)
+        {
+            const AZStd::vector<float> query(queries.begin() + q * m_columns.size(), queries.begin() + (q + 1) * m_columns.size());
+            index.FindNearestNeighbors(query, result);
+            EXPECT_EQ(batchResults[q], result) << "Query " << q;
+        }
+    }
+
+    TEST_F(FeatureSearchIndexFixture, ReusedSearchBuffersMatchFreshSearches)
+    {
+        FeatureSearchIndex::Settings settings;
+        settings.m_numCandidates = 8;
+        settings.m_numPcaComponents = 2;
+
+        FeatureSearchIndex index;
+        ASSERT_TRUE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+
+        // Alternate between batches of different sizes, so the buffers hold leftovers from bigger and smaller searches.
+        FeatureSearchIndex::SearchBuffers searchBuffers;
+        AZStd::vector<size_t> result;
+        AZStd::vector<size_t> expectedResult;
+        constexpr size_t batchSizes[] = { 1, 5, 2, 5, 1 };
+        for (const size_t numQueries : batchSizes)
+        {
+            AZStd::vector<float> queries;
+            for (size_t q = 0; q < numQueries; ++q)
+            {
+                const AZStd::vector<float> query = CreateQuery();
+                queries.insert(queries.end(), query.begin(), query.end());
+            }
+
+            AZStd::vector<AZStd::vector<size_t>> batchResults(numQueries);
+            index.FindNearestNeighbors(queries.data(), numQueries, batchResults.data(), searchBuffers);
+
+            for (size_t q = 0; q < numQueries; ++q)
+            {
+                const AZStd::vector<float> query(queries.begin() + q * m_columns.size(), queries.begin() + (q + 1) * m_columns.size());
+                index.FindNearestNeighbors(query, expectedResult);
+                EXPECT_EQ(batchResults[q], expectedResult) << "Batch of " << numQueries << ", query " << q;
+
+                index.FindNearestNeighbors(query, result, searchBuffers);
+                EXPECT_EQ(result, expectedResult) << "Batch of " << numQueries << ", query " << q;
+            }
+        }
+    }
+
+    TEST_F(FeatureSearchIndexFixture, QuantizedFindsNearestFrame)
+    {
+        FeatureSearchIndex::Settings settings;
+        settings.m_numCandidates = 8;
+        settings.m_quantize = true;
+
+        FeatureSearchIndex index;
+        ASSERT_TRUE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+        EXPECT_TRUE(index.IsQuantized());
+
+        AZStd::vector<size_t> result;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            const AZStd::vector<float> query = CreateQuery();
+            index.FindNearestNeighbors(query, result);
+            ASSERT_EQ(result.size(), settings.m_numCandidates);
+            EXPECT_TRUE(Contains(result, FindNearestBruteForce(query, 1)[0]));
+        }
+    }
+
+    TEST_F(FeatureSearchIndexFixture, PcaWithAllComponentsMatchesBruteForce)
+    {
+        // Projecting onto all principal components is a rotation, which preserves the distances.
+        FeatureSearchIndex::Settings settings;
+        settings.m_numCandidates = 16;
+        settings.m_numPcaComponents = m_columns.size();
+
+        FeatureSearchIndex index;
+        ASSERT_TRUE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+        EXPECT_NEAR(index.GetExplainedVariance(), 1.0f, 1e-4f);
+
+        AZStd::vector<size_t> result;
+        for (size_t i = 0; i < 20; ++i)
+        {
+            const AZStd::vector<float> query = CreateQuery();
+            index.FindNearestNeighbors(query, result);
+
+            AZStd::vector<size_t> expected = FindNearestBruteForce(query, settings.m_numCandidates);
+            AZStd::sort(result.begin(), result.end());
+            AZStd::sort(expected.begin(), expected.end());
+            EXPECT_EQ(result, expected);
+        }
+    }
+
+    TEST_F(FeatureSearchIndexFixture, PcaReducesCorrelatedDimensions)
+    {
+        // Let the indexed columns depend on two latent values only.
+        for (size_t row = 0; row < NumFrames; ++row)
+        {
+            const float a = m_random.GetRandomFloat();
+            const float b = m_random.GetRandomFloat();
+            m_featureMatrix(row, 1) = a;
+            m_featureMatrix(row, 2) = b;
+            m_featureMatrix(row, 3) = a + b;
+            m_featureMatrix(row, 4) = a - b;
+            m_featureMatrix(row, 5) = 2.0f * a;
+            m_featureMatrix(row, 6) = -b;
+        }
+
+        FeatureSearchIndex::Settings settings;
+        settings.m_numCandidates = 4;
+        settings.m_numPcaComponents = 2;
+
+        FeatureSearchIndex index;
+        ASSERT_TRUE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+        EXPECT_EQ(index.GetNumIndexDimensions(), 2u);
+        EXPECT_NEAR(index.GetExplainedVariance(), 1.0f, 1e-4f);
+
+        // Query exactly at an indexed frame.
+        AZStd::vector<float> query(m_columns.size());
+        AZStd::vector<size_t> result;
+        for (size_t frameIndex : { size_t{ 0 }, size_t{ 123 }, size_t{ 1000 } })
+        {
+            for (size_t i = 0; i < m_columns.size(); ++i)
+            {
+                query[i] = m_featureMatrix(frameIndex, m_columns[i]);
+            }
+            index.FindNearestNeighbors(query, result);
+            EXPECT_TRUE(Contains(result, frameIndex));
+        }
+    }
+
+    TEST_F(FeatureSearchIndexFixture, OnlyReturnsIndexedFrames)
+    {
+        // Index every third frame only and request more candidates than there are frames.
+        m_frameIndices.clear();
+        for (size_t frameIndex = 0; frameIndex < 10; frameIndex += 3)
+        {
+            m_frameIndices.emplace_back(frameIndex);
+        }
+
+        FeatureSearchIndex::Settings settings;
+        settings.m_numCandidates = 64;
+
+        FeatureSearchIndex index;
+        ASSERT_TRUE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+
+        AZStd::vector<size_t> result;
+        const AZStd::vector<float> query = CreateQuery();
+        index.FindNearestNeighbors(query, result);
+        EXPECT_EQ(result, FindNearestBruteForce(query, settings.m_numCandidates));
+        EXPECT_EQ(result.size(), m_frameIndices.size());
+    }
+
+    TEST_F(FeatureSearchIndexFixture, ZeroWeightIgnoresColumn)
+    {
+        m_columnWeights = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+
+        FeatureSearchIndex::Settings settings;
+        settings.m_numCandidates = 1;
+
+        FeatureSearchIndex index;
+        ASSERT_TRUE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+
+        // A query matching frame 42 in all but the ignored column.
+        AZStd::vector<float> query(m_columns.size());
+        for (size_t i = 0; i < m_columns.size(); ++i)
+        {
+            query[i] = m_featureMatrix(42, m_columns[i]);
+        }
+        query.back() = 100.0f;
+
+        AZStd::vector<size_t> result;
+        index.FindNearestNeighbors(query, result);
+        ASSERT_EQ(result.size(), 1u);
+        EXPECT_EQ(result[0], 42u);
+    }
+
+    TEST_F(FeatureSearchIndexFixture, InvalidSettings)
+    {
+        FeatureSearchIndex index;
+        FeatureSearchIndex::Settings settings;
+
+        settings.m_numCandidates = 0;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        settings.m_numCandidates = 8;
+        settings.m_numPcaComponents = m_columns.size() + 1;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(index.Init(m_featureMatrix, m_columns, m_columnWeights, m_frameIndices, settings));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        EXPECT_FALSE(index.IsInitialized());
+    }
+} // EMotionFX::MotionMatching
@@ -56,6 +56,8 @@ set(FILES
     Source/ImGuiMonitorBus.h
     Source/KdTree.cpp
     Source/KdTree.h
+    Source/FeatureSearchIndex.cpp
+    Source/FeatureSearchIndex.h
     Source/MotionMatchingData.cpp
     Source/MotionMatchingData.h
     Source/MotionMatchingInstance.cpp
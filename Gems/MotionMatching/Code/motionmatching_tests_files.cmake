@@ -10,6 +10,8 @@ set(FILES
     Tests/Fixture.h
     Tests/FeatureMatrixTests.cpp
     Tests/FeatureSchemaTests.cpp
+    Tests/FeatureSearchIndexBenchmarks.cpp
+    Tests/FeatureSearchIndexTests.cpp
     Tests/MinMaxScalerTests.cpp
     Tests/MotionMatchingTest.cpp
     Tests/StandardScalerTests.cpp
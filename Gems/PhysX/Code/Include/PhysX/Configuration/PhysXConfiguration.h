@@ -9,6 +9,7 @@
 #pragma once
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Physics/Configuration/SystemConfiguration.h>
 
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
@@ -39,6 +40,27 @@ namespace PhysX
         bool operator!=(const WindConfiguration& other) const;
     };
 
+    //! Settings of the worker threads that run the tasks of the PhysX simulation.
+    //! They are applied when the PhysX system is initialized.
+    class CpuDispatcherConfiguration
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+        AZ_TYPE_INFO(PhysX::CpuDispatcherConfiguration, "{8D2B4E71-53A6-4C0F-9E18-2F6B7C3A9D45}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! Number of worker threads. 0 uses one thread per hardware thread, minus the thread that waits for the simulation results.
+        AZ::u32 m_workerThreadCount = 0;
+        //! Platform specific priority of the worker threads, see AZStd::thread_desc::m_priority.
+        //! The default value leaves the platform default priority.
+        int m_workerThreadPriority = AZStd::thread_desc{}.m_priority;
+        //! Bitmask of the CPU cores the worker threads can run on, see AZStd::thread_desc::m_cpuId.
+        int m_workerThreadAffinityMask = AZStd::thread_desc{}.m_cpuId;
+
+        bool operator==(const CpuDispatcherConfiguration& other) const;
+        bool operator!=(const CpuDispatcherConfiguration& other) const;
+    };
+
     //! Contains global physics settings.
     //! Used to initialize the Physics System.
     struct PhysXSystemConfiguration : public AzPhysics::SystemConfiguration
@@ -50,6 +72,7 @@ namespace PhysX
         static PhysXSystemConfiguration CreateDefault();
 
         WindConfiguration m_windConfiguration; //!< Wind configuration for PhysX.
+        CpuDispatcherConfiguration m_cpuDispatcherConfiguration; //!< Worker threads running the PhysX simulation tasks.
 
         bool operator==(const PhysXSystemConfiguration& other) const;
         bool operator!=(const PhysXSystemConfiguration& other) const;
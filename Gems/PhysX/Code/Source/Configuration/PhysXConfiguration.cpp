@@ -40,6 +40,7 @@ namespace PhysX
     }
 
     AZ_CLASS_ALLOCATOR_IMPL(WindConfiguration, AZ::SystemAllocator);
+    AZ_CLASS_ALLOCATOR_IMPL(CpuDispatcherConfiguration, AZ::SystemAllocator);
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystemConfiguration, AZ::SystemAllocator);
 
     /*static*/ void WindConfiguration::Reflect(AZ::ReflectContext* context)
@@ -82,16 +83,62 @@ namespace PhysX
         return !(*this == other);
     }
 
+    /*static*/ void CpuDispatcherConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PhysX::CpuDispatcherConfiguration>()
+                ->Version(1)
+                ->Field("WorkerThreadCount", &CpuDispatcherConfiguration::m_workerThreadCount)
+                ->Field("WorkerThreadPriority", &CpuDispatcherConfiguration::m_workerThreadPriority)
+                ->Field("WorkerThreadAffinityMask", &CpuDispatcherConfiguration::m_workerThreadAffinityMask)
+                ;
+
+            if (AZ::EditContext* editContext = serialize->GetEditContext())
+            {
+                editContext->Class<PhysX::CpuDispatcherConfiguration>("CPU Dispatcher Configuration", "Worker threads running the PhysX simulation.")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &CpuDispatcherConfiguration::m_workerThreadCount,
+                        "Worker thread count",
+                        "Number of threads running the PhysX simulation tasks.\n"
+                        "0 uses one thread per hardware thread, minus the thread waiting for the simulation results.")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &CpuDispatcherConfiguration::m_workerThreadPriority,
+                        "Worker thread priority",
+                        "Platform specific priority of the worker threads.")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &CpuDispatcherConfiguration::m_workerThreadAffinityMask,
+                        "Worker thread affinity mask",
+                        "Bitmask of the CPU cores the worker threads can run on.")
+                    ;
+            }
+        }
+    }
+
+    bool CpuDispatcherConfiguration::operator==(const CpuDispatcherConfiguration& other) const
+    {
+        return m_workerThreadCount == other.m_workerThreadCount &&
+            m_workerThreadPriority == other.m_workerThreadPriority &&
+            m_workerThreadAffinityMask == other.m_workerThreadAffinityMask
+            ;
+    }
+
+    bool CpuDispatcherConfiguration::operator!=(const CpuDispatcherConfiguration& other) const
+    {
+        return !(*this == other);
+    }
+
     /*static*/ void PhysXSystemConfiguration::Reflect(AZ::ReflectContext* context)
     {
         AzPhysics::SystemConfiguration::Reflect(context);
         WindConfiguration::Reflect(context);
+        CpuDispatcherConfiguration::Reflect(context);
 
         if (auto* serializeContext = azdynamic_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<PhysX::PhysXSystemConfiguration, AzPhysics::SystemConfiguration>()
-                ->Version(2, &PhysXInternal::PhysXSystemConfigurationConverter)
+                ->Version(3, &PhysXInternal::PhysXSystemConfigurationConverter)
                 ->Field("WindConfiguration", &PhysXSystemConfiguration::m_windConfiguration)
+                ->Field("CpuDispatcherConfiguration", &PhysXSystemConfiguration::m_cpuDispatcherConfiguration)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -115,7 +162,8 @@ namespace PhysX
     bool PhysXSystemConfiguration::operator==(const PhysXSystemConfiguration& other) const
     {
         return AzPhysics::SystemConfiguration::operator==(other) &&
-            m_windConfiguration == other.m_windConfiguration
+            m_windConfiguration == other.m_windConfiguration &&
+            m_cpuDispatcherConfiguration == other.m_cpuDispatcherConfiguration
             ;
     }
 
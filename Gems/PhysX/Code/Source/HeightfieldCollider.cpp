@@ -29,15 +29,18 @@ namespace PhysX
 {
     AZ_CVAR(size_t, physx_heightfieldColliderUpdateRegionSize, 512 * 512, nullptr,
         AZ::ConsoleFunctorFlags::Null,
-        "Max size of a heightfield collider update region in heightfield points, used for partitioning updates for faster cancellation. "
-        "Each update will be the largest number of heightfield rows that stays below this total point count threshold.");
-
-    // The HeightfieldUpdateJobContext is an extremely simplified way to manage the background update jobs.
-    // On any heightfield change, the collider code will cancel any update job that's currently running, wait for it
-    // to complete, and then start a new update job.
-    // Also, on HeightfieldCollider destruction, any running jobs will get canceled and block on completion.
-    // Eventually, this could get migrated to a more complex system that allows for overlapping jobs, or potentially using a queue
-    // of regions to update in a currently-running job.
+        "Max size of a heightfield collider update pass in heightfield points, used for partitioning updates for faster cancellation. "
+        "Each pass refreshes whole dirty tiles until it reaches this total point count, and applies them to the physics scene at once.");
+
+    AZ_CVAR(size_t, physx_heightfieldColliderTileSize, 128, nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "Width and height of the tiles, in heightfield points, that a heightfield collider tracks changes in. "
+        "Only the tiles that overlap a change get refreshed. Changes take effect the next time a heightfield collider is rebuilt.");
+
+    // The HeightfieldUpdateJobContext is a simple way to manage the background update jobs.
+    // Data changes don't interact with the job context at all, since a running chain of update passes picks up any newly dirtied
+    // tiles on its own. Only a full rebuild of the heightfield, or HeightfieldCollider destruction, will cancel the running update
+    // jobs and block on their completion.
     void HeightfieldCollider::HeightfieldUpdateJobContext::Cancel()
     {
         m_isCanceled = true;
@@ -53,15 +56,16 @@ namespace PhysX
         // When the update job starts, track that it has started and that we shouldn't cancel anything yet.
         AZStd::unique_lock<AZStd::mutex> lock(m_jobsRunningNotificationMutex);
         m_isCanceled = false;
-        m_refreshInProgress = true;
+        m_refreshesInProgress++;
     }
 
     void HeightfieldCollider::HeightfieldUpdateJobContext::OnRefreshComplete()
     {
-        // On completion, track that the job has finished, and notify any listneers that it's done.
+        // On completion, track that the job has finished, and notify any listeners that it's done.
         {
             AZStd::unique_lock<AZStd::mutex> lock(m_jobsRunningNotificationMutex);
-            m_refreshInProgress = false;
+            AZ_Assert(m_refreshesInProgress > 0, "Heightfield refresh completed without being started.");
+            m_refreshesInProgress--;
         }
         m_jobsRunning.notify_all();
     }
@@ -74,47 +78,88 @@ namespace PhysX
             lock,
             [this]
             {
-                return !m_refreshInProgress;
+                return m_refreshesInProgress == 0;
             });
     }
 
 
-    HeightfieldCollider::DirtyHeightfieldRegion::DirtyHeightfieldRegion()
+    void HeightfieldCollider::DirtyHeightfieldTiles::Reset(size_t numColumnVertices, size_t numRowVertices, size_t tileSize)
     {
-        SetNull();
+        m_numColumnVertices = numColumnVertices;
+        m_numRowVertices = numRowVertices;
+        m_tileSize = AZStd::max(tileSize, static_cast<size_t>(1));
+        m_numTileColumns = (numColumnVertices + m_tileSize - 1) / m_tileSize;
+        m_numTileRows = (numRowVertices + m_tileSize - 1) / m_tileSize;
+        m_numDirtyTiles = m_numTileColumns * m_numTileRows;
+        m_dirtyTiles.assign(m_numDirtyTiles, true);
     }
 
-    void HeightfieldCollider::DirtyHeightfieldRegion::SetNull()
+    void HeightfieldCollider::DirtyHeightfieldTiles::AddRegion(size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
     {
-        m_minRowVertex = AZStd::numeric_limits<size_t>::max();
-        m_minColumnVertex = AZStd::numeric_limits<size_t>::max();
-        m_maxRowVertex = AZStd::numeric_limits<size_t>::lowest();
-        m_maxColumnVertex = AZStd::numeric_limits<size_t>::lowest();
+        const size_t endColumn = AZStd::min(startColumn + numColumns, m_numColumnVertices);
+        const size_t endRow = AZStd::min(startRow + numRows, m_numRowVertices);
+        if ((startColumn >= endColumn) || (startRow >= endRow))
+        {
+            return;
+        }
+
+        for (size_t tileRow = startRow / m_tileSize; tileRow <= (endRow - 1) / m_tileSize; tileRow++)
+        {
+            for (size_t tileColumn = startColumn / m_tileSize; tileColumn <= (endColumn - 1) / m_tileSize; tileColumn++)
+            {
+                const size_t tileIndex = (tileRow * m_numTileColumns) + tileColumn;
+                if (!m_dirtyTiles[tileIndex])
+                {
+                    m_dirtyTiles[tileIndex] = true;
+                    m_numDirtyTiles++;
+                }
+            }
+        }
     }
 
-    void HeightfieldCollider::DirtyHeightfieldRegion::AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId)
+    void HeightfieldCollider::DirtyHeightfieldTiles::AddTile(const HeightfieldTile& tile)
     {
-        size_t startRowVertex = 0;
-        size_t startColumnVertex = 0;
-        size_t numRowVertices = 0;
-        size_t numColumnVertices = 0;
+        AddRegion(tile.m_startColumn, tile.m_startRow, tile.m_numColumns, tile.m_numRows);
+    }
+
+    AZStd::vector<HeightfieldCollider::HeightfieldTile> HeightfieldCollider::DirtyHeightfieldTiles::TakeTiles(size_t maxPoints)
+    {
+        AZStd::vector<HeightfieldTile> tiles;
+        size_t numPoints = 0;
+
+        for (size_t tileIndex = 0; (tileIndex < m_dirtyTiles.size()) && (m_numDirtyTiles > 0) && (numPoints < maxPoints); tileIndex++)
+        {
+            if (m_dirtyTiles[tileIndex])
+            {
+                m_dirtyTiles[tileIndex] = false;
+                m_numDirtyTiles--;
 
-        Physics::HeightfieldProviderRequestsBus::Event(
-            entityId,
-            &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
-            dirtyRegion,
-            startColumnVertex,
-            startRowVertex,
-            numColumnVertices,
-            numRowVertices);
+                tiles.emplace_back(GetTile(tileIndex));
+                numPoints += tiles.back().m_numColumns * tiles.back().m_numRows;
+            }
+        }
 
-        m_minRowVertex = AZStd::min(m_minRowVertex, startRowVertex);
-        m_minColumnVertex = AZStd::min(m_minColumnVertex, startColumnVertex);
-        // Note that if the heightfield size has decreased, these numbers can end up larger than the total current heightfield size.
-        m_maxRowVertex = AZStd::max(m_maxRowVertex, startRowVertex + numRowVertices);
-        m_maxColumnVertex = AZStd::max(m_maxColumnVertex, startColumnVertex + numColumnVertices);
+        return tiles;
+    }
+
+    HeightfieldCollider::HeightfieldTile HeightfieldCollider::DirtyHeightfieldTiles::GetTile(size_t tileIndex) const
+    {
+        HeightfieldTile tile;
+        tile.m_startColumn = (tileIndex % m_numTileColumns) * m_tileSize;
+        tile.m_startRow = (tileIndex / m_numTileColumns) * m_tileSize;
+        tile.m_numColumns = AZStd::min(m_tileSize, m_numColumnVertices - tile.m_startColumn);
+        tile.m_numRows = AZStd::min(m_tileSize, m_numRowVertices - tile.m_startRow);
+        return tile;
     }
 
+    struct HeightfieldCollider::RefreshPass
+    {
+        //! The tiles to refresh in this pass.
+        AZStd::vector<HeightfieldTile> m_tiles;
+
+        //! The converted PhysX samples for each tile, filled in by the cook jobs.
+        AZStd::vector<Utils::HeightfieldSampleRegion> m_cookedTiles;
+    };
 
 
     HeightfieldCollider::HeightfieldCollider(
@@ -193,6 +238,10 @@ namespace PhysX
             sceneInterface->RemoveSimulatedBody(m_attachedSceneHandle, m_staticRigidBodyHandle);
         }
 
+        // The refresh passes also hold onto the shape while they're running, so make sure they've let go of it.
+        m_refreshShape.reset();
+        m_refreshScene = nullptr;
+
         // Now we can safely clear out the cached heightfield pointer.
         m_shapeConfig->SetCachedNativeHeightfield(nullptr);
     }
@@ -280,41 +329,178 @@ namespace PhysX
         }
     }
 
-    void HeightfieldCollider::UpdatePhysXHeightfieldRows(
-        AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape,
-        size_t startColumn, size_t startRow, size_t numColumns, size_t numRows)
+    void HeightfieldCollider::CookTile(RefreshPass& refreshPass, size_t tileIndex)
     {
-        // This method is called by an update job to update a portion of the PhysX heightfield to contain the latest heightfield data.
+        // This method is called by a cook job once the shape configuration has been updated for every tile in the pass.
+
+        if (m_jobContext->IsCanceled())
+        {
+            return;
+        }
+
+        const HeightfieldTile& tile = refreshPass.m_tiles[tileIndex];
+        Utils::HeightfieldSampleRegion& cookedTile = refreshPass.m_cookedTiles[tileIndex];
+
+        // The PhysX material indices for each vertex come from the vertices below and to the right of it, so the column and row
+        // just before the tile depend on the tile's data and need to be converted again as well.
+        cookedTile.m_startCol = (tile.m_startColumn > 0) ? (tile.m_startColumn - 1) : 0;
+        cookedTile.m_startRow = (tile.m_startRow > 0) ? (tile.m_startRow - 1) : 0;
+        cookedTile.m_numCols = (tile.m_startColumn + tile.m_numColumns) - cookedTile.m_startCol;
+        cookedTile.m_numRows = (tile.m_startRow + tile.m_numRows) - cookedTile.m_startRow;
+
+        // Every tile in the pass has finished updating the shape configuration before any tile gets cooked, so the neighboring
+        // vertices that this reads can't be modified while it's running.
+        cookedTile.m_samples = Utils::ConvertHeightfieldSamples(
+            *m_shapeConfig, cookedTile.m_startCol, cookedTile.m_startRow, cookedTile.m_numCols, cookedTile.m_numRows);
+    }
+
+    void HeightfieldCollider::ApplyRefreshPass(AZStd::shared_ptr<RefreshPass> refreshPass)
+    {
+        // This method is called by an update job once every tile in the pass has been cooked.
+
+        const bool isCanceled = m_jobContext->IsCanceled();
 
-        if (!m_jobContext->IsCanceled() && (numRows > 0) && (numColumns > 0))
+        if (!isCanceled && m_refreshShape)
         {
-            // Refresh a subset of the PhysX heightfield.
-            // This assumes that the shape configuration for this region has already been updated.
+            // Write all the tiles into the PhysX heightfield at once, so that the scene never contains a partially applied pass.
             // NOTE: For a given heightfield, only one of these calls should be executed at a time, since the underlying PhysX
             // heightfield has no thread safety protections and modifies min/max height data global to the heightfield on every refresh.
-            Utils::RefreshHeightfieldShape(scene, &(*shape), *m_shapeConfig, startColumn, startRow, numColumns, numRows);
+            // This is guaranteed by only ever having one pass running at a time.
+            Utils::RefreshHeightfieldShape(m_refreshScene, m_refreshShape.get(), *m_shapeConfig, refreshPass->m_cookedTiles);
 
-            // Reduce our dirty region by the number of rows that we're processing in this piece of the update job chain.
-            // We've updated both the shape configuration and the PhysX heightfield at this point, so those rows have completed
-            // their update. Even if we cancel the job at this point, we'll only need to reprocess these rows if data in those rows
-            // have changed.
-            // This dirty region logic assumes that we're updating all dirty columns for a row on every call. If this assumption
-            // ever changes, we'll need more complicated dirty region logic to track which columns in each row are dirty.
-            m_dirtyRegion.m_minRowVertex = startRow + numRows;
+            // Notify any listeners that the collider has changed after every pass, so that a steady stream of terrain changes
+            // doesn't keep them from ever seeing the updated collider.
+            Physics::ColliderComponentEventBus::Event(m_entityId, &Physics::ColliderComponentEvents::OnColliderChanged);
+        }
+
+        AZStd::vector<HeightfieldTile> nextTiles;
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_dirtyTilesMutex);
+
+            if (isCanceled)
+            {
+                // Keep the tiles from this pass dirty, since they were never written to the PhysX heightfield.
+                for (const HeightfieldTile& tile : refreshPass->m_tiles)
+                {
+                    m_dirtyTiles.AddTile(tile);
+                }
+            }
+            else
+            {
+                // Pick up any tiles that were dirtied while this pass was running.
+                nextTiles = m_dirtyTiles.TakeTiles(physx_heightfieldColliderUpdateRegionSize);
+            }
+
+            if (nextTiles.empty())
+            {
+                m_refreshPassRunning = false;
+                m_refreshShape.reset();
+                m_refreshScene = nullptr;
+            }
+        }
+
+        if (nextTiles.empty())
+        {
+            RefreshComplete();
+        }
+        else
+        {
+            StartRefreshPass(AZStd::move(nextTiles));
         }
     }
 
-    void HeightfieldCollider::RefreshComplete()
+    void HeightfieldCollider::StartRefreshPass(AZStd::vector<HeightfieldTile>&& tiles)
     {
-        // This method is called by an update job to signal that the chain of update jobs have completed.
+        auto refreshPass = AZStd::make_shared<RefreshPass>();
+        refreshPass->m_tiles = AZStd::move(tiles);
+        refreshPass->m_cookedTiles.resize(refreshPass->m_tiles.size());
+
+        constexpr bool autoDelete = true;
+
+        // The work for refreshing a set of tiles is broken up into a series of jobs designed to maximize parallelization, avoid jobs
+        // blocking on other jobs, and to respond to cancellation requests reasonably quickly.
+        //
+        // Usc = UpdateShapeConfigJob
+        // Csc = UpdateShapeConfigCompleteJob
+        // SCU = ShapeConfigUpdatedJob
+        // Ck  = CookTileJob
+        // Ap  = ApplyRefreshPassJob
+        //
+        // Usc1 -> Csc1 \        / Ck1 \
+        // Usc2 -> Csc2 --> SCU --> Ck2 --> Ap
+        // Usc3 -> Csc3 /        \ Ck3 /
+        //
+        // Every tile updates its shape configuration data in parallel, and then every tile converts its data to PhysX samples in
+        // parallel. The conversion waits for every tile to finish its update, because the material indices on the edge of a tile
+        // depend on the data in the neighboring tiles. The final Apply job writes every tile into the PhysX heightfield at once,
+        // and then either starts the next pass, or triggers RefreshComplete to signify that all the work is completed.
+        //
+        // For simplicity in managing the job chain, the entire chain of jobs is still triggered on cancellation, but all
+        // of the updating logic is skipped.
+
+        auto* applyJob = AZ::CreateJobFunction(
+            [this, refreshPass]()
+            {
+                ApplyRefreshPass(refreshPass);
+            },
+            autoDelete, m_jobContext.get());
+
+        auto* shapeConfigUpdatedJob = aznew AZ::MultipleDependentJob(autoDelete, m_jobContext.get());
+
+        AZStd::vector<AZ::Job*> updateShapeConfigJobs;
+        AZStd::vector<AZ::Job*> cookTileJobs;
+        updateShapeConfigJobs.reserve(refreshPass->m_tiles.size());
+        cookTileJobs.reserve(refreshPass->m_tiles.size());
 
-        // If the job hasn't been canceled, notify any listeners that the collider has changed.
-        if (!m_jobContext->IsCanceled())
+        for (size_t tileIndex = 0; tileIndex < refreshPass->m_tiles.size(); tileIndex++)
         {
-            m_dirtyRegion.SetNull();
-            Physics::ColliderComponentEventBus::Event(m_entityId, &Physics::ColliderComponentEvents::OnColliderChanged);
+            const HeightfieldTile& tile = refreshPass->m_tiles[tileIndex];
+
+            auto* updateShapeConfigCompleteJob = aznew AZ::MultipleDependentJob(autoDelete, m_jobContext.get());
+
+            auto* updateShapeConfigJob = AZ::CreateJobFunction(
+                AZStd::bind(&HeightfieldCollider::UpdateShapeConfigRows,
+                    this, updateShapeConfigCompleteJob, tile.m_startColumn, tile.m_startRow, tile.m_numColumns, tile.m_numRows),
+                    autoDelete, m_jobContext.get());
+
+            auto* cookTileJob = AZ::CreateJobFunction(
+                [this, refreshPass, tileIndex]()
+                {
+                    CookTile(*refreshPass, tileIndex);
+                },
+                autoDelete, m_jobContext.get());
+
+            // Set up the dependencies:
+            // UpdateShapeConfigJob -> UpdateShapeConfigCompleteJob -> ShapeConfigUpdatedJob -> CookTileJob -> ApplyRefreshPassJob
+            updateShapeConfigJob->SetDependent(updateShapeConfigCompleteJob);
+            updateShapeConfigCompleteJob->AddDependent(shapeConfigUpdatedJob);
+            shapeConfigUpdatedJob->AddDependent(cookTileJob);
+            cookTileJob->SetDependent(applyJob);
+
+            updateShapeConfigJobs.emplace_back(updateShapeConfigJob);
+            cookTileJobs.emplace_back(cookTileJob);
         }
 
+        // Start all the jobs except the UpdateShapeConfigComplete jobs.
+        // None of the jobs will actually start until all their dependencies are met, this just "primes" them so that they'll start
+        // as soon as they can.
+        // The completion jobs are started from the completion callback that's provided to UpdateHeightsAndMaterialsAsync. This
+        // effectively lets us create an implicit dependency on all the jobs created by that API, because until we start the
+        // completion jobs, nothing downstream from them can start either.
+        for (size_t jobIndex = 0; jobIndex < updateShapeConfigJobs.size(); jobIndex++)
+        {
+            updateShapeConfigJobs[jobIndex]->Start();
+            cookTileJobs[jobIndex]->Start();
+        }
+
+        shapeConfigUpdatedJob->Start();
+        applyJob->Start();
+    }
+
+    void HeightfieldCollider::RefreshComplete()
+    {
+        // This method is called by an update job to signal that the chain of update passes has completed.
+
         // Notify the job context that the job is completed, so that anything blocking on job completion knows it can proceed.
         m_jobContext->OnRefreshComplete();
     }
@@ -374,10 +560,9 @@ namespace PhysX
         // There are two refresh possibilities - resizing the area or updating the data.
         // Resize: we need to cancel any running jobs, wait for them to finish, resize the area, and kick them off again.
         //   PhysX heightfields need to have a static number of points, so a resize requires a complete rebuild of the heightfield.
-        // Update: technically, we could get more clever with updates, and potentially keep the same job chain running with a running list
-        //   of update regions. But for now, we're keeping it simple. Our update job will update in multiples of heightfield rows so
-        //   that we can incrementally shrink the update region as we finish updating pieces of it and cancel at a more granular level.
-        //   On a new update, we can then cancel the job, grow our update region as needed, and start the job chain back up again.
+        // Update: the heightfield is tracked as a grid of tiles, and an update only marks the tiles that overlap the update region
+        //   as dirty. If a refresh is already running, it picks up the newly dirtied tiles in its next pass, so updates never need to
+        //   cancel or wait on the running jobs, and only the dirty tiles get refreshed.
 
         // If we don't have a shape configuration yet, or if the configuration itself changed, we need to recreate the entire heightfield.
         bool shouldRecreateHeightfield = (m_shapeConfig == nullptr) ||
@@ -394,13 +579,14 @@ namespace PhysX
             shouldRecreateHeightfield = shouldRecreateHeightfield || (baseConfiguration.GetMaxHeightBounds() != m_shapeConfig->GetMaxHeightBounds());
         }
 
-        // If the update job is running, stop it and wait for it to complete.
-        m_jobContext->Cancel();
-        m_jobContext->BlockUntilComplete();
-
         // If our heightfield has changed size, recreate the configuration and initialize it.
         if (shouldRecreateHeightfield)
         {
+            // If the update job is running, stop it and wait for it to complete, since it's writing into the heightfield
+            // that's about to get destroyed.
+            m_jobContext->Cancel();
+            m_jobContext->BlockUntilComplete();
+
             // Destroy the existing heightfield. This will completely remove it from the world.
             ClearHeightfield();
 
@@ -413,6 +599,11 @@ namespace PhysX
                 AZStd::vector<Physics::HeightMaterialPoint> samples(numSamples);
                 m_shapeConfig->SetSamples(AZStd::move(samples));
             }
+
+            // Every tile of the new heightfield needs to be filled in, regardless of the size of the request region.
+            AZStd::unique_lock<AZStd::mutex> lock(m_dirtyTilesMutex);
+            m_dirtyTiles.Reset(
+                m_shapeConfig->GetNumColumnVertices(), m_shapeConfig->GetNumRowVertices(), physx_heightfieldColliderTileSize);
         }
 
         // If our new size is "none", we're done.
@@ -427,135 +618,57 @@ namespace PhysX
             // request the rigid body even while we're asynchronously updating the heightfield itself on a separate thread.
             InitStaticRigidBody();
         }
-
-        // Add the new request region to our dirty heightfield region
-        m_dirtyRegion.AddAabb(requestRegion, m_entityId);
-
-        AZ_Assert(m_dirtyRegion.m_maxRowVertex >= m_dirtyRegion.m_minRowVertex,
-            "Invalid dirty region (min=%zu max=%zu)", m_dirtyRegion.m_minRowVertex, m_dirtyRegion.m_maxRowVertex);
-
-        AZ_Assert(m_dirtyRegion.m_maxColumnVertex >= m_dirtyRegion.m_minColumnVertex,
-            "Invalid dirty region (min=%zu max=%zu)", m_dirtyRegion.m_maxColumnVertex, m_dirtyRegion.m_minColumnVertex);
-
-        // If our heightfield size has just shrunk and we had a pre-existing dirty region, the max vertex values could be higher than
-        // our current size, so clamp them to the current size.
-        m_dirtyRegion.m_maxRowVertex = AZStd::min(m_dirtyRegion.m_maxRowVertex, m_shapeConfig->GetNumRowVertices());
-        m_dirtyRegion.m_maxColumnVertex = AZStd::min(m_dirtyRegion.m_maxColumnVertex, m_shapeConfig->GetNumColumnVertices());
-
-        size_t startColumn = m_dirtyRegion.m_minColumnVertex;
-        size_t numColumns = m_dirtyRegion.m_maxColumnVertex - m_dirtyRegion.m_minColumnVertex;
-        size_t numRows = m_dirtyRegion.m_maxRowVertex - m_dirtyRegion.m_minRowVertex;
-
-        // If our dirty region is too small to affect any vertices, early-out.
-        if ((numRows == 0) || (numColumns == 0))
+        else
         {
-            return;
-        }
-
-        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
-        auto* scene = physicsSystem->GetScene(m_attachedSceneHandle);
-
-        auto shape = GetHeightfieldShape();
+            size_t startRowVertex = 0;
+            size_t startColumnVertex = 0;
+            size_t numRowVertices = 0;
+            size_t numColumnVertices = 0;
 
-        // Get the number of rows to update in each job. We subdivide the region into multiple jobs when processing
-        // so that cancellation requests can be detected and processed more quickly. If we just processed a single full dirty region,
-        // regardless of size, there would be a lot more work that needs to complete before we could cancel a job.
-        const size_t rowsPerUpdate = AZStd::max(physx_heightfieldColliderUpdateRegionSize / numColumns, static_cast<size_t>(1));
-
-        AZStd::vector<AZ::Job*> updateShapeConfigJobs;
-        AZStd::vector<AZ::MultipleDependentJob*> updateShapeConfigCompleteJobs;
-        AZStd::vector<AZ::Job*> updatePhysXHeightfieldJobs;
-
-        constexpr bool autoDelete = true;
-
-        // The work for refreshing a heightfield is broken up into a series of jobs designed to maximize parallelization, avoid jobs
-        // blocking on other jobs, and to respond to cancellation requests reasonably quickly.
-        // 
-        // For each block of rows being processed we do the following:
-        // UpdateShapeConfigJob -> (UpdateHeightsAndMaterialsAsync) -> UpdateShapeConfigCompleteJob -> UpdatePhysXHeightfieldJob
-        // i.e. we update the shape configuration, then we update the PhysX Heightfield
-        // The final UpdatePhysXHeightfieldJob triggers the RefreshCompleteJob to signify that all the work is completed.
-        // 
-        // For simplicity in managing the job chain, the entire chain of jobs is still triggered on cancellation, but all
-        // of the updating logic is skipped.
-        //
-        // For better parallelization, we set up the job dependencies to overlap the jobs like this:
-        // Usc = UpdateShapeConfigJob
-        // Csc = UpdateShapeConfigCompleteJob
-        // Uph = UpdatePhysXHeightfieldJob
-        // RC  = RefreshCompleteJob
-        //
-        // Usc1 -> Csc1 -> Usc2 -> Csc2 -> Usc3 -> Csc3
-        //             \-> Uph1 ---->  \-> Uph2 ---->  \-> Uph3 -> RC
-        // Basically, the UpdateShapeConfig runs in parallel with the UpdatePhysXHeightfield, but each type of update runs sequentially
-        // to avoid threading update problems, and the UpdatePhysXHeightfield step can't run until the UpdateShapeConfig step it depends
-        // on is complete.
+            Physics::HeightfieldProviderRequestsBus::Event(
+                m_entityId,
+                &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion,
+                requestRegion,
+                startColumnVertex,
+                startRowVertex,
+                numColumnVertices,
+                numRowVertices);
+
+            // Add the new request region to our dirty heightfield tiles.
+            AZStd::unique_lock<AZStd::mutex> lock(m_dirtyTilesMutex);
+            m_dirtyTiles.AddRegion(startColumnVertex, startRowVertex, numColumnVertices, numRowVertices);
+        }
 
-        for (size_t row = 0; row < numRows; row += rowsPerUpdate)
+        AZStd::vector<HeightfieldTile> tiles;
         {
-            size_t startRow = m_dirtyRegion.m_minRowVertex + row;
-            size_t subregionRows = AZStd::min(m_dirtyRegion.m_maxRowVertex - startRow, rowsPerUpdate);
-
-            // Create the jobs for this set of rows
+            AZStd::unique_lock<AZStd::mutex> lock(m_dirtyTilesMutex);
 
-            auto* updateShapeConfigCompleteJob = aznew AZ::MultipleDependentJob(autoDelete, m_jobContext.get());
-
-            auto* updateShapeConfigJob = AZ::CreateJobFunction(
-                AZStd::bind(&HeightfieldCollider::UpdateShapeConfigRows,
-                    this, updateShapeConfigCompleteJob, startColumn, startRow, numColumns, subregionRows),
-                    autoDelete, m_jobContext.get());
-
-            auto* updatePhysXHeightfieldJob = AZ::CreateJobFunction(
-                AZStd::bind(&HeightfieldCollider::UpdatePhysXHeightfieldRows,
-                    this, scene, shape, startColumn, startRow, numColumns, subregionRows),
-                    autoDelete, m_jobContext.get());
-
-            // Set up the dependencies:
-            // UpdateShapeConfigJob 1 -> UpdateShapeConfigCompleteJob 1 -> UpdatePhysXHeightfieldJob 1
-            updateShapeConfigJob->SetDependent(updateShapeConfigCompleteJob);
-            updateShapeConfigCompleteJob->AddDependent(updatePhysXHeightfieldJob);
-
-            // Set up additional dependencies for all jobs past the first one:
-            // UpdateShapeConfigCompleteJob 1 -> UpdateShapeConfigJob 2
-            // UpdatePhysXHeightfieldJob 1 -> UpdatePhysXHeightfieldJob 2
-            if (!updateShapeConfigCompleteJobs.empty())
+            // If a refresh is already running, it will pick up the dirty tiles when its current pass finishes.
+            if (m_refreshPassRunning)
             {
-                updateShapeConfigCompleteJobs.back()->AddDependent(updateShapeConfigJob);
-                updatePhysXHeightfieldJobs.back()->SetDependent(updatePhysXHeightfieldJob);
+                return;
             }
 
-            // Temporarily store all the jobs we're creating so that we can continue to set up dependencies and start the jobs at the end.
-            updateShapeConfigJobs.emplace_back(updateShapeConfigJob);
-            updateShapeConfigCompleteJobs.emplace_back(updateShapeConfigCompleteJob);
-            updatePhysXHeightfieldJobs.emplace_back(updatePhysXHeightfieldJob);
-        }
-
-        if (!updateShapeConfigJobs.empty())
-        {
-            // Set up the final completion job and dependency:
-            // UpdatePhysXHeightfieldJob -> RefreshCompleteJob
-            auto* refreshCompleteJob =
-                AZ::CreateJobFunction(AZStd::bind(&HeightfieldCollider::RefreshComplete, this), autoDelete, m_jobContext.get());
-            updatePhysXHeightfieldJobs.back()->SetDependent(refreshCompleteJob);
-
-            // Track that we're starting our refresh job chain.
-            m_jobContext->OnRefreshStart();
-
-            // Start all the jobs except the UpdateShapeConfigCompletion jobs.
-            // None of the jobs will actually start until all their dependencies are met, this just "primes" them so that they'll start
-            // as soon as they can.
-            // The completion jobs are started from the completion callback that's provided to UpdateHeightsAndMaterialsAsync. This 
-            // effectively lets us create an implicit dependency on all the jobs created by that API, because until we start the
-            // completion jobs, nothing downstream from them can start either.
+            tiles = m_dirtyTiles.TakeTiles(physx_heightfieldColliderUpdateRegionSize);
 
-            for (size_t jobIndex = 0; jobIndex < updateShapeConfigJobs.size(); jobIndex++)
+            // If our dirty region is too small to affect any vertices, early-out.
+            if (tiles.empty())
             {
-                updateShapeConfigJobs[jobIndex]->Start();
-                updatePhysXHeightfieldJobs[jobIndex]->Start();
+                return;
             }
 
-            refreshCompleteJob->Start();
+            m_refreshPassRunning = true;
+
+            // The scene and shape are looked up here on the main thread, and stay the same for the entire chain of refresh passes.
+            auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+            m_refreshScene = physicsSystem->GetScene(m_attachedSceneHandle);
+            m_refreshShape = GetHeightfieldShape();
         }
+
+        // Track that we're starting our refresh job chain.
+        m_jobContext->OnRefreshStart();
+
+        StartRefreshPass(AZStd::move(tiles));
     }
 
     void HeightfieldCollider::UpdateHeightfieldMaterialSlots(const Physics::MaterialSlots& updatedMaterialSlots)
@@ -9,7 +9,9 @@
 #pragma once
 
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <AzFramework/Physics/Components/SimulatedBodyComponentBus.h>
 #include <AzFramework/Physics/HeightfieldProviderBus.h>
@@ -104,16 +106,31 @@ namespace PhysX
         void UpdateHeightfieldMaterialSlots(const Physics::MaterialSlots& updatedMaterialSlots);
 
     private:
+        //! A rectangular block of heightfield vertices that gets refreshed as a single unit.
+        struct HeightfieldTile
+        {
+            size_t m_startColumn = 0;
+            size_t m_startRow = 0;
+            size_t m_numColumns = 0;
+            size_t m_numRows = 0;
+        };
+
+        //! The set of tiles being refreshed by one pass of the update job chain, along with their converted PhysX data.
+        struct RefreshPass;
+
         //! Updates a subset of rows in the heightfield shape configuration.
         void UpdateShapeConfigRows(
             AZ::Job* updateCompleteJob, size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
 
-        //! Updates a subset of rows in the PhysX heightfield based on the data in the heightfield shape configuration.
-        //! Note that while this takes in column ranges, the expectation is that it is processing all the dirty columns for each
-        //! row being updated. If this assumption changes, the dirty region tracking logic will also need to change.
-        void UpdatePhysXHeightfieldRows(
-            AzPhysics::Scene* scene, AZStd::shared_ptr<Physics::Shape> shape,
-            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
+        //! Converts the shape configuration data for one tile of a refresh pass into PhysX heightfield samples.
+        void CookTile(RefreshPass& refreshPass, size_t tileIndex);
+
+        //! Writes all the cooked tiles of a refresh pass into the PhysX heightfield, then starts the next pass if any tiles
+        //! were dirtied in the meantime.
+        void ApplyRefreshPass(AZStd::shared_ptr<RefreshPass> refreshPass);
+
+        //! Creates and starts the job chain that refreshes the given tiles.
+        void StartRefreshPass(AZStd::vector<HeightfieldTile>&& tiles);
 
         //! Called once all of the asynchronous update jobs have completed.
         void RefreshComplete();
@@ -144,8 +161,9 @@ namespace PhysX
             void BlockUntilComplete();
 
         private:
-            //! Track whether or not a refresh is currently happening.
-            bool m_refreshInProgress = false;
+            //! Track how many refreshes are currently happening. A new refresh can start while the previous one is still
+            //! running its final completion job, so this is a count instead of a flag.
+            size_t m_refreshesInProgress = 0;
             //! Mutex to protect the job-running state
             AZStd::mutex m_jobsRunningNotificationMutex;
             //! Notification mechanism for knowing when the jobs have stopped running.
@@ -178,21 +196,49 @@ namespace PhysX
         //! Cached entity name for the entity this collider is attached to.
         AZStd::string m_entityName;
 
-        //! Track the current dirty region for async heightfield refreshes.
-        struct DirtyHeightfieldRegion
+        //! Track which tiles of the heightfield still need to be refreshed.
+        class DirtyHeightfieldTiles
         {
-            DirtyHeightfieldRegion();
-            void SetNull();
-            void AddAabb(const AZ::Aabb& dirtyRegion, AZ::EntityId entityId);
-
-            size_t m_minRowVertex;      //! the first dirty row vertex
-            size_t m_minColumnVertex;   //! the first dirty column vertex
-            size_t m_maxRowVertex;      //! one past the last dirty row vertex (i.e. max - min = num dirty)
-            size_t m_maxColumnVertex;   //! one past the last dirty column vertex
+        public:
+            //! Set the size of the heightfield and its tiles, and mark every tile as dirty.
+            void Reset(size_t numColumnVertices, size_t numRowVertices, size_t tileSize);
+
+            //! Mark every tile that overlaps the given range of vertices as dirty.
+            //! Note that if the heightfield size has decreased, the range can extend past the current heightfield size.
+            void AddRegion(size_t startColumn, size_t startRow, size_t numColumns, size_t numRows);
+
+            //! Mark a single tile as dirty.
+            void AddTile(const HeightfieldTile& tile);
+
+            //! Remove dirty tiles from the set until they add up to at least maxPoints vertices, or no dirty tiles remain.
+            //! @return The removed tiles, in row-major order.
+            AZStd::vector<HeightfieldTile> TakeTiles(size_t maxPoints);
+
+        private:
+            HeightfieldTile GetTile(size_t tileIndex) const;
+
+            size_t m_numColumnVertices = 0;
+            size_t m_numRowVertices = 0;
+            size_t m_tileSize = 1;
+            size_t m_numTileColumns = 0;
+            size_t m_numTileRows = 0;
+            size_t m_numDirtyTiles = 0;
+            AZStd::vector<bool> m_dirtyTiles;
         };
 
-        DirtyHeightfieldRegion m_dirtyRegion;
-        
+        //! Protects the dirty tiles and the refresh state, which are shared between the main thread and the update jobs.
+        AZStd::mutex m_dirtyTilesMutex;
+        DirtyHeightfieldTiles m_dirtyTiles;
+
+        //! True while a chain of refresh passes is running. New dirty tiles get picked up by the running chain instead of
+        //! starting a second one.
+        bool m_refreshPassRunning = false;
+
+        //! The scene and shape that the running chain of refresh passes is writing into. These only change when the heightfield is
+        //! recreated, which always waits for the running chain to complete first.
+        AzPhysics::Scene* m_refreshScene = nullptr;
+        AZStd::shared_ptr<Physics::Shape> m_refreshShape;
+
         //! Specifies the way of creating Heightfield Collider.
         DataSource m_dataSourceType = DataSource::GenerateNewHeightfield;
        
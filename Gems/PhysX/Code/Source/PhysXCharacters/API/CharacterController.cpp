@@ -20,6 +20,7 @@
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
 #include <PhysX/MathConversion.h>
 #include <PhysXCharacters/API/CharacterController.h>
+#include <Scene/PhysXScene.h>
 #include <Source/Collision.h>
 #include <Source/Shape.h>
 
@@ -104,6 +105,31 @@ namespace PhysX
         m_obstacleRidingBehavior = obstacleRidingBehavior;
     }
 
+    void CharacterControllerCallbackManager::SetDeferHits(bool deferHits)
+    {
+        m_deferHits = deferHits;
+    }
+
+    void CharacterControllerCallbackManager::DispatchDeferredHits()
+    {
+        for (const DeferredHit& deferredHit : m_deferredHits)
+        {
+            if (const auto* shapeHit = AZStd::get_if<physx::PxControllerShapeHit>(&deferredHit))
+            {
+                m_onShapeHit(*shapeHit);
+            }
+            else if (const auto* controllersHit = AZStd::get_if<physx::PxControllersHit>(&deferredHit))
+            {
+                m_onControllerHit(*controllersHit);
+            }
+            else if (const auto* obstacleHit = AZStd::get_if<physx::PxControllerObstacleHit>(&deferredHit))
+            {
+                m_onObstacleHit(*obstacleHit);
+            }
+        }
+        m_deferredHits.clear();
+    }
+
     bool CharacterControllerCallbackManager::filter(
         const physx::PxController& controllerA, const physx::PxController& controllerB)
     {
@@ -143,6 +169,11 @@ namespace PhysX
     {
         if (m_onShapeHit)
         {
+            if (m_deferHits)
+            {
+                m_deferredHits.emplace_back(hit);
+                return;
+            }
             m_onShapeHit(hit);
         }
     }
@@ -151,6 +182,11 @@ namespace PhysX
     {
         if (m_onControllerHit)
         {
+            if (m_deferHits)
+            {
+                m_deferredHits.emplace_back(hit);
+                return;
+            }
             m_onControllerHit(hit);
         }
     }
@@ -159,6 +195,11 @@ namespace PhysX
     {
         if (m_onObstacleHit)
         {
+            if (m_deferHits)
+            {
+                m_deferredHits.emplace_back(hit);
+                return;
+            }
             m_onObstacleHit(hit);
         }
     }
@@ -632,32 +673,49 @@ namespace PhysX
     }
 
     void CharacterController::Move(const AZ::Vector3& requestedMovement, float deltaTime)
+    {
+        if (m_pxController)
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
+            MoveWithSceneLocked(requestedMovement, deltaTime);
+        }
+    }
+
+    void CharacterController::MoveWithSceneLocked(const AZ::Vector3& requestedMovement, float deltaTime)
     {
         if (m_pxController)
         {
             const AZ::Vector3 oldPosition = GetBasePosition();
+            m_pxController->move(PxMathConvert(requestedMovement), m_minimumMovementDistance, deltaTime, m_pxControllerFilters);
+            if (m_shadowBody)
             {
-                PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
-                m_pxController->move(PxMathConvert(requestedMovement), m_minimumMovementDistance, deltaTime, m_pxControllerFilters);
-                if (m_shadowBody)
-                {
-                    m_shadowBody->SetKinematicTarget(GetTransform());
-                }
+                m_shadowBody->SetKinematicTarget(GetTransform());
             }
             const AZ::Vector3 newPosition = GetBasePosition();
             m_observedVelocity = deltaTime > 0.0f ? (newPosition - oldPosition) / deltaTime : AZ::Vector3::CreateZero();
         }
     }
 
-    void CharacterController::ApplyRequestedVelocity(float deltaTime)
+    AZ::Vector3 CharacterController::GetRequestedMovement(float deltaTime) const
     {
         const AZ::Vector3 totalRequestedVelocity = m_requestedVelocityForTick + m_requestedVelocityForPhysicsTimestep;
         const AZ::Vector3 clampedVelocity = totalRequestedVelocity.GetLength() > m_maximumSpeed
             ? m_maximumSpeed * totalRequestedVelocity.GetNormalized()
             : totalRequestedVelocity;
-        const AZ::Vector3 deltaPosition = clampedVelocity * deltaTime;
+        return clampedVelocity * deltaTime;
+    }
+
+    void CharacterController::ApplyRequestedVelocity(float deltaTime)
+    {
+        Move(GetRequestedMovement(deltaTime), deltaTime);
+    }
 
-        Move(deltaPosition, deltaTime);
+    void CharacterController::QueueRequestedVelocity(float deltaTime)
+    {
+        if (auto* scene = azdynamic_cast<PhysXScene*>(GetScene()))
+        {
+            scene->QueueCharacterControllerMove(m_bodyHandle, GetRequestedMovement(deltaTime), deltaTime);
+        }
     }
 
     void CharacterController::SetRotation(const AZ::Quaternion& rotation)
@@ -14,6 +14,8 @@
 #include <AzFramework/Physics/Collision/CollisionGroups.h>
 #include <AzFramework/Physics/Collision/CollisionLayers.h>
 #include <AzFramework/Physics/Common/PhysicsTypes.h>
+#include <AzCore/std/containers/variant.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace PhysX
 {
@@ -118,6 +120,13 @@ namespace PhysX
         /// Sets the function which determines whether the controller should be able to ride on obstacles or should slide.
         void SetObstacleRidingBehavior(ObstacleRidingBehavior obstacleRidingBehavior);
 
+        /// While hits are deferred, the hit functions are not called during the moves of the controller.
+        /// The hits are stored instead, and reported in the same order by DispatchDeferredHits.
+        void SetDeferHits(bool deferHits);
+
+        /// Calls the hit functions for the hits stored while hits were deferred.
+        void DispatchDeferredHits();
+
         // physx::PxControllerFilterCallback
         bool filter(const physx::PxController& controllerA, const physx::PxController& controllerB) override;
 
@@ -146,6 +155,8 @@ namespace PhysX
         physx::PxControllerBehaviorFlags getBehaviorFlags(const physx::PxObstacle& obstacle) override;
 
     private:
+        using DeferredHit = AZStd::variant<physx::PxControllerShapeHit, physx::PxControllersHit, physx::PxControllerObstacleHit>;
+
         ControllerFilter m_controllerFilter;
         ObjectPreFilter m_objectPreFilter;
         ObjectPostFilter m_objectPostFilter;
@@ -155,6 +166,8 @@ namespace PhysX
         ObjectRidingBehavior m_objectRidingBehavior;
         ControllerRidingBehavior m_controllerRidingBehavior;
         ObstacleRidingBehavior m_obstacleRidingBehavior;
+        bool m_deferHits = false;
+        AZStd::vector<DeferredHit> m_deferredHits;
     };
 
     class CharacterController
@@ -222,6 +235,11 @@ namespace PhysX
         void* GetNativePointer() const override;
 
         // CharacterController specific
+        //! Queues the move for the requested velocity in the scene, instead of moving the controller immediately.
+        //! The scene moves all the queued controllers in a single batch when it starts simulating, see PhysXScene::QueueCharacterControllerMove.
+        void QueueRequestedVelocity(float deltaTime);
+        //! Same as Move, for callers which already hold the scene write lock.
+        void MoveWithSceneLocked(const AZ::Vector3& requestedMovement, float deltaTime);
         void Resize(float height);
         float GetHeight() const;
         void SetHeight(float height);
@@ -233,6 +251,7 @@ namespace PhysX
         void SetHalfForwardExtent(float halfForwardExtent);
 
     private:
+        AZ::Vector3 GetRequestedMovement(float deltaTime) const;
         void SetFilterDataAndShape(const Physics::CharacterConfiguration& characterConfig);
         void SetUserData(const Physics::CharacterConfiguration& characterConfig);
         void SetActorName(const AZStd::string& name = "Character Controller");
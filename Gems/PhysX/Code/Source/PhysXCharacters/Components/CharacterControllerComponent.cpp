@@ -480,7 +480,8 @@ namespace PhysX
     {
         if (auto* controller = GetController())
         {
-            controller->ApplyRequestedVelocity(physicsTimestep);
+            // The scene moves all the queued controllers in a single batch once this event has been handled.
+            controller->QueueRequestedVelocity(physicsTimestep);
             controller->ResetRequestedVelocityForPhysicsTimestep();
         }
     }
@@ -17,6 +17,7 @@
 #include <PhysX/Utils.h>
 #include <PhysXCharacters/API/CharacterController.h>
 #include <PhysXCharacters/API/CharacterUtils.h>
+#include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXSystem.h>
 #include <PhysX/Joint/Configuration/PhysXJointConfiguration.h>
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
@@ -26,6 +27,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -564,6 +566,8 @@ namespace PhysX
             m_sceneSimulationStartEvent.Signal(m_sceneHandle, deltatime);
         }
 
+        ExecuteQueuedCharacterControllerMoves();
+
         m_currentDeltaTime = deltatime;
 
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
@@ -1355,6 +1359,72 @@ namespace PhysX
         m_accumulatedDeltaTime = 0.0f;
     }
 
+    void PhysXScene::QueueCharacterControllerMove(
+        AzPhysics::SimulatedBodyHandle controllerHandle, const AZ::Vector3& movement, float deltaTime)
+    {
+        m_queuedCharacterControllerMoves.push_back({ controllerHandle, movement, deltaTime });
+    }
+
+    void PhysXScene::ExecuteQueuedCharacterControllerMoves()
+    {
+        if (m_queuedCharacterControllerMoves.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::ExecuteQueuedCharacterControllerMoves");
+
+        // Stable sort, so several moves queued for the same controller keep their order.
+        AZStd::stable_sort(m_queuedCharacterControllerMoves.begin(), m_queuedCharacterControllerMoves.end(),
+            [](const QueuedCharacterControllerMove& lhs, const QueuedCharacterControllerMove& rhs)
+            {
+                return AZStd::get<AzPhysics::HandleTypeIndex::Index>(lhs.m_controllerHandle) <
+                    AZStd::get<AzPhysics::HandleTypeIndex::Index>(rhs.m_controllerHandle);
+            });
+
+        m_movedCharacterControllers.clear();
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            for (const QueuedCharacterControllerMove& queuedMove : m_queuedCharacterControllerMoves)
+            {
+                // The controller may have been removed since its move was queued.
+                auto* controller = azdynamic_cast<CharacterController*>(GetSimulatedBodyFromHandle(queuedMove.m_controllerHandle));
+                if (controller == nullptr)
+                {
+                    continue;
+                }
+
+                if (m_movedCharacterControllers.empty() || m_movedCharacterControllers.back() != queuedMove.m_controllerHandle)
+                {
+                    m_movedCharacterControllers.push_back(queuedMove.m_controllerHandle);
+                    if (CharacterControllerCallbackManager* callbackManager = controller->GetCallbackManager())
+                    {
+                        callbackManager->SetDeferHits(true);
+                    }
+                }
+                controller->MoveWithSceneLocked(queuedMove.m_movement, queuedMove.m_deltaTime);
+            }
+        }
+        m_queuedCharacterControllerMoves.clear();
+
+        // The hit callbacks are called out of the scene lock, once all the controllers have moved.
+        // A hit callback may remove any controller, so each one is looked up again before its hits are dispatched.
+        for (AzPhysics::SimulatedBodyHandle controllerHandle : m_movedCharacterControllers)
+        {
+            auto* controller = azdynamic_cast<CharacterController*>(GetSimulatedBodyFromHandle(controllerHandle));
+            if (controller == nullptr)
+            {
+                continue;
+            }
+
+            if (CharacterControllerCallbackManager* callbackManager = controller->GetCallbackManager())
+            {
+                callbackManager->SetDeferHits(false);
+                callbackManager->DispatchDeferredHits();
+            }
+        }
+    }
+
     void PhysXScene::QueuedActiveBodyIndices::Insert(AzPhysics::SimulatedBodyIndex bodyIndex)
     {
         if (m_uniqueIndices.insert(bodyIndex).second)
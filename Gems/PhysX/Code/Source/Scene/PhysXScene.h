@@ -27,6 +27,8 @@ namespace physx
 
 namespace PhysX
 {
+    class CharacterController;
+
     //! PhysX implementation of the AzPhysics::Scene.
     class PhysXScene final
         : public AzPhysics::Scene
@@ -84,6 +86,12 @@ namespace PhysX
         //! Apply batched transform sync events for the current simulation pass. 
         //! This will clear the batched data for the next simulation pass.
         void FlushTransformSync();
+
+        //! Queues a move of a character controller. All the queued moves are executed in a single batch when the scene
+        //! starts simulating, after the OnSceneSimulationStart event, taking the scene write lock once for the whole batch.
+        //! The moves are executed in the order of the controllers body index, so the results don't depend on the order the
+        //! moves were queued in, and the hit callbacks of the controllers are called once all the controllers have moved.
+        void QueueCharacterControllerMove(AzPhysics::SimulatedBodyHandle controllerHandle, const AZ::Vector3& movement, float deltaTime);
         
     private:
 
@@ -113,6 +121,8 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        void ExecuteQueuedCharacterControllerMoves();
+
         void SyncActiveBodyTransform(const AzPhysics::SimulatedBodyHandleList& activeBodyHandles);
 
         bool m_isEnabled = true;
@@ -127,6 +137,18 @@ namespace PhysX
         // to tell how much time was simulated in this full pass.
         float m_accumulatedDeltaTime = 0.0f;
 
+        struct QueuedCharacterControllerMove
+        {
+            AzPhysics::SimulatedBodyHandle m_controllerHandle;
+            AZ::Vector3 m_movement;
+            float m_deltaTime;
+        };
+
+        // Character controller moves queued for the next simulation sub-step, and the controllers moved by the last batch.
+        // Both are kept between sub-steps so their memory is reused.
+        AZStd::vector<QueuedCharacterControllerMove> m_queuedCharacterControllerMoves;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> m_movedCharacterControllers;
+
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
 
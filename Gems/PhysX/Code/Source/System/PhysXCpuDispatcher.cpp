@@ -7,24 +7,153 @@
  */
 
 #include <System/PhysXCpuDispatcher.h>
-#include <System/PhysXJob.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/chrono/chrono.h>
 
 namespace PhysX
 {
+    namespace Internal
+    {
+        // Initial capacity of the task queue, enough for the tasks of a typical simulation step.
+        static constexpr size_t InitialTaskQueueCapacity = 256;
+    }
+
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
     {
         return aznew PhysXCpuDispatcher();
     }
 
+    PhysXCpuDispatcher::PhysXCpuDispatcher()
+    {
+        m_taskQueue.resize(Internal::InitialTaskQueueCapacity, nullptr);
+        StartWorkerThreads(CpuDispatcherConfiguration());
+    }
+
+    PhysXCpuDispatcher::~PhysXCpuDispatcher()
+    {
+        StopWorkerThreads();
+    }
+
+    void PhysXCpuDispatcher::Configure(const CpuDispatcherConfiguration& config)
+    {
+        StopWorkerThreads();
+        StartWorkerThreads(config);
+    }
+
+    AZ::u32 PhysXCpuDispatcher::GetWorkerThreadCount() const
+    {
+        return aznumeric_cast<AZ::u32>(m_workerThreads.size());
+    }
+
+    void PhysXCpuDispatcher::PublishStepStatistics()
+    {
+        const AZ::u64 taskCount = m_stepTaskCount.exchange(0, AZStd::memory_order_relaxed);
+        const AZ::u64 taskTimeNs = m_stepTaskTimeNs.exchange(0, AZStd::memory_order_relaxed);
+#if !defined(AZ_RELEASE_BUILD)
+        AZ_PROFILE_DATAPOINT(Physics, taskCount, L"PhysX/CpuDispatcher/TaskCount");
+        AZ_PROFILE_DATAPOINT(Physics, taskTimeNs / 1000, L"PhysX/CpuDispatcher/TaskTimeMicroseconds");
+        AZ_PROFILE_DATAPOINT(Physics, m_workerThreads.size(), L"PhysX/CpuDispatcher/WorkerThreads");
+#else
+        AZ_UNUSED(taskCount);
+        AZ_UNUSED(taskTimeNs);
+#endif
+    }
+
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
-        azJob->Start();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_taskQueueMutex);
+            if (m_taskQueueCount == m_taskQueue.size())
+            {
+                // Grow the ring buffer, unwrapping the queued tasks at the start of the new buffer.
+                AZStd::vector<physx::PxBaseTask*> taskQueue(m_taskQueue.size() * 2, nullptr);
+                for (size_t i = 0; i < m_taskQueueCount; ++i)
+                {
+                    taskQueue[i] = m_taskQueue[(m_taskQueueHead + i) % m_taskQueue.size()];
+                }
+                m_taskQueue = AZStd::move(taskQueue);
+                m_taskQueueHead = 0;
+            }
+            m_taskQueue[(m_taskQueueHead + m_taskQueueCount) % m_taskQueue.size()] = &task;
+            ++m_taskQueueCount;
+        }
+        m_taskQueueCondition.notify_one();
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
-        return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
+        return aznumeric_cast<physx::PxU32>(m_workerThreads.size());
     }
-} // namespace PhysX
 
+    void PhysXCpuDispatcher::StartWorkerThreads(const CpuDispatcherConfiguration& config)
+    {
+        AZ_Assert(m_workerThreads.empty(), "PhysX CPU dispatcher worker threads are already running.");
+
+        AZ::u32 workerThreadCount = config.m_workerThreadCount;
+        if (workerThreadCount == 0)
+        {
+            // The thread that starts the simulation waits for the results, leave it a hardware thread.
+            workerThreadCount = AZStd::max(AZStd::thread::hardware_concurrency(), 2u) - 1;
+        }
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "PhysX Worker";
+        threadDesc.m_priority = config.m_workerThreadPriority;
+        threadDesc.m_cpuId = config.m_workerThreadAffinityMask;
+
+        m_stopWorkerThreads = false;
+        m_workerThreads.reserve(workerThreadCount);
+        for (AZ::u32 i = 0; i < workerThreadCount; ++i)
+        {
+            m_workerThreads.emplace_back(threadDesc, [this]() { ProcessTasks(); });
+        }
+    }
+
+    void PhysXCpuDispatcher::StopWorkerThreads()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_taskQueueMutex);
+            AZ_Assert(m_taskQueueCount == 0, "PhysX CPU dispatcher stopped with tasks still queued.");
+            m_stopWorkerThreads = true;
+        }
+        m_taskQueueCondition.notify_all();
+
+        for (AZStd::thread& workerThread : m_workerThreads)
+        {
+            workerThread.join();
+        }
+        m_workerThreads.clear();
+    }
+
+    void PhysXCpuDispatcher::ProcessTasks()
+    {
+        while (true)
+        {
+            physx::PxBaseTask* task = nullptr;
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_taskQueueMutex);
+                m_taskQueueCondition.wait(lock, [this]() { return m_taskQueueCount > 0 || m_stopWorkerThreads; });
+                if (m_taskQueueCount == 0)
+                {
+                    return;
+                }
+                task = m_taskQueue[m_taskQueueHead];
+                m_taskQueueHead = (m_taskQueueHead + 1) % m_taskQueue.size();
+                --m_taskQueueCount;
+            }
+
+            const auto startTime = AZStd::chrono::steady_clock::now();
+            {
+                AZ_PROFILE_SCOPE(Physics, task->getName());
+                task->run();
+                task->release();
+            }
+            const auto taskTime = AZStd::chrono::steady_clock::now() - startTime;
+
+            m_stepTaskCount.fetch_add(1, AZStd::memory_order_relaxed);
+            m_stepTaskTimeNs.fetch_add(
+                AZStd::chrono::duration_cast<AZStd::chrono::nanoseconds>(taskTime).count(), AZStd::memory_order_relaxed);
+        }
+    }
+} // namespace PhysX
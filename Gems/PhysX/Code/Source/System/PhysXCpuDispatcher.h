@@ -7,27 +7,61 @@
  */
 
 #pragma once
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <PxPhysicsAPI.h>
+#include <PhysX/Configuration/PhysXConfiguration.h>
 #include <System/PhysXAllocator.h>
 
 namespace PhysX
 {
-    //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! CPU dispatcher which runs the tasks submitted by PhysX on a dedicated pool of worker threads.
+    //! Tasks are queued by pointer in a ring buffer that is reused from one step to the next, so submitting
+    //! a task doesn't allocate memory.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
     public:
         AZ_CLASS_ALLOCATOR(PhysXCpuDispatcher, PhysXAllocator);
 
-        PhysXCpuDispatcher() = default;
-        ~PhysXCpuDispatcher() = default;
-        
+        PhysXCpuDispatcher();
+        ~PhysXCpuDispatcher();
+
+        //! Restarts the worker threads with the given configuration.
+        //! Must not be called while a scene is simulating.
+        void Configure(const CpuDispatcherConfiguration& config);
+
+        //! Returns the number of worker threads running the tasks.
+        AZ::u32 GetWorkerThreadCount() const;
+
+        //! Reports the number of tasks run and the time spent running them since the previous call to the profiler.
+        void PublishStepStatistics();
+
     private:
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        void StartWorkerThreads(const CpuDispatcherConfiguration& config);
+        void StopWorkerThreads();
+        void ProcessTasks();
+
+        AZStd::vector<AZStd::thread> m_workerThreads;
+
+        AZStd::mutex m_taskQueueMutex;
+        AZStd::condition_variable m_taskQueueCondition;
+        AZStd::vector<physx::PxBaseTask*> m_taskQueue; //!< Ring buffer, only grows when it is full.
+        size_t m_taskQueueHead = 0;
+        size_t m_taskQueueCount = 0;
+        bool m_stopWorkerThreads = false;
+
+        AZStd::atomic<AZ::u64> m_stepTaskCount{ 0 };
+        AZStd::atomic<AZ::u64> m_stepTaskTimeNs{ 0 };
     };
 
-    //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! Creates a CPU dispatcher which runs the tasks submitted by PhysX on a dedicated pool of worker threads.
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate();
 } // namespace PhysX
@@ -152,6 +152,9 @@ namespace PhysX
             m_systemConfig = *physXConfig;
         }
 
+        // No scene exists yet, so no task can be in flight while the worker threads restart.
+        m_cpuDispatcher->Configure(m_systemConfig.m_cpuDispatcherConfiguration);
+
         m_state = State::Initialized;
         m_initializeEvent.Signal(&m_systemConfig);
     }
@@ -244,6 +247,7 @@ namespace PhysX
         
         // Flush performance data for this tick
         m_performanceCollector->FrameTick();
+        m_cpuDispatcher->PublishStepStatistics();
         
         if (physx_batchTransformSync)
         {
@@ -37,6 +37,8 @@ namespace physx
 
 namespace PhysX
 {
+    class PhysXCpuDispatcher;
+
     class PhysXSystem
         : public AZ::Interface<AzPhysics::SystemInterface>::Registrar
     {
@@ -76,7 +78,7 @@ namespace PhysX
         //TEMP -- until these are fully moved over here
         physx::PxPhysics* GetPxPhysics() { return m_physXSdk.m_physics; }
         physx::PxCooking* GetPxCooking() { return m_physXSdk.m_cooking; }
-        physx::PxCpuDispatcher* GetPxCpuDispathcher()
+        PhysXCpuDispatcher* GetPxCpuDispathcher()
         {
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
             return m_cpuDispatcher;
@@ -114,7 +116,7 @@ namespace PhysX
         PxAzErrorCallback m_physXErrorCallback;
         PxAzProfilerCallback m_pxAzProfilerCallback;
 
-        physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
+        PhysXCpuDispatcher* m_cpuDispatcher = nullptr;
 
         enum class State : AZ::u8
         {
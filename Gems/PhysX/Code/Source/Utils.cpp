@@ -278,6 +278,26 @@ namespace PhysX
         {
             AZ_PROFILE_FUNCTION(Physics);
 
+            // Convert the generic heightfield samples in the heigthfield shape to PhysX heightfield samples.
+            // This can be done outside the scene lock because we aren't modifying anything yet.
+            AZStd::vector<HeightfieldSampleRegion> regions(1);
+            regions[0].m_startCol = startCol;
+            regions[0].m_startRow = startRow;
+            regions[0].m_numCols = numColsToUpdate;
+            regions[0].m_numRows = numRowsToUpdate;
+            regions[0].m_samples = ConvertHeightfieldSamples(heightfield, startCol, startRow, numColsToUpdate, numRowsToUpdate);
+
+            RefreshHeightfieldShape(physicsScene, heightfieldShape, heightfield, regions);
+        }
+
+        void RefreshHeightfieldShape(
+            AzPhysics::Scene* physicsScene,
+            Physics::Shape* heightfieldShape,
+            Physics::HeightfieldShapeConfiguration& heightfield,
+            const AZStd::vector<HeightfieldSampleRegion>& regions)
+        {
+            AZ_PROFILE_FUNCTION(Physics);
+
             auto* pxScene = static_cast<physx::PxScene*>(physicsScene->GetNativePointer());
             AZ_Assert(pxScene, "Attempting to reference a null physics scene");
 
@@ -287,33 +307,38 @@ namespace PhysX
             physx::PxHeightField* pxHeightfield = static_cast<physx::PxHeightField*>(heightfield.GetCachedNativeHeightfield());
             AZ_Assert(pxHeightfield, "Attempting to refresh a null heightfield");
 
-            // Convert the generic heightfield samples in the heigthfield shape to PhysX heightfield samples.
-            // This can be done outside the scene lock because we aren't modifying anything yet.
-            AZStd::vector<physx::PxHeightFieldSample> physxSamples =
-                ConvertHeightfieldSamples(heightfield, startCol, startRow, numColsToUpdate, numRowsToUpdate);
-
-            // Create a descriptor for the subregion that we're updating.
-            physx::PxHeightFieldDesc desc;
-            desc.format = physx::PxHeightFieldFormat::eS16_TM;
-            desc.nbColumns = static_cast<physx::PxU32>(numColsToUpdate);
-            desc.nbRows = static_cast<physx::PxU32>(numRowsToUpdate);
-            desc.samples.data = physxSamples.data();
-            desc.samples.stride = sizeof(physx::PxHeightFieldSample);
-
-            // Modify the heightfield samples
-            constexpr bool shrinkBounds = false;
-            pxHeightfield->modifySamples(static_cast<physx::PxI32>(startCol), static_cast<physx::PxI32>(startRow), desc, shrinkBounds);
-
-            // Lock the scene and modify the heightfield shape in the scene.
+            // Lock the scene for the whole set of modifications so that the regions all become visible together, and then
+            // modify the heightfield shape in the scene.
             // (If only the heightfield is modified, the shape won't get refreshed with the new data)
+            PHYSX_SCENE_WRITE_LOCK(pxScene);
+
+            for (const HeightfieldSampleRegion& region : regions)
             {
-                PHYSX_SCENE_WRITE_LOCK(pxScene);
+                if (region.m_samples.empty())
+                {
+                    continue;
+                }
+
+                AZ_Assert(region.m_samples.size() == region.m_numCols * region.m_numRows, "Heightfield region has the wrong sample count.");
 
-                physx::PxHeightFieldGeometry hfGeom;
-                pxShape->getHeightFieldGeometry(hfGeom);
-                hfGeom.heightField = pxHeightfield;
-                pxShape->setGeometry(hfGeom);
+                // Create a descriptor for the subregion that we're updating.
+                physx::PxHeightFieldDesc desc;
+                desc.format = physx::PxHeightFieldFormat::eS16_TM;
+                desc.nbColumns = static_cast<physx::PxU32>(region.m_numCols);
+                desc.nbRows = static_cast<physx::PxU32>(region.m_numRows);
+                desc.samples.data = region.m_samples.data();
+                desc.samples.stride = sizeof(physx::PxHeightFieldSample);
+
+                // Modify the heightfield samples
+                constexpr bool shrinkBounds = false;
+                pxHeightfield->modifySamples(
+                    static_cast<physx::PxI32>(region.m_startCol), static_cast<physx::PxI32>(region.m_startRow), desc, shrinkBounds);
             }
+
+            physx::PxHeightFieldGeometry hfGeom;
+            pxShape->getHeightFieldGeometry(hfGeom);
+            hfGeom.heightField = pxHeightfield;
+            pxShape->setGeometry(hfGeom);
         }
 
         bool CreatePxGeometryFromConfig(const Physics::ShapeConfiguration& shapeConfiguration, physx::PxGeometryHolder& pxGeometry)
@@ -199,6 +199,22 @@ namespace PhysX
             const size_t col, const size_t row, 
             const size_t numCols, const size_t numRows);
 
+        //! Convert a subset of a heightfield shape configuration to a vector of PhysX Heightfield samples.
+        AZStd::vector<physx::PxHeightFieldSample> ConvertHeightfieldSamples(
+            const Physics::HeightfieldShapeConfiguration& heightfield,
+            const size_t startCol, const size_t startRow,
+            const size_t numColsToUpdate, const size_t numRowsToUpdate);
+
+        //! A rectangular region of a heightfield, along with the converted PhysX samples to write into it.
+        struct HeightfieldSampleRegion
+        {
+            size_t m_startCol = 0;
+            size_t m_startRow = 0;
+            size_t m_numCols = 0;
+            size_t m_numRows = 0;
+            AZStd::vector<physx::PxHeightFieldSample> m_samples;
+        };
+
         Physics::HeightfieldShapeConfiguration CreateBaseHeightfieldShapeConfiguration(AZ::EntityId entityId);
         Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId);
 
@@ -219,6 +235,19 @@ namespace PhysX
             const size_t numColsToUpdate,
             const size_t numRowsToUpdate);
 
+        //! Refresh several regions of the heightfield shape in the given scene with samples that have already been converted.
+        //! All of the regions are written while the scene is write-locked, so scene queries and simulation never see a partially
+        //! applied set of regions.
+        //! @param physicsScene The scene that the shape is located in.
+        //! @param heightfieldShape The shape containing the heightfield in the scene.
+        //! @param heightfield The shape configuration that holds the native heightfield to modify.
+        //! @param regions The regions to write. Regions with no samples are skipped.
+        void RefreshHeightfieldShape(
+            AzPhysics::Scene* physicsScene,
+            Physics::Shape* heightfieldShape,
+            Physics::HeightfieldShapeConfiguration& heightfield,
+            const AZStd::vector<HeightfieldSampleRegion>& regions);
+
         //! Sets an array of material slots from Physics Asset.
         //! If the configuration indicates that it should use the physics materials
         //! assignment from the physics asset it will also use those materials for the slots.
@@ -21,6 +21,7 @@
 #include <AzFramework/Physics/SystemBus.h>
 
 #include <PhysXCharacters/API/CharacterController.h>
+#include <Scene/PhysXScene.h>
 
 #include <PhysXTestCommon.h>
 
@@ -51,6 +52,13 @@ namespace PhysX::Benchmarks
 
             //! Number of iterations for each test
             static const int NumIterations = 3;
+
+            //! Number of character controllers moved by the batched move benchmark, as many as a busy server would have
+            static const int NumBatchedCharacters = 500;
+
+            //! Flags to select how the batched move benchmark moves the characters
+            static const int MoveEachCharacter = 0; // move each character immediately, locking the scene for each move
+            static const int QueueCharacterMoves = 1; // queue the moves, executed in a single batch by the scene
         } // namespace BenchmarkSettings
 
         //! Settings used for each character controller
@@ -400,6 +408,98 @@ namespace PhysX::Benchmarks
         PhysX::Benchmarks::Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
     }
 
+    //! BM_CharacterController_Moving_Batched - This test spawns 500 Character Controllers near the terrain and makes them move
+    //! in random directions, either moving each character immediately or queuing the moves so the scene executes them in a single batch.
+    //! The test will run the simulation for ~1800 game frames at 60fps.
+    BENCHMARK_DEFINE_F(PhysXCharactersBenchmarkFixture, BM_CharacterController_Moving_Batched)(benchmark::State& state)
+    {
+        //setup some pieces for the test
+        AZ::SimpleLcgRandom rand;
+        rand.SetSeed(CharacterConstants::RandGenSeed);
+        const int moveMode = static_cast<const int>(state.range(0));
+
+        //spawn character controllers
+        const float spawnAreaSize = CharacterConstants::TerrainSize * 0.25f;
+        const float spawnAreaCenter = CharacterConstants::TerrainSize * 0.5f;
+        Utils::GenerateSpawnPositionFuncPtr posGenerator = [spawnAreaSize, spawnAreaCenter, &rand]([[maybe_unused]] int idx) -> const AZ::Vector3 {
+            const float x = spawnAreaCenter + rand.GetRandomFloat() * spawnAreaSize;
+            const float y = spawnAreaCenter + rand.GetRandomFloat() * spawnAreaSize;
+            const float z = 0.0f;
+            return AZ::Vector3(x, y, z);
+        };
+        AZStd::vector<Physics::Character*> controllers = Utils::CreateCharacterControllers(
+            CharacterConstants::BenchmarkSettings::NumBatchedCharacters, CharacterConstants::CharacterSettings::ColliderType::Capsule,
+            m_testSceneHandle, &posGenerator);
+
+        //pair up each character controller with a movement vector
+        using ControllerAndMovementDirPair = AZStd::pair<PhysX::CharacterController*, AZ::Vector3>;
+        AZStd::vector<ControllerAndMovementDirPair> targetMoveAndControllers;
+        for (auto& controller : controllers)
+        {
+            targetMoveAndControllers.emplace_back(
+                ControllerAndMovementDirPair(static_cast<PhysX::CharacterController*>(controller), AZ::Vector3::CreateZero()));
+        }
+
+        //setup the sub tick tracker
+        PhysX::Benchmarks::Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        //break the sim into parts, and change direction each time
+        const AZ::u32 numDirectionChanges = 20;
+        const AZ::u32 numFramesPreDirection = CharacterConstants::GameFramesToSimulate / numDirectionChanges;
+
+        //setup the frame timer tracker
+        AZStd::vector<double> tickTimes;
+        tickTimes.reserve(CharacterConstants::GameFramesToSimulate);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            //run each simulation part, and change direction each time
+            for (AZ::u32 i = 0; i < numDirectionChanges; i++)
+            {
+                //Setup all characters movement - this section is not timed
+                for (auto& controllerMovementPair : targetMoveAndControllers)
+                {
+                    //convert from 0..1 to -1..1
+                    float x = ((rand.GetRandomFloat() * 2.0f - 1.0f) * CharacterConstants::CharacterSettings::MaxCharacterSpeed);
+                    float y = ((rand.GetRandomFloat() * 2.0f - 1.0f) * CharacterConstants::CharacterSettings::MaxCharacterSpeed);
+                    controllerMovementPair.second = AZ::Vector3(x, y, 0.0f);
+                }
+
+                for (AZ::u32 j = 0; j < numFramesPreDirection; j++)
+                {
+                    auto start = AZStd::chrono::steady_clock::now();
+                    //update the movement of all the characters controllers
+                    for (auto& controllerMovementPair : targetMoveAndControllers)
+                    {
+                        PhysX::CharacterController* controller = controllerMovementPair.first;
+                        controller->AddVelocityForPhysicsTimestep(controllerMovementPair.second);
+                        if (moveMode == CharacterConstants::BenchmarkSettings::QueueCharacterMoves)
+                        {
+                            controller->QueueRequestedVelocity(PhysX::Benchmarks::DefaultTimeStep);
+                        }
+                        else
+                        {
+                            controller->ApplyRequestedVelocity(PhysX::Benchmarks::DefaultTimeStep);
+                        }
+                        controller->ResetRequestedVelocityForPhysicsTimestep();
+                    }
+
+                    StepScene1Tick(DefaultTimeStep);
+
+                    //time each physics tick and store it to analyze
+                    auto tickElapsedMilliseconds = PhysX::Benchmarks::Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start);
+                    tickTimes.emplace_back(tickElapsedMilliseconds.count());
+                }
+            }
+        }
+        subTickTracker.Stop();
+
+        //get the P50, P90, P99 percentiles
+        PhysX::Benchmarks::Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        PhysX::Benchmarks::Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        state.SetLabel(moveMode == CharacterConstants::BenchmarkSettings::QueueCharacterMoves ? "QueueCharacterMoves" : "MoveEachCharacter");
+    }
+
     BENCHMARK_REGISTER_F(PhysXCharactersBenchmarkFixture, BM_CharacterController_AtRest)
         ->RangeMultiplier(CharacterConstants::BenchmarkSettings::RangeMultipler)
         ->Ranges({
@@ -430,6 +530,13 @@ namespace PhysX::Benchmarks
         ->Iterations(CharacterConstants::BenchmarkSettings::NumIterations)
         ;
 
+    BENCHMARK_REGISTER_F(PhysXCharactersBenchmarkFixture, BM_CharacterController_Moving_Batched)
+        ->Arg(CharacterConstants::BenchmarkSettings::MoveEachCharacter)
+        ->Arg(CharacterConstants::BenchmarkSettings::QueueCharacterMoves)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(CharacterConstants::BenchmarkSettings::NumIterations)
+        ;
+
 } // namespace PhysX::Benchmarks
 
 #endif // #ifdef HAVE_BENCHMARK
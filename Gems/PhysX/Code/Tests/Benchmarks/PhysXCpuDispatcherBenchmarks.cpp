@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <benchmark/benchmark.h>
+
+#include <AzTest/AzTest.h>
+
+#include <Benchmarks/PhysXBenchmarksUtilities.h>
+#include <Benchmarks/PhysXBenchmarksCommon.h>
+
+#include <PhysXTestCommon.h>
+#include <PhysXTestUtil.h>
+
+#include <System/PhysXCpuDispatcher.h>
+#include <System/PhysXSystem.h>
+
+namespace PhysX::Benchmarks
+{
+    namespace CpuDispatcherConstants
+    {
+        //! Controls the simulation length of the test. 5secs at 60fps
+        static const int GameFramesToSimulate = 300;
+
+        //! Number of dynamic rigid bodies stepped by the test.
+        static const int NumRigidBodies = 10000;
+
+        //! Number of rigid bodies in each row of the spawn grid
+        static const int BoxesPerRow = 100;
+
+        //! The size of the test terrain
+        static const float TerrainSize = 1000.0f;
+
+        //! Size of the boxes, and the gap between them when they are spawned
+        static const float BoxSize = 1.0f;
+        static const float BoxSpacing = 2.0f;
+
+        //! Height the boxes are dropped from, so they are moving and colliding with the terrain during the test
+        static const float SpawnHeight = 20.0f;
+
+        //! Number of iterations for each test
+        static const int NumIterations = 3;
+    } // namespace CpuDispatcherConstants
+
+    //! CPU dispatcher performance fixture.
+    //! Restarts the CPU dispatcher with the worker thread count of the benchmark, then creates a world and terrain.
+    class PhysXCpuDispatcherBenchmarkFixture
+        : public PhysXBaseBenchmarkFixture
+    {
+    protected:
+        void internalSetUp(const benchmark::State& state)
+        {
+            CpuDispatcherConfiguration config = GetPhysXSystem()->GetPhysXConfiguration().m_cpuDispatcherConfiguration;
+            config.m_workerThreadCount = aznumeric_cast<AZ::u32>(state.range(0));
+            GetPhysXSystem()->GetPxCpuDispathcher()->Configure(config);
+
+            PhysXBaseBenchmarkFixture::SetUpInternal();
+
+            m_terrainEntity = PhysX::TestUtils::CreateFlatTestTerrain(
+                m_testSceneHandle, CpuDispatcherConstants::TerrainSize, CpuDispatcherConstants::TerrainSize);
+        }
+
+        void internalTearDown()
+        {
+            m_terrainEntity = nullptr;
+            PhysXBaseBenchmarkFixture::TearDownInternal();
+
+            GetPhysXSystem()->GetPxCpuDispathcher()->Configure(GetPhysXSystem()->GetPhysXConfiguration().m_cpuDispatcherConfiguration);
+        }
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+    protected:
+        // PhysXBaseBenchmarkFixture Interface ---------
+        AzPhysics::SceneConfiguration GetDefaultSceneConfiguration() override
+        {
+            return AzPhysics::SceneConfiguration::CreateDefault();
+        }
+        // PhysXBaseBenchmarkFixture Interface ---------
+
+        EntityPtr m_terrainEntity;
+    };
+
+    //! BM_CpuDispatcher_StepDynamicBodies - This test drops 10k dynamic boxes on the terrain and steps the scene headless
+    //! for ~300 game frames at 60fps, with the number of CPU dispatcher worker threads requested by the benchmark.
+    BENCHMARK_DEFINE_F(PhysXCpuDispatcherBenchmarkFixture, BM_CpuDispatcher_StepDynamicBodies)(benchmark::State& state)
+    {
+        const int boxesPerRow = CpuDispatcherConstants::BoxesPerRow;
+        const float boxSizeWithSpacing = CpuDispatcherConstants::BoxSize + CpuDispatcherConstants::BoxSpacing;
+
+        //function to generate the rigid bodies position on a grid above the terrain
+        Utils::GenerateSpawnPositionFuncPtr posGenerator = [boxesPerRow, boxSizeWithSpacing](int idx) -> const AZ::Vector3 {
+            const float x = boxSizeWithSpacing * (1 + idx % boxesPerRow);
+            const float y = boxSizeWithSpacing * (1 + idx / boxesPerRow);
+            return AZ::Vector3(x, y, CpuDispatcherConstants::SpawnHeight);
+        };
+
+        auto boxShapeConfiguration = AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3(CpuDispatcherConstants::BoxSize));
+        Utils::GenerateColliderFuncPtr colliderGenerator = [&boxShapeConfiguration]([[maybe_unused]] int idx)
+        {
+            return boxShapeConfiguration;
+        };
+
+        //spawn the rigid bodies
+        Utils::BenchmarkRigidBodies rigidBodies = Utils::CreateRigidBodies(
+            CpuDispatcherConstants::NumRigidBodies, GetDefaultSceneHandle(), false, RigidBodyApiObject, &colliderGenerator, &posGenerator);
+
+        PhysXCpuDispatcher* cpuDispatcher = GetPhysXSystem()->GetPxCpuDispathcher();
+
+        //setup the sub tick tracker
+        Utils::PrePostSimulationEventHandler subTickTracker;
+        subTickTracker.Start(m_defaultScene);
+
+        //setup the frame timer tracker
+        Types::TimeList tickTimes;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < CpuDispatcherConstants::GameFramesToSimulate; i++)
+            {
+                auto start = AZStd::chrono::steady_clock::now();
+                StepScene1Tick(DefaultTimeStep);
+                cpuDispatcher->PublishStepStatistics();
+
+                //time each physics tick and store it to analyze
+                auto tickElapsedMilliseconds = Types::double_milliseconds(AZStd::chrono::steady_clock::now() - start);
+                tickTimes.emplace_back(tickElapsedMilliseconds.count());
+            }
+        }
+        subTickTracker.Stop();
+
+        //object clean up
+        if (auto handlesList = AZStd::get_if<AzPhysics::SimulatedBodyHandleList>(&rigidBodies))
+        {
+            m_defaultScene->RemoveSimulatedBodies(*handlesList);
+        }
+
+        AZStd::visit(
+            [](auto& rigidBodies)
+            {
+                rigidBodies.clear();
+            },
+            rigidBodies);
+
+        //sort the frame times and get the P50, P90, P99 percentiles
+        Utils::ReportFramePercentileCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+        Utils::ReportFrameStandardDeviationAndMeanCounters(state, tickTimes, subTickTracker.GetSubTickTimes());
+
+        state.counters["WorkerThreads"] = cpuDispatcher->GetWorkerThreadCount();
+    }
+
+    // Argument is the number of worker threads, 0 uses the default worker thread count
+    BENCHMARK_REGISTER_F(PhysXCpuDispatcherBenchmarkFixture, BM_CpuDispatcher_StepDynamicBodies)
+        ->Arg(1)
+        ->Arg(2)
+        ->Arg(4)
+        ->Arg(0)
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(CpuDispatcherConstants::NumIterations)
+        ->MeasureProcessCPUTime()
+        ;
+} // namespace PhysX::Benchmarks
+
+#endif // HAVE_BENCHMARK
@@ -17,6 +17,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <PhysX/ComponentTypeIds.h>
 #include <PhysX/SystemComponentBus.h>
+#include <Scene/PhysXScene.h>
 #include <Source/SphereColliderComponent.h>
 #include <Source/CapsuleColliderComponent.h>
 #include <System/PhysXSystem.h>
@@ -176,6 +177,98 @@ namespace PhysX
         }
     }
 
+    TEST_F(PhysXDefaultWorldTest, CharacterController_QueuedMoves_AppliedInOrderWhenSceneStartsSimulating)
+    {
+        ControllerTestBasis basis(m_testSceneHandle);
+        basis.Update(AZ::Vector3::CreateZero());
+        auto* controller = azdynamic_cast<CharacterController*>(basis.m_controller);
+        auto* scene = azdynamic_cast<PhysXScene*>(basis.m_testScene);
+        ASSERT_TRUE(controller != nullptr && scene != nullptr);
+
+        PhysX::TestUtils::AddStaticUnitBoxToScene(basis.m_sceneHandle, AZ::Vector3(1.5f, 0.0f, 0.5f));
+
+        // the first move is stopped by the box, the second one moves the controller away from it
+        const AZ::Vector3 startPosition = controller->GetBasePosition();
+        scene->QueueCharacterControllerMove(controller->m_bodyHandle, AZ::Vector3::CreateAxisX(2.0f), basis.m_timeStep);
+        scene->QueueCharacterControllerMove(controller->m_bodyHandle, AZ::Vector3::CreateAxisY(2.0f), basis.m_timeStep);
+        EXPECT_TRUE(controller->GetBasePosition().IsClose(startPosition));
+
+        basis.Update(AZ::Vector3::CreateZero());
+        EXPECT_TRUE(controller->GetBasePosition().IsClose(AZ::Vector3(0.65f, 2.0f, 0.0f)));
+    }
+
+    TEST_F(PhysXDefaultWorldTest, CharacterController_QueuedMoveHittingBox_HitReportedAfterMove)
+    {
+        ControllerTestBasis basis(m_testSceneHandle);
+        basis.Update(AZ::Vector3::CreateZero());
+        auto* controller = azdynamic_cast<CharacterController*>(basis.m_controller);
+        ASSERT_TRUE(controller != nullptr);
+
+        PhysX::TestUtils::AddStaticUnitBoxToScene(basis.m_sceneHandle, AZ::Vector3(1.5f, 0.0f, 0.5f));
+
+        int hitCount = 0;
+        AZ::Vector3 positionWhenHit = AZ::Vector3::CreateZero();
+        controller->GetCallbackManager()->SetOnShapeHit(
+            [&hitCount, &positionWhenHit, controller]([[maybe_unused]] const physx::PxControllerShapeHit& hit)
+            {
+                hitCount++;
+                positionWhenHit = controller->GetBasePosition();
+            });
+
+        controller->AddVelocityForTick(AZ::Vector3::CreateAxisX(2.0f / basis.m_timeStep));
+        controller->SetMaximumSpeed(2.0f / basis.m_timeStep);
+        controller->QueueRequestedVelocity(basis.m_timeStep);
+        basis.Update(AZ::Vector3::CreateZero());
+
+        EXPECT_GT(hitCount, 0);
+        EXPECT_TRUE(positionWhenHit.IsClose(AZ::Vector3::CreateAxisX(0.65f)));
+    }
+
+    TEST_F(PhysXDefaultWorldTest, CharacterController_QueuedMoveHitRemovesOtherController_OtherControllerHitsNotReported)
+    {
+        ControllerTestBasis basis(m_testSceneHandle);
+        ControllerTestBasis otherBasis(m_testSceneHandle);
+        basis.Update(AZ::Vector3::CreateZero());
+        auto* controller = azdynamic_cast<CharacterController*>(basis.m_controller);
+        auto* otherController = azdynamic_cast<CharacterController*>(otherBasis.m_controller);
+        ASSERT_TRUE(controller != nullptr && otherController != nullptr);
+
+        // the hits are dispatched in body index order, so the first controller's callback runs before the other controller's
+        ASSERT_LT(
+            AZStd::get<AzPhysics::HandleTypeIndex::Index>(controller->m_bodyHandle),
+            AZStd::get<AzPhysics::HandleTypeIndex::Index>(otherController->m_bodyHandle));
+
+        otherController->SetBasePosition(AZ::Vector3::CreateAxisY(5.0f));
+        PhysX::TestUtils::AddStaticUnitBoxToScene(basis.m_sceneHandle, AZ::Vector3(1.5f, 0.0f, 0.5f));
+        PhysX::TestUtils::AddStaticUnitBoxToScene(basis.m_sceneHandle, AZ::Vector3(1.5f, 5.0f, 0.5f));
+
+        // the first controller's hit removes the other controller, which hit a box during the same batch
+        controller->GetCallbackManager()->SetOnShapeHit(
+            [&otherBasis]([[maybe_unused]] const physx::PxControllerShapeHit& hit)
+            {
+                if (otherBasis.m_controllerEntity->GetState() == AZ::Entity::State::Active)
+                {
+                    otherBasis.m_controllerEntity->Deactivate();
+                }
+            });
+
+        int otherHitCount = 0;
+        otherController->GetCallbackManager()->SetOnShapeHit(
+            [&otherHitCount]([[maybe_unused]] const physx::PxControllerShapeHit& hit)
+            {
+                otherHitCount++;
+            });
+
+        auto* scene = azdynamic_cast<PhysXScene*>(basis.m_testScene);
+        ASSERT_TRUE(scene != nullptr);
+        scene->QueueCharacterControllerMove(controller->m_bodyHandle, AZ::Vector3::CreateAxisX(2.0f), basis.m_timeStep);
+        scene->QueueCharacterControllerMove(otherController->m_bodyHandle, AZ::Vector3::CreateAxisX(2.0f), basis.m_timeStep);
+        basis.Update(AZ::Vector3::CreateZero());
+
+        EXPECT_EQ(otherBasis.m_controllerEntity->GetState(), AZ::Entity::State::Init);
+        EXPECT_EQ(otherHitCount, 0);
+    }
+
     TEST_F(PhysXDefaultWorldTest, CharacterController_MovingDirectlyTowardsStaticBox_StoppedByBox)
     {
         ControllerTestBasis basis(m_testSceneHandle);
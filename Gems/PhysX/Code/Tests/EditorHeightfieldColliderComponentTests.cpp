@@ -25,6 +25,7 @@
 #include <AzCore/Casting/lossy_cast.h>
 #include <Utils.h>
 
+using ::testing::_;
 using ::testing::NiceMock;
 using ::testing::Return;
 
@@ -489,5 +490,42 @@ namespace PhysXEditorTests
         }
     }
 
+    TEST_F(PhysXEditorHeightfieldFixture, EditorHeightfieldColliderComponentHeightDataChangeRefreshesExistingHeightfield)
+    {
+        AZ::EntityId gameEntityId = m_gameEntity->GetId();
+
+        auto getNativeHeightfield = [gameEntityId]()
+        {
+            AzPhysics::SimulatedBody* staticBody = nullptr;
+            AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+                staticBody, gameEntityId, &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBody);
+            const auto* pxRigidStatic = static_cast<const physx::PxRigidStatic*>(staticBody->GetNativePointer());
+            PHYSX_SCENE_READ_LOCK(pxRigidStatic->getScene());
+
+            physx::PxShape* shape = nullptr;
+            pxRigidStatic->getShapes(&shape, 1, 0);
+
+            physx::PxHeightFieldGeometry heightfieldGeometry;
+            shape->getHeightFieldGeometry(heightfieldGeometry);
+            return heightfieldGeometry.heightField;
+        };
+
+        physx::PxHeightField* originalHeightfield = getNativeHeightfield();
+        ASSERT_NE(originalHeightfield, nullptr);
+
+        // A change that only affects the height data should refresh the dirty tiles of the existing heightfield,
+        // instead of rebuilding the heightfield.
+        EXPECT_CALL(*m_gameMockShapeRequests, UpdateHeightsAndMaterialsAsync(_, _, 0, 0, 3, 3)).Times(1);
+
+        Physics::HeightfieldProviderNotificationBus::Event(
+            gameEntityId, &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged,
+            AZ::Aabb::CreateFromMinMaxValues(0.0f, 1.0f, -3.0f, 2.0f, 3.0f, 3.0f),
+            Physics::HeightfieldProviderNotifications::HeightfieldChangeMask::HeightData);
+
+        m_gameEntity->FindComponent<PhysX::HeightfieldColliderComponent>()->BlockOnPendingJobs();
+
+        EXPECT_EQ(getNativeHeightfield(), originalHeightfield);
+    }
+
 } // namespace PhysXEditorTests
 
@@ -148,8 +148,6 @@ set(FILES
     Source/System/PhysXCookingParams.cpp
     Source/System/PhysXCpuDispatcher.cpp
     Source/System/PhysXCpuDispatcher.h
-    Source/System/PhysXJob.cpp
-    Source/System/PhysXJob.h
     Source/System/PhysXJointInterface.h
     Source/System/PhysXJointInterface.cpp
     Source/System/PhysXSdkCallbacks.h
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Debug/Budget.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 
 #include "Nodeable.h"
@@ -32,7 +33,8 @@ namespace ScriptCanvas
     {
     public:
         AZ_RTTI(EBusHandler, "{38E3448F-1876-41DF-A26F-EF873AF5EE14}", Nodeable);
-        AZ_CLASS_ALLOCATOR(EBusHandler, AZ::SystemAllocator);      
+        // a handler is created for every bus handled by every activated graph instance, so they are pooled rather than taken from the system heap
+        AZ_CLASS_ALLOCATOR(EBusHandler, AZ::ThreadPoolAllocator);
         
         static EBusHandler* Create(ExecutionStateWeakPtr executionState, AZStd::string_view busName);
         
@@ -58,13 +58,28 @@ namespace ScriptCanvas
         ActivationInputRange Context::CreateActivateInputRange(ActivationData& activationData)
         {
             const RuntimeData& runtimeData = activationData.runtimeData;
-            ActivationInputRange rangeOut = runtimeData.m_activationInputRange;
-            rangeOut.inputs = activationData.storage.begin();
+            const ActivationInputRange& staticRange = runtimeData.m_activationInputRange;
+
+            // an instance with no state of its own, which overrides no variables, has no entity ids, and has no dependencies that take
+            // construction arguments, pushes exactly the static arguments, so its range is a copy of the static one and needs no storage
+            if (staticRange.nodeableCount == 0
+                && staticRange.entityIdCount == 0
+                && !staticRange.requiresDependencyConstructionParameters
+                && activationData.variableOverrides.m_variables.empty())
+            {
+                return staticRange;
+            }
 
-            AZ_Assert(rangeOut.totalCount <= activationData.storage.size(), "Too many initial arguments for activation. "
+            // nodeables, overridden variables, entity ids and dependency construction arguments belong to the instance, so it gets its own copy
+            ActivationInputRange rangeOut = staticRange;
+
+            AZ_Assert(rangeOut.totalCount <= activationData.storage.capacity(), "Too many initial arguments for activation. "
                 "Consider increasing size, source of ActivationInputArray, or breaking up the source graph");
 
-            // nodeables - until the optimization is required, every instance gets their own copy
+            activationData.storage.resize(rangeOut.totalCount);
+            rangeOut.inputs = activationData.storage.data();
+
+            // nodeables
             {
                 auto sourceVariableIter = runtimeData.m_activationInputRange.inputs;
                 const auto sourceVariableSentinel = runtimeData.m_activationInputRange.inputs + runtimeData.m_activationInputRange.nodeableCount;
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/fixed_vector.h>
 #include <ScriptCanvas/Core/Core.h>
 
 namespace ScriptCanvas
@@ -19,7 +20,8 @@ namespace ScriptCanvas
 
     namespace Execution
     {
-        using ActivationInputArray = AZStd::array<AZ::BehaviorArgument, 128>;
+        // only the arguments of the activated graph are constructed, and none when it can use the shared range of its runtime data
+        using ActivationInputArray = AZStd::fixed_vector<AZ::BehaviorArgument, 128>;
 
         struct ActivationData
         {
@@ -48,6 +50,9 @@ namespace ScriptCanvas
             AZ_TYPE_INFO(Context, "{2C137581-19F4-42EB-8BF3-14DBFBC02D8D}");
             AZ_CLASS_ALLOCATOR(Context, AZ::SystemAllocator);
 
+            // Returns the static range of the runtime data when the graph has no nodeables, entity ids or dependency construction
+            // arguments and the instance overrides no variables, otherwise a range in the storage of the activation data, which must
+            // outlive the returned range. Either way, Lua copies each argument when it is pushed, so instances never share a value.
             static ActivationInputRange CreateActivateInputRange(ActivationData& activationData);
             static void InitializeStaticActivationData(RuntimeData& runtimeData);
 
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/ScriptSystemBus.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Editor/Framework/ScriptCanvasGraphUtilities.h>
+#include <Editor/Framework/ScriptCanvasTraceUtilities.h>
+#include <ScriptCanvas/Asset/RuntimeAsset.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+#include <ScriptCanvas/Execution/RuntimeComponent.h>
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+namespace ScriptCanvasTests
+{
+    // Gives the benchmarks access to the application the unit tests run in.
+    class ActivationBenchmarkApplication
+        : public ScriptCanvasTestFixture
+    {
+    public:
+        using ScriptCanvasTestFixture::SetUpTestCase;
+        using ScriptCanvasTestFixture::TearDownTestCase;
+    };
+
+    // Measures the cost of activating many entities that run the same graph, the way a level with many instances of one prefab does.
+    // Every entity has its own runtime component, with a copy of the same overrides, and all of them share the runtime asset. The
+    // counters are the bytes of the system and pool allocators, and of the Lua virtual machine, that each activated instance holds.
+    class ActivationBenchmarkFixture
+        : public benchmark::Fixture
+    {
+    public:
+        static constexpr const char* GraphName = "LY_SC_UnitTest_EventHandlerNoDisconnect";
+
+    private:
+        void internalSetUp()
+        {
+            ActivationBenchmarkApplication::SetUpTestCase();
+
+            ScriptCanvasEditor::ScopedOutputSuppression outputSuppressor;
+            const AZStd::string graphPath = AZStd::string::format("%s/%s.scriptcanvas", GetUnitTestDirPathRelative(), GraphName);
+            m_loadResult = ScriptCanvasEditor::LoadTestGraph(graphPath);
+            if (!m_loadResult.m_runtimeAsset)
+            {
+                return;
+            }
+
+            AZ::Outcome<ScriptCanvas::Translation::LuaAssetResult, AZStd::string> luaAssetOutcome = AZ::Failure(AZStd::string("lua asset creation failed"));
+            ScriptCanvasEditor::EditorAssetConversionBus::BroadcastResult(luaAssetOutcome
+                , &ScriptCanvasEditor::EditorAssetConversionBusTraits::CreateLuaAsset, m_loadResult.m_editorAsset, m_loadResult.m_editorAsset.RelativePath().c_str());
+            if (!luaAssetOutcome.IsSuccess())
+            {
+                return;
+            }
+
+            const ScriptCanvas::Translation::LuaAssetResult& luaAssetResult = luaAssetOutcome.GetValue();
+            ScriptCanvas::RuntimeData& runtimeData = m_loadResult.m_runtimeAsset.Get()->m_runtimeData;
+            runtimeData.m_script = luaAssetResult.m_scriptAsset;
+            runtimeData.m_input = luaAssetResult.m_runtimeInputs;
+            runtimeData.m_debugMap = luaAssetResult.m_debugMap;
+
+            m_runtimeDataOverrides.m_runtimeAsset = m_loadResult.m_runtimeAsset;
+            ScriptCanvasEditor::CopyAssetEntityIdsToOverrides(m_runtimeDataOverrides);
+            ScriptCanvas::Execution::Context::InitializeStaticActivationData(runtimeData);
+            ScriptCanvas::Execution::InitializeInterpretedStatics(runtimeData);
+
+            AZ::ScriptSystemRequestBus::BroadcastResult(m_scriptContext, &AZ::ScriptSystemRequests::GetContext, AZ::ScriptContextIds::DefaultScriptContextId);
+            m_isGraphLoaded = m_scriptContext != nullptr;
+        }
+
+        void internalTearDown()
+        {
+            DestroyEntities();
+            m_runtimeDataOverrides = {};
+            m_loadResult = {};
+            m_scriptContext = nullptr;
+            m_isGraphLoaded = false;
+
+            ActivationBenchmarkApplication::TearDownTestCase();
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        void CreateEntities(size_t count)
+        {
+            m_entities.reserve(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto entity = AZStd::make_unique<AZ::Entity>("ActivationBenchmark");
+                auto runtimeComponent = entity->CreateComponent<ScriptCanvas::RuntimeComponent>();
+                ScriptCanvas::RuntimeDataOverrides runtimeDataOverrides = m_runtimeDataOverrides;
+                runtimeComponent->TakeRuntimeDataOverrides(AZStd::move(runtimeDataOverrides));
+                entity->Init();
+                m_entities.push_back(AZStd::move(entity));
+            }
+        }
+
+        void DestroyEntities()
+        {
+            for (auto& entity : m_entities)
+            {
+                if (entity->GetState() == AZ::Entity::State::Active)
+                {
+                    entity->Deactivate();
+                }
+            }
+            m_entities.clear();
+
+            if (m_scriptContext)
+            {
+                m_scriptContext->GarbageCollect();
+            }
+        }
+
+        static size_t GetHeapBytes()
+        {
+            return AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes()
+                + AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Get().NumAllocatedBytes();
+        }
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> m_entities;
+        ScriptCanvasEditor::LoadTestGraphResult m_loadResult;
+        ScriptCanvas::RuntimeDataOverrides m_runtimeDataOverrides;
+        AZ::ScriptContext* m_scriptContext = nullptr;
+        bool m_isGraphLoaded = false;
+    };
+
+    BENCHMARK_DEFINE_F(ActivationBenchmarkFixture, ActivateInstances)(benchmark::State& state)
+    {
+        if (!m_isGraphLoaded)
+        {
+            state.SkipWithError("failed to load the benchmark graph");
+            return;
+        }
+
+        ScriptCanvasEditor::ScopedOutputSuppression outputSuppressor;
+        const size_t numInstances = aznumeric_cast<size_t>(state.range(0));
+        double heapBytesPerInstance = 0.0;
+        double luaBytesPerInstance = 0.0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            CreateEntities(numInstances);
+            m_scriptContext->GarbageCollect();
+            const size_t heapBytes = GetHeapBytes();
+            const size_t luaBytes = m_scriptContext->GetMemoryUsage();
+            state.ResumeTiming();
+
+            for (auto& entity : m_entities)
+            {
+                entity->Activate();
+            }
+
+            state.PauseTiming();
+            // everything that is still referenced after a full collection is held by the activated instances
+            m_scriptContext->GarbageCollect();
+            heapBytesPerInstance = (aznumeric_cast<double>(GetHeapBytes()) - aznumeric_cast<double>(heapBytes)) / aznumeric_cast<double>(numInstances);
+            luaBytesPerInstance = (aznumeric_cast<double>(m_scriptContext->GetMemoryUsage()) - aznumeric_cast<double>(luaBytes)) / aznumeric_cast<double>(numInstances);
+            DestroyEntities();
+            state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * numInstances);
+        state.counters["heapBytesPerInstance"] = heapBytesPerInstance;
+        state.counters["luaBytesPerInstance"] = luaBytesPerInstance;
+    }
+
+    BENCHMARK_REGISTER_F(ActivationBenchmarkFixture, ActivateInstances)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+} // namespace ScriptCanvasTests
+
+#endif // HAVE_BENCHMARK
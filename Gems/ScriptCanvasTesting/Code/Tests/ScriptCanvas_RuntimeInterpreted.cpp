@@ -9,11 +9,15 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/MathReflection.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptSystemBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <ScriptCanvas/Core/EBusHandler.h>
 #include <ScriptCanvas/Core/SubgraphInterfaceUtility.h>
 #include <ScriptCanvas/Core/Nodeable.h>
+#include <ScriptCanvas/Execution/ExecutionContext.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+#include <ScriptCanvas/Execution/RuntimeComponent.h>
+#include <Editor/Framework/ScriptCanvasGraphUtilities.h>
 #include <Source/Framework/ScriptCanvasTestFixture.h>
 #include <Source/Framework/ScriptCanvasTestNodes.h>
 #include <Source/Framework/ScriptCanvasTestUtilities.h>
@@ -727,6 +731,79 @@ TEST_F(ScriptCanvasTestFixture, InterpretedOnce)
     RunUnitTestGraph("LY_SC_UnitTest_Once", ExecutionMode::Interpreted);
 }
 
+TEST_F(ScriptCanvasTestFixture, InterpretedOnceInstancesAreIndependent)
+{
+    // Activates several entities that run the same graph, each one while the earlier ones are still active. Every instance has its
+    // own Once nodeable and variables, so each one has to pass the Once node and count from the values of the asset, no matter
+    // what the active instances did to theirs.
+    ScopedOutputSuppression outputSuppressor;
+    const AZStd::string graphPath = AZStd::string::format("%s/LY_SC_UnitTest_Once.scriptcanvas", GetUnitTestDirPathRelative());
+    LoadTestGraphResult loadResult = LoadTestGraph(graphPath);
+    ASSERT_TRUE(loadResult.m_runtimeAsset);
+
+    AZ::Outcome<ScriptCanvas::Translation::LuaAssetResult, AZStd::string> luaAssetOutcome = AZ::Failure(AZStd::string("lua asset creation failed"));
+    EditorAssetConversionBus::BroadcastResult(luaAssetOutcome
+        , &EditorAssetConversionBusTraits::CreateLuaAsset, loadResult.m_editorAsset, loadResult.m_editorAsset.RelativePath().c_str());
+    ASSERT_TRUE(luaAssetOutcome.IsSuccess()) << luaAssetOutcome.GetError().c_str();
+
+    const ScriptCanvas::Translation::LuaAssetResult& luaAssetResult = luaAssetOutcome.GetValue();
+    RuntimeData& runtimeData = loadResult.m_runtimeAsset.Get()->m_runtimeData;
+    runtimeData.m_script = luaAssetResult.m_scriptAsset;
+    runtimeData.m_input = luaAssetResult.m_runtimeInputs;
+    runtimeData.m_debugMap = luaAssetResult.m_debugMap;
+    ASSERT_FALSE(runtimeData.m_input.m_nodeables.empty());
+    ASSERT_FALSE(runtimeData.m_input.m_variables.empty());
+
+    RuntimeDataOverrides runtimeDataOverrides;
+    runtimeDataOverrides.m_runtimeAsset = loadResult.m_runtimeAsset;
+    CopyAssetEntityIdsToOverrides(runtimeDataOverrides);
+    ScriptCanvas::Execution::Context::InitializeStaticActivationData(runtimeData);
+    ScriptCanvas::Execution::InitializeInterpretedStatics(runtimeData);
+
+    constexpr size_t instanceCount = 3;
+    AZStd::vector<AZStd::unique_ptr<AZ::Entity>> entities;
+
+    for (size_t i = 0; i < instanceCount; ++i)
+    {
+        auto entity = AZStd::make_unique<AZ::Entity>("Once instance");
+        RuntimeDataOverrides instanceOverrides = runtimeDataOverrides;
+        entity->CreateComponent<RuntimeComponent>()->TakeRuntimeDataOverrides(AZStd::move(instanceOverrides));
+        entity->Init();
+        entities.push_back(AZStd::move(entity));
+    }
+
+    for (size_t i = 0; i < instanceCount; ++i)
+    {
+        Reporter reporter;
+        reporter.SetGraph(loadResult.m_runtimeAsset.GetId());
+        entities[i]->Activate();
+        reporter.FinishReport();
+
+        EXPECT_TRUE(reporter.IsComplete()) << "instance " << i << " did not complete";
+
+        for (const auto& failure : reporter.GetFailure())
+        {
+            ADD_FAILURE() << "instance " << i << ": " << failure.c_str();
+        }
+    }
+
+    // the active instances changed only their own copies of the variables
+    ASSERT_EQ(luaAssetResult.m_runtimeInputs.m_variables.size(), runtimeData.m_input.m_variables.size());
+    for (size_t i = 0; i < runtimeData.m_input.m_variables.size(); ++i)
+    {
+        EXPECT_EQ(luaAssetResult.m_runtimeInputs.m_variables[i].second.ToString(), runtimeData.m_input.m_variables[i].second.ToString());
+    }
+
+    for (auto& entity : entities)
+    {
+        entity->Deactivate();
+    }
+
+    entities.clear();
+    AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::ClearAssetReferences, luaAssetResult.m_scriptAsset.GetId());
+    AZ::ScriptSystemRequestBus::Broadcast(&AZ::ScriptSystemRequests::GarbageCollect);
+}
+
 TEST_F(ScriptCanvasTestFixture, InterpretedOperatorAdd)
 {
     RunUnitTestGraph("LY_SC_UnitTest_OperatorAdd", ExecutionMode::Interpreted);
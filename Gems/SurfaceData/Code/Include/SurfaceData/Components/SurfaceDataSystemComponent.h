@@ -9,8 +9,11 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <SurfaceData/SurfaceDataRegistryIndex.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 
@@ -19,6 +22,7 @@ namespace SurfaceData
     class SurfaceDataSystemComponent
         : public AZ::Component
         , private SurfaceDataSystemRequestBus::Handler
+        , private AZ::TickBus::Handler
     {
     public:
         AZ_COMPONENT(SurfaceDataSystemComponent, "{6F334BAA-7BD5-45F8-A9BA-760667D25FA0}");
@@ -36,8 +40,11 @@ namespace SurfaceData
         void Init() override;
         void Activate() override;
         void Deactivate() override;
-        
-        
+
+        ////////////////////////////////////////////////////////////////////////
+        // AZ::TickBus implementation
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
         ////////////////////////////////////////////////////////////////////////
         // SurfaceDataSystemRequestBus implementation
         void GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointList) const override;
@@ -73,7 +80,8 @@ namespace SurfaceData
         using SurfaceDataRegistryMap = AZStd::unordered_map<SurfaceDataRegistryHandle, SurfaceDataRegistryEntry>;
 
         // Get all the surface tags that can exist within the given bounds.
-        SurfaceTagSet GetTagsFromBounds(const AZ::Aabb& bounds, const SurfaceDataRegistryMap& registeredEntries) const;
+        SurfaceTagSet GetTagsFromBounds(
+            const AZ::Aabb& bounds, const SurfaceDataRegistryMap& registeredEntries, const SurfaceDataRegistryIndex& registryIndex) const;
         // Get all the surface provider tags that can exist within the given bounds.
         SurfaceTagSet GetProviderTagsFromBounds(const AZ::Aabb& bounds) const;
         // Get all the surface modifier tags that can exist within the given bounds.
@@ -96,10 +104,24 @@ namespace SurfaceData
         mutable AZStd::shared_mutex m_registrationMutex;
         SurfaceDataRegistryMap m_registeredSurfaceDataProviders;
         SurfaceDataRegistryMap m_registeredSurfaceDataModifiers;
+        // Spatial indices over the bounds of the registered providers and modifiers, so that queries only visit the nearby ones.
+        SurfaceDataRegistryIndex m_surfaceDataProviderIndex;
+        SurfaceDataRegistryIndex m_surfaceDataModifierIndex;
         SurfaceDataRegistryHandle m_registeredSurfaceDataProviderHandleCounter = InvalidSurfaceDataRegistryHandle;
         SurfaceDataRegistryHandle m_registeredSurfaceDataModifierHandleCounter = InvalidSurfaceDataRegistryHandle;
         AZStd::unordered_set<AZ::u32> m_registeredModifierTags;
 
+        // Counts of the providers and modifiers that queries used out of the ones registered, accumulated from every query thread
+        // and reported to the profiler once per tick.
+        struct QueryStats
+        {
+            AZStd::atomic_size_t m_acceptedProviders{ 0 };
+            AZStd::atomic_size_t m_registeredProviders{ 0 };
+            AZStd::atomic_size_t m_appliedModifiers{ 0 };
+            AZStd::atomic_size_t m_registeredModifiers{ 0 };
+        };
+        mutable QueryStats m_queryStats;
+
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
     };
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <SurfaceData/SurfaceDataTypes.h>
+
+namespace SurfaceData
+{
+    //! SurfaceDataRegistryIndex is a 2D spatial index for the bounds of registered surface data providers or modifiers.
+    //! Entries are bucketed into a uniform grid of XY cells, so a bounded query only visits the entries in the cells that it
+    //! overlaps instead of checking the bounds of every registered entry. Entries with infinite bounds, or with bounds that
+    //! cover too many cells (such as a terrain provider that spans the whole world), are kept in a separate list that every
+    //! query returns.
+    //! The index only narrows down the set of candidates. Callers are still expected to check the exact bounds of each entry.
+    class SurfaceDataRegistryIndex
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SurfaceDataRegistryIndex, AZ::SystemAllocator);
+
+        //! The default size of each grid cell, in meters.
+        static constexpr float DefaultCellSize = 64.0f;
+
+        //! Entries that cover more cells than this are stored in the unbounded list instead of in each cell.
+        static constexpr size_t MaxCellsPerEntry = 256;
+
+        explicit SurfaceDataRegistryIndex(float cellSize = DefaultCellSize);
+
+        //! Add an entry to the index. Invalid bounds are treated as infinite.
+        //! @param handle - The registry handle of the entry.
+        //! @param bounds - The bounds of the entry.
+        void Insert(const SurfaceDataRegistryHandle& handle, const AZ::Aabb& bounds);
+
+        //! Remove an entry from the index. Removing a handle that isn't in the index does nothing.
+        //! @param handle - The registry handle of the entry.
+        void Remove(const SurfaceDataRegistryHandle& handle);
+
+        //! Move an existing entry to new bounds, or add it if it isn't in the index yet.
+        //! @param handle - The registry handle of the entry.
+        //! @param bounds - The new bounds of the entry.
+        void Update(const SurfaceDataRegistryHandle& handle, const AZ::Aabb& bounds);
+
+        //! Remove every entry from the index.
+        void Clear();
+
+        //! Get the total number of entries in the index.
+        size_t GetSize() const
+        {
+            return m_entries.size();
+        }
+
+        //! Get the handles of every entry whose cells overlap the given bounds in XY.
+        //! @param bounds - The bounds to query. Invalid bounds are treated as infinite and return every entry.
+        //! @param outHandles - The list that the handles get added to, sorted by increasing handle with no duplicates.
+        void GetCandidates(const AZ::Aabb& bounds, AZStd::vector<SurfaceDataRegistryHandle>& outHandles) const;
+
+    private:
+        // The inclusive range of cells that a set of bounds covers.
+        struct CellRange
+        {
+            AZ::s32 m_minX = 0;
+            AZ::s32 m_minY = 0;
+            AZ::s32 m_maxX = 0;
+            AZ::s32 m_maxY = 0;
+            bool m_unbounded = true;
+        };
+
+        // Get the range of cells covered by the given bounds. The range is marked as unbounded if the bounds are invalid,
+        // or if they cover more than maxCells cells.
+        CellRange GetCellRange(const AZ::Aabb& bounds, size_t maxCells) const;
+
+        static AZ::u64 GetCellKey(AZ::s32 x, AZ::s32 y);
+        static AZ::s32 GetCellX(AZ::u64 cellKey);
+        static AZ::s32 GetCellY(AZ::u64 cellKey);
+
+        float m_inverseCellSize = 1.0f / DefaultCellSize;
+
+        // The cells that each entry is currently stored in, so that entries can be removed without knowing their old bounds.
+        AZStd::unordered_map<SurfaceDataRegistryHandle, CellRange> m_entries;
+        AZStd::unordered_map<AZ::u64, AZStd::vector<SurfaceDataRegistryHandle>> m_cells;
+        AZStd::vector<SurfaceDataRegistryHandle> m_unboundedEntries;
+    };
+}
@@ -11,6 +11,9 @@
 
 AZ_DECLARE_BUDGET(SurfaceData);
 
+// Records a value for a surface data profiler counter, such as the ratio of registered providers that a query rejected.
+#define SURFACE_DATA_PROFILE_DATAPOINT(value, counterName) AZ_PROFILE_DATAPOINT(SurfaceData, value, counterName)
+
 //#define ENABLE_SURFACE_DATA_PROFILE_VERBOSE
 #ifdef ENABLE_SURFACE_DATA_PROFILE_VERBOSE
 // Add verbose profile markers
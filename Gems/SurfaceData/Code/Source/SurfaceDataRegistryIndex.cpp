@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <SurfaceData/SurfaceDataRegistryIndex.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace SurfaceData
+{
+    SurfaceDataRegistryIndex::SurfaceDataRegistryIndex(float cellSize)
+        : m_inverseCellSize(1.0f / cellSize)
+    {
+        AZ_Assert(cellSize > 0.0f, "Surface data registry index cell size must be positive.");
+    }
+
+    void SurfaceDataRegistryIndex::Insert(const SurfaceDataRegistryHandle& handle, const AZ::Aabb& bounds)
+    {
+        AZ_Assert(!m_entries.contains(handle), "Surface data registry handle %u is already in the index.", handle);
+
+        const CellRange cellRange = GetCellRange(bounds, MaxCellsPerEntry);
+        m_entries[handle] = cellRange;
+
+        if (cellRange.m_unbounded)
+        {
+            m_unboundedEntries.push_back(handle);
+            return;
+        }
+
+        for (AZ::s32 y = cellRange.m_minY; y <= cellRange.m_maxY; y++)
+        {
+            for (AZ::s32 x = cellRange.m_minX; x <= cellRange.m_maxX; x++)
+            {
+                m_cells[GetCellKey(x, y)].push_back(handle);
+            }
+        }
+    }
+
+    void SurfaceDataRegistryIndex::Remove(const SurfaceDataRegistryHandle& handle)
+    {
+        auto entryItr = m_entries.find(handle);
+        if (entryItr == m_entries.end())
+        {
+            return;
+        }
+
+        const CellRange cellRange = entryItr->second;
+        m_entries.erase(entryItr);
+
+        if (cellRange.m_unbounded)
+        {
+            AZStd::erase(m_unboundedEntries, handle);
+            return;
+        }
+
+        for (AZ::s32 y = cellRange.m_minY; y <= cellRange.m_maxY; y++)
+        {
+            for (AZ::s32 x = cellRange.m_minX; x <= cellRange.m_maxX; x++)
+            {
+                auto cellItr = m_cells.find(GetCellKey(x, y));
+                if (cellItr != m_cells.end())
+                {
+                    AZStd::erase(cellItr->second, handle);
+                    if (cellItr->second.empty())
+                    {
+                        m_cells.erase(cellItr);
+                    }
+                }
+            }
+        }
+    }
+
+    void SurfaceDataRegistryIndex::Update(const SurfaceDataRegistryHandle& handle, const AZ::Aabb& bounds)
+    {
+        Remove(handle);
+        Insert(handle, bounds);
+    }
+
+    void SurfaceDataRegistryIndex::Clear()
+    {
+        m_entries.clear();
+        m_cells.clear();
+        m_unboundedEntries.clear();
+    }
+
+    void SurfaceDataRegistryIndex::GetCandidates(const AZ::Aabb& bounds, AZStd::vector<SurfaceDataRegistryHandle>& outHandles) const
+    {
+        const size_t firstCandidate = outHandles.size();
+
+        if (!bounds.IsValid())
+        {
+            for (const auto& [handle, cellRange] : m_entries)
+            {
+                outHandles.push_back(handle);
+            }
+        }
+        else
+        {
+            outHandles.insert(outHandles.end(), m_unboundedEntries.begin(), m_unboundedEntries.end());
+
+            // Never walk more cells than are actually occupied. Large queries check the occupied cells against the query range instead.
+            const CellRange queryRange = GetCellRange(bounds, m_cells.size());
+            if (queryRange.m_unbounded)
+            {
+                // The query covers more cells than there are occupied cells, so check each occupied cell against the query.
+                const CellRange fullRange = GetCellRange(bounds, AZStd::numeric_limits<size_t>::max());
+                for (const auto& [cellKey, cellHandles] : m_cells)
+                {
+                    const AZ::s32 x = GetCellX(cellKey);
+                    const AZ::s32 y = GetCellY(cellKey);
+                    if (fullRange.m_unbounded ||
+                        (x >= fullRange.m_minX && x <= fullRange.m_maxX && y >= fullRange.m_minY && y <= fullRange.m_maxY))
+                    {
+                        outHandles.insert(outHandles.end(), cellHandles.begin(), cellHandles.end());
+                    }
+                }
+            }
+            else
+            {
+                for (AZ::s32 y = queryRange.m_minY; y <= queryRange.m_maxY; y++)
+                {
+                    for (AZ::s32 x = queryRange.m_minX; x <= queryRange.m_maxX; x++)
+                    {
+                        auto cellItr = m_cells.find(GetCellKey(x, y));
+                        if (cellItr != m_cells.end())
+                        {
+                            outHandles.insert(outHandles.end(), cellItr->second.begin(), cellItr->second.end());
+                        }
+                    }
+                }
+            }
+        }
+
+        // Entries that span multiple cells show up once per cell, so remove the duplicates. Sorting also gives callers a
+        // consistent order to process the entries in, regardless of how they're distributed in the grid.
+        auto candidatesBegin = outHandles.begin() + firstCandidate;
+        AZStd::sort(candidatesBegin, outHandles.end());
+        outHandles.erase(AZStd::unique(candidatesBegin, outHandles.end()), outHandles.end());
+    }
+
+    SurfaceDataRegistryIndex::CellRange SurfaceDataRegistryIndex::GetCellRange(const AZ::Aabb& bounds, size_t maxCells) const
+    {
+        CellRange cellRange;
+        if (!bounds.IsValid())
+        {
+            return cellRange;
+        }
+
+        // Compute the cell counts in floating-point first so that huge bounds can't overflow the integer cell coordinates.
+        const float minX = floorf(bounds.GetMin().GetX() * m_inverseCellSize);
+        const float minY = floorf(bounds.GetMin().GetY() * m_inverseCellSize);
+        const float maxX = floorf(bounds.GetMax().GetX() * m_inverseCellSize);
+        const float maxY = floorf(bounds.GetMax().GetY() * m_inverseCellSize);
+        const double cellCount = (static_cast<double>(maxX) - minX + 1.0) * (static_cast<double>(maxY) - minY + 1.0);
+        constexpr float CellCoordinateLimit = static_cast<float>(AZStd::numeric_limits<AZ::s32>::max() / 2);
+        const bool outOfRange = (minX < -CellCoordinateLimit) || (minY < -CellCoordinateLimit) || (maxX > CellCoordinateLimit) ||
+            (maxY > CellCoordinateLimit);
+        if (outOfRange || (cellCount > static_cast<double>(maxCells)))
+        {
+            return cellRange;
+        }
+
+        cellRange.m_minX = aznumeric_cast<AZ::s32>(minX);
+        cellRange.m_minY = aznumeric_cast<AZ::s32>(minY);
+        cellRange.m_maxX = aznumeric_cast<AZ::s32>(maxX);
+        cellRange.m_maxY = aznumeric_cast<AZ::s32>(maxY);
+        cellRange.m_unbounded = false;
+        return cellRange;
+    }
+
+    AZ::u64 SurfaceDataRegistryIndex::GetCellKey(AZ::s32 x, AZ::s32 y)
+    {
+        return (static_cast<AZ::u64>(static_cast<AZ::u32>(x)) << 32) | static_cast<AZ::u64>(static_cast<AZ::u32>(y));
+    }
+
+    AZ::s32 SurfaceDataRegistryIndex::GetCellX(AZ::u64 cellKey)
+    {
+        return static_cast<AZ::s32>(static_cast<AZ::u32>(cellKey >> 32));
+    }
+
+    AZ::s32 SurfaceDataRegistryIndex::GetCellY(AZ::u64 cellKey)
+    {
+        return static_cast<AZ::s32>(static_cast<AZ::u32>(cellKey & 0xFFFFFFFF));
+    }
+}
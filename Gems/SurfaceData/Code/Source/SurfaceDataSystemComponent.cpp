@@ -24,6 +24,15 @@ AZ_DEFINE_BUDGET(SurfaceData);
 
 namespace SurfaceData
 {
+    namespace
+    {
+        // Get the fraction of the registered entries that queries skipped, for reporting to the profiler.
+        double GetRejectionRatio(size_t acceptedCount, size_t totalCount)
+        {
+            return (totalCount > 0) ? (1.0 - (aznumeric_cast<double>(acceptedCount) / totalCount)) : 0.0;
+        }
+    }
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -102,14 +111,29 @@ namespace SurfaceData
     {
         AZ::Interface<SurfaceDataSystem>::Register(this);
         SurfaceDataSystemRequestBus::Handler::BusConnect();
+        AZ::TickBus::Handler::BusConnect();
     }
 
     void SurfaceDataSystemComponent::Deactivate()
     {
+        AZ::TickBus::Handler::BusDisconnect();
         SurfaceDataSystemRequestBus::Handler::BusDisconnect();
         AZ::Interface<SurfaceDataSystem>::Unregister(this);
     }
 
+    void SurfaceDataSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        // Queries can run on any thread, so they only accumulate their counts. The ratios are reported once per tick, over all of
+        // the queries since the previous tick.
+        const size_t acceptedProviders = m_queryStats.m_acceptedProviders.exchange(0, AZStd::memory_order_relaxed);
+        const size_t registeredProviders = m_queryStats.m_registeredProviders.exchange(0, AZStd::memory_order_relaxed);
+        const size_t appliedModifiers = m_queryStats.m_appliedModifiers.exchange(0, AZStd::memory_order_relaxed);
+        const size_t registeredModifiers = m_queryStats.m_registeredModifiers.exchange(0, AZStd::memory_order_relaxed);
+
+        SURFACE_DATA_PROFILE_DATAPOINT(GetRejectionRatio(acceptedProviders, registeredProviders), L"SurfaceData/ProviderRejectionRatio");
+        SURFACE_DATA_PROFILE_DATAPOINT(GetRejectionRatio(appliedModifiers, registeredModifiers), L"SurfaceData/ModifierRejectionRatio");
+    }
+
     SurfaceDataRegistryHandle SurfaceDataSystemComponent::RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry)
     {
         const SurfaceDataRegistryHandle handle = RegisterSurfaceDataProviderInternal(entry);
@@ -353,16 +377,27 @@ namespace SurfaceData
             return false;
         };
 
-        // Gather up the subset of surface providers that overlap the input positions.
+        // Gather up the subset of surface providers that overlap the input positions. The spatial index narrows the registered
+        // providers down to the ones near the input positions, so that worlds with many providers don't check every one of them.
+        AZStd::vector<SurfaceDataRegistryHandle> candidateHandles;
+        m_surfaceDataProviderIndex.GetCandidates(inPositionBounds, candidateHandles);
+
+        AZStd::vector<AZStd::pair<SurfaceDataRegistryHandle, const SurfaceDataRegistryEntry*>> applicableProviders;
+        applicableProviders.reserve(candidateHandles.size());
         size_t maxPointsCreatedPerInput = 0;
-        for (const auto& [providerHandle, provider] : m_registeredSurfaceDataProviders)
+        for (const auto& providerHandle : candidateHandles)
         {
-            if (ProviderIsApplicable(provider))
+            auto providerItr = m_registeredSurfaceDataProviders.find(providerHandle);
+            if ((providerItr != m_registeredSurfaceDataProviders.end()) && ProviderIsApplicable(providerItr->second))
             {
-                maxPointsCreatedPerInput += provider.m_maxPointsCreatedPerInput;
+                applicableProviders.emplace_back(providerHandle, &providerItr->second);
+                maxPointsCreatedPerInput += providerItr->second.m_maxPointsCreatedPerInput;
             }
         }
 
+        m_queryStats.m_acceptedProviders.fetch_add(applicableProviders.size(), AZStd::memory_order_relaxed);
+        m_queryStats.m_registeredProviders.fetch_add(m_registeredSurfaceDataProviders.size(), AZStd::memory_order_relaxed);
+
         // If we don't have any surface providers that will create any new surface points, then there's nothing more to do.
         if (maxPointsCreatedPerInput == 0)
         {
@@ -386,13 +421,10 @@ namespace SurfaceData
         // Any generated points that have the same XY coordinates and extremely similar Z values will get combined together.
         {
             SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetSurfacePointsFromListInternal: GetSurfacePointsFromList");
-            for (const auto& [providerHandle, provider] : m_registeredSurfaceDataProviders)
+            for (const auto& [providerHandle, provider] : applicableProviders)
             {
-                if (ProviderIsApplicable(provider))
-                {
-                    SurfaceDataProviderRequestBus::Event(
-                        providerHandle, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, inPositions, surfacePointLists);
-                }
+                SurfaceDataProviderRequestBus::Event(
+                    providerHandle, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, inPositions, surfacePointLists);
             }
         }
 
@@ -403,15 +435,36 @@ namespace SurfaceData
         // within a water volume.
         {
             SURFACE_DATA_PROFILE_SCOPE_VERBOSE("GetSurfacePointsFromListInternal: ModifySurfaceWeights");
-            for (const auto& [modifierHandle, modifier] : m_registeredSurfaceDataModifiers)
+
+            // If no surface points were created, there's nothing for the modifiers to annotate.
+            const AZ::Aabb surfacePointBounds = surfacePointLists.GetSurfacePointAabb();
+            candidateHandles.clear();
+            if (surfacePointBounds.IsValid())
+            {
+                m_surfaceDataModifierIndex.GetCandidates(surfacePointBounds, candidateHandles);
+            }
+
+            size_t appliedModifiers = 0;
+            for (const auto& modifierHandle : candidateHandles)
             {
+                auto modifierItr = m_registeredSurfaceDataModifiers.find(modifierHandle);
+                if (modifierItr == m_registeredSurfaceDataModifiers.end())
+                {
+                    continue;
+                }
+
+                const SurfaceDataRegistryEntry& modifier = modifierItr->second;
                 bool hasInfiniteBounds = !modifier.m_bounds.IsValid();
 
-                if (hasInfiniteBounds || AabbOverlaps2D(modifier.m_bounds, surfacePointLists.GetSurfacePointAabb()))
+                if (hasInfiniteBounds || AabbOverlaps2D(modifier.m_bounds, surfacePointBounds))
                 {
                     surfacePointLists.ModifySurfaceWeights(modifierHandle);
+                    appliedModifiers++;
                 }
             }
+
+            m_queryStats.m_appliedModifiers.fetch_add(appliedModifiers, AZStd::memory_order_relaxed);
+            m_queryStats.m_registeredModifiers.fetch_add(m_registeredSurfaceDataModifiers.size(), AZStd::memory_order_relaxed);
         }
 
         // Notify the output structure that we're done building up the list.
@@ -427,6 +480,7 @@ namespace SurfaceData
         AZStd::unique_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
         SurfaceDataRegistryHandle handle = ++m_registeredSurfaceDataProviderHandleCounter;
         m_registeredSurfaceDataProviders[handle] = entry;
+        m_surfaceDataProviderIndex.Insert(handle, entry.m_bounds);
         return handle;
     }
 
@@ -439,6 +493,7 @@ namespace SurfaceData
         {
             entry = entryItr->second;
             m_registeredSurfaceDataProviders.erase(entryItr);
+            m_surfaceDataProviderIndex.Remove(handle);
         }
         return entry;
     }
@@ -452,6 +507,7 @@ namespace SurfaceData
         {
             oldBounds = entryItr->second.m_bounds;
             entryItr->second = entry;
+            m_surfaceDataProviderIndex.Update(handle, entry.m_bounds);
             return true;
         }
         return false;
@@ -463,6 +519,7 @@ namespace SurfaceData
         AZStd::unique_lock<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
         SurfaceDataRegistryHandle handle = ++m_registeredSurfaceDataModifierHandleCounter;
         m_registeredSurfaceDataModifiers[handle] = entry;
+        m_surfaceDataModifierIndex.Insert(handle, entry.m_bounds);
         m_registeredModifierTags.insert(entry.m_tags.begin(), entry.m_tags.end());
         return handle;
     }
@@ -476,6 +533,7 @@ namespace SurfaceData
         {
             entry = entryItr->second;
             m_registeredSurfaceDataModifiers.erase(entryItr);
+            m_surfaceDataModifierIndex.Remove(handle);
         }
         return entry;
     }
@@ -489,6 +547,7 @@ namespace SurfaceData
         {
             oldBounds = entryItr->second.m_bounds;
             entryItr->second = entry;
+            m_surfaceDataModifierIndex.Update(handle, entry.m_bounds);
             m_registeredModifierTags.insert(entry.m_tags.begin(), entry.m_tags.end());
             return true;
         }
@@ -496,14 +555,24 @@ namespace SurfaceData
     }
 
     SurfaceTagSet SurfaceDataSystemComponent::GetTagsFromBounds(
-        const AZ::Aabb& bounds, const SurfaceDataRegistryMap& registeredEntries) const
+        const AZ::Aabb& bounds, const SurfaceDataRegistryMap& registeredEntries, const SurfaceDataRegistryIndex& registryIndex) const
     {
         SurfaceTagSet tags;
 
         const bool inputHasInfiniteBounds = !bounds.IsValid();
 
-        for (const auto& [entryHandle, entry] : registeredEntries)
+        AZStd::vector<SurfaceDataRegistryHandle> candidateHandles;
+        registryIndex.GetCandidates(bounds, candidateHandles);
+
+        for (const auto& entryHandle : candidateHandles)
         {
+            auto entryItr = registeredEntries.find(entryHandle);
+            if (entryItr == registeredEntries.end())
+            {
+                continue;
+            }
+
+            const SurfaceDataRegistryEntry& entry = entryItr->second;
             const bool entryHasInfiniteBounds = !entry.m_bounds.IsValid();
 
             if (inputHasInfiniteBounds || entryHasInfiniteBounds || AabbOverlaps2D(entry.m_bounds, bounds))
@@ -520,12 +589,12 @@ namespace SurfaceData
 
     SurfaceTagSet SurfaceDataSystemComponent::GetProviderTagsFromBounds(const AZ::Aabb& bounds) const
     {
-        return GetTagsFromBounds(bounds, m_registeredSurfaceDataProviders);
+        return GetTagsFromBounds(bounds, m_registeredSurfaceDataProviders, m_surfaceDataProviderIndex);
     }
 
     SurfaceTagSet SurfaceDataSystemComponent::GetModifierTagsFromBounds(const AZ::Aabb& bounds) const
     {
-        return GetTagsFromBounds(bounds, m_registeredSurfaceDataModifiers);
+        return GetTagsFromBounds(bounds, m_registeredSurfaceDataModifiers, m_surfaceDataModifierIndex);
     }
 
     SurfaceTagSet SurfaceDataSystemComponent::ConvertTagVectorToSet(const SurfaceTagVector& surfaceTags) const
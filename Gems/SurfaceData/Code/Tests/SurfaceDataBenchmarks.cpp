@@ -250,6 +250,57 @@ namespace UnitTest
         }
     }
 
+    BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_GetSurfacePointsManyProviders)(benchmark::State& state)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // Create a grid of small box surfaces that covers the world, so that each query position only overlaps one of the
+        // many registered surface providers.
+        const int64_t providersPerSide = state.range(0);
+        constexpr float providerSize = 16.0f;
+        const float worldSize = providerSize * aznumeric_cast<float>(providersPerSide);
+
+        AZStd::vector<AZStd::unique_ptr<AZ::Entity>> benchmarkEntities;
+        benchmarkEntities.reserve(providersPerSide * providersPerSide);
+        for (int64_t y = 0; y < providersPerSide; y++)
+        {
+            for (int64_t x = 0; x < providersPerSide; x++)
+            {
+                const AZ::Vector3 center(
+                    (aznumeric_cast<float>(x) + 0.5f) * providerSize, (aznumeric_cast<float>(y) + 0.5f) * providerSize, 10.0f);
+                AZStd::unique_ptr<AZ::Entity> surface = CreateBenchmarkEntity(center, AZStd::array{ "surface1" }, {});
+                LmbrCentral::BoxShapeConfig boxConfig(AZ::Vector3(providerSize, providerSize, 1.0f));
+                auto shapeComponent = surface->CreateComponent(LmbrCentral::BoxShapeComponentTypeId);
+                shapeComponent->SetConfiguration(boxConfig);
+                surface->Init();
+                surface->Activate();
+                benchmarkEntities.push_back(AZStd::move(surface));
+            }
+        }
+
+        SurfaceData::SurfaceTagVector filterTags = CreateBenchmarkTagFilterList();
+
+        // Query a fixed set of random points scattered across the world.
+        constexpr size_t numQueries = 1024;
+        AZStd::vector<AZ::Vector3> queryPositions;
+        queryPositions.reserve(numQueries);
+        AZ::SimpleLcgRandom random(1234);
+        for (size_t query = 0; query < numQueries; query++)
+        {
+            queryPositions.emplace_back(random.GetRandomFloat() * worldSize, random.GetRandomFloat() * worldSize, 0.0f);
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (auto& queryPosition : queryPositions)
+            {
+                SurfaceData::SurfacePointList points;
+                AZ::Interface<SurfaceData::SurfaceDataSystem>::Get()->GetSurfacePoints(queryPosition, filterTags, points);
+                benchmark::DoNotOptimize(points);
+            }
+        }
+    }
+
     BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePoints)
         ->Arg( 1024 )
         ->Arg( 2048 )
@@ -265,6 +316,11 @@ namespace UnitTest
         ->Arg( 2048 )
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_REGISTER_F(SurfaceDataBenchmark, BM_GetSurfacePointsManyProviders)
+        ->Arg( 16 )
+        ->Arg( 64 )
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_DEFINE_F(SurfaceDataBenchmark, BM_AddSurfaceTagWeight)(benchmark::State& state)
     {
         AZ_PROFILE_FUNCTION(Entity);
@@ -27,6 +27,7 @@
 #include <SurfaceDataModule.h>
 #include <SurfaceData/SurfaceDataProviderRequestBus.h>
 #include <SurfaceData/SurfaceDataModifierRequestBus.h>
+#include <SurfaceData/SurfaceDataRegistryIndex.h>
 #include <SurfaceData/SurfaceTag.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 #include <Tests/SurfaceDataTestFixtures.h>
@@ -1042,5 +1043,79 @@ TEST_F(SurfaceDataTestApp, SurfaceData_FirstPointFilteredOut_SurfacePointListRem
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_RegistryIndexReturnsEveryOverlappingEntry)
+{
+    // Verify that the spatial index used for looking up surface providers and modifiers never misses an entry that overlaps
+    // a query, including entries with infinite bounds, entries that span many cells, and entries that moved or got removed.
+
+    constexpr float cellSize = 16.0f;
+    constexpr int numEntries = 200;
+    constexpr int numQueries = 200;
+    constexpr float worldSize = 1024.0f;
+
+    SurfaceData::SurfaceDataRegistryIndex index(cellSize);
+    AZStd::unordered_map<SurfaceData::SurfaceDataRegistryHandle, AZ::Aabb> entries;
+
+    AZ::SimpleLcgRandom random(1234);
+    auto createRandomBounds = [&random](float maxSize) -> AZ::Aabb
+    {
+        const AZ::Vector3 min(random.GetRandomFloat() * worldSize - (worldSize / 2.0f), random.GetRandomFloat() * worldSize - (worldSize / 2.0f), 0.0f);
+        const AZ::Vector3 size(random.GetRandomFloat() * maxSize, random.GetRandomFloat() * maxSize, 10.0f);
+        return AZ::Aabb::CreateFromMinMax(min, min + size);
+    };
+
+    for (SurfaceData::SurfaceDataRegistryHandle handle = 1; handle <= numEntries; handle++)
+    {
+        // Mix small entries, entries that span more cells than the index stores per entry, and entries with infinite bounds.
+        AZ::Aabb bounds = (handle % 10 == 0) ? createRandomBounds(worldSize) : createRandomBounds(cellSize * 3.0f);
+        if (handle % 50 == 0)
+        {
+            bounds = AZ::Aabb::CreateNull();
+        }
+        index.Insert(handle, bounds);
+        entries[handle] = bounds;
+    }
+
+    // Move some of the entries and remove some others.
+    for (SurfaceData::SurfaceDataRegistryHandle handle = 1; handle <= numEntries; handle += 7)
+    {
+        const AZ::Aabb bounds = createRandomBounds(cellSize * 2.0f);
+        index.Update(handle, bounds);
+        entries[handle] = bounds;
+    }
+    for (SurfaceData::SurfaceDataRegistryHandle handle = 3; handle <= numEntries; handle += 11)
+    {
+        index.Remove(handle);
+        entries.erase(handle);
+    }
+
+    EXPECT_EQ(index.GetSize(), entries.size());
+
+    for (int query = 0; query < numQueries; query++)
+    {
+        const AZ::Aabb queryBounds = createRandomBounds((query % 2) ? cellSize : worldSize);
+
+        AZStd::vector<SurfaceData::SurfaceDataRegistryHandle> candidates;
+        index.GetCandidates(queryBounds, candidates);
+
+        // The candidates should be sorted with no duplicates.
+        EXPECT_TRUE(AZStd::is_sorted(candidates.begin(), candidates.end()));
+        EXPECT_EQ(AZStd::adjacent_find(candidates.begin(), candidates.end()), candidates.end());
+
+        for (const auto& [handle, bounds] : entries)
+        {
+            if (!bounds.IsValid() || SurfaceData::AabbOverlaps2D(bounds, queryBounds))
+            {
+                EXPECT_TRUE(AZStd::binary_search(candidates.begin(), candidates.end(), handle));
+            }
+        }
+    }
+
+    // Infinite queries should return every entry.
+    AZStd::vector<SurfaceData::SurfaceDataRegistryHandle> allCandidates;
+    index.GetCandidates(AZ::Aabb::CreateNull(), allCandidates);
+    EXPECT_EQ(allCandidates.size(), entries.size());
+}
+
 // This uses custom test / benchmark hooks so that we can load LmbrCentral and use Shape components in our unit tests and benchmarks.
 AZ_UNIT_TEST_HOOK(new UnitTest::SurfaceDataTestEnvironment, UnitTest::SurfaceDataBenchmarkEnvironment);
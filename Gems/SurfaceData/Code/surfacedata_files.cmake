@@ -18,10 +18,12 @@ set(FILES
     Include/SurfaceData/SurfaceDataTagEnumeratorRequestBus.h
     Include/SurfaceData/SurfaceDataTagProviderRequestBus.h
     Include/SurfaceData/SurfaceDataProviderRequestBus.h
+    Include/SurfaceData/SurfaceDataRegistryIndex.h
     Include/SurfaceData/SurfaceDataModifierRequestBus.h
     Include/SurfaceData/SurfacePointList.h
     Include/SurfaceData/SurfaceTag.h
     Include/SurfaceData/Utility/SurfaceDataUtility.h
+    Source/SurfaceDataRegistryIndex.cpp
     Source/SurfaceDataSystemComponent.cpp
     Source/SurfaceDataTypes.cpp
     Source/SurfacePointList.cpp
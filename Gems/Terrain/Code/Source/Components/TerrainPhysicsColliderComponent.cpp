@@ -466,9 +466,10 @@ namespace Terrain
         const float worldHeightBoundsMin = worldSize.GetMin().GetZ();
         const float worldHeightBoundsMax = worldSize.GetMax().GetZ();
 
-        // Grab a local copy of the surface tag to material lookup to ensure that modifications on other threads
-        // don't affect us while we're in the middle of the query.
-        AZStd::unordered_map<SurfaceData::SurfaceTag, uint8_t> surfaceTagToMaterialIndexLookup;
+        // Grab a reference to the current surface tag to material lookup to ensure that modifications on other threads
+        // don't affect us while we're in the middle of the query. The lookup is never modified after it's built, so
+        // heightfield colliders that update many small regions at once can all share it instead of each copying it.
+        AZStd::shared_ptr<const AZStd::unordered_map<SurfaceData::SurfaceTag, uint8_t>> surfaceTagToMaterialIndexLookup;
         {
             AZStd::shared_lock lock(m_stateMutex);
             surfaceTagToMaterialIndexLookup = m_surfaceTagToMaterialIndexLookup;
@@ -504,8 +505,8 @@ namespace Terrain
             point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
 
             // Get the material index for the surface type. If we can't find it, use the default material.
-            if (const auto& entry = surfaceTagToMaterialIndexLookup.find(surfaceWeight.m_surfaceType);
-                entry != surfaceTagToMaterialIndexLookup.end())
+            if (const auto& entry = surfaceTagToMaterialIndexLookup->find(surfaceWeight.m_surfaceType);
+                entry != surfaceTagToMaterialIndexLookup->end())
             {
                 point.m_materialIndex = entry->second;
             }
@@ -577,7 +578,7 @@ namespace Terrain
         // Lock this *after* calling GetMaterialList() so that we don't have nested locks.
         AZStd::unique_lock lock(m_stateMutex);
 
-        m_surfaceTagToMaterialIndexLookup.clear();
+        auto surfaceTagToMaterialIndexLookup = AZStd::make_shared<AZStd::unordered_map<SurfaceData::SurfaceTag, uint8_t>>();
 
         for (const auto& mapping : m_configuration.m_surfaceMaterialMappings)
         {
@@ -585,11 +586,13 @@ namespace Terrain
             {
                 if (mapping.m_materialAsset == materialList[materialIndex])
                 {
-                    m_surfaceTagToMaterialIndexLookup.emplace(mapping.m_surfaceTag, materialIndex);
+                    surfaceTagToMaterialIndexLookup->emplace(mapping.m_surfaceTag, materialIndex);
                     break;
                 }
             }
         }
+
+        m_surfaceTagToMaterialIndexLookup = AZStd::move(surfaceTagToMaterialIndexLookup);
     }
 
     void TerrainPhysicsColliderComponent::UpdateConfiguration(const TerrainPhysicsColliderConfig& newConfiguration)
@@ -11,6 +11,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include <AzFramework/Physics/HeightfieldProviderBus.h>
 #include <AzFramework/Physics/Material/PhysicsMaterialAsset.h>
@@ -145,7 +146,8 @@ namespace Terrain
         TerrainPhysicsColliderConfig m_configuration;
         AZStd::atomic_bool m_terrainDataActive = false;
         AzFramework::Terrain::TerrainQueryRegion m_heightfieldRegion;
-        AZStd::unordered_map<SurfaceData::SurfaceTag, uint8_t> m_surfaceTagToMaterialIndexLookup;
+        //! The lookup is rebuilt instead of modified, so that async updates can share the current one without copying it.
+        AZStd::shared_ptr<const AZStd::unordered_map<SurfaceData::SurfaceTag, uint8_t>> m_surfaceTagToMaterialIndexLookup;
 
         // Protect state reads from happening in parallel with state writes.
         mutable AZStd::shared_mutex m_stateMutex;
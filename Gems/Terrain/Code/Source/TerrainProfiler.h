@@ -11,6 +11,9 @@
 
 AZ_DECLARE_BUDGET(Terrain);
 
+// Records a value for a terrain profiler counter, such as a cache hit rate.
+#define TERRAIN_PROFILE_DATAPOINT(value, counterName) AZ_PROFILE_DATAPOINT(Terrain, value, counterName)
+
 //#define ENABLE_TERRAIN_PROFILE_VERBOSE
 #ifdef ENABLE_TERRAIN_PROFILE_VERBOSE
 // Add verbose profile markers
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TerrainRaycast/TerrainHeightPyramid.h>
+#include <TerrainSystem/TerrainSystem.h>
+
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+using namespace Terrain;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+TerrainHeightPyramid::TerrainHeightPyramid(const TerrainSystem& terrainSystem)
+    : m_terrainSystem(terrainSystem)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+AZStd::shared_ptr<const TerrainHeightPyramid::HeightTile> TerrainHeightPyramid::GetTile(
+    int32_t tileX, int32_t tileY, float queryResolution)
+{
+    const uint64_t tileKey = GetTileKey(tileX, tileY);
+    uint64_t generation = 0;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+        if (queryResolution != m_queryResolution)
+        {
+            m_tiles.clear();
+            m_queryResolution = queryResolution;
+            ++m_generation;
+        }
+
+        if (auto tileIter = m_tiles.find(tileKey); tileIter != m_tiles.end())
+        {
+            tileIter->second.m_lastUsed = ++m_useCounter;
+            return tileIter->second.m_tile;
+        }
+
+        generation = m_generation;
+    }
+
+    // Build the tile without holding the lock, since querying the terrain locks the terrain areas, and the
+    // terrain areas can ask for a region to be refreshed while they hold their own locks.
+    AZStd::shared_ptr<const HeightTile> tile = BuildTile(tileX, tileY, queryResolution);
+
+    {
+        // Only cache the tile if nothing was dropped while it was being built, otherwise it might
+        // have been built from heights that have changed since.
+        AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+        if (generation == m_generation)
+        {
+            if (m_tiles.size() >= MaxCachedTiles)
+            {
+                EvictLeastRecentlyUsedTile();
+            }
+            m_tiles.emplace(tileKey, CachedTile{ tile, ++m_useCounter });
+        }
+    }
+
+    return tile;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainHeightPyramid::RefreshRegion(const AZ::Aabb& dirtyRegion)
+{
+    if (!dirtyRegion.IsValid())
+    {
+        return;
+    }
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+    ++m_generation;
+
+    if (m_tiles.empty())
+    {
+        return;
+    }
+
+    // Expand the region by a grid square so that the tiles sharing grid points on its edges are dropped too.
+    const float tileSize = m_queryResolution * TileSquares;
+    const AZ::Vector3 expansion(m_queryResolution, m_queryResolution, 0.0f);
+    const AZ::Vector3 dirtyMin = dirtyRegion.GetMin() - expansion;
+    const AZ::Vector3 dirtyMax = dirtyRegion.GetMax() + expansion;
+
+    for (auto tileIter = m_tiles.begin(); tileIter != m_tiles.end();)
+    {
+        const HeightTile& tile = *tileIter->second.m_tile;
+        const float tileMinX = tile.m_tileX * tileSize;
+        const float tileMinY = tile.m_tileY * tileSize;
+        const bool overlaps = (tileMinX <= dirtyMax.GetX()) && ((tileMinX + tileSize) >= dirtyMin.GetX()) &&
+            (tileMinY <= dirtyMax.GetY()) && ((tileMinY + tileSize) >= dirtyMin.GetY());
+        tileIter = overlaps ? m_tiles.erase(tileIter) : AZStd::next(tileIter);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainHeightPyramid::Clear()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+    m_tiles.clear();
+    ++m_generation;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t TerrainHeightPyramid::GetCachedTileCount() const
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+    return m_tiles.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+AZStd::shared_ptr<TerrainHeightPyramid::HeightTile> TerrainHeightPyramid::BuildTile(
+    int32_t tileX, int32_t tileY, float queryResolution) const
+{
+    AZ_PROFILE_FUNCTION(Terrain);
+
+    auto tile = AZStd::make_shared<HeightTile>();
+    tile->m_tileX = tileX;
+    tile->m_tileY = tileY;
+
+    // Get the heights of all the grid points of the tile, including the ones it shares with the next tiles.
+    constexpr int32_t PointsPerSide = TileSquares + 1;
+    tile->m_heights.resize(PointsPerSide * PointsPerSide);
+    const AZ::Vector2 tileStart(
+        aznumeric_cast<float>(tileX) * TileSquares * queryResolution, aznumeric_cast<float>(tileY) * TileSquares * queryResolution);
+    const AzFramework::Terrain::TerrainQueryRegion queryRegion(tileStart, PointsPerSide, PointsPerSide, AZ::Vector2(queryResolution));
+
+    m_terrainSystem.QueryRegion(
+        queryRegion,
+        AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+        [&heights = tile->m_heights](
+            size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+        {
+            heights[(yIndex * PointsPerSide) + xIndex] = surfacePoint.m_position.GetZ();
+        },
+        AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+
+    // Level 0 holds the height range of the corners of each grid square.
+    AZStd::vector<HeightRange>& squareRanges = tile->m_levels[0];
+    squareRanges.resize(TileSquares * TileSquares);
+    for (int32_t y = 0; y < TileSquares; ++y)
+    {
+        for (int32_t x = 0; x < TileSquares; ++x)
+        {
+            const float height0 = tile->GetHeight(x, y);
+            const float height1 = tile->GetHeight(x + 1, y);
+            const float height2 = tile->GetHeight(x, y + 1);
+            const float height3 = tile->GetHeight(x + 1, y + 1);
+            squareRanges[(y * TileSquares) + x] = HeightRange{ AZStd::min(AZStd::min(height0, height1), AZStd::min(height2, height3)),
+                                                               AZStd::max(AZStd::max(height0, height1), AZStd::max(height2, height3)) };
+        }
+    }
+
+    // Each level above merges the height ranges of 2x2 nodes of the level below.
+    for (int32_t level = 1; level < LevelCount; ++level)
+    {
+        const int32_t nodesPerSide = TileSquares >> level;
+        AZStd::vector<HeightRange>& levelRanges = tile->m_levels[level];
+        levelRanges.resize(nodesPerSide * nodesPerSide);
+        for (int32_t y = 0; y < nodesPerSide; ++y)
+        {
+            for (int32_t x = 0; x < nodesPerSide; ++x)
+            {
+                HeightRange range = tile->GetHeightRange(level - 1, x * 2, y * 2);
+                for (const HeightRange& childRange : { tile->GetHeightRange(level - 1, (x * 2) + 1, y * 2),
+                                                       tile->GetHeightRange(level - 1, x * 2, (y * 2) + 1),
+                                                       tile->GetHeightRange(level - 1, (x * 2) + 1, (y * 2) + 1) })
+                {
+                    range.m_min = AZStd::min(range.m_min, childRange.m_min);
+                    range.m_max = AZStd::max(range.m_max, childRange.m_max);
+                }
+                levelRanges[(y * nodesPerSide) + x] = range;
+            }
+        }
+    }
+
+    return tile;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainHeightPyramid::EvictLeastRecentlyUsedTile()
+{
+    auto oldestTile = m_tiles.begin();
+    for (auto tileIter = m_tiles.begin(); tileIter != m_tiles.end(); ++tileIter)
+    {
+        if (tileIter->second.m_lastUsed < oldestTile->second.m_lastUsed)
+        {
+            oldestTile = tileIter;
+        }
+    }
+
+    if (oldestTile != m_tiles.end())
+    {
+        m_tiles.erase(oldestTile);
+    }
+}
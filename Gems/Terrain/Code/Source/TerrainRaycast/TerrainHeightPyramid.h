@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+namespace Terrain
+{
+    class TerrainSystem;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    //! Min/max height pyramid over the terrain height grid, used by the terrain raycasts to skip
+    //! the parts of the grid that a ray passes above or below.
+    //! The grid is split into square tiles of TileSquares x TileSquares grid squares at the height
+    //! query resolution. Each tile keeps the heights of its grid points and a quadtree of height
+    //! ranges: level 0 holds the range of each grid square, and each level above holds the range
+    //! of 2x2 nodes of the level below, up to a single node for the whole tile.
+    //! Tiles are built the first time a ray needs them and dropped when the terrain heights under
+    //! them change, so only the parts of the world that are raycast against are ever sampled.
+    class TerrainHeightPyramid
+    {
+    public:
+        //! Number of grid squares along each side of a tile. Must be a power of two.
+        static constexpr int32_t TileSquares = 32;
+
+        //! Number of levels in the quadtree of each tile, from one node per grid square to one node per tile.
+        static constexpr int32_t LevelCount = 6;
+        static_assert((1 << (LevelCount - 1)) == TileSquares, "LevelCount doesn't match TileSquares");
+
+        //! Maximum number of tiles kept at once. Each tile uses about 15 KB, and the least recently
+        //! used tiles are dropped first when the cache is full.
+        static constexpr size_t MaxCachedTiles = 1024;
+
+        struct HeightRange
+        {
+            float m_min;
+            float m_max;
+        };
+
+        struct HeightTile
+        {
+            //! Height of a grid point of the tile, with x and y in [0, TileSquares].
+            float GetHeight(int32_t x, int32_t y) const
+            {
+                return m_heights[(y * (TileSquares + 1)) + x];
+            }
+
+            //! Height range of a node of the tile quadtree, with x and y in [0, TileSquares >> level).
+            const HeightRange& GetHeightRange(int32_t level, int32_t x, int32_t y) const
+            {
+                return m_levels[level][(y * (TileSquares >> level)) + x];
+            }
+
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+            AZStd::vector<float> m_heights;
+            AZStd::array<AZStd::vector<HeightRange>, LevelCount> m_levels;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Constructor
+        //! \param[in] terrainSystem The terrain system to get the heights from
+        TerrainHeightPyramid(const TerrainSystem& terrainSystem);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Disable copying
+        AZ_DISABLE_COPY_MOVE(TerrainHeightPyramid);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Get a tile of the pyramid, building it if it isn't cached. Safe to call from any thread.
+        //! \param[in] tileX The X coordinate of the tile, in tiles from the world origin
+        //! \param[in] tileY The Y coordinate of the tile, in tiles from the world origin
+        //! \param[in] queryResolution The current terrain height query resolution. All the cached
+        //!            tiles are dropped when it changes.
+        //! \return The tile, which stays valid for as long as the caller holds on to it
+        AZStd::shared_ptr<const HeightTile> GetTile(int32_t tileX, int32_t tileY, float queryResolution);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Drop the cached tiles that overlap a region whose terrain heights have changed.
+        //! \param[in] dirtyRegion The region that changed, only its XY bounds are used
+        void RefreshRegion(const AZ::Aabb& dirtyRegion);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Drop all the cached tiles.
+        void Clear();
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! \return The number of tiles currently cached
+        size_t GetCachedTileCount() const;
+
+    private:
+        AZStd::shared_ptr<HeightTile> BuildTile(int32_t tileX, int32_t tileY, float queryResolution) const;
+        void EvictLeastRecentlyUsedTile();
+
+        static uint64_t GetTileKey(int32_t tileX, int32_t tileY)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint32_t>(tileY);
+        }
+
+        struct CachedTile
+        {
+            AZStd::shared_ptr<const HeightTile> m_tile;
+            uint64_t m_lastUsed = 0;
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        // Variables
+        const TerrainSystem& m_terrainSystem; //!< Terrain system to get the heights from
+        mutable AZStd::mutex m_tileMutex; //!< Guards all the variables below
+        AZStd::unordered_map<uint64_t, CachedTile> m_tiles; //!< Cached tiles by tile coordinates
+        float m_queryResolution = 0.0f; //!< Query resolution the cached tiles were built with
+        uint64_t m_generation = 0; //!< Incremented whenever tiles are dropped, so tiles built from stale heights aren't cached
+        uint64_t m_useCounter = 0; //!< Incremented on every tile request, to track the least recently used tiles
+    };
+} // namespace Terrain
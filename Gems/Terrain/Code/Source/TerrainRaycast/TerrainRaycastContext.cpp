@@ -16,27 +16,22 @@ using namespace Terrain;
 
 namespace
 {
+    // Tolerance used when comparing the ray heights against the terrain height ranges, so that precision errors never
+    // cause a part of the terrain that the ray touches to get skipped. Skipping less than we could only costs a few
+    // extra triangle tests.
+    constexpr float HeightRangeTolerance = 0.01f;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    // Convenience function to get the terrain height values at each corner of an AABB, triangulate them,
-    // and then find the nearest intersection (if any) between the resulting triangles and the given ray.
-    static void TriangulateAndFindNearestIntersection(const TerrainSystem& terrainSystem,
-                                                      const AZ::Aabb& aabb,
+    // Triangulate the four corners of a terrain grid square and find the nearest intersection (if any)
+    // between the resulting triangles and the given ray.
+    static void TriangulateAndFindNearestIntersection(const AZ::Vector3& point0,
+                                                      const AZ::Vector3& point1,
+                                                      const AZ::Vector3& point2,
+                                                      const AZ::Vector3& point3,
                                                       const AZ::Intersect::SegmentTriangleHitTester& hitTester,
                                                       AzFramework::RenderGeometry::RayResult& result)
     {
-        // Obtain the height values at each corner of the AABB.
-        const AZ::Vector3& aabbMin = aabb.GetMin();
-        const AZ::Vector3& aabbMax = aabb.GetMax();
-        AZ::Vector3 point0 = aabbMin;
-        AZ::Vector3 point2 = aabbMax;
-        AZ::Vector3 point1(point0.GetX(), point2.GetY(), 0.0f);
-        AZ::Vector3 point3(point2.GetX(), point0.GetY(), 0.0f);
-        point0.SetZ(terrainSystem.GetHeight(point0, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point1.SetZ(terrainSystem.GetHeight(point1, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point2.SetZ(terrainSystem.GetHeight(point2, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-        point3.SetZ(terrainSystem.GetHeight(point3, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT));
-
-        // Finally, triangulate the four terrain points and check for a hit,
+        // Triangulate the four terrain points and check for a hit,
         // splitting using the top-left -> bottom-right diagonal so to match
         // the current behavior of the terrain physics and rendering systems.
         AZ::Vector3 bottomLeftHitNormal;
@@ -63,12 +58,156 @@ namespace
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // The ray being traced, in a form that makes it cheap to find which part of it lies over an XY rectangle.
+    // The t values used below go from 0 at the start of the ray to 1 at the end of the ray.
+    struct TraceRay
+    {
+        AZ::Vector2 m_start;
+        AZ::Vector2 m_delta;
+        float m_startZ;
+        float m_deltaZ;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Narrow down the [tEnter, tExit] range of the ray to the part that lies over the given XY rectangle.
+    // Returns false if no part of the range lies over the rectangle.
+    static bool ClipToRectangle(
+        const TraceRay& ray, const AZ::Vector2& rectMin, const AZ::Vector2& rectMax, float& tEnter, float& tExit)
+    {
+        for (int axis = 0; axis < 2; ++axis)
+        {
+            const float start = ray.m_start.GetElement(axis);
+            const float delta = ray.m_delta.GetElement(axis);
+            if (delta == 0.0f)
+            {
+                // The ray is parallel to this pair of rectangle edges, so it's either always or never between them.
+                if ((start < rectMin.GetElement(axis)) || (start > rectMax.GetElement(axis)))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            float t0 = (rectMin.GetElement(axis) - start) / delta;
+            float t1 = (rectMax.GetElement(axis) - start) / delta;
+            if (t0 > t1)
+            {
+                AZStd::swap(t0, t1);
+            }
+            tEnter = AZStd::max(tEnter, t0);
+            tExit = AZStd::min(tExit, t1);
+            if (tEnter > tExit)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Recursively find the nearest intersection between the ray and the terrain grid squares under a node of a
+    // height pyramid tile. Nodes are skipped entirely when the ray is above or below their height range over
+    // the [tEnter, tExit] range, and child nodes are visited from nearest to farthest so that the first hit
+    // found is the nearest one.
+    static bool FindNearestIntersectionInNode(const TerrainHeightPyramid::HeightTile& tile,
+                                              int32_t level,
+                                              int32_t nodeX,
+                                              int32_t nodeY,
+                                              float tEnter,
+                                              float tExit,
+                                              const TraceRay& traceRay,
+                                              float queryResolution,
+                                              const AZ::Intersect::SegmentTriangleHitTester& hitTester,
+                                              AzFramework::RenderGeometry::RayResult& result)
+    {
+        // The ray height is linear in t, so its range over [tEnter, tExit] is given by the heights at both ends.
+        const float enterZ = traceRay.m_startZ + (tEnter * traceRay.m_deltaZ);
+        const float exitZ = traceRay.m_startZ + (tExit * traceRay.m_deltaZ);
+        const TerrainHeightPyramid::HeightRange& heightRange = tile.GetHeightRange(level, nodeX, nodeY);
+        if ((AZStd::max(enterZ, exitZ) < (heightRange.m_min - HeightRangeTolerance)) ||
+            (AZStd::min(enterZ, exitZ) > (heightRange.m_max + HeightRangeTolerance)))
+        {
+            return false;
+        }
+
+        if (level == 0)
+        {
+            // This node is a single grid square, so test the ray against its triangles.
+            const int32_t squareX = (tile.m_tileX * TerrainHeightPyramid::TileSquares) + nodeX;
+            const int32_t squareY = (tile.m_tileY * TerrainHeightPyramid::TileSquares) + nodeY;
+            const float minX = aznumeric_cast<float>(squareX) * queryResolution;
+            const float minY = aznumeric_cast<float>(squareY) * queryResolution;
+            const float maxX = aznumeric_cast<float>(squareX + 1) * queryResolution;
+            const float maxY = aznumeric_cast<float>(squareY + 1) * queryResolution;
+
+            const AZ::Vector3 point0(minX, minY, tile.GetHeight(nodeX, nodeY));
+            const AZ::Vector3 point1(minX, maxY, tile.GetHeight(nodeX, nodeY + 1));
+            const AZ::Vector3 point2(maxX, maxY, tile.GetHeight(nodeX + 1, nodeY + 1));
+            const AZ::Vector3 point3(maxX, minY, tile.GetHeight(nodeX + 1, nodeY));
+            TriangulateAndFindNearestIntersection(point0, point1, point2, point3, hitTester, result);
+            return result;
+        }
+
+        // Find the part of the ray over each child node, expanding the child bounds slightly so that precision
+        // errors can't open up gaps between them.
+        struct ChildNode
+        {
+            int32_t m_x;
+            int32_t m_y;
+            float m_tEnter;
+            float m_tExit;
+        };
+        AZStd::array<ChildNode, 4> children;
+        size_t numChildren = 0;
+
+        const int32_t childLevel = level - 1;
+        const int32_t squaresPerChild = 1 << childLevel;
+        const float childSize = aznumeric_cast<float>(squaresPerChild) * queryResolution;
+        const AZ::Vector2 boundsTolerance(queryResolution * 0.001f);
+        for (int32_t childY = nodeY * 2; childY < (nodeY * 2) + 2; ++childY)
+        {
+            for (int32_t childX = nodeX * 2; childX < (nodeX * 2) + 2; ++childX)
+            {
+                const AZ::Vector2 childMin(
+                    aznumeric_cast<float>((tile.m_tileX * TerrainHeightPyramid::TileSquares) + (childX * squaresPerChild)) * queryResolution,
+                    aznumeric_cast<float>((tile.m_tileY * TerrainHeightPyramid::TileSquares) + (childY * squaresPerChild)) * queryResolution);
+                float childEnter = tEnter;
+                float childExit = tExit;
+                if (ClipToRectangle(
+                        traceRay, childMin - boundsTolerance, childMin + AZ::Vector2(childSize) + boundsTolerance, childEnter, childExit))
+                {
+                    // Insert the child in order of where the ray enters it.
+                    size_t insertIndex = numChildren++;
+                    for (; (insertIndex > 0) && (children[insertIndex - 1].m_tEnter > childEnter); --insertIndex)
+                    {
+                        children[insertIndex] = children[insertIndex - 1];
+                    }
+                    children[insertIndex] = ChildNode{ childX, childY, childEnter, childExit };
+                }
+            }
+        }
+
+        for (size_t child = 0; child < numChildren; ++child)
+        {
+            if (FindNearestIntersectionInNode(
+                    tile, childLevel, children[child].m_x, children[child].m_y, children[child].m_tEnter, children[child].m_tExit,
+                    traceRay, queryResolution, hitTester, result))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
 } // namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 TerrainRaycastContext::TerrainRaycastContext(TerrainSystem& terrainSystem)
     : m_terrainSystem(terrainSystem)
     , m_entityContextId(AzFramework::EntityContextId::CreateRandom())
+    , m_heightPyramid(terrainSystem)
 {
     AzFramework::RenderGeometry::IntersectorBus::Handler::BusConnect(m_entityContextId);
 }
@@ -79,22 +218,37 @@ TerrainRaycastContext::~TerrainRaycastContext()
     AzFramework::RenderGeometry::IntersectorBus::Handler::BusDisconnect();
 }
 
-/*
-   Iterative function that divides an AABB encompasing terrain points into grid squares based on
-   the given grid resolution and steps along the ray visiting each voxel it intersects in order
-   from nearest to farthest. In each square, it obtains the terrain height values at each corner and
-   triangulates them to find the nearest intersection (if any) between the triangles and the ray.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::RefreshRegion(const AZ::Aabb& dirtyRegion)
+{
+    m_heightPyramid.RefreshRegion(dirtyRegion);
+}
 
-   To step through the grid, we use an algorithm similar to Bresenham's line algorithm or a Digital
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void TerrainRaycastContext::ClearCachedHeights()
+{
+    m_heightPyramid.Clear();
+}
+
+/*
+   Iterative function that divides an AABB encompasing terrain points into height pyramid tiles and
+   steps along the ray visiting each tile it intersects in order from nearest to farthest. In each tile,
+   it descends the tile's quadtree of height ranges, skipping every node that the ray passes entirely
+   above or below, down to the terrain grid squares whose height range the ray crosses. In each of those
+   squares, it triangulates the terrain heights at the corners to find the nearest intersection (if any)
+   between the triangles and the ray.
+
+   To step through the tiles, we use an algorithm similar to Bresenham's line algorithm or a Digital
    Differential Analyzer. We can't use Bresenham's line algorithm itself because it will sometimes skip
-   squares if the ray only passes through a tiny portion, and we need to use every square that it passes through.
+   tiles if the ray only passes through a tiny portion, and we need to use every tile that it passes through.
 
-   We start by clipping the ray itself to the terrain AABB so that we don't walk through any grid squares
-   that cannot contain terrain. We then walk through the grid one square at a time, either moving horizontally
-   or vertically to the next square based on the ray's slope, until we reach the end of the ray or we've found a hit.
+   We start by clipping the ray itself to the terrain AABB so that we don't walk through any tiles
+   that cannot contain terrain. We then walk through the tiles one at a time, either moving horizontally
+   or vertically to the next tile based on the ray's slope, until we reach the end of the ray or we've found a hit.
 
    Visualization:
-    - X: Grid square intersection but no triangle hit found
+    - X: Grid square under the ray but outside of its height range, skipped without any triangle test
+    - O: Grid square intersection but no triangle hit found
     - T: Grid square intersection with a triangle hit found
     ________________________________________
     |    |    |    |    |    |    |    |    |
@@ -107,7 +261,7 @@ TerrainRaycastContext::~TerrainRaycastContext()
     |____|____|____|____|____|____|____|__/_|
     |    |    |    |    |    |    |    | /X |
     |____|____|____|____|____|____|____|/___|
-    |    |    |    |    |    |    | X  / X  |
+    |    |    |    |    |    |    | O  / O  |
     |____|____|____|____|____|____|___/|____|
     |    |    |    |    |    |    | T/ |    |
     |____|____|____|____|____|____|____|____|
@@ -117,13 +271,15 @@ TerrainRaycastContext::~TerrainRaycastContext()
 AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
     const AzFramework::RenderGeometry::RayRequest& ray)
 {
+    AZ_PROFILE_FUNCTION(Terrain);
+
     const AZ::Aabb terrainWorldBounds = m_terrainSystem.GetTerrainAabb();
-    const AZ::Vector2 terrainResolution(m_terrainSystem.GetTerrainHeightQueryResolution());
+    const float queryResolution = m_terrainSystem.GetTerrainHeightQueryResolution();
 
     // Initialize the result to invalid at the start.
     AzFramework::RenderGeometry::RayResult rayIntersectionResult = AzFramework::RenderGeometry::RayResult();
 
-    if (!terrainWorldBounds.IsValid())
+    if (!terrainWorldBounds.IsValid() || (queryResolution <= 0.0f))
     {
         // There is no terrain to intersect.
         return rayIntersectionResult;
@@ -139,7 +295,7 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
     bool rayIntersected = AZ::Intersect::ClipRayWithAabb(
         terrainWorldBounds.GetExpanded(AZ::Vector3(0.01f)), clippedRayStart, clippedRayEnd, tClipStart, tClipEnd);
 
-    if (!rayIntersected)
+    if (!rayIntersected || (tClipStart > tClipEnd))
     {
         // The ray does not intersect the terrain world bounds.
         return rayIntersectionResult;
@@ -149,32 +305,29 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
     const AZ::Vector2 clippedStart(clippedRayStart);
     const AZ::Vector2 clippedEnd(clippedRayEnd);
     const AZ::Vector2 clippedLineSegment = clippedEnd - clippedStart;
+    const AZ::Vector2 tileSize(queryResolution * TerrainHeightPyramid::TileSquares);
 
-    // Calculate the total number of terrain squares we'll need to visit to trace the ray segment.
-    // We need to visit 1 at the start, 1 for each X square we need to move, and 1 for each Y square we need to move,
-    // since we'll always move either horizontally or vertically one square at a time when traversing the ray segment.
-    const AZ::Vector2 numSquaresToMove =
-        ((clippedEnd / terrainResolution).GetFloor() - (clippedStart / terrainResolution).GetFloor()).GetAbs();
-    const int32_t numTerrainSquares =
-        1 + aznumeric_cast<int32_t>(numSquaresToMove.GetX()) + aznumeric_cast<int32_t>(numSquaresToMove.GetY());
+    // Calculate the total number of tiles we'll need to visit to trace the ray segment.
+    // We need to visit 1 at the start, 1 for each X tile we need to move, and 1 for each Y tile we need to move,
+    // since we'll always move either horizontally or vertically one tile at a time when traversing the ray segment.
+    const AZ::Vector2 clippedStartTile = (clippedStart / tileSize).GetFloor();
+    const AZ::Vector2 numTilesToMove = ((clippedEnd / tileSize).GetFloor() - clippedStartTile).GetAbs();
+    const int32_t numTiles = 1 + aznumeric_cast<int32_t>(numTilesToMove.GetX()) + aznumeric_cast<int32_t>(numTilesToMove.GetY());
 
-    // This tells us how much t distance on the line to move to increment one terrain square in each direction.
+    // This tells us how much t distance on the clipped line to move to increment one tile in each direction.
     // Note that it could be infinity (due to a divide-by-0) if we're not moving in that direction.
-    const AZ::Vector2 tDelta(terrainResolution / clippedLineSegment.GetAbs());
-
-    // Get the min world space corner of the terrain grid square containing (x0, y0)
-    const AZ::Vector2 clippedStartGridCorner = (clippedStart / terrainResolution).GetFloor() * terrainResolution;
+    const AZ::Vector2 tDelta(tileSize / clippedLineSegment.GetAbs());
 
-    // tUntilNextBoundary stores how much further we currently need to move along t to get to the next terrain grid square boundary
+    // tUntilNextBoundary stores how much further we currently need to move along t to get to the next tile boundary
     // in each direction.
-    // We initialize with the fractional amount that we're starting in the square or max() if we're not moving in this
+    // We initialize with the fractional amount that we're starting in the tile or max() if we're not moving in this
     // direction at all (when clippedLineSegment == 0)
-    const AZ::Vector2 tFromMinCorner((clippedStart - clippedStartGridCorner) / clippedLineSegment.GetAbs());
+    const AZ::Vector2 tFromMinCorner((clippedStart - (clippedStartTile * tileSize)) / clippedLineSegment.GetAbs());
 
     AZ::Vector2 tUntilNextBoundary = AZ::Vector2::CreateSelectCmpEqual(
         clippedLineSegment, AZ::Vector2::CreateZero(), AZ::Vector2(AZStd::numeric_limits<float>::max()), tFromMinCorner);
 
-    // If we're moving in the positive direction in the square, then the amount till the next boundary is actually
+    // If we're moving in the positive direction in the tile, then the amount till the next boundary is actually
     // the distance remaining to the max corner, not the distance in from the min corner, so flip our calculation.
     tUntilNextBoundary = AZ::Vector2::CreateSelectCmpGreater(clippedEnd, clippedStart, tDelta - tUntilNextBoundary, tUntilNextBoundary);
 
@@ -182,37 +335,46 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
     // to make sure we don't run into any precision issues caused from the clipping.
     AZ::Intersect::SegmentTriangleHitTester hitTester(ray.m_startWorldPosition, ray.m_endWorldPosition);
 
-    // These will hold our current square coordinates in world space values as we loop through the squares, starting with the
-    // grid square for (x0, y0). These values represent the minimum corner of each terrain square.
-    AZ::Vector2 curGridCorner = clippedStartGridCorner;
-
-    // This is how much we need to increment our x and y by to get to the next grid square along the line.
-    // They will either be +/- terrainResolution or 0 if we're not moving in that direction.
-    const AZ::Vector2 gridIncrement = terrainResolution *
-        AZ::Vector2::CreateSelectCmpEqual(clippedLineSegment,
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2::CreateZero(),
-                                          AZ::Vector2(AZ::GetSign(clippedLineSegment.GetX()), AZ::GetSign(clippedLineSegment.GetY())));
+    // The height pyramid traversal also works on the full ray, so that its t values match the ones of the hit tester.
+    TraceRay traceRay;
+    traceRay.m_start = AZ::Vector2(ray.m_startWorldPosition);
+    traceRay.m_delta = AZ::Vector2(ray.m_endWorldPosition) - traceRay.m_start;
+    traceRay.m_startZ = ray.m_startWorldPosition.GetZ();
+    traceRay.m_deltaZ = ray.m_endWorldPosition.GetZ() - traceRay.m_startZ;
+
+    // These hold our current tile coordinates as we loop through the tiles, starting with the tile containing (x0, y0),
+    // and how much we need to increment them by to get to the next tile along the line. The increments will either
+    // be +/- 1 or 0 if we're not moving in that direction.
+    int32_t tileX = aznumeric_cast<int32_t>(clippedStartTile.GetX());
+    int32_t tileY = aznumeric_cast<int32_t>(clippedStartTile.GetY());
+    const int32_t tileIncrementX = (clippedLineSegment.GetX() > 0.0f) ? 1 : ((clippedLineSegment.GetX() < 0.0f) ? -1 : 0);
+    const int32_t tileIncrementY = (clippedLineSegment.GetY() > 0.0f) ? 1 : ((clippedLineSegment.GetY() < 0.0f) ? -1 : 0);
 
     // Convenience vectors that we can use in the loop to just increment one direction.
     const AZ::Vector2 tDeltaX(tDelta.GetX(), 0.0f);
     const AZ::Vector2 tDeltaY(0.0f, tDelta.GetY());
-    const AZ::Vector2 gridIncrementX(gridIncrement.GetX(), 0.0f);
-    const AZ::Vector2 gridIncrementY(0.0f, gridIncrement.GetY());
 
-    // Walk through each grid square in the terrain that intersects the XY coordinates of the line.
-    // We'll check each square to see if the ray intersections actually intersect the terrain triangles in the square.
-    for (int terrainSquare = 0; terrainSquare < numTerrainSquares; terrainSquare++)
+    // Tiles are expanded slightly when finding the part of the ray over them, so that precision errors can't open up gaps between them.
+    const AZ::Vector2 boundsTolerance(queryResolution * 0.001f);
+
+    // Walk through each tile that intersects the XY coordinates of the line.
+    // We'll descend each tile to find the grid squares where the ray might actually intersect the terrain triangles.
+    for (int32_t tile = 0; tile < numTiles; tile++)
     {
-        // Create a bounding volume for this terrain square.
-        AZ::Aabb currentVoxel = AZ::Aabb::CreateFromMinMax(
-            AZ::Vector3(curGridCorner, terrainWorldBounds.GetMin().GetZ()),
-            AZ::Vector3(curGridCorner + terrainResolution, terrainWorldBounds.GetMax().GetZ()));
-
-        // Check for a hit against the terrain triangles in this square.
-        // Note - this could be optimized to be 2x faster by adding some code to keep track of the terrain heights
-        // from the previous square checked so that we only get the 2 new corners instead of all 4 every time.
-        TriangulateAndFindNearestIntersection(m_terrainSystem, currentVoxel, hitTester, rayIntersectionResult);
+        // Only the part of the ray over this tile (and within the terrain bounds) needs to be checked against it.
+        float tEnter = tClipStart;
+        float tExit = tClipEnd;
+        const AZ::Vector2 tileMin(
+            aznumeric_cast<float>(tileX) * tileSize.GetX(), aznumeric_cast<float>(tileY) * tileSize.GetY());
+        if (ClipToRectangle(traceRay, tileMin - boundsTolerance, tileMin + tileSize + boundsTolerance, tEnter, tExit))
+        {
+            AZStd::shared_ptr<const TerrainHeightPyramid::HeightTile> heightTile =
+                m_heightPyramid.GetTile(tileX, tileY, queryResolution);
+            FindNearestIntersectionInNode(
+                *heightTile, TerrainHeightPyramid::LevelCount - 1, 0, 0, tEnter, tExit, traceRay, queryResolution, hitTester,
+                rayIntersectionResult);
+        }
+
         if (rayIntersectionResult)
         {
             // Intersection found. Replace the triangle normal from the hit with a higher-quality normal calculated
@@ -225,15 +387,15 @@ AzFramework::RenderGeometry::RayResult TerrainRaycastContext::RayIntersect(
             break;
         }
 
-        // No hit yet, so move forward along the line (either horizontally or vertically) to the next terrain square.
+        // No hit yet, so move forward along the line (either horizontally or vertically) to the next tile.
         if (tUntilNextBoundary.GetY() < tUntilNextBoundary.GetX())
         {
-            curGridCorner += gridIncrementY;
+            tileY += tileIncrementY;
             tUntilNextBoundary += tDeltaY;
         }
         else
         {
-            curGridCorner += gridIncrementX;
+            tileX += tileIncrementX;
             tUntilNextBoundary += tDeltaX;
         }
     }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzFramework/Render/IntersectorInterface.h>
+#include <TerrainRaycast/TerrainHeightPyramid.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 namespace Terrain
@@ -41,6 +42,15 @@ namespace Terrain
         //! \ref AzFramework::RenderGeometry::RayIntersect
         AzFramework::RenderGeometry::RayResult RayIntersect(const AzFramework::RenderGeometry::RayRequest& ray) override;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Drop the cached raycast heights in a region whose terrain heights have changed.
+        //! \param[in] dirtyRegion The region that changed
+        void RefreshRegion(const AZ::Aabb& dirtyRegion);
+
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        //! Drop all the cached raycast heights.
+        void ClearCachedHeights();
+
     protected:
         ////////////////////////////////////////////////////////////////////////////////////////////
         // RenderGeometry::IntersectorBus inherits from RenderGeometry::IntersectionNotifications,
@@ -58,5 +68,6 @@ namespace Terrain
         // Variables
         TerrainSystem& m_terrainSystem; //!< Terrain system that owns this terrain raycast context
         AzFramework::EntityContextId m_entityContextId; //!< This object's entity context id
+        TerrainHeightPyramid m_heightPyramid; //!< Cached terrain heights and height ranges used to trace the rays
     };
 } // namespace Terrain
@@ -7,6 +7,8 @@
  */
 
 #include <TerrainSystem/TerrainSystem.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
 #include <SurfaceData/SurfaceDataTypes.h>
@@ -25,6 +27,17 @@ using namespace Terrain;
 
 AZ_DEFINE_BUDGET(Terrain);
 
+namespace Terrain
+{
+    AZ_CVAR(
+        uint32_t,
+        terrain_dataCacheBudgetMB,
+        64,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The memory budget in MB of each of the terrain height and surface data caches. 0 disables the caches.");
+}
+
 bool TerrainLayerPriorityComparator::operator()(const AZ::EntityId& layer1id, const AZ::EntityId& layer2id) const
 {
     // Comparator for insertion/key lookup.
@@ -88,6 +101,9 @@ void TerrainSystem::Activate()
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = true;
     m_cachedAreaBounds = AZ::Aabb::CreateNull();
+    m_terrainRaycastContext.ClearCachedHeights();
+    m_heightCache.Clear();
+    m_surfaceWeightCache.Clear();
 
     {
         AZStd::unique_lock<AZStd::shared_mutex> lock(m_areaMutex);
@@ -138,6 +154,9 @@ void TerrainSystem::Deactivate()
     m_dirtyRegion = AZ::Aabb::CreateNull();
     m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::All;
     m_requestedSettings.m_systemActive = false;
+    m_terrainRaycastContext.ClearCachedHeights();
+    m_heightCache.Clear();
+    m_surfaceWeightCache.Clear();
 
     AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
         &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataDestroyEnd);
@@ -426,27 +445,10 @@ void TerrainSystem::MakeBulkQueries(
     }
 }
 
-void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler, 
-    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+void TerrainSystem::GetHeightsFromAreas(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists) const
 {
     TERRAIN_PROFILE_FUNCTION_VERBOSE
 
-    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
-
-    AZStd::vector<AZ::Vector3> outPositions;
-    AZStd::vector<bool> outTerrainExists;
-
-    // outPositions holds the iterators to results of the bulk queries.
-    // In the case of the bilinear sampler, we'll be making 4 queries per
-    // input position.
-    size_t indexStepSize = (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) ? 4 : 1;
-    outPositions.reserve(inPositions.size() * indexStepSize);
-    outTerrainExists.resize(inPositions.size() * indexStepSize);
-
-    const float queryResolution = m_currentSettings.m_heightQueryResolution;
-
-    GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
-
     auto callback = [this]([[maybe_unused]] const AZStd::span<const AZ::Vector3> inPositions,
                         AZStd::span<AZ::Vector3> outPositions,
                         AZStd::span<bool> outTerrainExists,
@@ -481,7 +483,113 @@ void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>&
 
     // This will be unused for heights. It's fine if it's empty.
     AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeights;
-    MakeBulkQueries(outPositions, outPositions, outTerrainExists, outSurfaceWeights, callback);
+    MakeBulkQueries(inOutPositions, inOutPositions, terrainExists, outSurfaceWeights, callback);
+}
+
+void TerrainSystem::ProcessTilesInParallel(
+    size_t numTiles, const AZStd::function<void(size_t begin, size_t end)>& processTiles) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    // Waiting on jobs from inside a job can deadlock the job workers, so queries that already run in a terrain job (such as the
+    // subregions of QueryRegionAsync) fill their tiles serially. They are already running in parallel with each other.
+    if ((numTiles <= 1) || !m_terrainJobManager || m_terrainJobManager->GetCurrentJob())
+    {
+        processTiles(0, numTiles);
+        return;
+    }
+
+    int32_t subdivisionsX = 1;
+    int32_t subdivisionsY = 1;
+    SubdivideRegionForJobs(
+        aznumeric_cast<int32_t>(numTiles), 1, aznumeric_cast<int32_t>(m_terrainJobManager->GetNumWorkerThreads()), 1,
+        subdivisionsX, subdivisionsY);
+
+    if (subdivisionsX <= 1)
+    {
+        processTiles(0, numTiles);
+        return;
+    }
+
+    AZ::JobContext jobContext(*m_terrainJobManager);
+    AZ::JobCompletion jobCompletion(&jobContext);
+    const size_t tilesPerJob = numTiles / subdivisionsX;
+    for (int32_t jobIndex = 0; jobIndex < subdivisionsX; ++jobIndex)
+    {
+        // The last job also processes the remainder of the tiles.
+        const size_t begin = jobIndex * tilesPerJob;
+        const size_t end = (jobIndex == (subdivisionsX - 1)) ? numTiles : (begin + tilesPerJob);
+        AZ::Job* processJob = AZ::CreateJobFunction(
+            [&processTiles, begin, end]()
+            {
+                processTiles(begin, end);
+            },
+            true, &jobContext);
+        processJob->SetDependent(&jobCompletion);
+        processJob->Start();
+    }
+    jobCompletion.StartAndWaitForCompletion();
+}
+
+void TerrainSystem::GetHeightsSynchronous(const AZStd::span<const AZ::Vector3>& inPositions, Sampler sampler, 
+    AZStd::span<float> heights, AZStd::span<bool> terrainExists) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
+    AZStd::vector<AZ::Vector3> outPositions;
+    AZStd::vector<bool> outTerrainExists;
+
+    // outPositions holds the iterators to results of the bulk queries.
+    // In the case of the bilinear sampler, we'll be making 4 queries per
+    // input position.
+    size_t indexStepSize = (sampler == AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) ? 4 : 1;
+    outPositions.reserve(inPositions.size() * indexStepSize);
+    outTerrainExists.resize(inPositions.size() * indexStepSize);
+
+    const float queryResolution = m_currentSettings.m_heightQueryResolution;
+
+    GenerateQueryPositions(inPositions, outPositions, queryResolution, sampler);
+
+    const size_t cacheBudget = static_cast<size_t>(static_cast<uint32_t>(terrain_dataCacheBudgetMB)) * 1024 * 1024;
+    if (cacheBudget == 0)
+    {
+        GetHeightsFromAreas(outPositions, outTerrainExists);
+    }
+    else
+    {
+        // The grid points are served from the height cache. The terrain areas are only locked while the cache queries them, so that
+        // the area lock isn't held while waiting on the jobs that fill the cache.
+        AZStd::vector<CachedHeight> cachedHeights(outPositions.size());
+        m_heightCache.Query(
+            outPositions, queryResolution, cacheBudget, cachedHeights,
+            [this](AZStd::span<const AZ::Vector3> positions, AZStd::span<CachedHeight> outHeights)
+            {
+                const float minHeight = m_currentSettings.m_heightRange.m_min;
+                AZStd::vector<AZ::Vector3> queryPositions;
+                queryPositions.reserve(positions.size());
+                for (const AZ::Vector3& position : positions)
+                {
+                    queryPositions.emplace_back(position.GetX(), position.GetY(), minHeight);
+                }
+                AZStd::vector<bool> queryExists(positions.size(), false);
+                GetHeightsFromAreas(queryPositions, queryExists);
+
+                for (size_t index = 0; index < positions.size(); ++index)
+                {
+                    outHeights[index] = CachedHeight{ queryPositions[index].GetZ(), queryExists[index] };
+                }
+            },
+            [this](size_t numTiles, const AZStd::function<void(size_t begin, size_t end)>& processTiles)
+            {
+                ProcessTilesInParallel(numTiles, processTiles);
+            });
+
+        for (size_t index = 0; index < outPositions.size(); ++index)
+        {
+            outPositions[index].SetZ(cachedHeights[index].m_height);
+            outTerrainExists[index] = cachedHeights[index].m_exists;
+        }
+    }
 
     // Compute/store the final result
     for (size_t i = 0, iteratorIndex = 0; i < inPositions.size(); i++, iteratorIndex += indexStepSize)
@@ -1283,6 +1391,38 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
     Sampler querySampler = (sampler == Sampler::EXACT) ? Sampler::EXACT : Sampler::CLAMP;
     GenerateQueryPositions(inPositions, queryPositions, queryResolution, querySampler);
 
+    const size_t cacheBudget = static_cast<size_t>(static_cast<uint32_t>(terrain_dataCacheBudgetMB)) * 1024 * 1024;
+    if (cacheBudget == 0)
+    {
+        GetSurfaceWeightsFromAreas(queryPositions, outSurfaceWeightsList);
+        return;
+    }
+
+    m_surfaceWeightCache.Query(
+        queryPositions, queryResolution, cacheBudget, outSurfaceWeightsList,
+        [this](AZStd::span<const AZ::Vector3> positions, AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outWeights)
+        {
+            const float minHeight = m_currentSettings.m_heightRange.m_min;
+            AZStd::vector<AZ::Vector3> queryPositions;
+            queryPositions.reserve(positions.size());
+            for (const AZ::Vector3& position : positions)
+            {
+                queryPositions.emplace_back(position.GetX(), position.GetY(), minHeight);
+            }
+            GetSurfaceWeightsFromAreas(queryPositions, outWeights);
+        },
+        [this](size_t numTiles, const AZStd::function<void(size_t begin, size_t end)>& processTiles)
+        {
+            ProcessTilesInParallel(numTiles, processTiles);
+        });
+}
+
+void TerrainSystem::GetSurfaceWeightsFromAreas(
+    AZStd::span<const AZ::Vector3> inPositions,
+    AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const
+{
+    TERRAIN_PROFILE_FUNCTION_VERBOSE
+
     auto callback = [](const AZStd::span<const AZ::Vector3> inPositions,
                         [[maybe_unused]] AZStd::span<AZ::Vector3> outPositions,
                         [[maybe_unused]] AZStd::span<bool> outTerrainExists,
@@ -1302,10 +1442,11 @@ void TerrainSystem::GetOrderedSurfaceWeightsFromList(
                                     AzFramework::SurfaceData::SurfaceTagWeightComparator());
                             }
                         };
-    
-    // This will be unused for surface weights. It's fine if it's empty.
+
+    // These will be unused for surface weights. It's fine if they're empty.
     AZStd::vector<AZ::Vector3> outPositions;
-    MakeBulkQueries(queryPositions, outPositions, terrainExists, outSurfaceWeightsList, callback);
+    AZStd::vector<bool> outTerrainExists;
+    MakeBulkQueries(inPositions, outPositions, outTerrainExists, outSurfaceWeightsList, callback);
 }
 
 void TerrainSystem::GetOrderedSurfaceWeights(
@@ -1688,6 +1829,10 @@ void TerrainSystem::RegisterArea(AZ::EntityId areaId)
     m_dirtyRegion.AddAabb(aabb);
     m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
         AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
+    RefreshCachedData(
+        aabb,
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
+            AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
     m_cachedAreaBounds.AddAabb(aabb);
 }
 
@@ -1708,6 +1853,10 @@ void TerrainSystem::UnregisterArea(AZ::EntityId areaId)
                 m_dirtyRegion.AddAabb(areaData.m_areaBounds);
                 m_terrainDirtyMask |= AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
                     AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData;
+                RefreshCachedData(
+                    areaData.m_areaBounds,
+                    AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData |
+                        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData);
 
                 if (ContainedAabbTouchesEdge(m_cachedAreaBounds, areaData.m_areaBounds))
                 {
@@ -1763,6 +1912,27 @@ void TerrainSystem::RefreshRegion(
 
     // Keep track of which types of data have changed so that we can send out the appropriate notifications later.
     m_terrainDirtyMask |= changeMask;
+
+    // The terrain data is queried live, so the cached data for the region needs to be dropped right away
+    // instead of waiting for the next tick.
+    RefreshCachedData(dirtyRegion, changeMask);
+}
+
+void TerrainSystem::RefreshCachedData(
+    const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) const
+{
+    if ((changeMask & AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData) ==
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData)
+    {
+        m_terrainRaycastContext.RefreshRegion(dirtyRegion);
+        m_heightCache.RefreshRegion(dirtyRegion);
+    }
+
+    if ((changeMask & AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData) ==
+        AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::SurfaceData)
+    {
+        m_surfaceWeightCache.RefreshRegion(dirtyRegion);
+    }
 }
 
 void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
@@ -1821,9 +1991,32 @@ void TerrainSystem::OnTick(float /*deltaTime*/, AZ::ScriptTimePoint /*time*/)
         m_terrainDirtyMask = AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::None;
         m_dirtyRegion = AZ::Aabb::CreateNull();
 
+        // This also covers the areas that were registered, unregistered or refreshed since the last tick.
+        // Changing the settings can change the data everywhere, so all the cached data is dropped in that case.
+        if (terrainSettingsChanged)
+        {
+            m_terrainRaycastContext.ClearCachedHeights();
+            m_heightCache.Clear();
+            m_surfaceWeightCache.Clear();
+        }
+        else
+        {
+            RefreshCachedData(dirtyRegion, changeMask);
+        }
+
         AzFramework::Terrain::TerrainDataNotificationBus::Broadcast(
             &AzFramework::Terrain::TerrainDataNotificationBus::Events::OnTerrainDataChanged, dirtyRegion,
             changeMask);
     }
 
+    // Publish the data cache statistics for the last frame.
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    m_heightCache.GetAndResetStatistics(hits, misses);
+    TERRAIN_PROFILE_DATAPOINT((hits + misses) ? (aznumeric_cast<double>(hits) / (hits + misses)) : 0.0, L"Terrain/DataCache/HeightHitRate");
+    m_surfaceWeightCache.GetAndResetStatistics(hits, misses);
+    TERRAIN_PROFILE_DATAPOINT((hits + misses) ? (aznumeric_cast<double>(hits) / (hits + misses)) : 0.0, L"Terrain/DataCache/SurfaceHitRate");
+    TERRAIN_PROFILE_DATAPOINT(
+        aznumeric_cast<double>(m_heightCache.GetMemoryUsage() + m_surfaceWeightCache.GetMemoryUsage()) / (1024.0 * 1024.0),
+        L"Terrain/DataCache/MemoryMB");
 }
@@ -26,6 +26,7 @@
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
 #include <TerrainRaycast/TerrainRaycastContext.h>
 #include <TerrainSystem/TerrainSystemBus.h>
+#include <TerrainSystem/TerrainTileCache.h>
 
 AZ_DECLARE_BUDGET(Terrain);
 
@@ -246,6 +247,15 @@ namespace Terrain
             const AZStd::span<const AZ::Vector3>& inPositions,
             Sampler sampler, AZStd::span<float> heights,
             AZStd::span<bool> terrainExists) const;
+        //! Queries the terrain areas for the heights at a list of grid positions, without going through the height cache.
+        //! The heights are written to the Z values of the positions.
+        void GetHeightsFromAreas(AZStd::span<AZ::Vector3> inOutPositions, AZStd::span<bool> terrainExists) const;
+        //! Queries the terrain areas for the surface weights at a list of grid positions, without going through the surface cache.
+        void GetSurfaceWeightsFromAreas(
+            AZStd::span<const AZ::Vector3> inPositions,
+            AZStd::span<AzFramework::SurfaceData::SurfaceTagWeightList> outSurfaceWeightsList) const;
+        //! Runs processTiles over the tiles that a data cache needs to fill, split across the terrain job workers when possible.
+        void ProcessTilesInParallel(size_t numTiles, const AZStd::function<void(size_t begin, size_t end)>& processTiles) const;
         void GetNormalsSynchronous(
             const AZStd::span<const AZ::Vector3>& inPositions,
             Sampler sampler, AZStd::span<AZ::Vector3> normals,
@@ -284,6 +294,9 @@ namespace Terrain
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
         void RecalculateCachedBounds();
+        //! Drops the cached terrain data in a region whose data has changed.
+        void RefreshCachedData(
+            const AZ::Aabb& dirtyRegion, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask changeMask) const;
         AZ::Aabb ClampZBoundsToHeightBounds(const AZ::Aabb& aabb) const;
 
         struct TerrainSystemSettings
@@ -314,6 +327,15 @@ namespace Terrain
 
         mutable TerrainRaycastContext m_terrainRaycastContext;
 
+        // Cached terrain data at the points of the query grids, shared by all the bulk queries.
+        struct CachedHeight
+        {
+            float m_height = 0.0f;
+            bool m_exists = false;
+        };
+        mutable TerrainTileCache<CachedHeight> m_heightCache;
+        mutable TerrainTileCache<AzFramework::SurfaceData::SurfaceTagWeightList> m_surfaceWeightCache;
+
         AZ::JobManager* m_terrainJobManager = nullptr;
         mutable AZStd::mutex m_activeTerrainJobContextMutex;
         mutable AZStd::condition_variable m_activeTerrainJobContextMutexConditionVariable;
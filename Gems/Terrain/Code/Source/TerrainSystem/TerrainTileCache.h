@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace Terrain
+{
+    //! A memory-bounded cache of terrain data at the points of a terrain query grid.
+    //! The grid is split into square tiles of TilePoints x TilePoints points. A tile is filled in one bulk query the first time
+    //! a query needs enough of its points, and dropped when the terrain data under it changes or when it is the least recently
+    //! used tile and the cache is over its memory budget.
+    //! Only the query positions that lie on the grid are served from the cache, all the other positions are always queried
+    //! directly so that the results of the queries never change because of the cache.
+    //! All the methods are safe to call from any thread.
+    template<typename PointData>
+    class TerrainTileCache
+    {
+    public:
+        //! Number of grid points along each side of a tile.
+        static constexpr int32_t TilePoints = 32;
+
+        //! Minimum number of points that a query needs from a tile that isn't cached to fill the whole tile. Sparse queries
+        //! query their points directly instead, so that they don't pay for filling tiles they barely use.
+        static constexpr size_t MinPointsToFillTile = (TilePoints * TilePoints) / 16;
+
+        //! Queries the terrain data at a list of positions, and writes it to the matching points of outData.
+        using FillFunction = AZStd::function<void(AZStd::span<const AZ::Vector3> positions, AZStd::span<PointData> outData)>;
+
+        //! Runs processTiles over the range [0, numTiles), possibly split into multiple calls that run in parallel.
+        using TileProcessor = AZStd::function<void(size_t numTiles, const AZStd::function<void(size_t begin, size_t end)>& processTiles)>;
+
+        //! Gets the terrain data at a list of positions, from the cache when possible.
+        //! @param positions The positions to query.
+        //! @param queryResolution The resolution of the query grid. All the cached tiles are dropped when it changes.
+        //! @param memoryBudget The maximum memory used by the cached tiles, in bytes. Nothing is cached when it's 0.
+        //! @param outData The data at each position.
+        //! @param fillPoints Queries the terrain data for the tiles that need to be filled and the positions that aren't cached.
+        //! @param processTiles Runs the fill of the tiles that need to be filled, possibly in parallel.
+        void Query(
+            AZStd::span<const AZ::Vector3> positions,
+            float queryResolution,
+            size_t memoryBudget,
+            AZStd::span<PointData> outData,
+            const FillFunction& fillPoints,
+            const TileProcessor& processTiles);
+
+        //! Drops the cached tiles that overlap a region whose terrain data has changed.
+        void RefreshRegion(const AZ::Aabb& dirtyRegion);
+
+        //! Drops all the cached tiles.
+        void Clear();
+
+        //! Returns the number of points served from the cache and the number of points queried directly since the last call,
+        //! and resets both counts.
+        void GetAndResetStatistics(uint64_t& hits, uint64_t& misses);
+
+        //! Returns the memory currently used by the cached tiles, in bytes.
+        size_t GetMemoryUsage() const;
+
+    private:
+        struct Tile
+        {
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+            AZStd::vector<PointData> m_points;
+        };
+
+        struct CachedTile
+        {
+            AZStd::shared_ptr<const Tile> m_tile;
+            uint64_t m_lastUsed = 0;
+        };
+
+        //! The points that a query needs from one tile.
+        struct TileRequest
+        {
+            int32_t m_tileX = 0;
+            int32_t m_tileY = 0;
+            size_t m_numPoints = 0;
+            AZStd::shared_ptr<const Tile> m_tile;
+        };
+
+        static constexpr size_t TileMemorySize = sizeof(Tile) + (sizeof(PointData) * TilePoints * TilePoints);
+
+        static uint64_t GetTileKey(int32_t tileX, int32_t tileY)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(tileX)) << 32) | static_cast<uint32_t>(tileY);
+        }
+
+        static int32_t GetTileCoordinate(int64_t gridIndex)
+        {
+            // Round down towards negative infinity so that negative grid indices map to the correct tile.
+            return aznumeric_cast<int32_t>((gridIndex >= 0) ? (gridIndex / TilePoints) : (((gridIndex + 1) / TilePoints) - 1));
+        }
+
+        static constexpr size_t NotOnGrid = AZStd::numeric_limits<size_t>::max();
+
+        void EvictLeastRecentlyUsedTiles(size_t maxTiles);
+
+        mutable AZStd::mutex m_tileMutex; //!< Guards the tiles and all the variables used to track them
+        AZStd::unordered_map<uint64_t, CachedTile> m_tiles;
+        float m_queryResolution = 0.0f; //!< Query resolution the cached tiles were filled with
+        uint64_t m_generation = 0; //!< Incremented whenever tiles are dropped, so tiles filled from stale data aren't cached
+        uint64_t m_useCounter = 0; //!< Incremented on every tile lookup, to track the least recently used tiles
+
+        AZStd::atomic<uint64_t> m_hits{ 0 };
+        AZStd::atomic<uint64_t> m_misses{ 0 };
+    };
+
+    template<typename PointData>
+    void TerrainTileCache<PointData>::Query(
+        AZStd::span<const AZ::Vector3> positions,
+        float queryResolution,
+        size_t memoryBudget,
+        AZStd::span<PointData> outData,
+        const FillFunction& fillPoints,
+        const TileProcessor& processTiles)
+    {
+        if (positions.empty())
+        {
+            return;
+        }
+
+        const size_t maxTiles = memoryBudget / TileMemorySize;
+        if ((maxTiles == 0) || (queryResolution <= 0.0f))
+        {
+            Clear();
+            m_misses += positions.size();
+            fillPoints(positions, outData);
+            return;
+        }
+
+        // Find the tile and the point within the tile for each position that lies on the query grid.
+        // Consecutive positions are usually in the same tile, so the last tile request is reused before looking up the others.
+        AZStd::vector<TileRequest> tileRequests;
+        AZStd::unordered_map<uint64_t, size_t> tileRequestIndices;
+        AZStd::vector<size_t> requestIndices(positions.size(), NotOnGrid);
+        AZStd::vector<uint32_t> pointIndices(positions.size(), 0);
+        uint64_t lastTileKey = 0;
+        size_t lastRequestIndex = NotOnGrid;
+
+        for (size_t positionIndex = 0; positionIndex < positions.size(); ++positionIndex)
+        {
+            const AZ::Vector3& position = positions[positionIndex];
+            const int64_t gridX = aznumeric_cast<int64_t>(AZStd::lround(position.GetX() / queryResolution));
+            const int64_t gridY = aznumeric_cast<int64_t>(AZStd::lround(position.GetY() / queryResolution));
+
+            // Allow for the float error of positions that were computed to be on the grid, but nothing more than that, since the
+            // data between the grid points can be different from the data at the nearest grid point.
+            const float tolerance = AZStd::max(
+                queryResolution, AZStd::max(AZStd::abs(position.GetX()), AZStd::abs(position.GetY()))) *
+                AZStd::numeric_limits<float>::epsilon() * 4.0f;
+            if ((AZStd::abs(position.GetX() - (gridX * queryResolution)) > tolerance) ||
+                (AZStd::abs(position.GetY() - (gridY * queryResolution)) > tolerance))
+            {
+                continue;
+            }
+
+            const int32_t tileX = GetTileCoordinate(gridX);
+            const int32_t tileY = GetTileCoordinate(gridY);
+            const uint64_t tileKey = GetTileKey(tileX, tileY);
+            if ((lastRequestIndex == NotOnGrid) || (tileKey != lastTileKey))
+            {
+                auto [requestIter, inserted] = tileRequestIndices.emplace(tileKey, tileRequests.size());
+                if (inserted)
+                {
+                    tileRequests.push_back(TileRequest{ tileX, tileY, 0, nullptr });
+                }
+                lastTileKey = tileKey;
+                lastRequestIndex = requestIter->second;
+            }
+
+            ++tileRequests[lastRequestIndex].m_numPoints;
+            requestIndices[positionIndex] = lastRequestIndex;
+            pointIndices[positionIndex] = aznumeric_cast<uint32_t>(
+                ((gridY - (aznumeric_cast<int64_t>(tileY) * TilePoints)) * TilePoints) + (gridX - (aznumeric_cast<int64_t>(tileX) * TilePoints)));
+        }
+
+        // Look up the cached tiles, and find the tiles that are missing but needed by enough points to be worth filling.
+        AZStd::vector<size_t> tilesToFill;
+        uint64_t generation = 0;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+            if (queryResolution != m_queryResolution)
+            {
+                m_tiles.clear();
+                m_queryResolution = queryResolution;
+                ++m_generation;
+            }
+
+            for (size_t requestIndex = 0; requestIndex < tileRequests.size(); ++requestIndex)
+            {
+                TileRequest& tileRequest = tileRequests[requestIndex];
+                if (auto tileIter = m_tiles.find(GetTileKey(tileRequest.m_tileX, tileRequest.m_tileY)); tileIter != m_tiles.end())
+                {
+                    tileIter->second.m_lastUsed = ++m_useCounter;
+                    tileRequest.m_tile = tileIter->second.m_tile;
+                }
+                else if ((tileRequest.m_numPoints >= MinPointsToFillTile) && (tilesToFill.size() < maxTiles))
+                {
+                    // Tiles beyond the budget would only evict the tiles filled by this same query, so their points are
+                    // queried directly instead.
+                    tilesToFill.push_back(requestIndex);
+                }
+            }
+
+            generation = m_generation;
+        }
+
+        // Fill the missing tiles without holding the lock, since filling them queries the terrain areas, and the terrain areas
+        // can refresh regions of the cache while they hold their own locks.
+        if (!tilesToFill.empty())
+        {
+            processTiles(
+                tilesToFill.size(),
+                [&](size_t begin, size_t end)
+                {
+                    AZStd::vector<AZ::Vector3> tilePositions;
+                    tilePositions.reserve(TilePoints * TilePoints);
+                    for (size_t fillIndex = begin; fillIndex < end; ++fillIndex)
+                    {
+                        TileRequest& tileRequest = tileRequests[tilesToFill[fillIndex]];
+                        auto tile = AZStd::make_shared<Tile>();
+                        tile->m_tileX = tileRequest.m_tileX;
+                        tile->m_tileY = tileRequest.m_tileY;
+                        tile->m_points.resize(TilePoints * TilePoints);
+
+                        tilePositions.clear();
+                        for (int32_t y = 0; y < TilePoints; ++y)
+                        {
+                            const float positionY =
+                                aznumeric_cast<float>((aznumeric_cast<int64_t>(tileRequest.m_tileY) * TilePoints) + y) * queryResolution;
+                            for (int32_t x = 0; x < TilePoints; ++x)
+                            {
+                                const float positionX =
+                                    aznumeric_cast<float>((aznumeric_cast<int64_t>(tileRequest.m_tileX) * TilePoints) + x) * queryResolution;
+                                tilePositions.emplace_back(positionX, positionY, 0.0f);
+                            }
+                        }
+
+                        fillPoints(tilePositions, tile->m_points);
+                        tileRequest.m_tile = AZStd::move(tile);
+                    }
+                });
+
+            // Only cache the new tiles if nothing was dropped while they were being filled, otherwise they might have been
+            // filled from data that has changed since.
+            AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+            if ((generation == m_generation) && (queryResolution == m_queryResolution))
+            {
+                for (size_t requestIndex : tilesToFill)
+                {
+                    const TileRequest& tileRequest = tileRequests[requestIndex];
+                    m_tiles[GetTileKey(tileRequest.m_tileX, tileRequest.m_tileY)] = CachedTile{ tileRequest.m_tile, ++m_useCounter };
+                }
+                EvictLeastRecentlyUsedTiles(maxTiles);
+            }
+        }
+
+        // Copy the data of the points that are in a tile, and query all the other points directly.
+        AZStd::vector<size_t> uncachedIndices;
+        for (size_t positionIndex = 0; positionIndex < positions.size(); ++positionIndex)
+        {
+            const size_t requestIndex = requestIndices[positionIndex];
+            if ((requestIndex != NotOnGrid) && tileRequests[requestIndex].m_tile)
+            {
+                outData[positionIndex] = tileRequests[requestIndex].m_tile->m_points[pointIndices[positionIndex]];
+            }
+            else
+            {
+                uncachedIndices.push_back(positionIndex);
+            }
+        }
+
+        m_hits += positions.size() - uncachedIndices.size();
+        m_misses += uncachedIndices.size();
+
+        if (uncachedIndices.size() == positions.size())
+        {
+            fillPoints(positions, outData);
+        }
+        else if (!uncachedIndices.empty())
+        {
+            AZStd::vector<AZ::Vector3> uncachedPositions;
+            uncachedPositions.reserve(uncachedIndices.size());
+            for (size_t positionIndex : uncachedIndices)
+            {
+                uncachedPositions.push_back(positions[positionIndex]);
+            }
+
+            AZStd::vector<PointData> uncachedData(uncachedIndices.size());
+            fillPoints(uncachedPositions, uncachedData);
+
+            for (size_t uncachedIndex = 0; uncachedIndex < uncachedIndices.size(); ++uncachedIndex)
+            {
+                outData[uncachedIndices[uncachedIndex]] = AZStd::move(uncachedData[uncachedIndex]);
+            }
+        }
+    }
+
+    template<typename PointData>
+    void TerrainTileCache<PointData>::RefreshRegion(const AZ::Aabb& dirtyRegion)
+    {
+        if (!dirtyRegion.IsValid())
+        {
+            return;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+        ++m_generation;
+
+        // Expand the region by a grid point so that data that is interpolated from the points around the region is dropped too.
+        const float tileSize = m_queryResolution * TilePoints;
+        const AZ::Vector3 expansion(m_queryResolution, m_queryResolution, 0.0f);
+        const AZ::Vector3 dirtyMin = dirtyRegion.GetMin() - expansion;
+        const AZ::Vector3 dirtyMax = dirtyRegion.GetMax() + expansion;
+
+        for (auto tileIter = m_tiles.begin(); tileIter != m_tiles.end();)
+        {
+            const Tile& tile = *tileIter->second.m_tile;
+            const float tileMinX = tile.m_tileX * tileSize;
+            const float tileMinY = tile.m_tileY * tileSize;
+            const bool overlaps = (tileMinX <= dirtyMax.GetX()) && ((tileMinX + tileSize) >= dirtyMin.GetX()) &&
+                (tileMinY <= dirtyMax.GetY()) && ((tileMinY + tileSize) >= dirtyMin.GetY());
+            tileIter = overlaps ? m_tiles.erase(tileIter) : AZStd::next(tileIter);
+        }
+    }
+
+    template<typename PointData>
+    void TerrainTileCache<PointData>::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+        if (!m_tiles.empty())
+        {
+            m_tiles.clear();
+        }
+        ++m_generation;
+    }
+
+    template<typename PointData>
+    void TerrainTileCache<PointData>::GetAndResetStatistics(uint64_t& hits, uint64_t& misses)
+    {
+        hits = m_hits.exchange(0);
+        misses = m_misses.exchange(0);
+    }
+
+    template<typename PointData>
+    size_t TerrainTileCache<PointData>::GetMemoryUsage() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+        return m_tiles.size() * TileMemorySize;
+    }
+
+    template<typename PointData>
+    void TerrainTileCache<PointData>::EvictLeastRecentlyUsedTiles(size_t maxTiles)
+    {
+        if (m_tiles.size() <= maxTiles)
+        {
+            return;
+        }
+
+        // Find the use count that separates the tiles to keep from the tiles to evict in a single pass over the tiles.
+        AZStd::vector<uint64_t> lastUses;
+        lastUses.reserve(m_tiles.size());
+        for (const auto& [tileKey, cachedTile] : m_tiles)
+        {
+            lastUses.push_back(cachedTile.m_lastUsed);
+        }
+        const size_t numToEvict = m_tiles.size() - maxTiles;
+        AZStd::nth_element(lastUses.begin(), lastUses.begin() + (numToEvict - 1), lastUses.end());
+        const uint64_t newestEvictedUse = lastUses[numToEvict - 1];
+
+        // Use counts are unique, so this evicts exactly numToEvict tiles.
+        for (auto tileIter = m_tiles.begin(); tileIter != m_tiles.end();)
+        {
+            tileIter = (tileIter->second.m_lastUsed <= newestEvictedUse) ? m_tiles.erase(tileIter) : AZStd::next(tileIter);
+        }
+    }
+} // namespace Terrain
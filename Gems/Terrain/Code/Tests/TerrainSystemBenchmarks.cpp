@@ -195,6 +195,42 @@ namespace UnitTest
         ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsRegionAfterRefresh)(benchmark::State& state)
+    {
+        // Run the benchmark
+        RunTerrainApiBenchmark(
+            state,
+            [](float queryResolution, const AZ::Aabb& worldBounds, AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                // Refresh the whole world before every query so that none of the heights come from the terrain data cache.
+                // Comparing this to BM_ProcessHeightsRegion shows the difference between filling the cache and reusing it.
+                Terrain::TerrainSystemServiceRequestBus::Broadcast(
+                    &Terrain::TerrainSystemServiceRequestBus::Events::RefreshRegion, worldBounds,
+                    AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+
+                auto perPositionCallback = []([[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+                    const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
+                {
+                    benchmark::DoNotOptimize(surfacePoint.m_position.GetZ());
+                };
+
+                AZ::Vector2 stepSize = AZ::Vector2(queryResolution);
+                AzFramework::Terrain::TerrainQueryRegion queryRegion =
+                    AzFramework::Terrain::TerrainQueryRegion::CreateFromAabbAndStepSize(worldBounds, stepSize);
+                AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+                    &AzFramework::Terrain::TerrainDataRequests::QueryRegion, queryRegion,
+                    AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights, perPositionCallback, sampler);
+            }
+        );
+    }
+
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsRegionAfterRefresh)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR) })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP) })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP) })
+        ->Unit(::benchmark::kMillisecond);
+
     BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_ProcessHeightsRegionAsync)(benchmark::State& state)
     {
         // Run the benchmark
@@ -995,6 +1031,49 @@ namespace UnitTest
         ->Args({ 2048, 1000, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT) })
         ->Unit(::benchmark::kMillisecond);
 
+    BENCHMARK_DEFINE_F(TerrainSystemBenchmarkFixture, BM_GetClosestIntersectionByRayLength)(benchmark::State& state)
+    {
+        // Run the benchmark
+        constexpr uint32_t NumRays = 100;
+        const float rayLength = aznumeric_cast<float>(state.range(3));
+        RunTerrainApiBenchmark(
+            state,
+            [rayLength]([[maybe_unused]] float queryResolution, const AZ::Aabb& worldBounds,
+                [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampler)
+            {
+                // Cast rays of the same XY length in random directions, like line of sight checks, starting at the top of the
+                // terrain world and sloping down to the middle of it, so that long rays cross a lot of terrain before
+                // reaching it. The heights used by the rays are cached after the first iteration, so this measures the
+                // steady state of repeated raycasts over the same part of the world.
+                AZ::SimpleLcgRandom random;
+                AzFramework::RenderGeometry::RayRequest ray;
+                AzFramework::RenderGeometry::RayResult result;
+                for (uint32_t i = 0; i < NumRays; ++i)
+                {
+                    const float angle = random.GetRandomFloat() * AZ::Constants::TwoPi;
+                    ray.m_startWorldPosition.SetX(worldBounds.GetMin().GetX() + (random.GetRandomFloat() * worldBounds.GetXExtent()));
+                    ray.m_startWorldPosition.SetY(worldBounds.GetMin().GetY() + (random.GetRandomFloat() * worldBounds.GetYExtent()));
+                    ray.m_startWorldPosition.SetZ(worldBounds.GetMax().GetZ());
+                    ray.m_endWorldPosition.SetX(ray.m_startWorldPosition.GetX() + (rayLength * cosf(angle)));
+                    ray.m_endWorldPosition.SetY(ray.m_startWorldPosition.GetY() + (rayLength * sinf(angle)));
+                    ray.m_endWorldPosition.SetZ(worldBounds.GetCenter().GetZ());
+                    AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
+                        result, &AzFramework::Terrain::TerrainDataRequests::GetClosestIntersection, ray);
+                }
+            });
+
+        state.SetItemsProcessed(state.iterations() * NumRays);
+    }
+
+    // The fourth argument is the XY length of the rays, in meters.
+    BENCHMARK_REGISTER_F(TerrainSystemBenchmarkFixture, BM_GetClosestIntersectionByRayLength)
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 16 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 128 })
+        ->Args({ 1024, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 1024 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 16 })
+        ->Args({ 2048, 1, static_cast<int>(AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT), 2048 })
+        ->Unit(::benchmark::kMillisecond);
+
     // Benchmark a single usage of our more complicated terrain setup.
     BENCHMARK_DEFINE_F(TerrainSurfaceGradientBenchmarkFixture, BM_ProcessSurfacePointsList_SurfaceGradients)(benchmark::State& state)
     {
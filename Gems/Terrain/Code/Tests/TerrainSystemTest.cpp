@@ -1480,6 +1480,101 @@ namespace UnitTest
         EXPECT_EQ(numFailures, 0);
     }
 
+    TEST_F(TerrainSystemTest, TerrainGetClosestIntersectionAfterRefreshRegion)
+    {
+        // Create a Terrain Spawner with a box from (-200, -200, -50) to (200, 200, 50) that returns a height that we can
+        // change during the test.
+        float terrainHeight = 0.0f;
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-200.0f, -200.0f, -50.0f, 200.0f, 200.0f, 50.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&terrainHeight](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(terrainHeight);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // Use a long, shallow ray that crosses a lot of terrain before reaching the ground,
+        // and a short, steep ray that reaches it right away.
+        AzFramework::RenderGeometry::RayRequest longRay;
+        longRay.m_startWorldPosition = AZ::Vector3(-190.0f, -190.0f, 20.0f);
+        longRay.m_endWorldPosition = AZ::Vector3(190.0f, 190.0f, -20.0f);
+        AzFramework::RenderGeometry::RayRequest shortRay;
+        shortRay.m_startWorldPosition = AZ::Vector3(10.5f, 20.5f, 20.0f);
+        shortRay.m_endWorldPosition = AZ::Vector3(11.5f, 21.5f, -20.0f);
+
+        for (const auto& ray : { longRay, shortRay })
+        {
+            auto result = terrainSystem->GetClosestIntersection(ray);
+            EXPECT_TRUE(result);
+            EXPECT_NEAR(result.m_worldPosition.GetZ(), 0.0f, 0.001f);
+        }
+
+        // Raise the terrain and refresh it, then verify that the rays hit the new heights instead of the ones
+        // they saw before the refresh.
+        terrainHeight = 10.0f;
+        terrainSystem->RefreshRegion(spawnerBox, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+
+        for (const auto& ray : { longRay, shortRay })
+        {
+            auto result = terrainSystem->GetClosestIntersection(ray);
+            EXPECT_TRUE(result);
+            EXPECT_NEAR(result.m_worldPosition.GetZ(), 10.0f, 0.001f);
+            EXPECT_NEAR(result.m_distance, ray.m_startWorldPosition.GetDistance(result.m_worldPosition), 0.001f);
+        }
+    }
+
+    TEST_F(TerrainSystemTest, TerrainCachedHeightsMatchTerrainAreasAfterRefreshRegion)
+    {
+        // Create a Terrain Spawner whose height is X + Y plus an offset that we can change during the test.
+        float heightOffset = 0.0f;
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-100.0f, -100.0f, -500.0f, 100.0f, 100.0f, 500.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [&heightOffset](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() + position.GetY() + heightOffset);
+                terrainExists = true;
+            });
+
+        auto terrainSystem = CreateAndActivateTerrainSystem();
+
+        // Query regions that are large enough to fill the height cache, so that the second query of each pass is served from it.
+        // The second region is between the grid points, and its heights must never come from the cached grid points.
+        const AzFramework::Terrain::TerrainQueryRegion gridRegion(AZ::Vector3(-50.0f, -50.0f, 0.0f), 100, 100, AZ::Vector2(1.0f));
+        const AzFramework::Terrain::TerrainQueryRegion offGridRegion(AZ::Vector3(-50.25f, -50.5f, 0.0f), 100, 100, AZ::Vector2(1.0f));
+        auto checkHeights = [&]()
+        {
+            for (const auto& queryRegion : { gridRegion, offGridRegion })
+            {
+                for (int pass = 0; pass < 2; ++pass)
+                {
+                    terrainSystem->QueryRegion(
+                        queryRegion, AzFramework::Terrain::TerrainDataRequests::TerrainDataMask::Heights,
+                        [heightOffset](
+                            [[maybe_unused]] size_t xIndex, [[maybe_unused]] size_t yIndex,
+                            const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+                        {
+                            EXPECT_TRUE(terrainExists);
+                            EXPECT_NEAR(
+                                surfacePoint.m_position.GetZ(),
+                                surfacePoint.m_position.GetX() + surfacePoint.m_position.GetY() + heightOffset, 0.001f);
+                        },
+                        AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT);
+                }
+            }
+        };
+
+        checkHeights();
+
+        // Change the heights and refresh the region, then verify that the queries return the new heights instead of the cached ones.
+        heightOffset = 10.0f;
+        terrainSystem->RefreshRegion(spawnerBox, AzFramework::Terrain::TerrainDataNotifications::TerrainDataChangedMask::HeightData);
+        checkHeights();
+    }
+
     TEST_F(TerrainSystemTest, TerrainProcessAsyncCancellation)
     {
         // Tests cancellation of the asynchronous terrain API.
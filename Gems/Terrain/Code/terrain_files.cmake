@@ -27,6 +27,8 @@ set(FILES
     Source/Components/TerrainWorldDebuggerComponent.h
     Source/Components/TerrainWorldRendererComponent.cpp
     Source/Components/TerrainWorldRendererComponent.h
+    Source/TerrainRaycast/TerrainHeightPyramid.cpp
+    Source/TerrainRaycast/TerrainHeightPyramid.h
     Source/TerrainRaycast/TerrainRaycastContext.cpp
     Source/TerrainRaycast/TerrainRaycastContext.h
     Source/TerrainRenderer/Components/MacroMaterialImageModification.cpp
@@ -61,4 +63,5 @@ set(FILES
     Source/TerrainSystem/TerrainSystem.cpp
     Source/TerrainSystem/TerrainSystem.h
     Source/TerrainSystem/TerrainSystemBus.h
+    Source/TerrainSystem/TerrainTileCache.h
 )
@@ -19,6 +19,14 @@ namespace Vegetation
     {
         AZStd::atomic_int m_areaTaskQueueCount{ 0 };
         AZStd::atomic_int m_areaTaskActiveCount{ 0 };
+        //! Number of sectors whose surface points are currently being generated in parallel.
+        AZStd::atomic_int m_sectorPointBatchCount{ 0 };
+        //! Number of sectors with generated surface points that are waiting to be created or filled.
+        AZStd::atomic_int m_pregeneratedSectorCount{ 0 };
+        //! Time in microseconds spent by the slowest sector point worker of the last batch.
+        AZStd::atomic_int m_sectorPointWorkerTimeMax{ 0 };
+        //! Time in microseconds spent by all sector point workers of the last batch combined.
+        AZStd::atomic_int m_sectorPointWorkerTimeTotal{ 0 };
     };
 
     class DebugSystemData
@@ -18,11 +18,15 @@
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <SurfaceData/Utility/SurfaceDataUtility.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/utils.h>
@@ -39,6 +43,14 @@
 
 namespace Vegetation
 {
+    AZ_CVAR(
+        uint32_t,
+        veg_sectorPointBatchSize,
+        8,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The number of upcoming sectors whose surface points are generated in parallel by the vegetation thread. 0 or 1 generates them serially.");
+
     namespace AreaSystemUtil
     {
         template <typename T>
@@ -1073,14 +1085,14 @@ namespace Vegetation
         return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
     }
 
-    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorSizeInMeters, ClaimContext&& sectorPoints)
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         SectorInfo sectorInfo;
         sectorInfo.m_id = sectorId;
         sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
-        UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        UpdateSectorPoints(sectorInfo, sectorPoints);
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
@@ -1088,15 +1100,25 @@ namespace Vegetation
         return &sectorInfoRef;
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, ClaimContext& sectorPoints)
+    {
+        VEGETATION_PROFILE_FUNCTION_VERBOSE
+
+        // Only the points and masks are replaced, the claim callbacks of the base context stay bound to this sector.
+        AZStd::swap(sectorInfo.m_baseContext.m_masks, sectorPoints.m_masks);
+        sectorInfo.m_baseContext.m_availablePoints.swap(sectorPoints.m_availablePoints);
+    }
+
+    void AreaSystemComponent::VegetationThreadTasks::GenerateSectorPoints(
+        const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode, ClaimContext& sectorPoints) const
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
         const float vegStep = sectorSizeInMeters / static_cast<float>(sectorDensity);
 
         //build a free list of all points in the sector for areas to consume
-        sectorInfo.m_baseContext.m_masks.Clear();
-        sectorInfo.m_baseContext.m_availablePoints.clear();
-        sectorInfo.m_baseContext.m_availablePoints.reserve(sectorDensity * sectorDensity);
+        sectorPoints.m_masks.Clear();
+        sectorPoints.m_availablePoints.clear();
+        sectorPoints.m_availablePoints.reserve(sectorDensity * sectorDensity);
 
         // Determine within our texel area where we want to create our vegetation positions:
         // 0 = lower left corner, 0.5 = center
@@ -1105,7 +1127,7 @@ namespace Vegetation
         SurfaceData::SurfacePointList availablePointsPerPosition;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
-        AZ::Aabb regionBounds = sectorInfo.m_bounds;
+        AZ::Aabb regionBounds = GetSectorBounds(sectorId, sectorSizeInMeters);
         regionBounds.SetMin(regionBounds.GetMin() + regionOffset);
 
         // If we just used the sector bounds, floating-point error could sometimes cause an extra point to get generated
@@ -1123,20 +1145,73 @@ namespace Vegetation
             availablePointsPerPosition);
 
         uint claimIndex = 0;
-        availablePointsPerPosition.EnumeratePoints([this, &sectorInfo, &claimIndex]
+        availablePointsPerPosition.EnumeratePoints([this, &sectorId, &sectorPoints, &claimIndex]
         ([[maybe_unused]] size_t inPositionIndex, const AZ::Vector3& position,
             const AZ::Vector3& normal, const SurfaceData::SurfaceTagWeights& masks) -> bool
             {
-                ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.emplace_back();
-                claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
+                ClaimPoint& claimPoint = sectorPoints.m_availablePoints.emplace_back();
+                claimPoint.m_handle = CreateClaimHandle(sectorId, ++claimIndex);
                 claimPoint.m_position = position;
                 claimPoint.m_normal = normal;
                 claimPoint.m_masks = masks;
-                sectorInfo.m_baseContext.m_masks.AddSurfaceTagWeights(masks);
+                sectorPoints.m_masks.AddSurfaceTagWeights(masks);
                 return true;
             });
     }
 
+    void AreaSystemComponent::VegetationThreadTasks::GenerateSectorPoints(
+        AZStd::span<const SectorId> sectorIds, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode,
+        AZStd::span<ClaimContext> sectorPoints, AZStd::span<AZStd::chrono::microseconds> workerTimes) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+        AZ_Assert((sectorPoints.size() == sectorIds.size()) && (workerTimes.size() == sectorIds.size()),
+            "Every sector needs its own output buffer and timer");
+
+        auto generatePoints = [&, this](size_t workerIndex)
+        {
+            AZ_PROFILE_SCOPE(Entity, "Vegetation::AreaSystemComponent::VegetationThreadTasks::GenerateSectorPointsWorker");
+            const auto startTime = AZStd::chrono::steady_clock::now();
+            GenerateSectorPoints(sectorIds[workerIndex], sectorDensity, sectorSizeInMeters, sectorPointSnapMode, sectorPoints[workerIndex]);
+            workerTimes[workerIndex] = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now() - startTime);
+        };
+
+        auto* taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (sectorIds.size() == 1)
+        {
+            generatePoints(0);
+        }
+        else if (taskGraphActive && taskGraphActive->IsTaskGraphActive())
+        {
+            AZ::TaskGraph taskGraph{ "Vegetation::SectorPoints" };
+            AZ::TaskDescriptor sectorPointsDescriptor{ "Vegetation_GenerateSectorPoints", "Vegetation" };
+            for (size_t workerIndex = 0; workerIndex < sectorIds.size(); ++workerIndex)
+            {
+                taskGraph.AddTask(sectorPointsDescriptor, [&generatePoints, workerIndex]()
+                {
+                    generatePoints(workerIndex);
+                });
+            }
+
+            AZ::TaskGraphEvent waitForCompletion{ "Vegetation::SectorPoints Wait" };
+            taskGraph.Submit(&waitForCompletion);
+            waitForCompletion.Wait();
+        }
+        else
+        {
+            AZ::JobCompletion sectorPointsCompletion;
+            for (size_t workerIndex = 0; workerIndex < sectorIds.size(); ++workerIndex)
+            {
+                AZ::Job* sectorPointsJob = AZ::CreateJobFunction([&generatePoints, workerIndex]()
+                {
+                    generatePoints(workerIndex);
+                }, true, nullptr);
+                sectorPointsJob->SetDependent(&sectorPointsCompletion);
+                sectorPointsJob->Start();
+            }
+            sectorPointsCompletion.StartAndWaitForCompletion();
+        }
+    }
+
     void AreaSystemComponent::VegetationThreadTasks::UpdateSectorCallbacks(SectorInfo& sectorInfo)
     {
         //setup callback to test if matching point is already claimed
@@ -1398,13 +1473,13 @@ namespace Vegetation
         sectorInfo.m_claimedWorldPoints[handle] = instanceData;
     }
 
-    ClaimHandle AreaSystemComponent::VegetationThreadTasks::CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const
+    ClaimHandle AreaSystemComponent::VegetationThreadTasks::CreateClaimHandle(const SectorId& sectorId, uint32_t index) const
     {
         VEGETATION_PROFILE_FUNCTION_VERBOSE
 
         ClaimHandle handle = 0;
-        AreaSystemUtil::hash_combine_64(handle, sectorInfo.m_id.first);
-        AreaSystemUtil::hash_combine_64(handle, sectorInfo.m_id.second);
+        AreaSystemUtil::hash_combine_64(handle, sectorId.first);
+        AreaSystemUtil::hash_combine_64(handle, sectorId.second);
         AreaSystemUtil::hash_combine_64(handle, index);
         return handle;
     }
@@ -1472,6 +1547,13 @@ namespace Vegetation
                 // - Vegetation tasks have been queued for this thread to process
 
                 // Our main thread has potentially updated its state, so cache a new copy of the pieces of state we need.
+                // Any surface points generated ahead of time are only valid for the sector settings they were generated with.
+                if ((m_cachedMainThreadData.m_sectorDensity != cachedMainThreadData->m_sectorDensity) ||
+                    (m_cachedMainThreadData.m_sectorSizeInMeters != cachedMainThreadData->m_sectorSizeInMeters) ||
+                    (m_cachedMainThreadData.m_sectorPointSnapMode != cachedMainThreadData->m_sectorPointSnapMode))
+                {
+                    m_pregeneratedSectorPoints.clear();
+                }
                 m_cachedMainThreadData = *cachedMainThreadData;
 
                 // Run through all the queued tasks to update vegetation area active states and lists of dirty sectors
@@ -1594,6 +1676,22 @@ namespace Vegetation
             m_updateWorkList.end());
         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Refreshed RequestedUpdate list should not be larger than the view rectangle.");
 
+        // Drop any surface points generated ahead of time for sectors that left the view rectangle or whose surface data changed.
+        for (auto pointsItr = m_pregeneratedSectorPoints.begin(); pointsItr != m_pregeneratedSectorPoints.end();)
+        {
+            const bool stale = deleteAllSectors || !currViewRect.IsInside(pointsItr->first) ||
+                threadData->m_dirtySectorSurfacePoints.IsDirty(pointsItr->first);
+            if (stale)
+            {
+                RecycleSectorPoints(AZStd::move(pointsItr->second));
+                pointsItr = m_pregeneratedSectorPoints.erase(pointsItr);
+            }
+            else
+            {
+                ++pointsItr;
+            }
+        }
+
         // Clear our delete work list, we'll recreate it and sort it again below.
         // Note: We do NOT clear m_updateWorkList, because we use it to incrementally determine any new
         // updates to add to the queue.  Without it, we wouldn't know if a previous data change caused
@@ -1779,6 +1877,8 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
+            GenerateUpcomingSectorPoints(vegTasks);
+
             auto& updateEntry = m_updateWorkList.back();
             SectorId sectorId = updateEntry.first;
             UpdateMode mode = updateEntry.second;
@@ -1787,9 +1887,7 @@ namespace Vegetation
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
                 auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
 
                 switch (mode)
                 {
@@ -1797,7 +1895,9 @@ namespace Vegetation
                     {
                         auto sectorInfo = vegTasks->GetSector(sectorId);
                         AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        ClaimContext sectorPoints = TakeSectorPoints(sectorId, vegTasks);
+                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorPoints);
+                        RecycleSectorPoints(AZStd::move(sectorPoints));
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1813,7 +1913,7 @@ namespace Vegetation
                     case UpdateMode::Create:
                     {
                         AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorSizeInMeters, TakeSectorPoints(sectorId, vegTasks));
                         vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
                     }
                     break;
@@ -1827,4 +1927,113 @@ namespace Vegetation
         return false;
     }
 
+    void AreaSystemComponent::UpdateContext::GenerateUpcomingSectorPoints(VegetationThreadTasks* vegTasks)
+    {
+        const uint32_t batchSize = veg_sectorPointBatchSize;
+        if (batchSize <= 1)
+        {
+            return;
+        }
+
+        // Only generate a new batch once the next sector to process needs points that haven't been generated yet.
+        const auto& nextEntry = m_updateWorkList.back();
+        if ((nextEntry.second == UpdateMode::Fill) || m_pregeneratedSectorPoints.contains(nextEntry.first))
+        {
+            return;
+        }
+
+        AZ_PROFILE_FUNCTION(Entity);
+
+        // The work list is processed from the back, so gather the batch in that order.
+        m_sectorPointBatch.clear();
+        for (auto entryItr = m_updateWorkList.rbegin(); (entryItr != m_updateWorkList.rend()) && (m_sectorPointBatch.size() < batchSize); ++entryItr)
+        {
+            if ((entryItr->second != UpdateMode::Fill) && !m_pregeneratedSectorPoints.contains(entryItr->first))
+            {
+                m_sectorPointBatch.push_back(entryItr->first);
+            }
+        }
+
+        // Each worker gets its own output buffer, so the workers never share any state.  Buffers recycled from replaced or
+        // dropped sector points keep their capacity, so steady-state batches don't reallocate their point lists.
+        const size_t workerCount = m_sectorPointBatch.size();
+        m_sectorPointBuffers.clear();
+        while ((m_sectorPointBuffers.size() < workerCount) && !m_recycledSectorPoints.empty())
+        {
+            m_sectorPointBuffers.push_back(AZStd::move(m_recycledSectorPoints.back()));
+            m_recycledSectorPoints.pop_back();
+        }
+        m_sectorPointBuffers.resize(workerCount);
+        m_sectorPointWorkerTimes.resize(workerCount);
+
+        DebugData* debugData = vegTasks->GetDebugData();
+        if (debugData)
+        {
+            debugData->m_sectorPointBatchCount.store(static_cast<int>(workerCount), AZStd::memory_order_relaxed);
+        }
+
+        vegTasks->GenerateSectorPoints(
+            m_sectorPointBatch, m_cachedMainThreadData.m_sectorDensity, m_cachedMainThreadData.m_sectorSizeInMeters,
+            m_cachedMainThreadData.m_sectorPointSnapMode, m_sectorPointBuffers, m_sectorPointWorkerTimes);
+
+        // Merge the worker results in batch order.
+        for (size_t workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+        {
+            m_pregeneratedSectorPoints.emplace(m_sectorPointBatch[workerIndex], AZStd::move(m_sectorPointBuffers[workerIndex]));
+        }
+
+        if (debugData)
+        {
+            AZStd::chrono::microseconds workerTimeMax{ 0 };
+            AZStd::chrono::microseconds workerTimeTotal{ 0 };
+            for (const auto& workerTime : m_sectorPointWorkerTimes)
+            {
+                workerTimeMax = AZStd::max(workerTimeMax, workerTime);
+                workerTimeTotal += workerTime;
+            }
+
+            debugData->m_sectorPointBatchCount.store(0, AZStd::memory_order_relaxed);
+            debugData->m_pregeneratedSectorCount.store(static_cast<int>(m_pregeneratedSectorPoints.size()), AZStd::memory_order_relaxed);
+            debugData->m_sectorPointWorkerTimeMax.store(static_cast<int>(workerTimeMax.count()), AZStd::memory_order_relaxed);
+            debugData->m_sectorPointWorkerTimeTotal.store(static_cast<int>(workerTimeTotal.count()), AZStd::memory_order_relaxed);
+        }
+    }
+
+    ClaimContext AreaSystemComponent::UpdateContext::TakeSectorPoints(const SectorId& sectorId, VegetationThreadTasks* vegTasks)
+    {
+        ClaimContext sectorPoints;
+        if (auto pointsItr = m_pregeneratedSectorPoints.find(sectorId); pointsItr != m_pregeneratedSectorPoints.end())
+        {
+            sectorPoints = AZStd::move(pointsItr->second);
+            m_pregeneratedSectorPoints.erase(pointsItr);
+        }
+        else
+        {
+            if (!m_recycledSectorPoints.empty())
+            {
+                sectorPoints = AZStd::move(m_recycledSectorPoints.back());
+                m_recycledSectorPoints.pop_back();
+            }
+            vegTasks->GenerateSectorPoints(
+                sectorId, m_cachedMainThreadData.m_sectorDensity, m_cachedMainThreadData.m_sectorSizeInMeters,
+                m_cachedMainThreadData.m_sectorPointSnapMode, sectorPoints);
+        }
+
+        if (DebugData* debugData = vegTasks->GetDebugData())
+        {
+            debugData->m_pregeneratedSectorCount.store(static_cast<int>(m_pregeneratedSectorPoints.size()), AZStd::memory_order_relaxed);
+        }
+        return sectorPoints;
+    }
+
+    void AreaSystemComponent::UpdateContext::RecycleSectorPoints(ClaimContext&& sectorPoints)
+    {
+        // Only keep as many spare buffers as a single batch can use.
+        const uint32_t batchSize = veg_sectorPointBatchSize;
+        if (m_recycledSectorPoints.size() < batchSize)
+        {
+            m_recycledSectorPoints.push_back(AZStd::move(sectorPoints));
+        }
+    }
+
 }
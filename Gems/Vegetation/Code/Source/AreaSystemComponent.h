@@ -20,6 +20,13 @@
 #include <CrySystemBus.h>
 #include <ISystem.h>
 #include <AzFramework/Terrain/TerrainDataRequestBus.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/span.h>
+
+namespace UnitTest
+{
+    class VegetationSectorPointsTests;
+}
 
 namespace Vegetation
 {
@@ -87,6 +94,7 @@ namespace Vegetation
     {
     public:
         friend class EditorAreaSystemComponent;
+        friend class ::UnitTest::VegetationSectorPointsTests;
         AZ_COMPONENT(AreaSystemComponent, "{7CE8E791-6BC6-4C88-8727-A476DE00F9A1}");
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& services);
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& services);
@@ -291,8 +299,17 @@ namespace Vegetation
             const SectorInfo* GetSector(const SectorId& sectorId) const;
             SectorInfo* GetSector(const SectorId& sectorId);
 
-            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            SectorInfo* CreateSector(const SectorId& sectorId, int sectorSizeInMeters, ClaimContext&& sectorPoints);
+            //! Swaps the points and masks of sectorPoints into the sector, so sectorPoints is left holding the sector's previous
+            //! points and its buffers can be reused.
+            void UpdateSectorPoints(SectorInfo& sectorInfo, ClaimContext& sectorPoints);
+            //! Gathers the surface points of a sector into sectorPoints.  This doesn't touch the rolling window,
+            //! so the points of several sectors can be generated concurrently.
+            void GenerateSectorPoints(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode, ClaimContext& sectorPoints) const;
+            //! Gathers the surface points of each sector in sectorIds concurrently, one worker per sector.  Worker i only writes to
+            //! sectorPoints[i] and workerTimes[i], so the results line up with sectorIds no matter which worker finishes first.
+            void GenerateSectorPoints(AZStd::span<const SectorId> sectorIds, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode,
+                AZStd::span<ClaimContext> sectorPoints, AZStd::span<AZStd::chrono::microseconds> workerTimes) const;
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
@@ -301,6 +318,7 @@ namespace Vegetation
             static AZ::Aabb GetSectorBounds(const SectorId& sectorId, int sectorSizeInMeters);
 
             void FetchDebugData();
+            DebugData* GetDebugData() const { return m_debugData; }
 
             void MarkDirtySectors(const AZ::Aabb& bounds, DirtySectors& dirtySet, float worldToSector, const ViewRect& viewRect);
             void AddUnregisteredVegetationArea(const VegetationAreaInfo& area, float worldToSector, const ViewRect& viewRect);
@@ -313,7 +331,7 @@ namespace Vegetation
         private:
             // claiming logic
             void CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData);
-            ClaimHandle CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const;
+            ClaimHandle CreateClaimHandle(const SectorId& sectorId, uint32_t index) const;
 
             void ReleaseUnusedClaims(SectorInfo& sectorInfo);
             void ReleaseUnregisteredClaims(SectorInfo& sectorInfo);
@@ -430,6 +448,9 @@ namespace Vegetation
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
             bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void GenerateUpcomingSectorPoints(VegetationThreadTasks* vegTasks);
+            ClaimContext TakeSectorPoints(const SectorId& sectorId, VegetationThreadTasks* vegTasks);
+            void RecycleSectorPoints(ClaimContext&& sectorPoints);
 
             enum class UpdateMode
             {
@@ -446,6 +467,18 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // Surface points generated ahead of time, in parallel, for the next sectors in m_updateWorkList that need them.
+            // Sectors are still created and filled one at a time in work list order, so the claims are the same as if the
+            // points had been generated serially.
+            AZStd::unordered_map<SectorId, ClaimContext> m_pregeneratedSectorPoints;
+
+            // Per-worker state for GenerateUpcomingSectorPoints, kept between batches to avoid reallocating it.  The point buffers
+            // of replaced or dropped sector points are recycled into m_recycledSectorPoints and handed back out to the workers.
+            AZStd::vector<SectorId> m_sectorPointBatch;
+            AZStd::vector<ClaimContext> m_sectorPointBuffers;
+            AZStd::vector<AZStd::chrono::microseconds> m_sectorPointWorkerTimes;
+            AZStd::vector<ClaimContext> m_recycledSectorPoints;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
@@ -974,9 +974,13 @@ void DebugComponent::DrawDebugStats(AzFramework::DebugDisplayRequests& debugDisp
         40.0f, 22.0f, 0.7f,
         AZStd::string::format(
             "VegetationSystemStats:\nActive Instances Count: %d\nInstance Register Queue: %d\nInstance Unregister Queue: %d\nThread "
-            "Queue Count: %d\nThread Processing Count: %d",
+            "Queue Count: %d\nThread Processing Count: %d\nSector Point Workers: %d\nSector Points Ready: %d\nSector Point Worker Time (max / total us): %d / %d",
             instanceCount, createTaskCount, destroyTaskCount, m_debugData->m_areaTaskQueueCount.load(AZStd::memory_order_relaxed),
-            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed))
+            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed),
+            m_debugData->m_sectorPointBatchCount.load(AZStd::memory_order_relaxed),
+            m_debugData->m_pregeneratedSectorCount.load(AZStd::memory_order_relaxed),
+            m_debugData->m_sectorPointWorkerTimeMax.load(AZStd::memory_order_relaxed),
+            m_debugData->m_sectorPointWorkerTimeTotal.load(AZStd::memory_order_relaxed))
             .c_str(),
         false);
 }
@@ -15,12 +15,14 @@
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/chrono/chrono.h>
 
 //////////////////////////////////////////////////////////////////////////
 
 #include <Vegetation/Ebuses/AreaSystemRequestBus.h>
 #include <VegetationModule.h>
 #include <AreaSystemComponent.h>
+#include "VegetationMocks.h"
 
 namespace UnitTest
 {
@@ -152,5 +154,65 @@ namespace UnitTest
         // This test simply creates an environment that activates and deactivates the vegetation system components.
         // If it runs without asserting / crashing, then it is successful.
     }
-}
 
+    // Exposes the sector point generation of the area system so the batched and serial paths can be compared directly.
+    class VegetationSectorPointsTests
+        : public VegetationTestApp
+    {
+    protected:
+        using VegetationThreadTasks = Vegetation::AreaSystemComponent::VegetationThreadTasks;
+        using SectorId = Vegetation::AreaSystemComponent::SectorId;
+
+        static void ExpectSamePoints(const Vegetation::ClaimContext& expected, const Vegetation::ClaimContext& actual)
+        {
+            EXPECT_EQ(expected.m_masks, actual.m_masks);
+            ASSERT_EQ(expected.m_availablePoints.size(), actual.m_availablePoints.size());
+            for (size_t pointIndex = 0; pointIndex < expected.m_availablePoints.size(); ++pointIndex)
+            {
+                const Vegetation::ClaimPoint& expectedPoint = expected.m_availablePoints[pointIndex];
+                const Vegetation::ClaimPoint& actualPoint = actual.m_availablePoints[pointIndex];
+                EXPECT_EQ(expectedPoint.m_handle, actualPoint.m_handle);
+                EXPECT_TRUE(expectedPoint.m_position.IsClose(actualPoint.m_position));
+                EXPECT_TRUE(expectedPoint.m_normal.IsClose(actualPoint.m_normal));
+                EXPECT_EQ(expectedPoint.m_masks, actualPoint.m_masks);
+            }
+        }
+    };
+
+    TEST_F(VegetationSectorPointsTests, GenerateSectorPoints_BatchedWorkers_MatchSerialGeneration)
+    {
+        // Sectors are created and filled in work list order from the generated points, so identical points and claim handles
+        // mean the batched path claims exactly the same instances as the serial path.
+        MockSurfaceHandler mockSurfaceHandler;
+        mockSurfaceHandler.m_outPosition = AZ::Vector3(0.0f, 0.0f, 3.0f);
+        mockSurfaceHandler.m_outNormal = AZ::Vector3::CreateAxisZ();
+        mockSurfaceHandler.m_outMasks.AddSurfaceTagWeight(AZ_CRC_CE("test_mask"), 1.0f);
+
+        constexpr int sectorDensity = 4;
+        constexpr int sectorSizeInMeters = 16;
+        const AZStd::vector<SectorId> sectorIds = { { 0, 0 }, { 1, 0 }, { -1, 2 }, { 3, -4 }, { 5, 5 }, { -2, -2 }, { 7, 1 }, { 0, 6 } };
+
+        VegetationThreadTasks vegTasks;
+        AZStd::vector<Vegetation::ClaimContext> serialPoints(sectorIds.size());
+        for (size_t sectorIndex = 0; sectorIndex < sectorIds.size(); ++sectorIndex)
+        {
+            vegTasks.GenerateSectorPoints(
+                sectorIds[sectorIndex], sectorDensity, sectorSizeInMeters, Vegetation::SnapMode::Corner, serialPoints[sectorIndex]);
+            EXPECT_EQ(serialPoints[sectorIndex].m_availablePoints.size(), static_cast<size_t>(sectorDensity * sectorDensity));
+        }
+
+        // The second run reuses the buffers that the first run filled.
+        AZStd::vector<Vegetation::ClaimContext> batchedPoints(sectorIds.size());
+        AZStd::vector<AZStd::chrono::microseconds> workerTimes(sectorIds.size());
+        for (int run = 0; run < 2; ++run)
+        {
+            vegTasks.GenerateSectorPoints(
+                sectorIds, sectorDensity, sectorSizeInMeters, Vegetation::SnapMode::Corner, batchedPoints, workerTimes);
+
+            for (size_t sectorIndex = 0; sectorIndex < sectorIds.size(); ++sectorIndex)
+            {
+                ExpectSamePoints(serialPoints[sectorIndex], batchedPoints[sectorIndex]);
+            }
+        }
+    }
+}
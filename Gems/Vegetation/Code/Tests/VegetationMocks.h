@@ -339,9 +339,27 @@ namespace UnitTest
             surfacePointList.EndListConstruction();
         }
 
-        void GetSurfacePointsFromRegion([[maybe_unused]] const AZ::Aabb& inRegion, [[maybe_unused]] const AZ::Vector2 stepSize, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
-            [[maybe_unused]] SurfaceData::SurfacePointList& surfacePointListPerPosition) const override
+        // Returns one point per grid position in the region, at the grid position's x and y and at m_outPosition's height.
+        void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            SurfaceData::SurfacePointList& surfacePointListPerPosition) const override
         {
+            AZStd::vector<AZ::Vector3> inPositions;
+            for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+            {
+                for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+                {
+                    inPositions.emplace_back(x, y, inRegion.GetMin().GetZ());
+                }
+            }
+
+            surfacePointListPerPosition.Clear();
+            surfacePointListPerPosition.StartListConstruction(inPositions, 1, {});
+            for (const auto& inPosition : inPositions)
+            {
+                surfacePointListPerPosition.AddSurfacePoint(AZ::EntityId(), inPosition,
+                    AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_outPosition.GetZ()), m_outNormal, m_outMasks);
+            }
+            surfacePointListPerPosition.EndListConstruction();
         }
 
         void GetSurfacePointsFromList(